@@ -0,0 +1,217 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****     C C O U N T E R _ B E N C H . C P P  ____  F I L E     ****
+*       ********************************************************************
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*       INFO:
+*               Headless load test of the coincidence-counter data path.  Drives a "SyntheticStream" through the
+*               same "drain_stream" + "Ingestor" core as "CCounterApp::_FetchData" (drain + decode, plot rings,
+*               running statistics, tiered history, linearize) and then decimates every series as the plots would,
+*               once per simulated frame.  No window, no GL context.
+*
+*       USAGE:
+*               ccounter_bench  [--rate HZ]  [--pattern steady|poisson|bursty]  [--lines]  [--seconds S]
+*                               [--fps F]  [--buffer N]  [--queue N]  [--width PX]
+*
+*       REPORTS:
+*               packets/s sustained (ingested / wall time),  dropped frames / lines,  per-frame drain and plot time,
+*               and per-packet queue wait (read -> taken) and ingest latency (taken -> in the buffers)  (p50 / p99 / max).
+*
+**************************************************************************************
+**************************************************************************************/
+#include "app/c_counter/_synthetic.h"
+#include "app/c_counter/_ingest.h"
+#include "app/c_counter/_decimation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <algorithm>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <thread>
+
+
+
+namespace cc = cb::ccounter;
+
+
+
+//  0.      HELPERS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "Options"
+struct Options
+{
+    double                              rate                = 100'000.0;
+    cc::SyntheticStream::Pattern        pattern             = cc::SyntheticStream::Pattern::Steady;
+    bool                                lines               = false;
+    double                              seconds             = 10.0;
+    double                              fps                 = 60.0;
+    std::size_t                         buffer              = 512ULL;       //  "CCounterApp::ms_BUFFER_SIZE".
+    std::size_t                         queue               = cb::utl::PyStream::ms_DEF_QUEUE_CAPACITY;
+    int                                 width               = 1200;         //  Plot width in pixels.
+};
+
+
+//  "parse_options"
+static bool parse_options(int argc, char ** argv, Options & opt)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view  arg     = argv[i];
+        const char *            val     = ( i + 1 < argc )  ? argv[i + 1]   : nullptr;
+        auto                    take    = [&i, val](void) { ++i;  return val; };
+
+        if      ( arg == "--lines" )                    { opt.lines     = true; }
+        else if ( arg == "--rate"       &&  val )       { opt.rate      = std::strtod(take(), nullptr); }
+        else if ( arg == "--seconds"    &&  val )       { opt.seconds   = std::strtod(take(), nullptr); }
+        else if ( arg == "--fps"        &&  val )       { opt.fps       = std::max(1.0, std::strtod(take(), nullptr)); }
+        else if ( arg == "--buffer"     &&  val )       { opt.buffer    = std::strtoull(take(), nullptr, 10); }
+        else if ( arg == "--queue"      &&  val )       { opt.queue     = std::strtoull(take(), nullptr, 10); }
+        else if ( arg == "--width"      &&  val )       { opt.width     = std::atoi(take()); }
+        else if ( arg == "--pattern"    &&  val ) {
+            const std::string_view  p   = take();
+            if      ( p == "steady"  )  { opt.pattern = cc::SyntheticStream::Pattern::Steady;  }
+            else if ( p == "poisson" )  { opt.pattern = cc::SyntheticStream::Pattern::Poisson; }
+            else if ( p == "bursty"  )  { opt.pattern = cc::SyntheticStream::Pattern::Bursty;  }
+            else                        { return false; }
+        }
+        else                                            { return false; }
+    }
+    return true;
+}
+
+
+//  "Percentiles"
+struct Percentiles      { double p50, p99, max; };
+static Percentiles percentiles(std::vector<std::int64_t> v)
+{
+    if ( v.empty() )    { return { 0.0, 0.0, 0.0 }; }
+    std::sort(v.begin(), v.end());
+    auto                at      = [&v](const double q) { return 1e-6 * static_cast<double>( v[ static_cast<std::size_t>(q * static_cast<double>(v.size() - 1ULL)) ] ); };
+    return { at(0.50), at(0.99), 1e-6 * static_cast<double>(v.back()) };
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1.      MAIN...
+// *************************************************************************** //
+// *************************************************************************** //
+
+int main(int argc, char ** argv)
+{
+    using                               Packet          = cc::CoincidencePacket;
+    using                               buffer_type     = cblib::ndRingBuffer<ImVec2>;
+    static constexpr std::size_t        NUM             = 15ULL;                //  "CCounterApp::ms_NUM".
+    using                               Ingestor        = cc::Ingestor<NUM>;
+    static constexpr float              HISTORY         = 30.0f;                //  Seconds on screen.
+    //
+    Options                             opt             {   };
+    cc::SyntheticStream                 source          {   };
+    std::array<buffer_type, NUM>        buffers         {   };
+    std::array<buffer_type, NUM>        averages        {   };
+    std::array<cc::RunningStats, NUM>   stats           ;
+    std::array<cc::TieredHistory, NUM>  history         {   };
+    std::array<cc::TieredHistory, NUM>  avg_history     {   };
+    std::array<cc::M4Decimator<ImVec2>, NUM>    m4_raw  {   };
+    std::array<cc::M4Decimator<ImVec2>, NUM>    m4_avg  {   };
+    std::array<cc::SyntheticStream::BinaryFrame, 32>    frames  {   };     //  "CCounterApp::ms_RECV_BATCH".
+    std::array<cc::SyntheticStream::Line, 32>           lines   {   };
+    cb::utl::LatencyHistogram           lat_queue       {   };
+    cb::utl::LatencyHistogram           lat_ingest      {   };
+    std::vector<std::int64_t>           drain_ns        {   };
+    std::vector<std::int64_t>           plot_ns         {   };
+    std::size_t                         ingested        = 0ULL;
+    std::size_t                         points          = 0ULL;
+    std::uint64_t                       version         = 0ULL;
+
+
+    if ( !parse_options(argc, argv, opt) ) {
+        std::fprintf(stderr, "usage: %s [--rate HZ] [--pattern steady|poisson|bursty] [--lines] [--seconds S] [--fps F]"
+                             " [--buffer N] [--queue N] [--width PX]\n", argv[0]);
+        return 2;
+    }
+    for (std::size_t i = 0ULL; i < NUM; ++i) {
+        buffers[i].set_capacity(opt.buffer);    averages[i].set_capacity(opt.buffer);
+        stats[i].set_capacity(opt.buffer);      history[i].allocate();      avg_history[i].allocate();
+    }
+    Ingestor::channel_map               channels        {   };
+    for (std::size_t i = 0ULL; i < NUM; ++i)    { channels[i] = static_cast<cc::ChannelID>(i + 1ULL); }
+    Ingestor                            core            ( { buffers, averages, stats, history, avg_history, nullptr }, channels
+                                                        , { nullptr, &lat_queue, &lat_ingest, nullptr } );
+    source.set_framing( (opt.lines)     ? cc::SyntheticStream::Framing::Lines   : cc::SyntheticStream::Framing::Binary );
+    source.set_queue_capacity(opt.queue);
+    source.set_rate(opt.rate);
+    source.set_pattern(opt.pattern);
+
+
+    //      1.      ONE SIMULATED FRAME PER "1 / fps"...
+    const std::int64_t      frame_ns    = static_cast<std::int64_t>(1e9 / opt.fps);
+    const std::int64_t      t0          = cc::steady_ns();
+    const std::int64_t      t_end       = t0 + static_cast<std::int64_t>(1e9 * opt.seconds);
+    std::int64_t            next        = t0 + frame_ns;
+    source.start();
+
+    for (std::int64_t now = t0; now < t_end; now = cc::steady_ns())
+    {
+        const float         t           = 1e-9f * static_cast<float>(now - t0);
+
+        //          1A.     DRAIN  (the same "drain_stream" + "Ingestor" core as "_FetchData" step 1).
+        const std::size_t   n           = cc::drain_stream( source, std::span(frames), std::span(lines), /*mutual_exclusion=*/false
+            , [&core, t](const Packet & packet, const std::int64_t read_ns, const std::int64_t recv_ns)
+                { core.received(packet, t, read_ns, recv_ns); } );
+        if ( core.commit(n) )   { ++version; }
+        ingested               += n;
+        const std::int64_t  t_drain     = cc::steady_ns();
+
+        //          1B.     PLOT  (the CPU side:  M4 decimation of every series the master plot draws).
+        for (std::size_t i = 0ULL; i < NUM; ++i) {
+            points += m4_raw[i].update(buffers[i],  t - HISTORY, t, opt.width, version, 0ULL).size();
+            points += m4_avg[i].update(averages[i], t - HISTORY, t, opt.width, version, 0ULL).size();
+        }
+        const std::int64_t  t_plot      = cc::steady_ns();
+
+        drain_ns.push_back(t_drain - now);
+        plot_ns .push_back(t_plot  - t_drain);
+
+        //          1C.     WAIT FOR THE NEXT FRAME  (an overrun starts the next one immediately, as vsync would not).
+        if ( t_plot < next )    { std::this_thread::sleep_for( std::chrono::nanoseconds(next - t_plot) ); }
+        next                    = std::max(next + frame_ns, t_plot);
+    }
+    source.stop();
+
+
+    //      2.      REPORT...
+    const double            wall        = 1e-9 * static_cast<double>(cc::steady_ns() - t0);
+    const Percentiles       d           = percentiles(drain_ns);
+    const Percentiles       p           = percentiles(plot_ns);
+    std::printf("source         %s, %s, %.0f packets/s requested, queue %zu\n"
+               , cc::SyntheticStream::ms_PATTERN_NAMES[ static_cast<std::size_t>(opt.pattern) ]
+               , (opt.lines) ? "JSON lines" : "binary frames", opt.rate, source.get_queue_capacity());
+    std::printf("sustained      %.0f packets/s  (%zu ingested of %zu generated in %.2f s)\n"
+               , static_cast<double>(ingested) / wall, ingested, source.get_generated(), wall);
+    std::printf("dropped        %zu frames, %zu lines  (queue peak %zu)\n"
+               , source.get_dropped_frames(), source.get_dropped_lines(), source.get_queue_high_water());
+    std::printf("frames         %zu at %.0f fps  (%zu points drawn on average)\n"
+               , drain_ns.size(), opt.fps, points / std::max<std::size_t>(drain_ns.size(), 1ULL));
+    std::printf("drain  [ms]    p50 %8.3f   p99 %8.3f   max %8.3f\n", d.p50, d.p99, d.max);
+    std::printf("plot   [ms]    p50 %8.3f   p99 %8.3f   max %8.3f\n", p.p50, p.p99, p.max);
+    for (const auto & [name, h] : { std::pair{ "queue  [ms]", &lat_queue }, std::pair{ "ingest [ms]", &lat_ingest } })
+        { std::printf("%s    p50 %8.3f   p99 %8.3f   max %8.3f\n", name, 1e-6 * h->percentile(0.50), 1e-6 * h->percentile(0.99), 1e-6 * h->max()); }
+    return 0;
+}
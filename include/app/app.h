@@ -426,6 +426,10 @@ protected:
         //  static float                ui_scale    = ui_scaler.GetUIScale();
         
         
+        //      1.      RUN CONTINUATIONS POSTED BY BACKGROUND TASKS  (save/load completion, etc)...
+        cb::utl::TaskScheduler::instance().drain_main();
+        
+        
         //      1.6.    QUERY FOR UPDATING GUI-SCALE...
         //  if ( ui_scaler.Begin() ) {
         //      S.m_logger.info( std::format("application UI-scale set to {:.2f}", ui_scale) );
@@ -0,0 +1,325 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****          _ D E C I M A T I O N . H  ____  F I L E          ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _decimation.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_decimation.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_DECIMATION_H
+#define _CBAPP_COUNTER_DECIMATION_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include <vector>
+#include <deque>
+#include <span>
+#include <array>
+#include <algorithm>
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         M4Decimator:
+//                 Pixel-Bounded View of One Time-Series.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "M4Decimator"
+//      Reduces the visible part of a time-sorted series to at most four points per horizontal pixel -- the first,
+//      minimum, maximum and last sample of each pixel column, in time order -- so the drawn line (and its auto-fit)
+//      is indistinguishable from the full series while the point count depends on the plot width only.
+//
+//      -   Visible range:  located by binary search on x ("time_lower_bound"), plus one sample on either side so
+//                          the line still reaches the plot edges.  Ranges already under 4 points / pixel are handed
+//                          back as-is (no copy).
+//      -   Columns:        aligned to multiples of the column width, not to "xmin", so a scrolling view keeps its
+//                          columns:  each frame drops the ones that left the view and re-scans only the new samples
+//                          plus the edge columns (clipped by the view, still growing, or partly evicted by the ring).  A change of zoom or width, or a "generation" bump (data cleared),
+//                          re-scans the visible range once.
+//      -   Cache:          while neither the view, the width nor the data changed, "update" returns the last output.
+//
+//      "RB" needs  size(), empty(), operator[](i) and time_lower_bound(x, &P::x)  (e.g. "cblib::ndRingBuffer").
+//
+template< typename P >
+class M4Decimator
+{
+// *************************************************************************** //
+public:
+    using                               point_type                      = P;
+    using                               size_type                       = std::size_t;
+    using                               column_index                    = std::int64_t;
+    static constexpr size_type          ms_POINTS_PER_PX                = 4ULL;
+
+    //  "Stats"
+    struct Stats {
+        size_type                       hits                            = 0ULL;     //  "update" served from the cache.
+        size_type                       passthrough                     = 0ULL;     //  Range small enough to draw directly.
+        size_type                       rescans                         = 0ULL;     //  Full re-scans of the visible range.
+        size_type                       scanned                         = 0ULL;     //  Samples visited by the last update.
+        size_type                       points                          = 0ULL;     //  Points in the last output.
+    };
+
+// *************************************************************************** //
+protected:
+    //  "Column"
+    //      Offsets are counted from the column's first sample, so they survive the ring shifting its indices.
+    struct Column {
+        column_index                    idx                             = 0;
+        point_type                      first                           {   };
+        point_type                      lo                              {   };
+        point_type                      hi                              {   };
+        point_type                      last                            {   };
+        std::uint32_t                   n                               = 0u;
+        std::uint32_t                   o_lo                            = 0u;
+        std::uint32_t                   o_hi                            = 0u;
+    };
+    //
+    std::deque<Column>                  m_cols                          = {   };
+    std::vector<point_type>             m_out                           = {   };
+    Stats                               m_stats                         = {   };
+    //
+    //                              CACHE KEY:
+    double                              m_dx                            = 0.0;
+    float                               m_xmin                          = 0.0f;
+    float                               m_xmax                          = 0.0f;
+    int                                 m_px                            = 0;
+    std::uint64_t                       m_version                       = ~0ULL;
+    std::uint64_t                       m_generation                    = ~0ULL;
+    bool                                m_valid                         = false;
+
+// *************************************************************************** //
+public:
+
+    //  "clear"
+    inline void                         clear                           (void) noexcept
+    { this->m_cols.clear();  this->m_out.clear();  this->m_valid = false;  return; }
+
+    [[nodiscard]] inline const Stats &  stats                           (void) const noexcept   { return this->m_stats; }
+
+
+    //  "update"
+    //      Points to draw for  [xmin, xmax]  over "px" pixels.  "version" must change whenever samples were pushed and
+    //      "generation" whenever the series was cleared or re-allocated.  The span stays valid until the next call or
+    //      until "buf" is modified.
+    //
+    template< typename RB >
+    [[nodiscard]] inline std::span<const point_type>
+                                        update                          (const RB & buf, const float xmin, const float xmax, const int px,
+                                                                         const std::uint64_t version, const std::uint64_t generation)
+    {
+        this->m_stats.scanned       = 0ULL;
+        if ( buf.empty() )          { this->clear();  return {}; }
+
+        //      1.      VISIBLE RANGE  [lo, hi),  widened by one sample on either side.
+        size_type       lo          = buf.time_lower_bound(xmin, &point_type::x);
+        size_type       hi          = buf.time_lower_bound(xmax, &point_type::x);
+        lo                          = (lo > 0ULL)   ? lo - 1ULL     : 0ULL;
+        hi                          = std::min<size_type>(hi + 1ULL, buf.size());
+        if ( hi <= lo )             { return {}; }
+
+        const size_type n           = hi - lo;
+        if ( px <= 0  ||  !(xmax > xmin)  ||  n <= ms_POINTS_PER_PX * static_cast<size_type>(px) )
+        {
+            ++this->m_stats.passthrough;
+            this->m_stats.points    = n;
+            return passthrough(buf, lo, hi);
+        }
+
+
+        //      2.      CACHE HIT.
+        if ( this->m_valid  &&  version == this->m_version  &&  generation == this->m_generation  &&
+             px == this->m_px  &&  xmin == this->m_xmin  &&  xmax == this->m_xmax )
+        {
+            ++this->m_stats.hits;
+            return this->m_out;
+        }
+
+
+        //      3.      REUSE WHAT COLUMNS WE CAN,  SCAN THE REST.
+        const double    dx          = static_cast<double>(xmax - xmin) / static_cast<double>(px);
+        if ( !this->m_valid  ||  dx != this->m_dx  ||  generation != this->m_generation )
+            { this->m_cols.clear(); }
+        this->m_dx                  = dx;
+
+        const column_index  c_lo    = this->column_of( buf[lo].x );
+        const column_index  c_hi    = this->column_of( buf[hi - 1ULL].x );
+        const column_index  c_old   = this->column_of( buf[0].x );      //  May have lost samples to eviction.
+
+        //          The cached edge columns were clipped to the old [lo, hi) (and the newest may have grown since), the
+        //          ones at the new edges will be clipped again, and the oldest may have lost samples:  re-scan those.
+        while ( !this->m_cols.empty()  &&  this->m_cols.front().idx <= std::max(c_lo, c_old) )
+            { this->m_cols.pop_front(); }
+        while ( !this->m_cols.empty()  &&  this->m_cols.back().idx >= c_hi )
+            { this->m_cols.pop_back(); }
+        if ( !this->m_cols.empty() )    { this->m_cols.pop_front(); }
+        if ( !this->m_cols.empty() )    { this->m_cols.pop_back();  }
+
+        if ( this->m_cols.empty() )
+        {
+            ++this->m_stats.rescans;
+            this->scan_back(buf, lo, hi);
+        }
+        else
+        {
+            const size_type     a       = this->first_index_of(buf, this->m_cols.front().idx, lo, hi);
+            const size_type     b       = this->first_index_of(buf, this->m_cols.back().idx + 1, lo, hi);
+            this->scan_front(buf, lo, a);
+            this->scan_back(buf, b, hi);
+        }
+
+
+        //      4.      EMIT  (each column's distinct samples in time order).
+        this->m_out.clear();
+        for (const Column & c : this->m_cols)   { emit(c, this->m_out); }
+
+        this->m_xmin                = xmin;
+        this->m_xmax                = xmax;
+        this->m_px                  = px;
+        this->m_version             = version;
+        this->m_generation          = generation;
+        this->m_valid               = true;
+        this->m_stats.points        = this->m_out.size();
+        return this->m_out;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "column_of"
+    [[nodiscard]] inline column_index   column_of                       (const float x) const noexcept
+    { return static_cast<column_index>( std::floor( static_cast<double>(x) / this->m_dx ) ); }
+
+    //  "first_index_of"
+    //      First index in [lo, hi) whose column is >= "c".  Binary search, then settle float rounding at the edge.
+    template< typename RB >
+    [[nodiscard]] inline size_type      first_index_of                  (const RB & buf, const column_index c, const size_type lo, const size_type hi) const
+    {
+        const float     x0      = static_cast<float>( static_cast<double>(c) * this->m_dx );
+        size_type       i       = std::clamp<size_type>( buf.time_lower_bound(x0, &point_type::x), lo, hi );
+        while ( i > lo  &&  this->column_of(buf[i - 1ULL].x) >= c )     { --i; }
+        while ( i < hi  &&  this->column_of(buf[i].x) < c )             { ++i; }
+        return i;
+    }
+
+    //  "scan_back" / "scan_front"
+    //      Fold samples [a, b) into columns appended after / inserted before the retained ones.
+    template< typename RB >
+    inline void                         scan_back                       (const RB & buf, const size_type a, const size_type b)
+    {
+        for (size_type i = a; i < b; ++i)   { this->fold(this->m_cols, buf[i]); }
+        this->m_stats.scanned      += (b > a) ? b - a : 0ULL;
+        return;
+    }
+    template< typename RB >
+    inline void                         scan_front                      (const RB & buf, const size_type a, const size_type b)
+    {
+        if ( b <= a )       { return; }
+        std::deque<Column>      head;
+        for (size_type i = a; i < b; ++i)   { this->fold(head, buf[i]); }
+        this->m_cols.insert(this->m_cols.begin(), head.begin(), head.end());
+        this->m_stats.scanned      += b - a;
+        return;
+    }
+
+    //  "fold"
+    inline void                         fold                            (std::deque<Column> & cols, const point_type & p) const
+    {
+        const column_index  c       = this->column_of(p.x);
+        if ( cols.empty()  ||  cols.back().idx != c ) {
+            cols.push_back( Column{ c, p, p, p, p, 1u, 0u, 0u } );
+            return;
+        }
+        Column &            col     = cols.back();
+        const std::uint32_t k       = col.n++;
+        if ( p.y < col.lo.y )       { col.lo = p;  col.o_lo = k; }
+        if ( p.y > col.hi.y )       { col.hi = p;  col.o_hi = k; }
+        col.last                    = p;
+        return;
+    }
+
+    //  "emit"
+    static inline void                  emit                            (const Column & c, std::vector<point_type> & out)
+    {
+        struct Item { std::uint32_t o; const point_type * p; };
+        std::array<Item, 4>     items   = {{ {0u, &c.first}, {c.o_lo, &c.lo}, {c.o_hi, &c.hi}, {c.n - 1u, &c.last} }};
+        if ( items[1].o > items[2].o )  { std::swap(items[1], items[2]); }
+
+        std::uint32_t           prev    = ~0u;
+        for (const Item & it : items) {
+            if ( it.o == prev )         { continue; }
+            out.push_back( *it.p );
+            prev                        = it.o;
+        }
+        return;
+    }
+
+    //  "passthrough"
+    //      Contiguous ranges are returned in place;  a wrapped ring is copied (still under 4 points / pixel).
+    template< typename RB >
+    [[nodiscard]] inline std::span<const point_type>
+                                        passthrough                     (const RB & buf, const size_type lo, const size_type hi)
+    {
+        const point_type *      first   = &buf[lo];
+        if ( &buf[hi - 1ULL] == first + (hi - 1ULL - lo) )     { return { first, hi - lo }; }
+
+        this->m_out.clear();
+        for (size_type i = lo; i < hi; ++i)     { this->m_out.push_back( buf[i] ); }
+        this->m_valid           = false;
+        return this->m_out;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //   END "M4Decimator" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_DECIMATION_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
@@ -0,0 +1,183 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****              _ I N G E S T . H  ____  F I L E              ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _ingest.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_ingest.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_INGEST_H
+#define _CBAPP_COUNTER_INGEST_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.1.        ** MY **  HEADERS...
+#include "app/c_counter/_recorder.h"
+#include "app/c_counter/_running_stats.h"
+#include "app/c_counter/_tiered_history.h"
+#include "utility/_latency.h"
+
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+
+#include <array>
+#include <algorithm>
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         Ingestor:
+//                 One Packet  ===>  Every Per-Channel Series.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "Ingestor"
+//      The ingest core shared by "CCounterApp::_FetchData" and "bench/ccounter_bench.cpp".  Holds references to the
+//      caller's per-channel series (it owns none of them), so building one per frame costs nothing.
+//
+//      -   "push":         raw ring, running maximum, windowed statistics, averaged ring and both tiered histories
+//                          for every channel of "channels", all stamped with plot time "t".
+//      -   "received":     "push" plus the hooks of a live packet:  recorder, queue / ingest latency and the deferred
+//                          "glass" sample.  Every hook is optional ("nullptr").
+//      -   "commit":       after a batch, keeps every ring contiguous so the plots can hand ImPlot one pointer.
+//
+template< std::size_t N >
+class Ingestor
+{
+// *************************************************************************** //
+public:
+    using                               size_type                       = std::size_t;
+    using                               series_type                     = cblib::ndRingBuffer<ImVec2>;
+    using                               channel_map                     = std::array<ChannelID, N>;
+
+    //  "Series"
+    struct Series {
+        std::array<series_type, N> &    raw;
+        std::array<series_type, N> &    avg;
+        std::array<RunningStats, N> &   stats;
+        std::array<TieredHistory, N> &  history;
+        std::array<TieredHistory, N> &  avg_history;
+        std::array<float, N> *          max                             = nullptr;
+    };
+
+    //  "Hooks"
+    struct Hooks {
+        Recorder *                      recorder                        = nullptr;
+        utl::LatencyHistogram *         queue                           = nullptr;      //  Read  -> taken off the ring.
+        utl::LatencyHistogram *         ingest                          = nullptr;      //  Taken -> in the series.
+        utl::LatencyHistogram *         glass                           = nullptr;      //  Read  -> frame presented (deferred).
+    };
+
+// *************************************************************************** //
+protected:
+    Series                              m_series;
+    channel_map                         m_channels;
+    Hooks                               m_hooks;
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    inline                              Ingestor                        (const Series & series, const channel_map & channels, const Hooks & hooks = {}) noexcept
+        : m_series(series), m_channels(channels), m_hooks(hooks)        {   }
+
+
+    //  "push"
+    //      Fold one packet, received at plot time "t", into every series.
+    //
+    inline void                         push                            (const CoincidencePacket & packet, const float t) noexcept
+    {
+        Series &            S       = this->m_series;
+        for (size_type i = 0ULL; i < N; ++i)
+        {
+            const float         y       = static_cast<float>( packet[ this->m_channels[i] ] );
+
+            S.raw[i]            .push_back({ t, y });                       //  1.  RAW SAMPLE.
+            if ( S.max )        { (*S.max)[i] = std::max((*S.max)[i], y); } //  2.  RUNNING MAXIMUM.
+            S.stats[i]          .push(t, y);                                //  3.  O(1) UPDATE OF THE WINDOWED STATISTICS.
+            const float         avg     = S.stats[i].mean();
+            S.avg[i]            .push_back({ t, avg });                     //  4.  AVERAGED SAMPLE.
+            S.history[i]        .push(t, y);                                //  5.  ROLL BOTH INTO THE LONG HISTORY.
+            S.avg_history[i]    .push(t, avg);
+        }
+        return;
+    }
+
+
+    //  "received"
+    //      "push" for a live packet:  "read_ns" is its reader-thread stamp, "recv_ns" when its batch left the ring.
+    //
+    inline void                         received                        (const CoincidencePacket & packet, const float t,
+                                                                         const std::int64_t read_ns, const std::int64_t recv_ns) noexcept
+    {
+        const Hooks &       H       = this->m_hooks;
+        this->push(packet, t);
+        if ( H.recorder )   { H.recorder->append(packet, read_ns); }
+        if ( H.queue )      { H.queue ->record(recv_ns - read_ns); }
+        if ( H.ingest )     { H.ingest->record(steady_ns() - recv_ns); }
+        if ( H.glass )      { utl::LatencyTracer::instance().defer(*H.glass, read_ns); }
+        return;
+    }
+
+
+    //  "commit"
+    //      Call once after a batch of "n" packets;  returns true (and linearizes every ring) when anything arrived.
+    //
+    inline bool                         commit                          (const size_type n) noexcept
+    {
+        if ( n == 0ULL )    { return false; }
+        for (size_type i = 0ULL; i < N; ++i)
+            { this->m_series.raw[i].linearize();   this->m_series.avg[i].linearize(); }
+        return true;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //   END "Ingestor" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_INGEST_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
@@ -47,6 +47,8 @@
 #include <string>           //  <======| std::string, ...
 #include <string_view>
 #include <vector>           //  <======| std::vector, ...
+#include <span>
+#include <cstddef>
 #include <stdexcept>        //  <======| ...
 #include <limits.h>
 #include <math.h>
@@ -122,6 +124,7 @@ struct PerFrame_t {
     float           xmin            = -1.0f;
     float           xmax            = -1.0f;
     float           now             = -1.0f;
+    float           clock           = -1.0f;        //  Plot-time "now":  "now" for live data, the replay clock during a replay.
     float           spark_now       = -1.0f;
 //
     bool            got_packet      = false;
@@ -137,6 +140,7 @@ struct PerFrame_t {
         this->xmin            = -1.0f;
         this->xmax            = -1.0f;
         this->now             = -1.0f;
+        this->clock           = -1.0f;
         this->spark_now       = -1.0f;
         this->got_packet      = false;
         return;
@@ -199,6 +203,35 @@ struct CoincidencePacket
 
 
 
+//  "fold_coincidences"
+//      Add every coincidence count into the single-channel counts of the APDs that took part in it.
+//      The index value encodes which APD channels participated:
+//          bit3=A,     bit2=B,     bit1=C,     bit0=D      (e.g. 0b1100 == AB)
+//
+inline void fold_coincidences(CoincidencePacket & packet) noexcept
+{
+    using               Index           = CoincidencePacket::Index;
+    constexpr size_t    N               = static_cast<size_t>(Index::COUNT);
+    
+    for (size_t i = 0ULL; i < N; ++i)
+    {
+        const int       val     = packet.counts[ static_cast<Index>(i) ];
+        const uint8_t   mask    = static_cast<uint8_t>(i);
+        
+        if (val == 0)           { continue; }
+
+        //  skip single channels or UNUSED (they already hold the count)
+        if ( mask == 0 || mask == 1 || mask == 2 || mask == 4 || mask == 8 )    { continue; }
+
+        if (mask & 0x8)         { packet.counts[Index::A] += val; }     //  A.
+        if (mask & 0x4)         { packet.counts[Index::B] += val; }     //  B.
+        if (mask & 0x2)         { packet.counts[Index::C] += val; }     //  C.
+        if (mask & 0x1)         { packet.counts[Index::D] += val; }     //  D.
+    }
+    return;
+}
+
+
 //  "parse_packet"
 //      Parse one JSON‑line; returns nullopt on format errors
 //
@@ -274,27 +307,7 @@ parse_packet(std::string_view line, bool mutual_exclusion)   // NEW ARG (default
 
 
         //      2.      ADAPT GEORGES' FPGA VALUES FROM:  [ NON-MUTEX (Default) ] -- TO -- [ MUTEX ]...
-        if ( !mutual_exclusion )
-        {
-            //      The index value encodes which APD channels participated:
-            //          bit3=A,     bit2=B,     bit1=C,     bit0=D      (e.g. 0b1100 == AB)
-            //
-            for (i = 0ULL, idx = static_cast<Index>(i); i < N; idx = static_cast<Index>(++i) )
-            {
-                const int       val     = packet.counts[idx];
-                const uint8_t   mask    = static_cast<uint8_t>(i);
-                
-                if (val == 0)           { continue; }
-
-                //  skip single channels or UNUSED (they already hold the count)
-                if ( mask == 0 || mask == 1 || mask == 2 || mask == 4 || mask == 8 )    { continue; }
-
-                if (mask & 0x8)         { packet.counts[Index::A] += val; }     //  A.
-                if (mask & 0x4)         { packet.counts[Index::B] += val; }     //  B.
-                if (mask & 0x2)         { packet.counts[Index::C] += val; }     //  C.
-                if (mask & 0x1)         { packet.counts[Index::D] += val; }     //  D.
-            }
-        }
+        if ( !mutual_exclusion )    { fold_coincidences(packet); }
     }
     //
     //      ERROR :     Some type of malformed JSON / JSON-Keys, etc...
@@ -310,6 +323,44 @@ parse_packet(std::string_view line, bool mutual_exclusion)   // NEW ARG (default
 
 
 
+//  "decode_packet"
+//      Decode one binary frame payload  (see "fpga_stream_v3.py --binary");  returns nullopt on a version / size mismatch.
+//      Payload v1, little-endian:      u32 seq  |  i64 cycles  |  i32 counts[16]        (76 bytes).
+//
+static constexpr uint16_t       DEF_PACKET_VERSION      = 1U;
+static constexpr size_t         DEF_PACKET_SIZE         = 4ULL + 8ULL + 4ULL * static_cast<size_t>(ChannelID::COUNT);
+//
+inline std::optional<CoincidencePacket>
+decode_packet(const uint16_t version, std::span<const std::byte> payload, bool mutual_exclusion)
+{
+    using               Packet          = CoincidencePacket;
+    using               Index           = Packet::Index;
+    Packet              packet          {   };
+    
+    auto                load_le         = [&payload](const size_t at, const size_t width) -> uint64_t {
+        uint64_t    v   = 0ULL;
+        for (size_t b = 0ULL; b < width; ++b)   { v |= std::to_integer<uint64_t>(payload[at + b]) << (8ULL * b); }
+        return v;
+    };
+
+
+    //      CASE 0 :    UNKNOWN LAYOUT...
+    if ( version != DEF_PACKET_VERSION  ||  payload.size() != DEF_PACKET_SIZE )   { return std::nullopt; }
+
+
+    //      1.      FIXED OFFSETS;  NO PARSING, NO ALLOCATION...
+    packet.cycles       = static_cast<int>( static_cast<int64_t>(load_le(4ULL, 8ULL)) );
+    for (size_t i = 0ULL; i < static_cast<size_t>(Index::COUNT); ++i) {
+        packet.counts[ static_cast<Index>(i) ]  = static_cast<int32_t>( static_cast<uint32_t>(load_le(12ULL + 4ULL * i, 4ULL)) );
+    }
+    
+    if ( !mutual_exclusion )    { fold_coincidences(packet); }
+    return packet;
+}
+
+
+
+
     
 // *************************************************************************** //
 //      1A. TYPES |        PRAGMATIC ABSTRACTIONS.
@@ -0,0 +1,390 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****            _ R E C O R D E R . H  ____  F I L E            ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _recorder.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_recorder.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_RECORDER_H
+#define _CBAPP_COUNTER_RECORDER_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.1.        ** MY **  HEADERS...
+#include "app/state/state.h"               //  "app::AppState" (the config aliases pulled in by "_internal.h" need it).
+#include "app/c_counter/_internal.h"
+#include "utility/_latency.h"               //  "utl::monotonic_ns".
+
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+
+#include <array>
+#include <vector>
+#include <span>
+#include <fstream>
+#include <filesystem>
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      FILE FORMAT...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "steady_ns"
+//      Monotonic receive timestamp used by the recorder and the replay clock.  Same clock as the reader threads' stamps.
+[[nodiscard]] inline std::int64_t steady_ns(void) noexcept     { return utl::monotonic_ns(); }
+
+
+//  "RecordCodec"
+//
+enum class RecordCodec : std::uint32_t {
+    Raw = 0,            //  Plain columns.
+    Delta,              //  Per-column delta, zig-zag, LEB128 varint  (counts move slowly:  ~4-6x smaller).
+    COUNT
+};
+
+
+//  Layout  (native byte-order, see "src/app/c_counter/recorder.cpp" and "scripts/python/read_ccrec.py"):
+//      header      char[8] "CCRECORD",  u32 version,  u32 flags,  i64 wall-clock start (ns since epoch),
+//                  u32 channels,  u32 packets per chunk                                                (32 bytes)
+//      chunk       char[4] "CHNK",  u32 packets,  u32 codec,  u32 payload bytes,  payload
+//      payload     columns, one after the other:   i64 t_ns[n]  |  i32 cycles[n]  |  i32 counts[16][n]
+//                  ("t_ns" counts from the moment the file was opened;  every chunk decodes on its own.)
+//
+static constexpr char               REC_MAGIC [8]               = { 'C', 'C', 'R', 'E', 'C', 'O', 'R', 'D' };
+static constexpr char               REC_CHUNK [4]               = { 'C', 'H', 'N', 'K' };
+static constexpr std::uint32_t      REC_VERSION                 = 1U;
+static constexpr std::uint32_t      REC_FLAG_MUTEX              = 1U << 0;      //  Packets were recorded with "mutual exclusion" counts.
+
+
+
+//  "RecordBlock"
+//      One chunk of packets, stored column-wise.
+//
+struct RecordBlock
+{
+    static constexpr std::size_t                    ms_CHANNELS     = static_cast<std::size_t>(ChannelID::COUNT);
+//
+    std::vector<std::int64_t>                       t_ns            {   };
+    std::vector<std::int32_t>                       cycles          {   };
+    std::array<std::vector<std::int32_t>, ms_CHANNELS>
+                                                    counts          {   };
+//
+//
+    [[nodiscard]] inline std::size_t                size            (void) const noexcept   { return this->t_ns.size(); }
+    [[nodiscard]] inline bool                       empty           (void) const noexcept   { return this->t_ns.empty(); }
+    //
+    inline void                                     reserve         (const std::size_t n)
+    { this->t_ns.reserve(n);  this->cycles.reserve(n);  for (auto & c : this->counts) { c.reserve(n); }  return; }
+    //
+    inline void                                     clear           (void) noexcept
+    { this->t_ns.clear();  this->cycles.clear();  for (auto & c : this->counts) { c.clear(); }  return; }
+    //
+    inline void                                     resize          (const std::size_t n)
+    { this->t_ns.resize(n);  this->cycles.resize(n);  for (auto & c : this->counts) { c.resize(n); }  return; }
+    //
+    inline void                                     push            (const CoincidencePacket & packet, const std::int64_t t)
+    {
+        this->t_ns  .push_back( t );
+        this->cycles.push_back( static_cast<std::int32_t>(packet.cycles) );
+        for (std::size_t c = 0ULL; c < ms_CHANNELS; ++c)
+            { this->counts[c].push_back( static_cast<std::int32_t>( packet.counts[ static_cast<ChannelID>(c) ] ) ); }
+        return;
+    }
+    //
+    [[nodiscard]] inline CoincidencePacket          packet          (const std::size_t i) const noexcept
+    {
+        CoincidencePacket       p       {   };
+        p.cycles                        = this->cycles[i];
+        for (std::size_t c = 0ULL; c < ms_CHANNELS; ++c)
+            { p.counts[ static_cast<ChannelID>(c) ] = this->counts[c][i]; }
+        return p;
+    }
+};
+
+
+//  "encode_block" / "decode_block"
+//      "decode_block" returns false when the payload is truncated or does not hold exactly "n" packets;  an "n" the
+//      payload cannot possibly hold is rejected before anything is allocated.
+void                                encode_block            (const RecordBlock & , const RecordCodec , std::vector<std::byte> & );
+[[nodiscard]] bool                  decode_block            (std::span<const std::byte> , const std::size_t , const RecordCodec , RecordBlock & );
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         Recorder:
+//                 In-Process Recording of Parsed Packets.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "Recorder"
+//      Appends every ingested "CoincidencePacket" with its receive time to a chunked, column-wise file.
+//
+//      -   Double-buffered:    "append" fills the front block (GUI thread, no I/O);  a full block is swapped with the
+//                              back block and handed to "utl::TaskScheduler", which encodes and writes it while the
+//                              front block keeps filling.  Only if the previous write is still running when the next
+//                              block fills does "append" wait for it (counted in "Stats::stalls").
+//      -   "close" hands over the partial block, waits for the writer and closes the file;  the destructor does too.
+//
+class Recorder
+{
+// *************************************************************************** //
+public:
+    static constexpr std::size_t        ms_BLOCK_PACKETS                = 4'096ULL;
+
+    //  "Stats"
+    struct Stats {
+        std::size_t                     packets                         = 0ULL;
+        std::size_t                     chunks                          = 0ULL;
+        std::size_t                     raw_bytes                       = 0ULL;     //  Size the chunks would have with "RecordCodec::Raw".
+        std::size_t                     file_bytes                      = 0ULL;
+        std::size_t                     stalls                          = 0ULL;
+        bool                            failed                          = false;
+    };
+
+// *************************************************************************** //
+protected:
+    std::ofstream                       m_file                          {   };
+    std::filesystem::path               m_path                          {   };
+    RecordCodec                         m_codec                         = RecordCodec::Delta;
+    std::int64_t                        m_t0                            = 0;
+    bool                                m_open                          = false;
+    //
+    RecordBlock                         m_front                         {   };      //  GUI thread.
+    RecordBlock                         m_back                          {   };      //  Writer, while "m_busy".
+    std::vector<std::byte>              m_scratch                       {   };      //  Writer.
+    std::atomic<bool>                   m_busy                          { false };
+    //
+    std::size_t                         m_packets                       = 0ULL;
+    std::size_t                         m_stalls                        = 0ULL;
+    std::atomic<std::size_t>            m_chunks                        { 0ULL };
+    std::atomic<std::size_t>            m_raw_bytes                     { 0ULL };
+    std::atomic<std::size_t>            m_file_bytes                    { 0ULL };
+    std::atomic<bool>                   m_failed                        { false };
+
+// *************************************************************************** //
+public:
+                                        Recorder                        (void)                  = default;
+                                        ~Recorder                       (void)                  { this->close(); }
+                                        Recorder                        (const Recorder & )     = delete;
+    Recorder &                          operator =                      (const Recorder & )     = delete;
+
+    [[nodiscard]] bool                  open                            (const std::filesystem::path & , const RecordCodec = RecordCodec::Delta, const std::uint32_t flags = 0U);
+    void                                flush                           (void);
+    void                                close                           (void);
+    [[nodiscard]] Stats                 stats                           (void) const noexcept;
+
+    [[nodiscard]] inline bool           is_open                         (void) const noexcept   { return this->m_open; }
+    [[nodiscard]] inline const std::filesystem::path &
+                                        path                            (void) const noexcept   { return this->m_path; }
+
+    //  "append"
+    //      "t_ns" is a "steady_ns" timestamp;  no-op while closed.
+    inline void                         append                          (const CoincidencePacket & packet, const std::int64_t t_ns)
+    {
+        if ( !this->m_open )    { return; }
+        this->m_front.push(packet, t_ns - this->m_t0);
+        ++this->m_packets;
+        if ( this->m_front.size() >= ms_BLOCK_PACKETS )     { this->flush(); }
+        return;
+    }
+
+// *************************************************************************** //
+protected:
+    void                                wait_idle                       (void) noexcept;
+    void                                write_back                      (void);
+
+// *************************************************************************** //
+// *************************************************************************** //   END "Recorder" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         ReplaySource:
+//                 Paced Playback of a Recorded Session.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "ReplaySource"
+//      Reads a "Recorder" file chunk by chunk and hands its packets back in recorded order, either paced by the
+//      recorded receive times (1x or N x) or as fast as the caller can take them.
+//
+//      -   "drain" is called once per frame (from "CCounterApp::_FetchData") and ingests everything that is due.  In
+//          "Speed::Max" it keeps going until "ms_MAX_FRAME_NS" of the frame is spent, so the GUI keeps rendering and
+//          "Stats" measure the whole ingest -> statistics -> plot pipeline.
+//      -   Each packet comes with its recorded time, rebased to the first packet and divided by the speed factor (1
+//          for "Realtime" and "Max"), so a frame's worth of packets keeps its recorded spacing on the plot.
+//      -   "clock_ns" is the replay's own "now" on that same time axis:  the paced wall time since "start", or in
+//          "Speed::Max" the time of the last packet handed out (which runs ahead of the wall clock).
+//      -   The file is untrusted:  a chunk may not claim more packets than the header's packets-per-chunk, nor more
+//          payload than is left in the file.
+//
+class ReplaySource
+{
+// *************************************************************************** //
+public:
+    enum class Speed : std::uint8_t { Realtime = 0, Scaled, Max, COUNT };
+    static constexpr std::array<const char *, static_cast<std::size_t>(Speed::COUNT)>
+                                        ms_SPEED_NAMES                  = { "1x", "N x", "Max" };
+    static constexpr std::int64_t       ms_MAX_FRAME_NS                 = 12'000'000;       //  "Speed::Max" budget per frame.
+    static constexpr std::size_t        ms_MAX_CHUNK_PACKETS            = 1ULL << 20;       //  Largest packets-per-chunk "open" accepts.
+
+    //  "Stats"
+    struct Stats {
+        std::size_t                     packets                         = 0ULL;     //  Replayed so far.
+        std::size_t                     total                           = 0ULL;     //  In the file.
+        std::size_t                     frames                          = 0ULL;     //  "drain" calls since "start".
+        std::int64_t                    wall_ns                         = 0;        //  Since "start".
+        std::int64_t                    busy_ns                         = 0;        //  Spent inside "drain".
+        //
+        [[nodiscard]] inline double     rate                            (void) const noexcept   //  Packets / s.
+        { return (this->wall_ns > 0)    ? 1e9 * static_cast<double>(this->packets) / static_cast<double>(this->wall_ns)    : 0.0; }
+        [[nodiscard]] inline double     ns_per_packet                   (void) const noexcept
+        { return (this->packets > 0)    ? static_cast<double>(this->busy_ns) / static_cast<double>(this->packets)          : 0.0; }
+    };
+
+// *************************************************************************** //
+protected:
+    std::ifstream                       m_file                          {   };
+    std::filesystem::path               m_path                          {   };
+    std::streamoff                      m_data_begin                    = 0;
+    std::uint32_t                       m_flags                         = 0U;
+    std::size_t                         m_chunk_packets                 = 0ULL;     //  Header:  most packets any chunk may hold.
+    std::streamoff                      m_size                          = 0;        //  File size.
+    //
+    RecordBlock                         m_block                         {   };
+    std::vector<std::byte>              m_payload                       {   };
+    std::size_t                         m_pos                           = 0ULL;     //  Next packet in "m_block".
+    //
+    Speed                               m_speed                         = Speed::Realtime;
+    double                              m_factor                        = 1.0;
+    std::int64_t                        m_start_ns                      = 0;        //  "steady_ns" at "start".
+    std::int64_t                        m_first_t                       = 0;        //  Recorded time of the first packet.
+    std::int64_t                        m_clock_ns                      = 0;        //  Replay time reached by the last "drain".
+    bool                                m_active                        = false;
+    Stats                               m_stats                         {   };
+
+// *************************************************************************** //
+public:
+    [[nodiscard]] bool                  open                            (const std::filesystem::path & );
+    void                                close                           (void) noexcept;
+    void                                start                           (const Speed , const double factor = 1.0);
+    inline void                         stop                            (void) noexcept         { this->m_active = false; }
+
+    [[nodiscard]] inline bool           is_open                         (void) const noexcept   { return this->m_file.is_open(); }
+    [[nodiscard]] inline bool           active                          (void) const noexcept   { return this->m_active; }
+    [[nodiscard]] inline std::uint32_t  flags                           (void) const noexcept   { return this->m_flags; }
+    [[nodiscard]] inline std::int64_t   clock_ns                        (void) const noexcept   { return this->m_clock_ns; }
+    [[nodiscard]] inline const Stats &  stats                           (void) const noexcept   { return this->m_stats; }
+    [[nodiscard]] inline const std::filesystem::path &
+                                        path                            (void) const noexcept   { return this->m_path; }
+
+
+    //  "drain"
+    //      Pass every packet that is due at "now_ns" to "ingest(const CoincidencePacket &, std::int64_t t_ns)", where
+    //      "t_ns" is its replay time since "start";  returns how many.
+    //
+    template< typename F >
+    inline std::size_t                  drain                           (const std::int64_t now_ns, F && ingest)
+    {
+        if ( !this->m_active )      { return 0ULL; }
+
+        const bool          paced       = ( this->m_speed != Speed::Max );
+        const double        factor      = ( this->m_speed == Speed::Scaled )    ? this->m_factor    : 1.0;
+        const std::int64_t  due         = this->m_first_t + static_cast<std::int64_t>( static_cast<double>(now_ns - this->m_start_ns) * factor );
+        std::size_t         n           = 0ULL;
+
+        for (;;)
+        {
+            if ( this->m_pos == this->m_block.size()  &&  !this->next_block() )
+                { this->m_active = false;  break; }
+
+            if ( paced ) {
+                if ( this->m_block.t_ns[this->m_pos] > due )    { break; }
+            }
+            else if ( (n & 0xFFULL) == 0xFFULL  &&  steady_ns() - now_ns >= ms_MAX_FRAME_NS )
+                { break; }
+
+            const std::int64_t  t_ns        = static_cast<std::int64_t>( static_cast<double>(this->m_block.t_ns[this->m_pos] - this->m_first_t) / factor );
+            ingest( this->m_block.packet(this->m_pos), t_ns );
+            this->m_clock_ns            = std::max(this->m_clock_ns, t_ns);
+            ++this->m_pos;
+            ++n;
+        }
+        if ( paced )                { this->m_clock_ns = std::max(this->m_clock_ns, now_ns - this->m_start_ns); }
+
+        const std::int64_t  end         = steady_ns();
+        this->m_stats.packets      += n;
+        this->m_stats.frames       += 1ULL;
+        this->m_stats.wall_ns       = end - this->m_start_ns;
+        this->m_stats.busy_ns      += end - now_ns;
+        return n;
+    }
+
+// *************************************************************************** //
+protected:
+    [[nodiscard]] bool                  next_block                      (void);
+
+// *************************************************************************** //
+// *************************************************************************** //   END "ReplaySource" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_RECORDER_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
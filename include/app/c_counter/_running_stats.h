@@ -0,0 +1,293 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****       _ R U N N I N G _ S T A T S . H  ____  F I L E       ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _running_stats.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_running_stats.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_RUNNING_STATS_H
+#define _CBAPP_COUNTER_RUNNING_STATS_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.1.        ** MY **  HEADERS...
+#include "app/c_counter/_types.h"
+
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         RunningStats:
+//                 Sliding-Window Statistics of One Counter.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "RunningStats"
+//      Mean / standard deviation / min / max over either the last N samples or the last T seconds, updated in O(1)
+//      (amortised) per pushed sample instead of re-scanning the history on every packet.
+//
+//      -   Sums:       sliding  sum(y - K)  and  sum((y - K)^2)  over the window, shifted by a reference value K (the
+//                      first sample of the window at the last re-sum) so the variance does not cancel catastrophically.
+//                      Counter values are integers, so these sums are exact;  for safety they are re-summed from the
+//                      retained samples once every "capacity" pushes (still O(1) amortised).
+//      -   Min / Max:  monotonic deques of sample indices.
+//      -   Time index: timestamps are non-decreasing, so a new window length T is located by binary search over the
+//                      retained samples;  the sums and deques are then rebuilt once, in O(window).
+//
+//      Retains the last "capacity" samples (normally the size of the plot buffer), so a time window can never reach
+//      further back than the plotted history — the same limit the old re-scan had.
+//
+class RunningStats
+{
+// *************************************************************************** //
+public:
+    using                               size_type                       = std::size_t;
+    using                               index_type                      = std::uint64_t;    //  Absolute sample index.
+    struct                              Sample                          { float t; float y; };
+
+// *************************************************************************** //
+protected:
+    std::vector<Sample>                 m_ring                          = {   };
+    index_type                          m_total                         = 0ULL;             //  Samples ever pushed (next index).
+    size_type                           m_count                         = 0ULL;             //  Samples retained.
+    //
+    AvgMode                             m_mode                          = AvgMode::Samples;
+    index_type                          m_N                             = 10ULL;
+    double                              m_T                             = 30.0;
+    //
+    index_type                          m_begin                         = 0ULL;             //  First index inside the window.
+    double                              m_K                             = 0.0;
+    double                              m_sum                           = 0.0;
+    double                              m_sq                            = 0.0;
+    std::deque<index_type>              m_maxq                          = {   };
+    std::deque<index_type>              m_minq                          = {   };
+    size_type                           m_since_resum                   = 0ULL;
+
+// *************************************************************************** //
+public:
+
+    //  Default / Parametric Constructor.
+    explicit inline                     RunningStats                    (const size_type capacity = 0ULL)     { this->set_capacity(capacity); }
+
+    //  "set_capacity"
+    //      Resizes the retained history (clears everything).
+    inline void                         set_capacity                    (const size_type capacity)
+    {
+        this->m_ring.assign(capacity, Sample{ 0.0f, 0.0f });
+        this->clear();
+        return;
+    }
+
+    //  "clear"
+    inline void                         clear                           (void) noexcept
+    {
+        this->m_total       = 0ULL;     this->m_count       = 0ULL;     this->m_begin       = 0ULL;
+        this->m_K           = 0.0;      this->m_sum         = 0.0;      this->m_sq          = 0.0;
+        this->m_maxq.clear();           this->m_minq.clear();           this->m_since_resum = 0ULL;
+        return;
+    }
+
+
+    //  "set_window"
+    //      Cheap when nothing changed, so callers may simply forward the UI values before every push.  A change
+    //      re-seats the window over the retained samples, so the statistics are immediately those of the new window.
+    //
+    inline void                         set_window                      (const AvgMode mode, const index_type N, const double T)
+    {
+        const index_type    n       = std::max<index_type>(N, 1ULL);
+        if ( mode == this->m_mode  &&  n == this->m_N  &&  T == this->m_T )     { return; }
+        this->m_mode        = mode;
+        this->m_N           = n;
+        this->m_T           = T;
+        this->reseat();
+        return;
+    }
+
+
+    //  "push"
+    //      Append one sample;  "t" must not decrease.
+    //
+    inline void                         push                            (const float t, const float y)
+    {
+        const size_type     cap     = this->m_ring.size();
+        if (cap == 0ULL)    { return; }
+
+        if (this->m_count == cap)                                   //  1.  Evict the oldest retained sample.
+        {
+            const index_type    o   = this->m_total - this->m_count;
+            if (o >= this->m_begin)     { this->drop(o);    this->m_begin = o + 1ULL; }
+            --this->m_count;
+        }
+        if (this->m_begin == this->m_total)     { this->m_K = static_cast<double>(y); }     //  Empty window:  re-base.
+
+        this->m_ring[ this->m_total % cap ]     = Sample{ t, y };   //  2.  Append, then admit into the window.
+        const index_type    i       = this->m_total++;
+        ++this->m_count;
+        this->admit(i);
+
+        this->slide();                                              //  3.  Expire whatever fell out of the window.
+        if ( ++this->m_since_resum >= cap )     { this->resum(); }
+        return;
+    }
+
+
+    //  Queries.
+    [[nodiscard]] inline size_type      count                           (void) const noexcept   { return static_cast<size_type>(this->m_total - this->m_begin); }
+    [[nodiscard]] inline size_type      capacity                        (void) const noexcept   { return this->m_ring.size(); }
+    [[nodiscard]] inline bool           empty                           (void) const noexcept   { return this->count() == 0ULL; }
+    //
+    [[nodiscard]] inline float          mean                            (void) const noexcept
+    { return (this->empty())  ? 0.0f  : static_cast<float>( this->m_K + this->m_sum / static_cast<double>(this->count()) ); }
+    //
+    //  "variance"      Population variance of the window.
+    [[nodiscard]] inline float          variance                        (void) const noexcept
+    {
+        if ( this->empty() )    { return 0.0f; }
+        const double    n       = static_cast<double>(this->count());
+        const double    mu      = this->m_sum / n;
+        return static_cast<float>( std::max(this->m_sq / n - mu * mu, 0.0) );
+    }
+    [[nodiscard]] inline float          stddev                          (void) const noexcept   { return std::sqrt( this->variance() ); }
+    [[nodiscard]] inline float          max                             (void) const noexcept   { return (this->empty()) ? 0.0f : this->at(this->m_maxq.front()).y; }
+    [[nodiscard]] inline float          min                             (void) const noexcept   { return (this->empty()) ? 0.0f : this->at(this->m_minq.front()).y; }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "at"
+    [[nodiscard]] inline const Sample & at                              (const index_type i) const noexcept
+    { return this->m_ring[ static_cast<size_type>(i % this->m_ring.size()) ]; }
+
+    //  "admit" / "drop"
+    inline void                         admit                           (const index_type i)
+    {
+        const float     y       = this->at(i).y;
+        const double    d       = static_cast<double>(y) - this->m_K;
+        this->m_sum            += d;
+        this->m_sq             += d * d;
+        while ( !this->m_maxq.empty()  &&  this->at(this->m_maxq.back()).y <= y )    { this->m_maxq.pop_back(); }
+        while ( !this->m_minq.empty()  &&  this->at(this->m_minq.back()).y >= y )    { this->m_minq.pop_back(); }
+        this->m_maxq.push_back(i);
+        this->m_minq.push_back(i);
+        return;
+    }
+    inline void                         drop                            (const index_type i) noexcept
+    {
+        const double    d       = static_cast<double>( this->at(i).y ) - this->m_K;
+        this->m_sum            -= d;
+        this->m_sq             -= d * d;
+        if ( !this->m_maxq.empty()  &&  this->m_maxq.front() == i )     { this->m_maxq.pop_front(); }
+        if ( !this->m_minq.empty()  &&  this->m_minq.front() == i )     { this->m_minq.pop_front(); }
+        return;
+    }
+
+    //  "slide"
+    //      Advance the window start;  the newest sample always stays inside.
+    inline void                         slide                           (void) noexcept
+    {
+        if (this->m_mode == AvgMode::Samples) {
+            while ( this->m_total - this->m_begin > this->m_N )         { this->drop(this->m_begin++); }
+            return;
+        }
+        const double    t_last  = static_cast<double>( this->at(this->m_total - 1ULL).t );
+        while ( this->m_begin + 1ULL < this->m_total  &&  t_last - static_cast<double>(this->at(this->m_begin).t) > this->m_T )
+            { this->drop(this->m_begin++); }
+        return;
+    }
+
+    //  "reseat"
+    //      Locate the window for new settings over the retained samples, then rebuild its sums and deques.
+    inline void                         reseat                          (void)
+    {
+        if (this->m_count == 0ULL)      { this->m_begin = this->m_total;    return; }
+        const index_type    oldest  = this->m_total - this->m_count;
+
+        if (this->m_mode == AvgMode::Samples) {
+            this->m_begin           = std::max<index_type>( oldest, this->m_total - std::min<index_type>(this->m_N, this->m_count) );
+        }
+        else {                                                      //  First sample with  t_last - t <= T.
+            const double    t_last  = static_cast<double>( this->at(this->m_total - 1ULL).t );
+            index_type      lo      = oldest,       hi      = this->m_total - 1ULL;
+            while (lo < hi) {
+                const index_type    mid     = lo + (hi - lo) / 2ULL;
+                if ( t_last - static_cast<double>(this->at(mid).t) > this->m_T )    { lo = mid + 1ULL; }
+                else                                                                { hi = mid;        }
+            }
+            this->m_begin           = lo;
+        }
+        this->resum();
+        return;
+    }
+
+    //  "resum"
+    //      Exact rebuild of the window's sums and deques from the retained samples.
+    inline void                         resum                           (void)
+    {
+        this->m_sum         = 0.0;      this->m_sq          = 0.0;
+        this->m_maxq.clear();           this->m_minq.clear();
+        this->m_since_resum = 0ULL;
+        if (this->m_begin == this->m_total)     { return; }
+        this->m_K           = static_cast<double>( this->at(this->m_begin).y );
+        for (index_type i = this->m_begin; i < this->m_total; ++i)     { this->admit(i); }
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //   END "RunningStats" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_RUNNING_STATS_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
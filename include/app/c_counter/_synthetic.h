@@ -0,0 +1,245 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****           _ S Y N T H E T I C . H  ____  F I L E           ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _synthetic.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_synthetic.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_SYNTHETIC_H
+#define _CBAPP_COUNTER_SYNTHETIC_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.1.        ** MY **  HEADERS...
+#include "utility/pystream/pystream.h"
+#include "app/c_counter/_internal.h"
+#include "app/c_counter/_recorder.h"          //  "steady_ns".
+
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <memory>
+
+#include <array>
+#include <algorithm>
+#include <string>
+#include <span>
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         SyntheticStream:
+//                 Built-In Packet Source for Load Testing.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "SyntheticStream"
+//      Stands in for "utl::PyStream" + "fpga_stream_v3.py":  a producer thread fills the same kind of drop-oldest ring
+//      with the same binary frames (payload v1, see "decode_packet") or JSON lines, so everything downstream of
+//      "try_receive_many" runs exactly as with the FPGA -- minus Python's sleep / print ceiling.
+//
+//      -   Rate:       1 Hz .. 1 MHz (packets / s).  The producer wakes every ~0.5 ms and emits what the clock owes it,
+//                      so high rates arrive in small bursts, as they would from a pipe.
+//      -   Pattern:    "Steady" (evenly spaced),  "Poisson" (random arrivals),  or "Bursty" (the whole rate packed
+//                      into the first "burst_duty" of every "burst_period" -- same mean, peaks of rate / duty).
+//      -   Counts:     all 16 channels.  Singles around "mean_counts", each extra detector in a coincidence ~10x
+//                      fewer, with sqrt(N) noise and a slow drift so the plots have something to show.
+//
+class SyntheticStream
+{
+// *************************************************************************** //
+public:
+    using                               Framing                         = utl::PyStream::Framing;
+    using                               BinaryFrame                     = utl::PyStream::BinaryFrame;
+    using                               Line                            = utl::PyStream::Line;
+    using                               LineRing                        = utl::PyStream::LineRing;
+    using                               FrameRing                       = utl::PyStream::FrameRing;
+    using                               size_type                       = std::size_t;
+
+    enum class Pattern : std::uint8_t { Steady = 0, Poisson, Bursty, COUNT };
+    static constexpr std::array<const char *, static_cast<size_type>(Pattern::COUNT)>
+                                        ms_PATTERN_NAMES                = { "Steady", "Poisson", "Bursty" };
+    //
+    static constexpr double             ms_MIN_RATE                     = 1.0;
+    static constexpr double             ms_MAX_RATE                     = 1'000'000.0;
+    static constexpr std::int64_t       ms_TICK_NS                      = 500'000;
+
+// *************************************************************************** //
+protected:
+    Framing                             m_framing                       = Framing::Binary;
+    size_type                           m_queue_capacity                = utl::PyStream::ms_DEF_QUEUE_CAPACITY;
+    std::unique_ptr<LineRing>           m_line_ring                     = nullptr;
+    std::unique_ptr<FrameRing>          m_frame_ring                    = nullptr;
+    std::thread                         m_thread                        ;
+    //
+    //                              SETTINGS  (may change while running):
+    std::atomic<double>                 m_rate                          { 1'000.0 };
+    std::atomic<Pattern>                m_pattern                       { Pattern::Steady };
+    std::atomic<double>                 m_burst_duty                    { 0.10 };
+    std::atomic<double>                 m_burst_period                  { 1.00 };
+    std::atomic<double>                 m_mean_counts                   { 2'000.0 };
+    //
+    //                              STATE:
+    std::atomic_bool                    m_running                       { false };
+    std::atomic<size_type>              m_generated                     { 0ULL };
+    std::atomic<size_type>              m_dropped_lines                 { 0ULL };
+    std::atomic<size_type>              m_dropped_frames                { 0ULL };
+
+// *************************************************************************** //
+public:
+                                        SyntheticStream                 (void)                          = default;
+                                        ~SyntheticStream                (void)                          { this->stop(); }
+                                        SyntheticStream                 (const SyntheticStream & )      = delete;
+    SyntheticStream &                   operator =                      (const SyntheticStream & )      = delete;
+
+    //                              OPERATION FUNCTIONS  ( "utl::PyStream" subset ):
+    bool                                start                           (void);
+    void                                stop                            (void);
+    bool                                send                            (const std::string & msg);      //  "integration_window <s>"  sets the rate.
+    size_type                           try_receive_many                (std::span<Line> out);
+    size_type                           try_receive_many                (std::span<BinaryFrame> out);
+
+    //                              SETTERS:
+    inline void                         set_framing                     (const Framing f)           { if ( !this->is_running() )  { this->m_framing = f; } }
+    inline void                         set_queue_capacity              (const size_type cap)       { if ( !this->is_running() )  { this->m_queue_capacity = cap; } }
+    inline void                         set_rate                        (const double hz) noexcept  { this->m_rate.store( std::clamp(hz, ms_MIN_RATE, ms_MAX_RATE), std::memory_order_relaxed ); }
+    inline void                         set_pattern                     (const Pattern p) noexcept  { this->m_pattern.store(p, std::memory_order_relaxed); }
+    inline void                         set_burst                       (const double duty, const double period_s) noexcept
+    {
+        this->m_burst_duty  .store( std::clamp(duty, 0.001, 1.0),       std::memory_order_relaxed );
+        this->m_burst_period.store( std::max(period_s, 0.001),          std::memory_order_relaxed );
+    }
+    inline void                         set_mean_counts                 (const double n) noexcept   { this->m_mean_counts.store( std::max(n, 0.0), std::memory_order_relaxed ); }
+
+    //                              GETTERS  ( same names as "utl::PyStream" ):
+    [[nodiscard]] inline bool           is_running                      (void) const noexcept       { return this->m_running.load(); }
+    [[nodiscard]] inline Framing        get_framing                     (void) const noexcept       { return this->m_framing; }
+    [[nodiscard]] inline double         get_rate                        (void) const noexcept       { return this->m_rate.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline Pattern        get_pattern                     (void) const noexcept       { return this->m_pattern.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline size_type      get_generated                   (void) const noexcept       { return this->m_generated.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline size_type      get_dropped_lines               (void) const noexcept       { return this->m_dropped_lines.load(); }
+    [[nodiscard]] inline size_type      get_dropped_frames              (void) const noexcept       { return this->m_dropped_frames.load(); }
+    [[nodiscard]] inline size_type      get_bad_frames                  (void) const noexcept       { return 0ULL; }
+    [[nodiscard]] inline size_type      get_queue_capacity              (void) const noexcept       { return this->m_queue_capacity; }
+    [[nodiscard]] inline size_type      get_queue_depth                 (void) const noexcept
+    {
+        if ( this->m_framing == Framing::Binary )   { return (this->m_frame_ring)   ? this->m_frame_ring->size()    : 0ULL; }
+        return (this->m_line_ring)      ? this->m_line_ring->size()     : 0ULL;
+    }
+    [[nodiscard]] inline size_type      get_queue_high_water            (void) const noexcept
+    {
+        if ( this->m_framing == Framing::Binary )   { return (this->m_frame_ring)   ? static_cast<size_type>(this->m_frame_ring->high_water())  : 0ULL; }
+        return (this->m_line_ring)      ? static_cast<size_type>(this->m_line_ring->high_water())   : 0ULL;
+    }
+
+// *************************************************************************** //
+protected:
+    void                                producer_func                   (void);
+
+// *************************************************************************** //
+// *************************************************************************** //   END "SyntheticStream" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      2.      SHARED DRAIN...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "drain_stream"
+//      Pop every pending message of "src" ("utl::PyStream" or "SyntheticStream") in batches of "frames" / "lines",
+//      decode it and call  "on_packet(const CoincidencePacket &, std::int64_t read_ns, std::int64_t recv_ns)"  ("read_ns":
+//      the message's stamp from the reader thread;  "recv_ns":  "steady_ns()" when its batch was taken off the ring).
+//      Returns the number of messages taken, including any that failed to decode.
+//
+//      Stops after one queue's worth, or once "budget_ns" of the frame is spent (checked per batch), whichever
+//      comes first:  a producer faster than the consumer would otherwise keep this loop busy forever, and a large
+//      queue or a slow "on_packet" would stretch the frame.  The rest waits for the next frame (or is dropped by
+//      the ring, which it would have been anyway).
+//
+static constexpr std::int64_t       DRAIN_BUDGET_NS             = 8'000'000;    //  Half a 60 Hz frame.
+//
+template< typename Source, typename F >
+inline std::size_t drain_stream(  Source & src, std::span<typename Source::BinaryFrame> frames, std::span<typename Source::Line> lines
+                                , const bool mutual_exclusion, F && on_packet, const std::int64_t budget_ns = DRAIN_BUDGET_NS )
+{
+    const std::size_t   limit   = std::max<std::size_t>( src.get_queue_capacity(), frames.size() );
+    const std::int64_t  start   = steady_ns();
+    std::size_t         total   = 0ULL;
+    auto                more    = [&](void) { return total < limit  &&  steady_ns() - start < budget_ns; };
+
+    //      1.      BINARY FRAMES  [ fixed offsets, no allocation;  one ring claim per batch ].
+    for (std::size_t n = 0ULL; more()  &&  (n = src.try_receive_many(frames)) > 0ULL; total += n)
+    {
+        const std::int64_t      recv_ns     = steady_ns();
+        for (std::size_t k = 0ULL; k < n; ++k) {
+            if ( auto packet = decode_packet(frames[k].version, frames[k].bytes(), mutual_exclusion) )
+                { on_packet(*packet, frames[k].t_read_ns, recv_ns); }
+        }
+    }
+
+    //      2.      JSON LINES  [ fallback for scripts without "--binary" ].
+    for (std::size_t n = 0ULL; more()  &&  (n = src.try_receive_many(lines)) > 0ULL; total += n)
+    {
+        const std::int64_t      recv_ns     = steady_ns();
+        for (std::size_t k = 0ULL; k < n; ++k) {
+            if ( auto packet = parse_packet(lines[k].text, mutual_exclusion) )
+                { on_packet(*packet, lines[k].t_read_ns, recv_ns); }
+        }
+    }
+    return total;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_SYNTHETIC_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
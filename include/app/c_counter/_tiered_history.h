@@ -0,0 +1,234 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****      _ T I E R E D _ H I S T O R Y . H  ____  F I L E      ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*              MODULE:      CBAPP > CCOUNTER/           | _tiered_history.h
+*
+*       ********************************************************************
+*                FILE:      [include/app/c_counter/_tiered_history.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_COUNTER_TIERED_HISTORY_H
+#define _CBAPP_COUNTER_TIERED_HISTORY_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//      0.1.        ** MY **  HEADERS...
+#include "cblib.h"
+
+
+//      0.2         STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include <array>
+#include <algorithm>
+
+
+//      0.3         "DEAR IMGUI" HEADERS...
+#include "imgui.h"
+
+
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                         TieredHistory:
+//                 Rolled-Up Long History of One Counter.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "TieredHistory"
+//      Fixed-memory history of one series at several resolutions, so hours of data stay plottable while the raw
+//      ring ("CCounterApp::m_buffers") only keeps the most recent samples.
+//
+//      -   Tiers:      buckets of 1 s, 10 s and 1 min (see "ms_TIERS"), each holding count / sum / min / max of the
+//                      samples whose time falls inside it.  Every tier is fed straight from "push", O(1) per tier.
+//      -   Series:     each tier also keeps an  (x = bucket centre, y = mean)  ring in the plot buffer type, so the
+//                      plotting / decimation path takes a tier exactly like the raw ring.  The newest (still open)
+//                      bucket is the last element and is updated in place;  its x is its newest sample until the
+//                      bucket closes (so the line reaches "now"), which keeps the series sorted either way.  That
+//                      close moves an existing point back to its centre, so each close bumps the tier's
+//                      "generation":  callers that cache per-point results (the M4 decimator) must re-scan on a bump.
+//      -   Selection:  "select" picks the finest series whose retained data still reaches back to the left edge
+//                      of the view.
+//
+class TieredHistory
+{
+// *************************************************************************** //
+public:
+    using                               size_type                       = std::size_t;
+    using                               series_type                     = cblib::ndRingBuffer<ImVec2>;
+
+    //  "Bucket"
+    struct Bucket {
+        float                           t0                              = 0.0f;     //  Bucket start.
+        std::uint32_t                   count                           = 0u;
+        double                          sum                             = 0.0;
+        float                           min                             = 0.0f;
+        float                           max                             = 0.0f;
+    };
+    using                               bucket_ring                     = cblib::ndRingBuffer<Bucket>;
+
+    //  "TierSpec"
+    struct TierSpec {
+        float                           width;                                      //  Seconds per bucket.
+        size_type                       capacity;                                   //  Buckets retained.
+    };
+    static constexpr size_type          ms_NUM_TIERS                    = 3ULL;
+    static constexpr std::array<TierSpec, ms_NUM_TIERS>
+                                        ms_TIERS                        = {{
+        {  1.0f     , 3'600ULL  }       //  1 h     at  1 s.
+      , { 10.0f     , 2'160ULL  }       //  6 h     at 10 s.
+      , { 60.0f     , 1'440ULL  }       //  24 h    at  1 min.
+    }};
+    static constexpr size_type          ms_RAW                          = ms_NUM_TIERS;     //  "select" result:  use the raw ring.
+
+// *************************************************************************** //
+protected:
+    struct Tier {
+        series_type                     series                          {   };
+        bucket_ring                     buckets                         {   };
+        std::int64_t                    open                            = 0;        //  Index (t0 / width) of the open bucket.
+        std::uint64_t                   generation                      = 0ULL;     //  Bumped whenever a closed point moved.
+    };
+    std::array<Tier, ms_NUM_TIERS>      m_tiers                         = {   };
+
+// *************************************************************************** //
+public:
+
+    //  "allocate"
+    //      Sizes every tier from "ms_TIERS" (clears everything).
+    inline void                         allocate                        (void)
+    {
+        for (size_type i = 0ULL; i < ms_NUM_TIERS; ++i) {
+            this->m_tiers[i].series .set_capacity( ms_TIERS[i].capacity );
+            this->m_tiers[i].buckets.set_capacity( ms_TIERS[i].capacity );
+        }
+        this->clear();
+        return;
+    }
+
+    //  "clear"
+    inline void                         clear                           (void) noexcept
+    {
+        for (Tier & tier : this->m_tiers)   { tier.series.clear();  tier.buckets.clear();  tier.open = 0; }
+        return;
+    }
+
+
+    //  "push"
+    //      Fold one sample into every tier;  "t" must not decrease.
+    //
+    inline void                         push                            (const float t, const float y)
+    {
+        for (size_type i = 0ULL; i < ms_NUM_TIERS; ++i)
+        {
+            Tier &              tier    = this->m_tiers[i];
+            const float         w       = ms_TIERS[i].width;
+            const std::int64_t  idx     = static_cast<std::int64_t>( std::floor(t / w) );
+
+            if ( tier.buckets.capacity() == 0ULL )      { continue; }
+
+            if ( tier.buckets.empty()  ||  idx != tier.open )       //  1.  Close the open bucket, open a new one.
+            {
+                if ( !tier.series.empty() )
+                    { tier.series.back().x = tier.buckets.back().t0 + 0.5f * w;  ++tier.generation; }
+                tier.open           = idx;
+                tier.buckets.push_back( Bucket{ static_cast<float>(idx) * w, 1u, y, y, y } );
+                tier.series .push_back( ImVec2( t, y ) );
+                continue;
+            }
+
+            Bucket &            b       = tier.buckets.back();      //  2.  Grow the open bucket in place.
+            b.count            += 1u;
+            b.sum              += y;
+            b.min               = std::min(b.min, y);
+            b.max               = std::max(b.max, y);
+            tier.series.back()  = ImVec2( t, static_cast<float>( b.sum / b.count ) );
+        }
+        return;
+    }
+
+
+    //  Queries.
+    [[nodiscard]] inline const series_type &    series                  (const size_type tier) const noexcept   { return this->m_tiers[tier].series;  }
+    [[nodiscard]] inline const bucket_ring &    buckets                 (const size_type tier) const noexcept   { return this->m_tiers[tier].buckets; }
+    [[nodiscard]] inline std::uint64_t          generation              (const size_type tier) const noexcept   { return this->m_tiers[tier].generation; }
+    //
+    //  "bytes"     Heap held by all tiers.
+    [[nodiscard]] inline size_type              bytes                   (void) const noexcept
+    {
+        size_type   n   = 0ULL;
+        for (const Tier & tier : this->m_tiers)
+            { n += tier.series.capacity() * sizeof(ImVec2)  +  tier.buckets.capacity() * sizeof(Bucket); }
+        return n;
+    }
+
+
+    //  "select"
+    //      Finest source whose data reaches back to "xmin":  "ms_RAW" when the raw ring does, else a tier index.
+    //      A ring that never overflowed holds everything since the last clear, so it always qualifies;  when even
+    //      the coarsest tier falls short, that tier is used anyway.
+    //
+    [[nodiscard]] inline size_type              select                  (const series_type & raw, const float xmin) const noexcept
+    {
+        if ( reaches(raw, xmin) )       { return ms_RAW; }
+        for (size_type i = 0ULL; i < ms_NUM_TIERS; ++i)
+            { if ( reaches(this->m_tiers[i].series, xmin) )     { return i; } }
+        return ms_NUM_TIERS - 1ULL;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "reaches"
+    [[nodiscard]] static inline bool            reaches                 (const series_type & s, const float xmin) noexcept
+    { return s.size() < s.capacity()  ||  s.empty()  ||  s.front().x <= xmin; }
+
+
+// *************************************************************************** //
+// *************************************************************************** //   END "TieredHistory" CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
+
+
+
+
+
+
+#endif      //  _CBAPP_COUNTER_TIERED_HISTORY_H  //
+// *************************************************************************** //
+// *************************************************************************** //   END.
@@ -30,6 +30,12 @@
 #include "utility/utility.h"
 #include "utility/pystream/pystream.h"
 #include "app/c_counter/_internal.h"
+#include "app/c_counter/_running_stats.h"
+#include "app/c_counter/_decimation.h"
+#include "app/c_counter/_tiered_history.h"
+#include "app/c_counter/_recorder.h"
+#include "app/c_counter/_synthetic.h"
+#include "app/c_counter/_ingest.h"
 
 
 //  0.2     STANDARD LIBRARY HEADERS...
@@ -48,6 +54,7 @@
 #include <stdexcept>        //  <======| ...
 #include <limits.h>
 #include <math.h>
+#include <ctime>
 
 //  0.3     "DEAR IMGUI" HEADERS...
 #include "imgui.h"
@@ -89,6 +96,7 @@ public:
     static constexpr size_t                 ms_BUFFER_SIZE                  = 512ULL;           //  NUM. OF DATA-PACKETS FROM CCOUNTER.
     static constexpr size_t                 ms_NUM                          = 15;               //  NUM. OF CHANNELS.
     static constexpr size_t                 ms_CMD_MSG_SIZE                 = 512ULL;           //  BUFFER-SIZE FOR MESSAGE TO PYSTREAM.        //  formerly: "ms_MSG_BUFFER_SIZE"
+    static constexpr size_t                 ms_RECV_BATCH                   = 32ULL;            //  MESSAGES DRAINED FROM PYSTREAM PER CALL.
     //
     static constexpr auto	                cv_DEF_COOLDOWN_DURATION	    = std::chrono::milliseconds(500);
     
@@ -112,6 +120,10 @@ public:
     using                                   Packet                          = ccounter::CoincidencePacket;
     //
     using                                   ChannelSpec                     = ccounter::ChannelSpec;
+    using                                   RunningStats                    = ccounter::RunningStats;
+    using                                   Decimator                       = ccounter::M4Decimator<ImVec2>;
+    using                                   TieredHistory                   = ccounter::TieredHistory;
+    using                                   Ingestor                        = ccounter::Ingestor<ms_NUM>;
     using                                   Style                           = ccounter::CCounterStyle;
     //
     using                                   PythonCMD                       = ccounter::PythonCMD;                          //  Enums.
@@ -160,8 +172,18 @@ protected:
     std::array<buffer_type, ms_NUM>         m_buffers                       = {      };     //  RAW-DATA values for each counter.
     std::array<buffer_type, ms_NUM>         m_avg_counts                    = {      };     //  AVERAGE values for each counter.
     std::array<float      , ms_NUM>         m_max_counts                    = { 0.0f };     //  MAXIMUM values for each counter.
+    std::array<RunningStats, ms_NUM>        m_stats                         = {      };     //  WINDOWED STATISTICS for each counter (feeds "m_avg_counts").
+    std::array<TieredHistory, ms_NUM>       m_history                       = {      };     //  LONG HISTORY of "m_buffers"     (1 s / 10 s / 1 min buckets).
+    std::array<TieredHistory, ms_NUM>       m_avg_history                   = {      };     //  LONG HISTORY of "m_avg_counts".
     size_t                                  m_num_packets                   = 0ULL;
     //
+    //                                  PLOT DECIMATION  (drawn points follow the plot width, not the history length):
+    mutable std::array<Decimator, ms_NUM>   m_m4_master                     = {      };     //  "m_buffers"     in the master plot.
+    mutable std::array<Decimator, ms_NUM>   m_m4_average                    = {      };     //  "m_avg_counts"  in the master plot.
+    mutable std::array<Decimator, ms_NUM>   m_m4_single                     = {      };     //  "m_buffers"     in each sparkline.
+    std::uint64_t                           m_data_version                  = 0ULL;         //  Bumped by every frame that pushed samples.
+    std::uint64_t                           m_data_generation               = 0ULL;         //  Bumped whenever the buffers are cleared / re-sized.
+    //
     //
     //
     //                                  WIDGET ROWS:
@@ -205,6 +227,18 @@ protected:
     //                                  PYSTREAM:
     utl::PyStream                           m_python                            = {   };    //  utl::PyStream(app::PYTHON_DUMMY_FPGA_FILEPATH);
     uint32_t                                m_child_pid                         = 0U;
+    bool                                    m_binary_stream                     = true;     //  "--binary" frames  (false: JSON lines).
+    std::array<utl::PyStream::BinaryFrame, ms_RECV_BATCH>   m_frames            = {   };    //  re-used for every batch of frames
+    std::array<utl::PyStream::Line, ms_RECV_BATCH>          m_lines             = {   };    //  ... and of lines  (keep their capacity).
+    //
+    //                                  LATENCY  ( "utl::LatencyTracer";  shown in the debugger's "Latency" tab ):
+    utl::LatencyHistogram *                 m_lat_queue                         = &utl::LatencyTracer::instance().histogram("ccounter.queue");     //  pipe read  -> taken off the ring.
+    utl::LatencyHistogram *                 m_lat_ingest                        = &utl::LatencyTracer::instance().histogram("ccounter.ingest");    //  taken      -> decoded, in the plot buffers.
+    utl::LatencyHistogram *                 m_lat_glass                         = &utl::LatencyTracer::instance().histogram("ccounter.glass");     //  pipe read  -> frame presented.
+    //
+    //                                  LOAD TEST:
+    ccounter::SyntheticStream               m_synth                             {   };      //  Built-in packet source  (replaces the script while "m_synthetic_source").
+    bool                                    m_synthetic_source                  = false;
     //
     //                                  PYTHON COMMUNICATION:
     char                                    m_py_message [ms_CMD_MSG_SIZE]      = { '\0' };
@@ -212,7 +246,16 @@ protected:
     //
     //                                  PYTHON PATHS:
     std::filesystem::path                   m_script_filepath                   = {"../../scripts/python/fpga_stream_v3.py"};
-    std::filesystem::path                   m_output_filepath                   = {   };
+    std::filesystem::path                   m_output_filepath                   = {   };    //  empty:  "ccounter_<date>_<time>.ccrec".
+    //
+    //                                  IN-PROCESS RECORDING / REPLAY:
+    ccounter::Recorder                      m_recorder                          {   };
+    ccounter::ReplaySource                  m_replay                            {   };
+    char                                    m_replay_path [ms_CMD_MSG_SIZE]     = { '\0' };
+    ccounter::ReplaySource::Speed           m_replay_speed                      = ccounter::ReplaySource::Speed::Realtime;
+    Param<double>                           m_replay_factor                     = { 10.0,   {1.0        , 1000.0 }  };
+    float                                   m_replay_x0                         = 0.0f;     //  Plot time at which the replay started.
+    bool                                    m_replay_data                       = false;    //  The plots hold replayed packets.
     //
     //
     //
@@ -249,7 +292,7 @@ protected:
     //
     //                                  PLOT-APPEARANCE STUFF:
     float                                   ms_CENTER                       = 0.95f;
-    Param<double>                           m_history_length                = { 30.0f,  {5.0f,   90.0}  };
+    Param<double>                           m_history_length                = { 30.0f,  {5.0f,   86'400.0}  };   //  Up to 24 h  (see "TieredHistory").
     float                                   m_last_packet_time              = 0.0f;                             //  time of last data arrival
     float                                   m_freeze_xmin                   = 0.0f;                             //  cached limits when paused
     float                                   m_freeze_xmax                   = 0.0f;
@@ -495,8 +538,6 @@ protected:
     //                              "_MECH" HELPER FUNCTIONS:
     inline void                         _FetchData                          (void) noexcept;
     //
-    inline float                        ComputeAverage                      (const buffer_type &, AvgMode , ImU64 , double , float ) const;
-    //
     //
     //
     //                              DEPRICATED:
@@ -515,7 +556,9 @@ protected:
     //
     //                              PLOTTING UTILITIES:
     template<typename RB = buffer_type>
-    inline void                         plot_sparkline                      (const RB & , const ImVec4 & , const ImVec2 , const float , const float , const float , const ImPlotAxisFlags) const noexcept;
+    inline void                         plot_sparkline                      (const RB & , Decimator & , const std::uint64_t , const ImVec4 & , const ImVec2 , const float , const float , const float , const ImPlotAxisFlags) const noexcept;
+    inline std::pair<const buffer_type *, std::uint64_t>
+                                        _plot_source                        (const buffer_type & , const TieredHistory & , const float ) const noexcept;
 
         
     // *************************************************************************** //
@@ -604,7 +647,7 @@ protected:
         
         if ( this->m_process_running )
         {
-            status = this->m_python.send(this->m_py_message);
+            status = (this->m_synthetic_source)     ? this->m_synth.send(this->m_py_message)    : this->m_python.send(this->m_py_message);
         }
         else {
             //  this->S.m_logger.warning("[[CCounter]] failed to deliver message to PyStream -- process not running");
@@ -633,6 +676,14 @@ protected:
         
         if ( !this->m_process_running )
         {
+            //      A live run never appends to a replay:  its packets would land at earlier x than the replayed ones.
+            if ( this->m_replay.active()  ||  this->m_replay_data ) {
+                this->m_replay.stop();
+                this->_clear_plot_data();
+                this->_reset_average_values();
+                this->m_num_packets     = 0ULL;
+            }
+            
             const bool      spawned     = this->_start_process_IMPL();
             
             if ( !spawned ) {
@@ -685,6 +736,7 @@ protected:
         //      CASE 1 :    *PAUSE* RECORDING  [ stop playback but leave recording status ].
         if (pause) {
             this->m_python.stop();
+            this->m_synth.stop();
             this->m_process_running         = false;
             return;
         }
@@ -692,6 +744,7 @@ protected:
         //      CASE 2 :    CEASE PLAYBACK *AND* FINALIZE RECORDING...
         else {
             this->m_python.stop();
+            this->m_synth.stop();
             this->m_process_running         = false;
             this->_stop_recording();
         }
@@ -701,24 +754,81 @@ protected:
     
     
     //  "_start_recording"
-    inline bool                             _start_recording                    (void) noexcept {
-    
-        //  if (this->m_process_running) {
-        //
-        //  }
+    //      Record every packet "_FetchData" receives (in-process;  see "ccounter::Recorder").
+    inline bool                             _start_recording                    (void) noexcept
+    {
+        namespace                   cc          = ccounter;
+        std::filesystem::path       path        = this->m_output_filepath;
         
+        if ( this->m_recorder.is_open() )       { this->m_process_recording = true;  return true; }
+        
+        //      1.      DEFAULT FILE NAME  "ccounter_YYYYMMDD_HHMMSS.ccrec"  (working directory)...
+        if ( path.empty() ) {
+            char                name [64]   = { '\0' };
+            const std::time_t   now         = std::time(nullptr);
+            std::strftime( name, sizeof(name), "ccounter_%Y%m%d_%H%M%S.ccrec", std::localtime(&now) );
+            path                            = name;
+        }
+        
+        //      2.      OPEN...
+        if ( !this->m_recorder.open(path, cc::RecordCodec::Delta, (this->m_use_mutex_count) ? cc::REC_FLAG_MUTEX : 0U) ) {
+            this->S.m_logger.error( std::format("[[CCounter]] unable to open recording file \"{}\"", path.string()) );
+            return false;
+        }
+        this->S.m_logger.info( std::format("[[CCounter]] recording to \"{}\"", path.string()) );
         this->m_process_recording = true;
         return true;
     }
     
     
     //  "_stop_recording"
-    inline void                             _stop_recording                     (void) noexcept {
+    inline void                             _stop_recording                     (void) noexcept
+    {
         this->m_process_recording = false;
+        if ( !this->m_recorder.is_open() )      { return; }
+        
+        this->m_recorder.close();
+        const auto      stats       = this->m_recorder.stats();
+        this->S.m_logger.info( std::format(
+              "[[CCounter]] recorded {} packets to \"{}\" ({} chunks, {} bytes, {:.1f}x smaller than raw, {} writer stalls{})"
+            , stats.packets,    this->m_recorder.path().string(),   stats.chunks,   stats.file_bytes
+            , (stats.file_bytes > 0ULL)     ? static_cast<double>(stats.raw_bytes) / static_cast<double>(stats.file_bytes)   : 0.0
+            , stats.stalls,     (stats.failed)  ? ", WRITE ERRORS"  : ""
+        ));
         return;
     }
     
     
+    //  "_start_replay"
+    //      Feed the recording at "m_replay_path" back through "_FetchData", starting from empty plots.
+    inline bool                             _start_replay                       (void) noexcept
+    {
+        namespace                   cc          = ccounter;
+        const std::filesystem::path path        { this->m_replay_path };
+        
+        if ( path.empty()  ||  !this->m_replay.open(path) ) {
+            this->S.m_logger.warning( std::format("[[CCounter]] unable to open recording \"{}\"", path.string()) );
+            return false;
+        }
+        
+        this->_clear_plot_data();
+        this->_reset_average_values();
+        this->m_num_packets     = 0ULL;
+        this->m_replay_x0       = static_cast<float>( ImGui::GetTime() );
+        this->m_replay_data     = true;
+        this->m_replay.start( this->m_replay_speed, this->m_replay_factor.Value() );
+        this->S.m_logger.info( std::format(
+              "[[CCounter]] replaying {} packets from \"{}\" at {} ({} counts)"
+            , this->m_replay.stats().total, path.string()
+            , (this->m_replay_speed == cc::ReplaySource::Speed::Scaled)
+                ? std::format("{:.0f}x", this->m_replay_factor.Value())
+                : cc::ReplaySource::ms_SPEED_NAMES[ static_cast<size_t>(this->m_replay_speed) ]
+            , (this->m_replay.flags() & cc::REC_FLAG_MUTEX)     ? "mutual-exclusion"    : "non-mutex"
+        ));
+        return true;
+    }
+    
+    
     //  "_clear_all"
     inline void                             _clear_all                          (void) noexcept
     {
@@ -745,6 +855,9 @@ protected:
     inline void                             _clear_plot_data                    (void) noexcept
     {
         for (auto & b : this->m_buffers)      { b.clear(); }   //b.Erase();
+        for (auto & h : this->m_history)      { h.clear(); }
+        ++this->m_data_generation;
+        this->m_replay_data     = false;
         this->_reset_max_values();
         
         return;
@@ -764,6 +877,9 @@ protected:
         for (auto & vec : m_avg_counts) {
             vec.clear();    //  b.Erase();
         }
+        for (auto & stats : m_stats)    { stats.clear(); }
+        for (auto & h : m_avg_history)  { h.clear(); }
+        ++this->m_data_generation;
         return;
     }
     
@@ -814,12 +930,33 @@ protected:
         bool            spawned     = false;
         
         
+        //      0.      LOAD TEST:  NO CHILD PROCESS, THE BUILT-IN SOURCE FEEDS THE SAME RINGS...
+        if ( this->m_synthetic_source )
+        {
+            this->m_synth.set_framing( (this->m_binary_stream)      ? utl::PyStream::Framing::Binary    : utl::PyStream::Framing::Lines );
+            this->m_synth.set_queue_capacity( this->m_python.get_queue_capacity() );
+            this->m_process_running     = this->m_synth.start();
+            this->S.m_logger.info( std::format(
+                  "[[CCounter]] started synthetic source ({:.0f} packets/s, {}, {})"
+                , this->m_synth.get_rate()
+                , cc::SyntheticStream::ms_PATTERN_NAMES[ static_cast<size_t>(this->m_synth.get_pattern()) ]
+                , (this->m_binary_stream)       ? "binary frames"   : "JSON lines"
+            ) );
+            return this->m_process_running;
+        }
+        
+        
         // OPTIONAL:    configure before start()
         //
         //      this->m_python.set_python_executable("/path/to/venv/bin/python");
         //      this->m_python.set_working_directory("/path/to/project");
         //      this->m_python.set_filepath("/path/to/script.py");
         //      this->m_python.set_args({ "-u", "--flag", "value" });
+        try {
+            this->m_python.set_framing( (this->m_binary_stream)     ? utl::PyStream::Framing::Binary    : utl::PyStream::Framing::Lines );
+            this->m_python.set_args( (this->m_binary_stream)        ? std::vector<std::string>{ "--binary" }    : std::vector<std::string>{} );
+        }
+        catch (const std::exception & e)                { header = "ERROR";  body = std::format( "logic_error: {}\n", e.what() );  return false; }
 
     
     
@@ -906,7 +1043,11 @@ protected:
         {
             this->m_buffers[i]      .set_capacity(buffer_size);     //  1.  MAIN COUNTER DATA.
             this->m_avg_counts[i]   .set_capacity(buffer_size);     //  2.  AVG-VALUE DATA.
+            this->m_stats[i]        .set_capacity(buffer_size);     //  3.  RUNNING STATISTICS (same reach as the plot).
+            this->m_history[i]      .allocate();                    //  4.  ROLLED-UP HISTORY (fixed size).
+            this->m_avg_history[i]  .allocate();
         }
+        ++this->m_data_generation;
         
         
         {
@@ -918,6 +1059,11 @@ protected:
                 , buffer_size
                 , buff_bytes
             ));
+            this->S.m_logger.info( std::format(
+                  "[[CCounter]] allocated {} history tiers ({} bytes)"
+                , 2 * CCounterApp::ms_NUM
+                , 2ULL * CCounterApp::ms_NUM * this->m_history[0].bytes()
+            ));
         }
         return;
     }
@@ -225,6 +225,7 @@ protected:
     //      "Orchid" TESTING FUNCTIONS.         |   "unit_testing.cpp" ...
     // *************************************************************************** //
     void                                TestOrchid                          (void) noexcept;
+    void                                TestOrchidHistory                   (void) noexcept;
     
     
     // *************************************************************************** //
@@ -234,6 +235,27 @@ protected:
     //      "ndRingBuffer" TESTING FUNCTIONS.   |   "unit_testing.cpp" ...
     // *************************************************************************** //
     void                                TestndRingBuffer                    (void) noexcept;
+    void                                TestFDTDRasterizer                  (void) noexcept;
+    
+    
+    // *************************************************************************** //
+    //
+    //
+    // *************************************************************************** //
+    //      BENCHMARKING FUNCTIONS.             |   "benchmarks.cpp" ...
+    // *************************************************************************** //
+    void                                BenchmarkFFT                        (void) noexcept;
+    void                                BenchmarkYeeKernels                 (void) noexcept;
+    void                                BenchmarkThreadScaling              (void) noexcept;
+    
+    
+    // *************************************************************************** //
+    //
+    //
+    // *************************************************************************** //
+    //      LATENCY FUNCTIONS.                  |   "benchmarks.cpp" ...
+    // *************************************************************************** //
+    void                                LatencyPanel                        (void) noexcept;
     
     
     
@@ -44,6 +44,8 @@
 #include <string>           //  <======| std::string, ...
 #include <string_view>
 #include <vector>           //  <======| std::vector, ...
+#include <memory>
+#include <atomic>
 #include <stdexcept>        //  <======| ...
 #include <limits.h>
 #include <math.h>
@@ -116,6 +118,25 @@ protected:
     //  MISC APPLICATION STUFF...
     bool                                            m_initialized                   = false;
     
+    //                                          2.  2D FDTD RUN  (the drawn scene, rasterized into an "FDTD_2D")...
+    struct FDTDRun {
+        //  "Ticket"    Shared with the queued task:  whichever of the task and "destroy" claims it first wins, so a
+        //              task the scheduler skips (or that "destroy" discards) can never leave anybody waiting.
+        struct Ticket {
+            std::atomic<bool>                               claimed         { false };
+            std::atomic<bool>                               done            { false };
+        };
+    //
+        std::unique_ptr< fdtd::SceneRasterizer<double> >    scene;
+        std::unique_ptr< fdtd::FDTD_2D<double> >            engine;
+        std::shared_ptr<Ticket>                             ticket;                     //  Last run;  "nullptr" before the first.
+        utl::CancelToken                                    token;
+        double                                              cell            = 4.0;      //  World units per cell.
+        int                                                 steps           = 400;
+        std::vector<double>                                 Ez;                         //  Snapshot after the last run.
+        double                                              Ez_max          = 0.0;
+    }                                               m_fdtd;
+    
     //                                          3.  SUBSIDIARY WINDOWS...
     app::WinInfo                                    m_detview_window                = {
                                                         "Editor Controls",
@@ -142,6 +163,9 @@ protected:
     void                display_controls                (void);
     
     
+    void                display_fdtd                    (void);
+    
+    
     //  2C.1        Utility Functions...
     //                  ...
     
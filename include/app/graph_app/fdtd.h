@@ -71,6 +71,23 @@
 #endif     /*     _GLIBCXX_TYPEINFO    */
 
 
+#ifndef _CB_FDTD_FFT_H
+#    include "fdtd/_fft.h"
+#endif     /*     _CB_FDTD_FFT_H    */
+
+#ifndef _CB_FDTD_FRAME_SINK_H
+#    include "fdtd/_frame_sink.h"
+#endif     /*     _CB_FDTD_FRAME_SINK_H    */
+
+#ifndef _CB_FDTD_KERNELS_H
+#    include "fdtd/_kernels.h"
+#endif     /*     _CB_FDTD_KERNELS_H    */
+
+#ifndef _CB_FDTD_WORKER_POOL_H
+#    include "fdtd/_worker_pool.h"
+#endif     /*     _CB_FDTD_WORKER_POOL_H    */
+
+
 //  #ifndef _CB_FDTD_SOURCES_H
 //  #    include <sources.h>
 //  #endif /*    _CB_FDTD_SOURCES_H    */
@@ -135,6 +152,7 @@ namespace cb { //     BEGINNING NAMESPACE "cb"...
 
 //    "real_DFT"
 //    Compute Discrete Fourier Transform (DFT) of a real-signal.
+//    O(N^2) reference implementation.  Use "fdtd::real_FFT" (fdtd/_fft.h) for anything performance-sensitive.
 //
 //        "sig_t"         ===>    time-domain signal.
 //        "sig_f"            ===>     frequency-domain signal.
@@ -222,9 +240,10 @@ normalised_freq_axis(std::size_t N)
 /*---------------------------------------------------------------------
     build_spectrum_frames ––
     Given NT time‑domain frames (each length NX), compute for each frame:
-        1) DFT of the real signal (complex bins)
+        1) FFT of the real signal (N/2 + 1 complex bins)
         2) Normalise magnitudes → [0,1]
-    Returns NT × NX real‑valued matrix (vector< vector<T> >).
+    Returns NT × (NX/2 + 1) real‑valued matrix (vector< vector<T> >),
+    matching "normalised_freq_axis(NX)".
 ---------------------------------------------------------------------*/
 template< typename T >
 inline std::vector< std::vector<T> >
@@ -234,13 +253,18 @@ build_spectrum_frames(const std::vector< std::vector<T> > & time_frames)
 
     std::vector< std::vector<T> > spec_frames;
     spec_frames.reserve(time_frames.size());
+    if ( time_frames.empty() )  { return spec_frames; }
+
+    const fdtd::RealFFT<T> &                plan    = fdtd::get_real_fft_plan<T>( time_frames.front().size() );
+    typename fdtd::RealFFT<T>::Workspace    ws;
+    std::vector<complex_t>                  sig_f   ( plan.bins() );
 
     for (const auto & sig_t : time_frames) {
-        auto sig_f  = real_DFT<T, complex_t>(sig_t);             // complex bins
+        plan.forward(sig_t.data(), sig_f.data(), ws);           // complex bins
         auto mags   = normalize_spectrum<complex_t>(sig_f);      // real [0,1]
         spec_frames.emplace_back(std::move(mags));               // store frame
     }
-    return spec_frames;      // NT frames, each size NX
+    return spec_frames;      // NT frames, each size NX/2 + 1
 }
 
 
@@ -277,7 +301,12 @@ struct grid_1D {
     using     complex_t             = std::complex<value_type>;
     using     re_array             = std::vector<value_type>;
     using     im_array             = std::vector<complex_t>;
+    using     re_view              = std::span<value_type>;
+    using     arena_t              = fdtd::AlignedArena<value_type>;
     using     sbyte                 = std::int_fast8_t;
+    
+    //  Slots of the real-valued field arrays inside "m_arena".
+    enum Slot : size_type { EZ = 0, HY, CEZE, CEZH, CHYE, CHYH, NUM_SLOTS };
 // *************************************************************************** //
 
 // *************************************************************************** //
@@ -285,10 +314,11 @@ struct grid_1D {
     //    Default Constructor.
     //
     inline grid_1D(void) :
-        m_Ez(N, 0.0f),                          m_Hy(N, 0.0f),
+        m_arena(NUM_SLOTS, N),
+        m_Ez(m_arena.span(EZ)),                 m_Hy(m_arena.span(HY)),
         m_eps_r(N, complex_t(0.0f, 0.0f)),      m_mu_r(N, complex_t(0.0f, 0.0f)),
-        m_cezE(N, 0.0f),                        m_cezH(N, 0.0f),
-        m_chyE(N, 0.0f),                        m_chyH(N, 0.0f)
+        m_cezE(m_arena.span(CEZE)),             m_cezH(m_arena.span(CEZH)),
+        m_chyE(m_arena.span(CHYE)),             m_chyH(m_arena.span(CHYH))
     {
         for (std::size_t m = 0ULL; m < N; ++m) {
             this->m_Ez[m]         = 0.0f;
@@ -305,10 +335,15 @@ struct grid_1D {
 
     //    Copy Constructor.
     //
+    //        Deep-copies the arena, then re-seats every view onto the NEW storage.
+    //
     inline grid_1D(const grid_1D & src) :
-                   m_Ez(src.m_Ez),         m_Hy(src.m_Hy),         m_eps_r(src.m_eps_r),
-                m_mu_r(src.m_mu_r),        m_cezE(src.m_cezE),        m_cezH(src.m_cezH),
-                m_chyE(src.m_chyE),        m_chyH(src.m_chyH)        {}
+                m_arena(src.m_arena),
+                m_Ez(m_arena.span(EZ)),    m_Hy(m_arena.span(HY)),    m_eps_r(src.m_eps_r),
+                m_mu_r(src.m_mu_r),        m_cezE(m_arena.span(CEZE)), m_cezH(m_arena.span(CEZH)),
+                m_chyE(m_arena.span(CHYE)), m_chyH(m_arena.span(CHYH))  {}
+    
+    inline grid_1D & operator = (const grid_1D & )      = delete;
 
     //    Default Destructor.
     //
@@ -316,10 +351,12 @@ struct grid_1D {
 
 
 //    Data-Members...
+//        Fields and update coefficients are views into ONE aligned, padded arena (see "fdtd::yee_update").
 // *************************************************************************** //
-    re_array        m_Ez,       m_Hy;
+    arena_t         m_arena;
+    re_view         m_Ez,       m_Hy;
     im_array        m_eps_r,    m_mu_r;
-    re_array        m_cezE,        m_cezH,        m_chyE,        m_chyH;
+    re_view         m_cezE,        m_cezH,        m_chyE,        m_chyH;
 // *************************************************************************** //
 
 //    END GRID_1D INLINE STRUCT DEFINITION.
@@ -363,6 +400,11 @@ public:
     using       typename        base::re_array                      ;
     using       typename        base::im_array;
     using       re_frame        = std::vector<re_array>             ;       using       im_frame            = std::vector<im_array>;
+    using       sink_t          = fdtd::FrameSink<value_type>       ;       using       sink_ptr            = std::unique_ptr<sink_t>;
+    using       pool_t          = fdtd::WorkerPool                  ;       using       pool_ptr            = std::unique_ptr<pool_t>;
+//
+    static constexpr size_type          ms_MIN_CHUNK            = 8192ULL;                          //  Fewest cells worth a worker.
+    static constexpr size_type          ms_LINE                 = 64ULL / sizeof(value_type);       //  Chunk alignment (one cache line).
 
 // *************************************************************************** //
 //
@@ -377,9 +419,8 @@ protected:
 
     std::array<value_type, NT>          m_time;
     re_array                            m_xvals;
-    re_frame                            m_Hy_T,                 m_Ez_T,
-                                        m_Hy_F_NORM,            m_Ez_F_NORM;
-    im_frame                            m_Hy_F,                 m_Ez_F;
+    sink_ptr                            m_sink;                 //  Decides which time-steps (and spectra) are kept.
+    pool_ptr                            m_pool;                 //  Persistent workers:  one dispatch per half-step.
     
 
     const size_type                     m_src_pos               = 2ULL;//2ULL;
@@ -407,11 +448,10 @@ public:
 
     //    Default Constructor.
     //
-    inline FDTD_1D(void) noexcept : base(),
+    inline FDTD_1D(void) : base(),
         m_xvals(NX, 0.0f),
-        m_Hy_T( NT, re_array(NX, 0.0f) ),                           m_Ez_T( NT, re_array(NX, 0.0f) ),
-        m_Hy_F_NORM( NT, re_array(NX, 0.0f) ),                      m_Ez_F_NORM( NT, re_array(NX, 0.0f) ),
-        m_Hy_F( NT, im_array(NX, complex_t(0.0f, 0.0f)) ),          m_Ez_F( NT, im_array(NX, complex_t(0.0f, 0.0f)) )
+        m_sink( fdtd::make_frame_sink<value_type>( {} ) ),
+        m_pool( std::make_unique<pool_t>( useful_threads( fdtd::default_thread_count() ) ) )
     {
         //this->m_material_width     = size_type(4*this->m_wavelen / ( std::sqrt(this->m_perm) )) - 1;
     
@@ -453,18 +493,10 @@ public:
 
 
     //    Copy Constructor.
+    //        Deleted: recorded frames are owned by a (possibly disk-backed) sink.
     //
-#ifndef _CBAPP_DISABLE_FDTD_FILE_IO
-    inline FDTD_1D(const FDTD_1D & src) noexcept :
-            base(src),                 m_filename(src.m_filename),
-            m_Hy_T(src.m_Hy_T),     m_Ez_T(src.m_Ez_T) {}
-//
-# else
-//
-    inline FDTD_1D(const FDTD_1D & src) noexcept :
-        base(src),                  m_Hy_T(src.m_Hy_T),
-        m_Ez_T(src.m_Ez_T) {}
-#endif  //  _CBAPP_DISABLE_FDTD_FILE_IO  //
+    inline FDTD_1D(const FDTD_1D & src)                         = delete;
+    inline FDTD_1D & operator = (const FDTD_1D & src)           = delete;
 
 
     //    Default Destructor.
@@ -501,17 +533,8 @@ private:
         for (size_type m = 0ULL; m < NX; ++m)
             this->m_xvals[m] = m;
 
-        for (size_type q = 0; q < NT; ++q) {//    INITIALIZE  Hy(t), Ez(t)  TO ZERO.
+        for (size_type q = 0; q < NT; ++q)//    INITIALIZE TIME-VALS.
             this->m_time[q] = q;
-
-            for (size_type m = 0; m < NX; ++m) {
-                this->m_Hy_T[q][m] = 0.0f;
-                this->m_Ez_T[q][m] = 0.0f;
-
-                this->m_Hy_F[q][m] = complex_t(0.0, 0.0);
-                this->m_Ez_F[q][m] = complex_t(0.0, 0.0);
-            }
-        }
         
     #ifndef _CBAPP_DISABLE_FDTD_FILE_IO
         this->m_footer = binary_footer( {{NX, 1ULL, 1ULL, NT}, {1.0f, 0.0f, 0.0f, 1.0f}},
@@ -789,27 +812,37 @@ protected:
     }
 
     //    "update_H"
+    //        Hy[m] = chyH[m]*Hy[m] + chyE[m]*(Ez[m+1] - Ez[m]),   m in [0, NX-1).     SIMD path chosen at run-time.
+    //        Split into cache-line aligned chunks across the worker pool;  returns once every chunk is done.
     //
     inline void update_H(void)
     {
-        //base::m_Hy[NX-2]     = base::m_Hy[NX-1];
-        for (size_type m = 0ULL; m < NX-1; ++m) {
-                base::m_Hy[m] = base::m_chyH[m] * base::m_Hy[m] +
-                                base::m_chyE[m] * (base::m_Ez[m + 1] - base::m_Ez[m]);
-        }
-
+        const fdtd::SimdLevel   lvl     = fdtd::simd_level();
+        value_type *            Hy      = base::m_Hy.data();
+        const value_type *      Ez      = base::m_Ez.data();
+        const value_type *      chyH    = base::m_chyH.data();
+        const value_type *      chyE    = base::m_chyE.data();
+
+        this->m_pool->parallel_for(NX - 1ULL, [=](const size_type b, const size_type e) {
+            fdtd::yee_update(Hy + b, chyH + b, chyE + b, Ez + b + 1ULL, Ez + b, e - b, lvl);
+        }, ms_MIN_CHUNK, ms_LINE);
         return;
     }
 
     //    "update_E"
+    //        Ez[m] = cezE[m]*Ez[m] + cezH[m]*(Hy[m] - Hy[m-1]),   m in [1, NX-1).
     //
     inline void update_E(void)
     {
-        for (size_type m = 1ULL; m < NX-1; ++m) {
-                base::m_Ez[m] = base::m_cezE[m] * base::m_Ez[m] +
-                                base::m_cezH[m] * (base::m_Hy[m] - base::m_Hy[m - 1]);
-        }
-
+        const fdtd::SimdLevel   lvl     = fdtd::simd_level();
+        value_type *            Ez      = base::m_Ez.data()     + 1;
+        const value_type *      Hy      = base::m_Hy.data()     + 1;
+        const value_type *      cezE    = base::m_cezE.data()   + 1;
+        const value_type *      cezH    = base::m_cezH.data()   + 1;
+
+        this->m_pool->parallel_for(NX - 2ULL, [=](const size_type b, const size_type e) {
+            fdtd::yee_update(Ez + b, cezE + b, cezH + b, Hy + b, Hy + b - 1, e - b, lvl);
+        }, ms_MIN_CHUNK, ms_LINE);
         return;
     }
 
@@ -921,6 +954,7 @@ protected:
     }
 
 
+
 // *************************************************************************** //
 //
 //
@@ -929,17 +963,39 @@ protected:
 // *************************************************************************** //
 public:
 
-    //  "get_E_time_data"
+    //  "get_sink"
+    //      Recorded frames: time-domain fields and normalised spectra.     Read only after "run" has returned.
+    //
+    inline const sink_t & get_sink(void) const noexcept {
+        return *this->m_sink;
+    }
+    
+    //  "set_frame_sink"
+    //      Choose what "run" keeps.    Must NOT be called while "run" is executing.
+    //
+    inline void set_frame_sink(sink_ptr sink) {
+        if (!sink)  { throw std::invalid_argument("FDTD_1D: frame sink cannot be \"nullptr\"."); }
+        this->m_sink = std::move(sink);
+    }
+
+    //  "set_threads"
+    //      Size of the worker pool (caller included), capped so no worker gets fewer than "ms_MIN_CHUNK" cells.
+    //      Must NOT be called while "run" is executing.
+    //
+    inline void set_threads(const size_type n) {
+        this->m_pool = std::make_unique<pool_t>( useful_threads(n) );
+    }
+    
+    //  "threads"
     //
-    inline re_frame * get_E_time_data(void) {
-        return std::addressof( this->m_Ez_T );
+    inline size_type threads(void) const noexcept {
+        return this->m_pool->size();
     }
     
-    //  "get_E_freq_data"
+    //  "useful_threads"
     //
-    inline re_frame * get_E_freq_data(void) {
-        return std::addressof( this->m_Ez_F_NORM );
-        //return std::addressof( this->m_Ez_F );
+    static constexpr size_type useful_threads(const size_type n) noexcept {
+        return std::clamp<size_type>( NX / ms_MIN_CHUNK, 1ULL, std::max<size_type>(n, 1ULL) );
     }
 
     //  "get_fourier_freqs"
@@ -979,10 +1035,19 @@ public:
     //    "run"
     //
     inline void run(void)
+    { this->run( []() noexcept { return false; } ); return; }
+
+
+    //    "run"
+    //        Polls "stop_requested()" once per time-step;  returns false (skipping the sink's "end" and the file
+    //        write) when it fires, so a background run can be abandoned at shutdown.
+    //
+    template< typename Stop >
+    inline bool run(Stop && stop_requested)
     {
         //static_assert(0 <= m_TFSF_boundary && m_TFSF_boundary < NX);
         
-        size_type        m = 0ULL,     q = 0ULL;
+        size_type        q = 0ULL;
         this->init_grid();
         
         
@@ -993,11 +1058,14 @@ public:
         
         //  this->create_film(210ULL, 25);
         //  this->create_film(350ULL, 25);
+        this->m_sink->begin(NX, NT);
 
 
         //    MAIN FDTD LOOP...
         for (q=0ULL; q < NT; ++q)
         {
+            if ( stop_requested() )     { return false; }
+            
             //    1.    SIMULATE...
             this->abc_1();
             this->update_H();
@@ -1005,19 +1073,10 @@ public:
             this->abc_2();
             this->update_E();
 
-            //    2.    COPYING DATA...
-            for (m = 0ULL; m < NX; ++m) {
-                this->m_Ez_T[q][m] = base::m_Ez[m];
-                this->m_Hy_T[q][m] = base::m_Hy[m];
-            }
-        }
-
-
-        //    3.    COMPUTING DISCRETE FOURIER TRANSFORM...
-        for (q = 0ULL; q < NT; ++q) {
-            this->m_Hy_F[q] = real_DFT<value_type>(this->m_Hy_T[q]);
-            this->m_Ez_F[q] = real_DFT<value_type>(this->m_Ez_T[q]);
+            //    2.    HAND THE STEP TO THE SINK  (it decides what to keep;  spectra of kept frames run in parallel in "end")...
+            this->m_sink->push( q, base::m_Ez.data(), base::m_Hy.data() );
         }
+        this->m_sink->end( this->m_pool.get() );
 
     
         //    Wrapping up simulation and saving data...
@@ -1028,15 +1087,7 @@ public:
     #endif  //  _CBAPP_DISABLE_FDTD_FILE_IO  //
     
     
-        // 4. NORMALISE DFT magnitudes (real, 0‒1) -------------------------
-        for (q = 0ULL; q < NT; ++q) {
-            m_Hy_F_NORM[q] = normalize_spectrum<complex_t>( m_Hy_F[q] );
-            m_Ez_F_NORM[q] = normalize_spectrum<complex_t>( m_Ez_F[q] );
-        }
-    
-    
-    
-        return;
+        return true;
     }
 
 
@@ -1044,8 +1095,9 @@ public:
     //
     inline void barebones(void)
     {
-        size_type        m = 0ULL,     q = 0ULL;
+        size_type        q = 0ULL;
         this->init_grid();
+        this->m_sink->begin(NX, NT);
 
         //    MAIN FDTD LOOP...
         for (q=0ULL; q < NT; ++q)
@@ -1058,19 +1110,10 @@ public:
             this->update_E();
             this->hard_source(q);
 
-            //    2.    COPYING DATA...
-            for (m = 0ULL; m < NX; ++m) {
-                this->m_Ez_T[q][m] = base::m_Ez[m];
-                this->m_Hy_T[q][m] = base::m_Hy[m];
-            }
-        }
-
-
-        //    3.    COMPUTING DISCRETE FOURIER TRANSFORM...
-        for (q = 0ULL; q < NT; ++q) {
-            this->m_Hy_F[q] = real_DFT<value_type, NX>(this->m_Hy_T[q]);
-            this->m_Ez_F[q] = real_DFT<value_type, NX>(this->m_Ez_T[q]);
+            //    2.    HAND THE STEP TO THE SINK...
+            this->m_sink->push( q, base::m_Ez.data(), base::m_Hy.data() );
         }
+        this->m_sink->end( this->m_pool.get() );
 
         //    Wrapping up simulation and saving data...
     #ifndef _CBAPP_DISABLE_FDTD_FILE_IO
@@ -171,6 +171,7 @@ public:
         { 20,               { 1,         100}               },                              //  Wavelength
         { 8,                { 1,         500}               },                              //  Duration
     };
+    fdtd::FrameSinkCFG                              m_frame_sink_cfg                = {};                   //  Which time-steps the solver retains.
     //
     FDTD_t                                          ms_model                        = cb::FDTD_1D<NX, NT, double>();
     NEW_FDTD_t		                                ms_simulation                   = NEW_FDTD_t();
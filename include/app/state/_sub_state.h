@@ -224,6 +224,10 @@ struct MenuState_t
     
     //  "Orchid" Operation Functions...
     inline void                                 orchid_push             (OrchidAction && act) noexcept      { this->m_orchid.push( std::move(act) );    }
+    template< typename A, typename... Args >
+    inline void                                 orchid_emplace          (Args &&... args)                   { this->m_orchid.template emplace<A>( std::forward<Args>(args)... ); }
+    inline void                                 orchid_seal             (void) noexcept                     { this->m_orchid.seal();                    }
+    [[nodiscard]] inline Orchid::Stats          orchid_stats            (void) const noexcept               { return this->m_orchid.stats();            }
     inline void                                 orchid_undo             (void) noexcept                     { this->m_orchid.undo();                    }
     inline void                                 orchid_redo             (void) noexcept                     { this->m_orchid.redo();                    }
  
@@ -526,11 +526,15 @@ public:
     // *************************************************************************** //
     
     inline void                                     OrchidPush                  (OrchidAction && act) noexcept      { this->GetMenuState().orchid_push( std::move(act) );   }
+    template< typename A, typename... Args >
+    inline void                                     OrchidEmplace               (Args &&... args)                   { this->GetMenuState().template orchid_emplace<A>( std::forward<Args>(args)... ); }
+    inline void                                     OrchidSeal                  (void) noexcept                     { this->GetMenuState().orchid_seal();                   }
     inline void                                     OrchidUndo                  (void) noexcept                     { this->GetMenuState().orchid_undo();                   }
     inline void                                     OrchidRedo                  (void) noexcept                     { this->GetMenuState().orchid_redo();                   }
     //
     [[nodiscard]] Orchid::size_type                 Orchid_undo_count           (void) noexcept                     { return this->GetMenuState().undo_count();             }
     [[nodiscard]] Orchid::size_type                 Orchid_redo_count           (void) noexcept                     { return this->GetMenuState().redo_count();             }
+    [[nodiscard]] Orchid::Stats                     Orchid_stats                (void) noexcept                     { return this->GetMenuState().orchid_stats();           }
     
     
     
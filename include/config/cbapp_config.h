@@ -123,6 +123,7 @@
 #if !( defined(_WIN32) || defined(MINGW) )
     # define     CBAPP_DISABLE_TERMINAL_COLORS              1           //  DISABLE ANSI Colors for LOGGER OUTPUT.
 #endif      //  _WIN32 || MINGW  //
+//  #define     CBAPP_LOG_BINARY_SINK                           "cbapp.cblog"   //  ALSO write a binary log (decode with "scripts/python/decode_cblog.py").
 
 
 
@@ -132,13 +133,15 @@
 // *************************************************************************** //
 
 //              1.      META-DATA CAPTURE FOR LOGGING.
+//                      "level" must be a constant:  levels below "CBAPP_LOG_COMPILE_LEVEL" compile to nothing.
 // *************************************************************************** //
 #define CB_LOG(level, fmt, ...)                                             \
+    do { if constexpr ( ::cb::utl::log_compiled_in(level) ) {               \
     Logger::instance().log_ex(                                              \
         fmt,                                                                \
         level,                                                              \
         __FILE__, __LINE__, __func__, std::this_thread::get_id()            \
-        __VA_OPT__(, ) __VA_ARGS__)
+        __VA_OPT__(, ) __VA_ARGS__); } } while (0)
 
 
 //  clang-specific macros
@@ -617,6 +620,10 @@ public:
     using                           BrowserState                = BrowserState_t    <ObjectCFG>                                         ;       \
     using                           ItemDDropper                = ItemDDropper_t                                                        ;       \
     using                           IndexState                  = IndexState_t      <VertexID, PointID, LineID, PathID, ZID, HitID>     ;       \
+    using                           VertexIndex                 = VertexIndex_t     <Vertex, Path>                                      ;       \
+    using                           SpatialIndex                = SpatialIndex_t    <VertexID>                                          ;       \
+    using                           CurveCache                  = CurveCache_t      <ImVec2>                                            ;       \
+    using                           RetainedGeometry            = RetainedGeometry_t<ImVec2>                                            ;       \
     /*                                                                                                                                  */      \
     /*      6.      AUXILIARY STATE OBJECTS...                                                                                          */      \
     using                           BoxDrag                     = BoxDrag_t         <EditorCFG>                                         ;       \
@@ -639,8 +646,8 @@ public:
 #define                 _EDITOR_APP_MISC_TYPES_API                                                                                      \
     /*                                                                                                                                  */      \
     /*      8.      MORE CALLBACKS...                                                                                                   */      \
-    using                           GVertexFn                   = Vertex* (&)(std::vector<Vertex> &, VertexID) noexcept                 ;       \
-    using                           CGVertexFn                  = const Vertex* (&)(const std::vector<Vertex>&, VertexID) noexcept      ;       \
+    using                           GVertexFn                   = const VertexIndex &                                                   ;       \
+    using                           CGVertexFn                  = const VertexIndex &                                                   ;       \
     /*                                                                                                                                  */      \
     /*      9.      OTHER OBJECT TYPES...                                                                                               */      \
     using                           OverlayManager              = OverlayManager_t  <OverlayID, MappingFn>                              ;       \
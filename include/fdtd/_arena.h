@@ -0,0 +1,217 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****                 _ A R E N A . H  ____  F I L E             ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/_arena.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ARENA_H
+#define _CB_FDTD_ARENA_H  1
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <new>
+#include <type_traits>
+#include <stdexcept>
+
+#include <cstdint>
+#include <cstring>
+
+#include <memory>
+#include <span>
+#include <utility>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Aligned Field Arena.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "AlignedArena"
+//      ONE aligned allocation carved into "count" equally-sized arrays of "n" values each.
+//
+//      -   Every array starts on an "Align"-byte boundary (one cache line / one AVX-512 register by default).
+//      -   Every array is followed by at least "ms_PAD" values of zeroed padding, so the next array starts aligned.
+//          The kernels mask their tails and never read the padding.
+//      -   Copies are deep.
+//
+template< typename T = double, std::size_t Align = 64ULL >
+class AlignedArena {
+    static_assert( std::is_trivially_copyable_v<T>,             "AlignedArena: T must be trivially copyable." );
+    static_assert( (Align & (Align - 1ULL)) == 0ULL,           "AlignedArena: alignment must be a power of two." );
+    static_assert( Align >= alignof(T),                         "AlignedArena: alignment is weaker than alignof(T)." );
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       size_type           = std::size_t;
+    using       pointer             = value_type *;
+    using       const_pointer       = const value_type *;
+    static constexpr size_type      ms_ALIGN                = Align;
+    static constexpr size_type      ms_PAD                  = (Align / sizeof(T) > 0ULL) ? Align / sizeof(T) : 1ULL;
+
+// *************************************************************************** //
+protected:
+    struct Deleter {
+        inline void operator ()     (value_type * p) const noexcept
+        { ::operator delete[]( static_cast<void *>(p), std::align_val_t(Align) ); }
+    };
+//
+    size_type                           m_count                 = 0ULL;
+    size_type                           m_size                  = 0ULL;
+    size_type                           m_stride                = 0ULL;
+    std::unique_ptr<value_type[], Deleter>  m_data              = nullptr;
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline                              AlignedArena            (void) noexcept         = default;
+
+    //  Parametric Constructor.
+    //      "count" arrays of "n" zero-initialised values.
+    //
+    inline                              AlignedArena            (const size_type count, const size_type n)
+        : m_count(count), m_size(n), m_stride( padded(n) )
+    { this->allocate(); }
+
+    //  Copy Constructor.
+    //
+    inline                              AlignedArena            (const AlignedArena & src)
+        : m_count(src.m_count), m_size(src.m_size), m_stride(src.m_stride)
+    {
+        this->allocate();
+        if (this->m_data)   { std::memcpy( this->m_data.get(), src.m_data.get(), this->bytes() ); }
+    }
+
+    //  Copy Assignment.
+    //
+    inline AlignedArena &               operator =              (const AlignedArena & src)
+    {
+        if (this != &src)   { AlignedArena tmp(src);    *this = std::move(tmp); }
+        return *this;
+    }
+
+    //  Move Constructor / Assignment.
+    //
+    inline                              AlignedArena            (AlignedArena && src) noexcept
+        : m_count( std::exchange(src.m_count, 0ULL) ), m_size( std::exchange(src.m_size, 0ULL) ),
+          m_stride( std::exchange(src.m_stride, 0ULL) ), m_data( std::move(src.m_data) )      {   }
+
+    inline AlignedArena &               operator =              (AlignedArena && src) noexcept
+    {
+        this->m_count   = std::exchange(src.m_count,    0ULL);
+        this->m_size    = std::exchange(src.m_size,     0ULL);
+        this->m_stride  = std::exchange(src.m_stride,   0ULL);
+        this->m_data    = std::move(src.m_data);
+        return *this;
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    PUBLIC API...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "data"
+    //      First element of array "i".
+    [[nodiscard]] inline pointer        data                    (const size_type i) noexcept        { return this->m_data.get() + i * this->m_stride; }
+    [[nodiscard]] inline const_pointer  data                    (const size_type i) const noexcept  { return this->m_data.get() + i * this->m_stride; }
+
+    //  "span"
+    //      Array "i" without its padding.
+    [[nodiscard]] inline std::span<value_type>          span    (const size_type i) noexcept        { return { this->data(i), this->m_size }; }
+    [[nodiscard]] inline std::span<const value_type>    span    (const size_type i) const noexcept  { return { this->data(i), this->m_size }; }
+
+    //  "count" / "size" / "stride" / "bytes"
+    [[nodiscard]] inline size_type      count                   (void) const noexcept   { return this->m_count;     }
+    [[nodiscard]] inline size_type      size                    (void) const noexcept   { return this->m_size;      }
+    [[nodiscard]] inline size_type      stride                  (void) const noexcept   { return this->m_stride;    }
+    [[nodiscard]] inline size_type      bytes                   (void) const noexcept   { return this->m_count * this->m_stride * sizeof(value_type); }
+
+    //  "fill"
+    //      Set the valid part of array "i" to "value" (padding stays zero).
+    inline void                         fill                    (const size_type i, const value_type value) noexcept
+    {
+        pointer     p       = this->data(i);
+        for (size_type m = 0ULL; m < this->m_size; ++m)     { p[m] = value; }
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "padded"
+    //      Round "n" up to a whole number of "Align"-sized blocks, then add one more block of padding.
+    [[nodiscard]] static constexpr size_type    padded          (const size_type n) noexcept
+    { return ( (n + ms_PAD - 1ULL) / ms_PAD ) * ms_PAD + ms_PAD; }
+
+    //  "allocate"
+    inline void                         allocate                (void)
+    {
+        const size_type     total   = this->bytes();
+        if (total == 0ULL)  { this->m_data.reset(); return; }
+
+        void *              raw     = ::operator new[]( total, std::align_val_t(Align) );
+        std::memset(raw, 0, total);
+        this->m_data.reset( static_cast<value_type *>(raw) );
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "AlignedArena" INLINE CLASS DEFINITION.
+};
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ARENA_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -21,6 +21,9 @@
 //  0.1.        ** MY **  HEADERS...
 #include CBAPP_USER_CONFIG
 #include "fdtd/_fdtd_impl.h"
+#include "fdtd/_frame_sink.h"
+#include "fdtd/_kernels.h"
+#include "fdtd/_worker_pool.h"
 
 
 //  0.2     STANDARD LIBRARY HEADERS...
@@ -34,6 +37,7 @@
 
 #include <vector>
 #include <array>
+#include <memory>
 #include <initializer_list>
 
 #include <utility>
@@ -80,6 +84,11 @@ public:
 //
     using       re_array        = base::re_array                    ;       using       im_array            = base::im_array;
     using       re_frame        = std::vector<re_array>             ;       using       im_frame            = std::vector<im_array>;
+    using       sink_t          = FrameSink<value_type>             ;       using       sink_ptr            = std::unique_ptr<sink_t>;
+    using       pool_t          = WorkerPool                        ;       using       pool_ptr            = std::unique_ptr<pool_t>;
+//
+    static constexpr size_type          ms_MIN_CHUNK            = 8192ULL;                          //  Fewest cells worth a worker.
+    static constexpr size_type          ms_LINE                 = 64ULL / sizeof(value_type);       //  Chunk alignment (one cache line).
 
 // *************************************************************************** //
 //
@@ -95,9 +104,9 @@ protected:
 //
     std::vector<value_type>             m_time;
     re_array                            m_xvals;
-    re_frame                            m_Hy_T,                 m_Ez_T,
-                                        m_Hy_F_NORM,            m_Ez_F_NORM;
-    im_frame                            m_Hy_F,                 m_Ez_F;
+    sink_ptr                            m_sink;                 //  Decides which time-steps (and spectra) are kept.
+    size_type                           m_threads               = default_thread_count();
+    pool_ptr                            m_pool;                 //  Persistent workers, sized for "NX" by "run".
     
 
     const size_type                     m_src_pos               = 2ULL;     //2ULL;
@@ -125,12 +134,10 @@ public:
 
     //    Default Constructor.
     //
-    inline FDTD_1D(void) noexcept
+    inline FDTD_1D(void)
         :   m_base(),
             m_xvals     ( 0,    value_type(0.0f) ),
-            m_Hy_T      ( 0,    re_array(0.0f) ),                           m_Ez_T      ( 0,    re_array(0.0f) ),
-            m_Hy_F_NORM ( 0,    re_array(0.0f) ),                           m_Ez_F_NORM ( 0,    re_array(0.0f) ),
-            m_Hy_F      ( 0,    im_array(0, complex_t(0.0f, 0.0f)) ),       m_Ez_F      ( 0,    im_array(0, complex_t(0.0f, 0.0f)) )
+            m_sink      ( make_frame_sink<value_type>( {} ) )
     {
         // ...
     }
@@ -184,17 +191,8 @@ private:
         for (size_type m = 0ULL; m < NX; ++m)
             this->m_xvals[m] = m;
 
-        for (size_type q = 0; q < NT; ++q) {//    INITIALIZE  Hy(t), Ez(t)  TO ZERO.
+        for (size_type q = 0; q < NT; ++q)//    INITIALIZE TIME-VALS.
             this->m_time[q] = q;
-
-            for (size_type m = 0; m < NX; ++m) {
-                this->m_Hy_T[q][m] = 0.0f;
-                this->m_Ez_T[q][m] = 0.0f;
-
-                this->m_Hy_F[q][m] = complex_t(0.0, 0.0);
-                this->m_Ez_F[q][m] = complex_t(0.0, 0.0);
-            }
-        }
         
         return;
     }
@@ -283,27 +281,50 @@ protected:
 // *************************************************************************** //
 
     //    "update_H"
+    //        One pool dispatch:  cache-line aligned chunks of  [0, NX-1).
     //
     inline void update_H(void)
     {
-        for (size_type m = 0ULL; m < NX-1; ++m) {
-                m_base.m_Hy[m] = m_base.m_chyH[m] * m_base.m_Hy[m] +
-                                m_base.m_chyE[m] * (m_base.m_Ez[m + 1] - m_base.m_Ez[m]);
-        }
-
+        const SimdLevel         lvl     = simd_level();
+        value_type *            Hy      = m_base.m_Hy.data();
+        const value_type *      Ez      = m_base.m_Ez.data();
+        const value_type *      chyH    = m_base.m_chyH.data();
+        const value_type *      chyE    = m_base.m_chyE.data();
+
+        if (NX < 2ULL)          { return; }
+        this->m_pool->parallel_for(NX - 1ULL, [=](const size_type b, const size_type e) {
+            yee_update(Hy + b, chyH + b, chyE + b, Ez + b + 1ULL, Ez + b, e - b, lvl);
+        }, ms_MIN_CHUNK, ms_LINE);
         return;
     }
 
 
     //    "update_E"
+    //        One pool dispatch:  cache-line aligned chunks of  [1, NX-1).
     //
     inline void update_E(void)
     {
-        for (size_type m = 1ULL; m < NX-1; ++m) {
-                m_base.m_Ez[m] = m_base.m_cezE[m] * m_base.m_Ez[m] +
-                                m_base.m_cezH[m] * (m_base.m_Hy[m] - m_base.m_Hy[m - 1]);
-        }
+        const SimdLevel         lvl     = simd_level();
+        value_type *            Ez      = m_base.m_Ez.data()    + 1;
+        const value_type *      Hy      = m_base.m_Hy.data()    + 1;
+        const value_type *      cezE    = m_base.m_cezE.data()  + 1;
+        const value_type *      cezH    = m_base.m_cezH.data()  + 1;
+
+        if (NX < 3ULL)          { return; }
+        this->m_pool->parallel_for(NX - 2ULL, [=](const size_type b, const size_type e) {
+            yee_update(Ez + b, cezE + b, cezH + b, Hy + b, Hy + b - 1, e - b, lvl);
+        }, ms_MIN_CHUNK, ms_LINE);
+        return;
+    }
 
+
+    //    "prepare_pool"
+    //        (Re-)build the pool only if "NX" or the requested thread count changed since the last run.
+    //
+    inline void prepare_pool(void)
+    {
+        const size_type     n       = std::clamp<size_type>( NX / ms_MIN_CHUNK, 1ULL, std::max<size_type>(this->m_threads, 1ULL) );
+        if ( !this->m_pool || this->m_pool->size() != n )   { this->m_pool = std::make_unique<pool_t>(n); }
         return;
     }
 
@@ -403,16 +424,26 @@ protected:
 // *************************************************************************** //
 public:
 
-    //  "get_E_time_data"
+    //  "get_sink"
+    //      Recorded frames: time-domain fields and normalised spectra.     Read only after "run" has returned.
     //
-    inline re_frame * get_E_time_data(void) {
-        return std::addressof( this->m_Ez_T );
+    inline const sink_t & get_sink(void) const noexcept {
+        return *this->m_sink;
     }
     
-    //  "get_E_freq_data"
+    //  "set_frame_sink"
+    //      Choose what "run" keeps.    Must NOT be called while "run" is executing.
     //
-    inline re_frame * get_E_freq_data(void) {
-        return std::addressof( this->m_Ez_F_NORM );
+    inline void set_frame_sink(sink_ptr sink) {
+        if (!sink)  { throw std::invalid_argument("FDTD_1D: frame sink cannot be \"nullptr\"."); }
+        this->m_sink = std::move(sink);
+    }
+
+    //  "set_threads"
+    //      Upper bound on the pool size (caller included);  "run" never gives a worker fewer than "ms_MIN_CHUNK" cells.
+    //
+    inline void set_threads(const size_type n) noexcept {
+        this->m_threads = std::max<size_type>(n, 1ULL);
     }
 
     //  "get_fourier_freqs"
@@ -441,9 +472,10 @@ public:
     //
     inline void run(void)
     {
-        size_type        m = 0ULL,     q = 0ULL;
+        size_type        q = 0ULL;
         this->init_grid();
-        
+        this->prepare_pool();
+        this->m_sink->begin(NX, NT);
     
 
 
@@ -457,28 +489,10 @@ public:
             this->abc_2();
             this->update_E();
 
-            //    2.    COPYING DATA...
-            for (m = 0ULL; m < NX; ++m) {
-                this->m_Ez_T[q][m] = m_base.m_Ez[m];
-                this->m_Hy_T[q][m] = m_base.m_Hy[m];
-            }
-        }
-
-
-        //    3.    COMPUTING DISCRETE FOURIER TRANSFORM...
-        for (q = 0ULL; q < NT; ++q) {
-            this->m_Hy_F[q] = real_DFT<value_type>(this->m_Hy_T[q]);
-            this->m_Ez_F[q] = real_DFT<value_type>(this->m_Ez_T[q]);
-        }
-    
-    
-        // 4. NORMALISE DFT magnitudes (real, 0‒1) -------------------------
-        //using complex_t = typename m_base.complex_t;
-        for (q = 0ULL; q < NT; ++q) {
-            m_Hy_F_NORM[q] = normalize_spectrum<complex_t>( m_Hy_F[q] );
-            m_Ez_F_NORM[q] = normalize_spectrum<complex_t>( m_Ez_F[q] );
+            //    2.    HAND THE STEP TO THE SINK  (it decides what to keep;  spectra of kept frames run in parallel in "end")...
+            this->m_sink->push( q, m_base.m_Ez.data(), m_base.m_Hy.data() );
         }
-    
+        this->m_sink->end( this->m_pool.get() );
     
     
         return;
@@ -36,6 +36,9 @@
 
 #include <typeinfo>
 
+#include "fdtd/_fft.h"
+#include "fdtd/_arena.h"
+
 
 
 namespace cb { namespace fdtd { namespace spc {//     BEGINNING NAMESPACE "cb" :: "fdtd" :: "spc"...
@@ -92,6 +95,7 @@ namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
 
 //    "real_DFT"
 //    Compute Discrete Fourier Transform (DFT) of a real-signal.
+//    O(N^2) reference implementation.  Use "real_FFT" (fdtd/_fft.h) for anything performance-sensitive.
 //
 //        "sig_t"         ===>    time-domain signal.
 //        "sig_f"            ===>     frequency-domain signal.
@@ -179,9 +183,10 @@ normalised_freq_axis(std::size_t N)
 /*---------------------------------------------------------------------
     build_spectrum_frames ––
     Given NT time‑domain frames (each length NX), compute for each frame:
-        1) DFT of the real signal (complex bins)
+        1) FFT of the real signal (N/2 + 1 complex bins)
         2) Normalise magnitudes → [0,1]
-    Returns NT × NX real‑valued matrix (vector< vector<T> >).
+    Returns NT × (NX/2 + 1) real‑valued matrix (vector< vector<T> >),
+    matching "normalised_freq_axis(NX)".
 ---------------------------------------------------------------------*/
 template< typename T >
 inline std::vector< std::vector<T> >
@@ -191,13 +196,18 @@ build_spectrum_frames(const std::vector< std::vector<T> > & time_frames)
 
     std::vector< std::vector<T> > spec_frames;
     spec_frames.reserve(time_frames.size());
+    if ( time_frames.empty() )  { return spec_frames; }
+
+    const RealFFT<T> &                  plan    = get_real_fft_plan<T>( time_frames.front().size() );
+    typename RealFFT<T>::Workspace      ws;
+    std::vector<complex_t>              sig_f   ( plan.bins() );
 
     for (const auto & sig_t : time_frames) {
-        auto sig_f  = real_DFT<T, complex_t>(sig_t);             // complex bins
+        plan.forward(sig_t.data(), sig_f.data(), ws);           // complex bins
         auto mags   = normalize_spectrum<complex_t>(sig_f);      // real [0,1]
         spec_frames.emplace_back(std::move(mags));               // store frame
     }
-    return spec_frames;      // NT frames, each size NX
+    return spec_frames;      // NT frames, each size NX/2 + 1
 }
 
 
@@ -234,8 +244,13 @@ struct grid_1D {
     using       complex_t           = std::complex<value_type>;
     using       re_array            = std::vector<value_type>;
     using       im_array            = std::vector<complex_t>;
+    using       re_view             = std::span<value_type>;
+    using       arena_t             = AlignedArena<value_type>;
     using       sbyte               = std::int_fast8_t;
     
+    //  Slots of the real-valued field arrays inside "m_arena".
+    enum Slot : size_type { EZ = 0, HY, CEZE, CEZH, CHYE, CHYH, NUM_SLOTS };
+    
     
 // *************************************************************************** //
 // *************************************************************************** //
@@ -243,10 +258,11 @@ struct grid_1D {
     //    Default Constructor.
     //
     inline grid_1D(void) :
-        m_Ez        (0, value_type(0.0f)        ),      m_Hy    ( 0, value_type(0.0f)       ),
+        m_arena     (NUM_SLOTS, 0               ),
+        m_Ez        (m_arena.span(EZ)           ),      m_Hy    ( m_arena.span(HY)          ),
         m_eps_r     (0, complex_t(0.0f, 0.0f)   ),      m_mu_r  ( 0, complex_t(0.0f, 0.0f)  ),
-        m_cezE      (0, value_type(0.0f)        ),      m_cezH  ( 0, value_type(0.0f)       ),
-        m_chyE      (0, value_type(0.0f)        ),      m_chyH  ( 0, value_type(0.0f)       )
+        m_cezE      (m_arena.span(CEZE)         ),      m_cezH  ( m_arena.span(CEZH)        ),
+        m_chyE      (m_arena.span(CHYE)         ),      m_chyH  ( m_arena.span(CHYH)        )
     {
         //  ...
     }
@@ -273,10 +289,15 @@ struct grid_1D {
 
     //    Copy Constructor.
     //
+    //        Deep-copies the arena, then re-seats every view onto the NEW storage.
+    //
     inline grid_1D(const grid_1D & src) :
-                m_Ez(src.m_Ez),             m_Hy(src.m_Hy),             m_eps_r(src.m_eps_r),
-                m_mu_r(src.m_mu_r),         m_cezE(src.m_cezE),         m_cezH(src.m_cezH),
-                m_chyE(src.m_chyE),         m_chyH(src.m_chyH)          { }
+                N(src.N),                   m_arena(src.m_arena),
+                m_Ez(m_arena.span(EZ)),     m_Hy(m_arena.span(HY)),     m_eps_r(src.m_eps_r),
+                m_mu_r(src.m_mu_r),         m_cezE(m_arena.span(CEZE)), m_cezH(m_arena.span(CEZH)),
+                m_chyE(m_arena.span(CHYE)), m_chyH(m_arena.span(CHYH))  { }
+    
+    inline grid_1D & operator = (const grid_1D & )      = delete;
 
     //    Default Destructor.
     //
@@ -285,10 +306,12 @@ struct grid_1D {
 
 //    Data-Members...
 // *************************************************************************** //
+    //        Fields and update coefficients are views into ONE aligned, padded arena (see "yee_update").
     size_type       N = 0ULL;
-    re_array        m_Ez,           m_Hy;
+    arena_t         m_arena;
+    re_view         m_Ez,           m_Hy;
     im_array        m_eps_r,        m_mu_r;
-    re_array        m_cezE,         m_cezH,         m_chyE,         m_chyH;
+    re_view         m_cezE,         m_cezH,         m_chyE,         m_chyH;
 // *************************************************************************** //
 
 //    END GRID_1D INLINE STRUCT DEFINITION.
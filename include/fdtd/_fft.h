@@ -0,0 +1,600 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****                  _ F F T . H  ____  F I L E                ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/_fft.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_FFT_H
+#define _CB_FDTD_FFT_H  1
+
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <numbers>
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Complex, Mixed-Radix FFT Plan.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "ComplexFFT"
+//      Forward, out-of-place, N-point complex FFT.
+//
+//      -   N is factored into radices {4, 2, 3, 5, ...} and evaluated with a recursive decimation-in-time
+//          Cooley-Tukey pass.  Twiddle factors are computed ONCE at construction.
+//      -   If N has a prime factor larger than "ms_MAX_RADIX", the plan falls back to Bluestein's
+//          chirp-z algorithm (convolution through a power-of-two sub-plan) so that every N is O(N log N).
+//      -   A plan is immutable after construction.  All scratch memory is supplied by the caller, so ONE
+//          plan can be shared by any number of threads.
+//
+template< typename T = double >
+class ComplexFFT {
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       complex_t           = std::complex<value_type>;
+    using       size_type           = std::size_t;
+    using       workspace_t         = std::vector<complex_t>;
+//
+    static constexpr size_type      ms_MAX_RADIX            = 31ULL;
+
+// *************************************************************************** //
+protected:
+    struct Stage    { size_type p; size_type m; };
+//
+    size_type                       N                       = 0ULL;
+    std::vector<Stage>              m_stages;
+    std::vector<complex_t>          m_twiddles;
+    size_type                       m_max_radix             = 0ULL;
+//
+    //                      BLUESTEIN FALLBACK:
+    bool                            m_bluestein             = false;
+    std::unique_ptr<ComplexFFT>     m_conv_plan;
+    std::vector<complex_t>          m_chirp;                //  exp( -i pi n^2 / N ),           size N.
+    std::vector<complex_t>          m_chirp_fft;            //  FFT of the conj-chirp kernel,   size M.
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline explicit ComplexFFT(const size_type N_)
+        : N(N_)
+    {
+        if (N == 0ULL)  { throw std::invalid_argument("ComplexFFT: transform length must be non-zero."); }
+
+        this->factorize();
+        if (this->m_bluestein)  { this->init_bluestein();   }
+        else                    { this->init_twiddles();    }
+    }
+
+    //  Default Destructor.
+    //
+    inline ~ComplexFFT(void)                                = default;
+    //
+                            ComplexFFT  (const ComplexFFT & )   = delete;
+    ComplexFFT &            operator =  (const ComplexFFT & )   = delete;
+
+
+// *************************************************************************** //
+//
+//
+//    PUBLIC API...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "size"
+    [[nodiscard]] inline size_type      size                (void) const noexcept   { return this->N;               }
+
+    //  "uses_bluestein"
+    [[nodiscard]] inline bool           uses_bluestein      (void) const noexcept   { return this->m_bluestein;     }
+
+    //  "workspace_size"
+    //      Number of complex scratch elements "forward" requires.
+    [[nodiscard]] inline size_type      workspace_size      (void) const noexcept
+    {
+        if (!this->m_bluestein)     { return this->m_max_radix; }
+        const size_type     M       = this->m_conv_plan->size();
+        return 2ULL * M + this->m_conv_plan->workspace_size();
+    }
+
+
+    //  "forward"
+    //      out[k] = sum_n in[n] * exp( -2 pi i k n / N ).      "in" and "out" must NOT alias.
+    //
+    inline void                         forward             (const complex_t * in, complex_t * out, workspace_t & work) const
+    {
+        if ( work.size() < this->workspace_size() )     { work.resize( this->workspace_size() ); }
+        this->execute(in, out, work.data());
+        return;
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    PRIVATE MEMBER FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+protected:
+
+    //  "execute"
+    //
+    inline void                         execute             (const complex_t * in, complex_t * out, complex_t * scratch) const
+    {
+        if (this->m_bluestein)  { this->bluestein(in, out, scratch);            }
+        else                    { this->work(out, in, 1ULL, 0ULL, scratch);     }
+        return;
+    }
+
+
+    //  "factorize"
+    //
+    inline void                         factorize           (void)
+    {
+        size_type   n   = this->N;
+        size_type   p   = 4ULL;
+
+        do {
+            while (n % p) {
+                switch (p) {
+                    case 4ULL   : { p = 2ULL;   break; }
+                    case 2ULL   : { p = 3ULL;   break; }
+                    default     : { p += 2ULL;  break; }
+                }
+                if (p * p > n)  { p = n; }
+            }
+            n                  /= p;
+            this->m_stages.push_back( {p, n} );
+            this->m_max_radix   = std::max(this->m_max_radix, p);
+        } while (n > 1ULL);
+
+        this->m_bluestein       = (this->m_max_radix > ms_MAX_RADIX);
+        return;
+    }
+
+
+    //  "init_twiddles"
+    //
+    inline void                         init_twiddles       (void)
+    {
+        const value_type    theta   = -value_type(2) * std::numbers::pi_v<value_type> / static_cast<value_type>(this->N);
+
+        this->m_twiddles.resize(this->N);
+        for (size_type k = 0ULL; k < this->N; ++k)
+            this->m_twiddles[k] = std::polar( value_type(1), theta * static_cast<value_type>(k) );
+        return;
+    }
+
+
+    //  "init_bluestein"
+    //
+    inline void                         init_bluestein      (void)
+    {
+        const value_type    pi      = std::numbers::pi_v<value_type>;
+        size_type           M       = 1ULL;
+        while (M < 2ULL * this->N - 1ULL)   { M <<= 1ULL; }
+
+        this->m_stages.clear();
+        this->m_conv_plan           = std::make_unique<ComplexFFT>(M);
+
+        //  1.  Chirp.      n^2 is reduced modulo 2N so the phase stays accurate for large N.
+        this->m_chirp.resize(this->N);
+        for (size_type n = 0ULL; n < this->N; ++n) {
+            const size_type     n2  = (n * n) % (2ULL * this->N);
+            this->m_chirp[n]        = std::polar( value_type(1), -pi * static_cast<value_type>(n2) / static_cast<value_type>(this->N) );
+        }
+
+        //  2.  Convolution kernel  b[n] = conj(chirp[|n|])  wrapped onto M points.
+        std::vector<complex_t>  kernel  (M, complex_t(0, 0));
+        workspace_t             scratch;
+        kernel[0]                       = std::conj(this->m_chirp[0]);
+        for (size_type n = 1ULL; n < this->N; ++n) {
+            kernel[n]                   = std::conj(this->m_chirp[n]);
+            kernel[M - n]               = std::conj(this->m_chirp[n]);
+        }
+
+        this->m_chirp_fft.resize(M);
+        this->m_conv_plan->forward(kernel.data(), this->m_chirp_fft.data(), scratch);
+        return;
+    }
+
+
+    //  "work"
+    //      Recursive decimation-in-time pass.      "stage" indexes "m_stages".
+    //
+    inline void                         work                (complex_t * out, const complex_t * in, const size_type fstride,
+                                                             const size_type stage, complex_t * scratch) const
+    {
+        const size_type     p       = this->m_stages[stage].p;
+        const size_type     m       = this->m_stages[stage].m;
+
+        if (m == 1ULL) {
+            for (size_type k = 0ULL; k < p; ++k)
+                out[k] = in[k * fstride];
+        }
+        else {
+            for (size_type k = 0ULL; k < p; ++k)
+                this->work(out + k * m, in + k * fstride, fstride * p, stage + 1ULL, scratch);
+        }
+
+        switch (p) {
+            case 2ULL   : { this->butterfly_2(out, fstride, m);                 break; }
+            case 3ULL   : { this->butterfly_3(out, fstride, m);                 break; }
+            case 4ULL   : { this->butterfly_4(out, fstride, m);                 break; }
+            default     : { this->butterfly_generic(out, fstride, m, p, scratch);   break; }
+        }
+        return;
+    }
+
+
+    //  "butterfly_2"
+    //
+    inline void                         butterfly_2         (complex_t * out, const size_type fstride, const size_type m) const noexcept
+    {
+        complex_t *         F1      = out + m;
+        for (size_type k = 0ULL; k < m; ++k) {
+            const complex_t     t   = F1[k] * this->m_twiddles[k * fstride];
+            F1[k]                   = out[k] - t;
+            out[k]                 += t;
+        }
+        return;
+    }
+
+
+    //  "butterfly_3"
+    //
+    inline void                         butterfly_3         (complex_t * out, const size_type fstride, const size_type m) const noexcept
+    {
+        const value_type    s3      = this->m_twiddles[fstride * m].imag();     //  Im( exp(-2 pi i / 3) ).
+        complex_t *         F1      = out + m;
+        complex_t *         F2      = out + 2ULL * m;
+
+        for (size_type k = 0ULL; k < m; ++k) {
+            const complex_t     a   = out[k];
+            const complex_t     b   = F1[k] * this->m_twiddles[k * fstride];
+            const complex_t     c   = F2[k] * this->m_twiddles[2ULL * k * fstride];
+            const complex_t     s   = b + c;
+            const complex_t     d   = b - c;
+            const complex_t     h   = a - value_type(0.5) * s;
+            const complex_t     r   = complex_t( -s3 * d.imag(), s3 * d.real() );       //  i * s3 * d.
+
+            out[k]                  = a + s;
+            F1[k]                   = h + r;
+            F2[k]                   = h - r;
+        }
+        return;
+    }
+
+
+    //  "butterfly_4"
+    //
+    inline void                         butterfly_4         (complex_t * out, const size_type fstride, const size_type m) const noexcept
+    {
+        complex_t *         F1      = out + m;
+        complex_t *         F2      = out + 2ULL * m;
+        complex_t *         F3      = out + 3ULL * m;
+
+        for (size_type k = 0ULL; k < m; ++k) {
+            const complex_t     a   = out[k];
+            const complex_t     b   = F1[k] * this->m_twiddles[k * fstride];
+            const complex_t     c   = F2[k] * this->m_twiddles[2ULL * k * fstride];
+            const complex_t     d   = F3[k] * this->m_twiddles[3ULL * k * fstride];
+            const complex_t     s5  = a - c;
+            const complex_t     s6  = a + c;
+            const complex_t     s3  = b + d;
+            const complex_t     s4  = b - d;
+
+            out[k]                  = s6 + s3;
+            F2[k]                   = s6 - s3;
+            F1[k]                   = complex_t( s5.real() + s4.imag(),  s5.imag() - s4.real() );
+            F3[k]                   = complex_t( s5.real() - s4.imag(),  s5.imag() + s4.real() );
+        }
+        return;
+    }
+
+
+    //  "butterfly_generic"
+    //      O(p^2) butterfly for any remaining (small, odd) radix.
+    //
+    inline void                         butterfly_generic   (complex_t * out, const size_type fstride, const size_type m,
+                                                             const size_type p, complex_t * scratch) const noexcept
+    {
+        for (size_type u = 0ULL; u < m; ++u)
+        {
+            for (size_type q1 = 0ULL; q1 < p; ++q1)
+                scratch[q1] = out[u + q1 * m];
+
+            for (size_type q1 = 0ULL; q1 < p; ++q1) {
+                const size_type     k       = u + q1 * m;
+                size_type           twidx   = 0ULL;
+                complex_t           acc     = scratch[0];
+
+                for (size_type q = 1ULL; q < p; ++q) {
+                    twidx  += fstride * k;
+                    if (twidx >= this->N)   { twidx -= this->N; }
+                    acc    += scratch[q] * this->m_twiddles[twidx];
+                }
+                out[k] = acc;
+            }
+        }
+        return;
+    }
+
+
+    //  "bluestein"
+    //      X[k] = c[k] * ( (x * c)  (*)  conj(c) )[k],     evaluated with a size-M circular convolution.
+    //
+    inline void                         bluestein           (const complex_t * in, complex_t * out, complex_t * scratch) const
+    {
+        const size_type     M       = this->m_conv_plan->size();
+        complex_t *         a       = scratch;
+        complex_t *         A       = scratch + M;
+        complex_t *         inner   = scratch + 2ULL * M;
+
+        for (size_type n = 0ULL; n < this->N; ++n)      { a[n] = in[n] * this->m_chirp[n];  }
+        std::fill(a + this->N, a + M, complex_t(0, 0));
+
+        this->m_conv_plan->execute(a, A, inner);
+
+        //  Inverse FFT by conjugation:     ifft(X) = conj( fft( conj(X) ) ) / M.
+        for (size_type k = 0ULL; k < M; ++k)            { A[k] = std::conj( A[k] * this->m_chirp_fft[k] ); }
+        this->m_conv_plan->execute(A, a, inner);
+
+        const value_type    inv_M   = value_type(1) / static_cast<value_type>(M);
+        for (size_type k = 0ULL; k < this->N; ++k)      { out[k] = std::conj(a[k]) * inv_M * this->m_chirp[k]; }
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "ComplexFFT" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Real-Input FFT (Half-Spectrum Output).
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "RealFFT"
+//      N-point FFT of a REAL signal, returning only the N/2 + 1 non-negative frequency bins
+//      (the same bins as "normalised_freq_axis(N)").
+//
+//      -   EVEN N:     the signal is packed into an N/2-point complex sequence  z[n] = x[2n] + i x[2n+1],
+//                      transformed once, and split back into the real spectrum.  Roughly half the work
+//                      of a full complex transform.
+//      -   ODD N:      falls back to a full N-point complex transform.
+//
+template< typename T = double >
+class RealFFT {
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       complex_t           = std::complex<value_type>;
+    using       size_type           = std::size_t;
+    using       plan_t              = ComplexFFT<value_type>;
+
+    //  "Workspace"
+    //      Per-thread scratch memory.      Re-use ONE instance across calls to avoid allocations.
+    struct Workspace {
+        std::vector<complex_t>      packed;
+        std::vector<complex_t>      spectrum;
+        std::vector<complex_t>      plan;
+    };
+
+// *************************************************************************** //
+protected:
+    size_type                       N                       = 0ULL;
+    bool                            m_packed                = false;
+    plan_t                          m_plan;
+    std::vector<complex_t>          m_split_twiddles;       //  exp( -2 pi i k / N ),   k = 0 ... N/2.
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline explicit RealFFT(const size_type N_)
+        : N(N_), m_packed( (N_ % 2ULL == 0ULL) && (N_ >= 2ULL) ), m_plan( m_packed ? N_ / 2ULL : N_ )
+    {
+        if (!this->m_packed)    { return; }
+
+        const value_type    theta   = -value_type(2) * std::numbers::pi_v<value_type> / static_cast<value_type>(this->N);
+        this->m_split_twiddles.resize( this->N / 2ULL + 1ULL );
+        for (size_type k = 0ULL; k <= this->N / 2ULL; ++k)
+            this->m_split_twiddles[k] = std::polar( value_type(1), theta * static_cast<value_type>(k) );
+    }
+
+    //  Default Destructor.
+    //
+    inline ~RealFFT(void)                                   = default;
+
+
+// *************************************************************************** //
+//
+//
+//    PUBLIC API...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "size"
+    [[nodiscard]] inline size_type      size                (void) const noexcept   { return this->N;                   }
+
+    //  "bins"
+    //      Number of output bins, N/2 + 1.
+    [[nodiscard]] inline size_type      bins                (void) const noexcept   { return this->N / 2ULL + 1ULL;     }
+
+
+    //  "forward"
+    //      Writes "bins()" complex values to "out".
+    //
+    inline void                         forward             (const value_type * in, complex_t * out, Workspace & ws) const
+    {
+        const size_type     H       = this->N / 2ULL;
+
+        //      CASE 0 :    ODD LENGTH  | plain complex transform.
+        if (!this->m_packed)
+        {
+            ws.packed.resize(this->N);
+            ws.spectrum.resize(this->N);
+            for (size_type n = 0ULL; n < this->N; ++n)  { ws.packed[n] = complex_t(in[n], value_type(0)); }
+
+            this->m_plan.forward(ws.packed.data(), ws.spectrum.data(), ws.plan);
+            std::copy_n(ws.spectrum.data(), this->bins(), out);
+            return;
+        }
+
+        //      CASE 1 :    EVEN LENGTH | pack, transform, split.
+        ws.packed.resize(H);
+        ws.spectrum.resize(H);
+        for (size_type n = 0ULL; n < H; ++n)            { ws.packed[n] = complex_t(in[2ULL * n], in[2ULL * n + 1ULL]); }
+
+        this->m_plan.forward(ws.packed.data(), ws.spectrum.data(), ws.plan);
+
+        const complex_t *   Z       = ws.spectrum.data();
+        const complex_t     half_i  = complex_t(value_type(0), value_type(-0.5));
+        for (size_type k = 0ULL; k <= H; ++k)
+        {
+            const complex_t     Zk  = Z[ (k == H) ? 0ULL : k ];
+            const complex_t     Zr  = std::conj( Z[ (k == 0ULL) ? 0ULL : H - k ] );
+            const complex_t     Fe  = value_type(0.5) * (Zk + Zr);          //  Spectrum of the EVEN samples.
+            const complex_t     Fo  = half_i * (Zk - Zr);                   //  Spectrum of the ODD samples.
+            out[k]                  = Fe + this->m_split_twiddles[k] * Fo;
+        }
+        return;
+    }
+
+
+    //  "forward"
+    //      Allocating convenience overload.
+    //
+    [[nodiscard]] inline std::vector<complex_t>
+                                        forward             (const std::vector<value_type> & sig_t) const
+    {
+        if (sig_t.size() != this->N)    { throw std::invalid_argument("RealFFT: input length does not match the plan."); }
+
+        Workspace                   ws;
+        std::vector<complex_t>      sig_f   ( this->bins() );
+        this->forward(sig_t.data(), sig_f.data(), ws);
+        return sig_f;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "RealFFT" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//    PLAN CACHE AND INLINE FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "get_real_fft_plan"
+//      Returns a shared, immutable plan for length N.      Plans (and their twiddle tables) are built on
+//      first use and cached for the lifetime of the program.
+//
+template< typename T >
+[[nodiscard]] inline const RealFFT<T> &
+get_real_fft_plan(const std::size_t N)
+{
+    static std::mutex                                                       s_mtx;
+    static std::unordered_map< std::size_t, std::unique_ptr<RealFFT<T>> >   s_plans;
+
+    std::lock_guard<std::mutex>     lock    (s_mtx);
+    auto &                          slot    = s_plans[N];
+    if (!slot)  { slot = std::make_unique<RealFFT<T>>(N); }
+    return *slot;
+}
+
+
+//  "real_FFT"
+//      Drop-in replacement for "real_DFT" that returns ONLY the N/2 + 1 half-spectrum bins
+//      (matching "normalised_freq_axis(N)").
+//
+template< typename T >
+[[nodiscard]] inline std::vector< std::complex<T> >
+real_FFT(const std::vector<T> & sig_t)
+{
+    if ( sig_t.empty() )    { return {}; }
+    return get_real_fft_plan<T>( sig_t.size() ).forward(sig_t);
+}
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_FFT_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
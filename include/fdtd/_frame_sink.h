@@ -0,0 +1,685 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****           _ F R A M E _ S I N K . H  ____  F I L E         ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/_frame_sink.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_FRAME_SINK_H
+#define _CB_FDTD_FRAME_SINK_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/_fft.h"
+#include "fdtd/_worker_pool.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <atomic>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <string>
+
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      0.      TYPES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FrameSinkType"
+//
+enum class FrameSinkType : uint8_t {
+      KeepAll = 0       //  Retain every time-step in memory     (old behavior).
+    , Decimate          //  Retain every k-th time-step.
+    , Ring              //  Retain only the most recent M frames.
+    , Disk              //  Stream every k-th frame to a binary file; read back on demand.
+//
+    , COUNT
+};
+
+
+//  "DEF_FRAME_SINK_TYPE_NAMES"
+//
+inline constexpr std::array<const char *, static_cast<std::size_t>(FrameSinkType::COUNT)>
+DEF_FRAME_SINK_TYPE_NAMES       = { "Keep All", "Decimate", "Ring", "Disk" };
+
+
+//  "FrameSinkCFG"
+//      Everything needed to build a sink.      "param" is the stride (Decimate, Disk) or the ring capacity (Ring).
+//
+struct FrameSinkCFG {
+    FrameSinkType               type            = FrameSinkType::KeepAll;
+    std::size_t                 param           = 1ULL;
+    bool                        keep_H          = false;        //  Also retain Hy (time + spectrum).
+    std::filesystem::path       path            = {};           //  Only used by "Disk".
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Abstract Frame Sink.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FrameSink"
+//      Receives one (Ez, Hy) snapshot per time-step from the solver and decides what to keep.
+//
+//      -   The SOLVER calls "begin" once, "push" every step, and "end" once.
+//      -   Retained frames are stored together with their normalised half-spectrum (N/2 + 1 bins), so the
+//          FFT is only paid for frames that are actually kept.  Sinks that hold their frames in memory defer
+//          every spectrum to "end", which runs them as a parallel-for across frames on the solver's pool.
+//      -   READERS ("size", "Ez_T", "Ez_F", ...) must only be used after "end".
+//          Pointers returned by readers stay valid until the next read of a DIFFERENT frame on "Disk" sinks.
+//
+template< typename T = double >
+class FrameSink {
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       size_type           = std::size_t;
+    using       complex_t           = std::complex<value_type>;
+    using       fft_t               = RealFFT<value_type>;
+
+// *************************************************************************** //
+protected:
+    size_type                           m_NX                    = 0ULL;
+    size_type                           m_NT                    = 0ULL;
+    size_type                           m_bins                  = 0ULL;
+    bool                                m_keep_H                = false;
+    bool                                m_defer                 = false;    //  Spectra computed in "end", not "push".
+//
+    const fft_t *                       m_plan                  = nullptr;
+    typename fft_t::Workspace           m_ws;
+    std::vector<complex_t>              m_spec;
+    std::vector<value_type>             m_Ez_F,                 m_Hy_F;
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline explicit                     FrameSink               (const bool keep_H = false, const bool defer = false) noexcept
+        : m_keep_H(keep_H), m_defer(defer)  {   }
+
+    //  Default Destructor.
+    //
+    inline virtual                      ~FrameSink              (void)                          = default;
+
+
+// *************************************************************************** //
+//
+//
+//    SOLVER-SIDE API...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "begin"
+    //
+    inline void                         begin                   (const size_type NX, const size_type NT)
+    {
+        this->m_NX          = NX;
+        this->m_NT          = NT;
+        this->m_bins        = (NX > 0ULL) ? NX / 2ULL + 1ULL : 0ULL;
+        this->m_plan        = (NX > 0ULL) ? &get_real_fft_plan<value_type>(NX) : nullptr;
+        this->m_spec.resize(this->m_bins);
+        this->m_Ez_F.resize(this->m_bins);
+        this->m_Hy_F.resize(this->m_keep_H ? this->m_bins : 0ULL);
+
+        this->on_begin();
+        return;
+    }
+
+
+    //  "push"
+    //      Offer time-step "q".  Cost is O(1) if the sink does not retain it.
+    //
+    inline void                         push                    (const size_type q, const value_type * Ez, const value_type * Hy)
+    {
+        if ( !this->wants(q) )  { return; }
+        if (this->m_defer)      { this->store(q, Ez, (this->m_keep_H) ? Hy : nullptr, nullptr, nullptr);   return; }
+
+        this->spectrum(Ez, this->m_Ez_F.data());
+        if (this->m_keep_H)     { this->spectrum(Hy, this->m_Hy_F.data()); }
+
+        this->store( q, Ez, (this->m_keep_H) ? Hy : nullptr,
+                     this->m_Ez_F.data(), (this->m_keep_H) ? this->m_Hy_F.data() : nullptr );
+        return;
+    }
+
+
+    //  "end"
+    //      "pool" (optional) runs any deferred spectra in parallel.
+    //
+    inline void                         end                     (WorkerPool * pool = nullptr)   { this->on_end(pool); return; }
+
+
+// *************************************************************************** //
+//
+//
+//    READER-SIDE API...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "nx" / "bins" / "keeps_H"
+    [[nodiscard]] inline size_type      nx                      (void) const noexcept   { return this->m_NX;        }
+    [[nodiscard]] inline size_type      bins                    (void) const noexcept   { return this->m_bins;      }
+    [[nodiscard]] inline bool           keeps_H                 (void) const noexcept   { return this->m_keep_H;    }
+    [[nodiscard]] inline bool           empty                   (void) const            { return this->size() == 0ULL; }
+
+    //  Number of retained frames, and the time-step "q" of frame "i" (oldest first).
+    [[nodiscard]] virtual size_type     size                    (void) const                = 0;
+    [[nodiscard]] virtual size_type     step                    (const size_type i) const   = 0;
+
+    //  Field data of frame "i".        "*_T" has "nx()" values; "*_F" has "bins()" normalised magnitudes.
+    [[nodiscard]] virtual const value_type *    Ez_T            (const size_type i) const   = 0;
+    [[nodiscard]] virtual const value_type *    Ez_F            (const size_type i) const   = 0;
+    [[nodiscard]] virtual const value_type *    Hy_T            (const size_type i) const   = 0;
+    [[nodiscard]] virtual const value_type *    Hy_F            (const size_type i) const   = 0;
+
+    //  Bytes of frame data currently held in memory.
+    [[nodiscard]] virtual size_type     bytes                   (void) const                = 0;
+
+    //  Short, human-readable name for the UI.
+    [[nodiscard]] virtual const char *  name                    (void) const noexcept       = 0;
+
+
+// *************************************************************************** //
+//
+//
+//    PROTECTED HOOKS...
+// *************************************************************************** //
+// *************************************************************************** //
+protected:
+
+    //  "record_size"
+    //      Values per frame:   [ Ez_T (NX) | Ez_F (bins) | Hy_T (NX) | Hy_F (bins) ].
+    [[nodiscard]] inline size_type      record_size             (void) const noexcept
+    { return (this->m_NX + this->m_bins) * ( (this->m_keep_H) ? 2ULL : 1ULL ); }
+
+    //  "write_record"
+    //      Null spectra are left untouched (deferred sinks fill them in "end").
+    inline void                         write_record            (value_type * dst, const value_type * Ez, const value_type * Hy,
+                                                                 const value_type * Ez_F, const value_type * Hy_F) const noexcept
+    {
+        std::memcpy(dst,                             Ez,     this->m_NX   * sizeof(value_type));
+        if (Ez_F)               { std::memcpy(dst + this->m_NX, Ez_F, this->m_bins * sizeof(value_type)); }
+        if (!this->m_keep_H)    { return; }
+        dst                        += this->m_NX + this->m_bins;
+        std::memcpy(dst,                             Hy,     this->m_NX   * sizeof(value_type));
+        if (Hy_F)               { std::memcpy(dst + this->m_NX, Hy_F, this->m_bins * sizeof(value_type)); }
+        return;
+    }
+
+    //  Record-relative offsets.
+    [[nodiscard]] inline size_type      off_Ez_F                (void) const noexcept   { return this->m_NX;                                        }
+    [[nodiscard]] inline size_type      off_Hy_T                (void) const noexcept   { return this->m_NX + this->m_bins;                         }
+    [[nodiscard]] inline size_type      off_Hy_F                (void) const noexcept   { return 2ULL * this->m_NX + this->m_bins;                  }
+
+    virtual void                        on_begin                (void)                      {   }
+    virtual void                        on_end                  (WorkerPool * )             {   }
+    [[nodiscard]] virtual bool          wants                   (const size_type q) const   = 0;
+    virtual void                        store                   (const size_type q, const value_type * Ez, const value_type * Hy,
+                                                                 const value_type * Ez_F, const value_type * Hy_F) = 0;
+
+
+    //  "spectrum"
+    //      Normalised |FFT| (0 ... 1) of one field snapshot.   Re-entrant as long as each caller brings its own
+    //      workspace and "bins()"-sized scratch spectrum (the plan itself is read-only).
+    inline void                         spectrum                (const value_type * sig_t, value_type * dst,
+                                                                 typename fft_t::Workspace & ws, complex_t * spec) const
+    {
+        if (!this->m_plan)      { return; }
+        this->m_plan->forward(sig_t, spec, ws);
+
+        value_type      peak    = value_type(0);
+        for (size_type k = 0ULL; k < this->m_bins; ++k) {
+            dst[k]              = std::abs(spec[k]);
+            peak                = std::max(peak, dst[k]);
+        }
+        if (peak > value_type(0)) {
+            for (size_type k = 0ULL; k < this->m_bins; ++k)     { dst[k] /= peak; }
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+private:
+
+    //  "spectrum"
+    //      Serial form used by "push".
+    inline void                         spectrum                (const value_type * sig_t, value_type * dst)
+    { this->spectrum(sig_t, dst, this->m_ws, this->m_spec.data()); }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "FrameSink" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 DERIVED CLASS:
+//         In-Memory Sink  (Keep-All, Decimate, Ring).
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "MemoryFrameSink"
+//      Keeps every "stride"-th frame.      "capacity == 0" is unbounded; otherwise only the most recent
+//      "capacity" retained frames are kept (ring).  All frames live in ONE contiguous allocation.
+//
+//      Spectra are deferred:  "push" only copies the fields, and "end" computes one spectrum per SURVIVING frame
+//      (a ring never pays for frames it has already overwritten).
+//
+template< typename T = double >
+class MemoryFrameSink : public FrameSink<T> {
+// *************************************************************************** //
+public:
+    using       base                = FrameSink<T>;
+    using       typename            base::value_type;
+    using       typename            base::size_type;
+
+// *************************************************************************** //
+protected:
+    size_type                           m_stride                = 1ULL;
+    size_type                           m_capacity              = 0ULL;
+    size_type                           m_count                 = 0ULL;     //  Total frames ever stored.
+    std::vector<value_type>             m_data;
+    std::vector<size_type>              m_steps;
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline explicit                     MemoryFrameSink         (const size_type stride = 1ULL, const size_type capacity = 0ULL, const bool keep_H = false)
+        : base(keep_H, true), m_stride( std::max<size_type>(stride, 1ULL) ), m_capacity(capacity)  {   }
+
+
+    //  "size"
+    [[nodiscard]] inline size_type      size                    (void) const override
+    { return (this->m_capacity == 0ULL) ? this->m_count : std::min(this->m_count, this->m_capacity); }
+
+    //  "step"
+    [[nodiscard]] inline size_type      step                    (const size_type i) const override
+    { return this->m_steps[ this->slot(i) ]; }
+
+    [[nodiscard]] inline const value_type *     Ez_T            (const size_type i) const override  { return this->record(i);                                   }
+    [[nodiscard]] inline const value_type *     Ez_F            (const size_type i) const override  { return this->record(i) + this->off_Ez_F();                }
+    [[nodiscard]] inline const value_type *     Hy_T            (const size_type i) const override  { return (this->m_keep_H) ? this->record(i) + this->off_Hy_T() : nullptr; }
+    [[nodiscard]] inline const value_type *     Hy_F            (const size_type i) const override  { return (this->m_keep_H) ? this->record(i) + this->off_Hy_F() : nullptr; }
+
+    //  "bytes"
+    [[nodiscard]] inline size_type      bytes                   (void) const override
+    { return this->m_data.capacity() * sizeof(value_type) + this->m_steps.capacity() * sizeof(size_type); }
+
+    //  "name"
+    [[nodiscard]] inline const char *   name                    (void) const noexcept override
+    {
+        if (this->m_capacity != 0ULL)   { return DEF_FRAME_SINK_TYPE_NAMES[ static_cast<std::size_t>(FrameSinkType::Ring)      ]; }
+        if (this->m_stride   != 1ULL)   { return DEF_FRAME_SINK_TYPE_NAMES[ static_cast<std::size_t>(FrameSinkType::Decimate)  ]; }
+        return DEF_FRAME_SINK_TYPE_NAMES[ static_cast<std::size_t>(FrameSinkType::KeepAll) ];
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "slot"
+    //      Logical index (oldest first) ===> physical slot.
+    [[nodiscard]] inline size_type      slot                    (const size_type i) const noexcept
+    {
+        if ( this->m_capacity == 0ULL || this->m_count <= this->m_capacity )    { return i; }
+        return (this->m_count + i) % this->m_capacity;
+    }
+
+    //  "record"
+    [[nodiscard]] inline const value_type *     record          (const size_type i) const noexcept
+    { return this->m_data.data() + this->slot(i) * this->record_size(); }
+
+
+    //  "on_begin"
+    //      Pre-size the storage so the solver never re-allocates mid-run.
+    inline void                         on_begin                (void) override
+    {
+        const size_type     expected    = (this->m_NT + this->m_stride - 1ULL) / this->m_stride;
+        const size_type     frames      = (this->m_capacity == 0ULL) ? expected : std::min(expected, this->m_capacity);
+
+        this->m_count                   = 0ULL;
+        this->m_data.assign( frames * this->record_size(), value_type(0) );
+        this->m_steps.assign( frames, 0ULL );
+        return;
+    }
+
+    //  "on_end"
+    //      Deferred spectra:  a parallel-for across the stored frames, with one FFT workspace per participant.
+    inline void                         on_end                  (WorkerPool * pool) override
+    {
+        using       workspace_t     = typename base::fft_t::Workspace;
+        using       scratch_t       = std::vector<typename base::complex_t>;
+        const size_type     frames      = this->size();
+        const size_type     rec         = this->record_size();
+        const size_type     P           = (pool) ? pool->size() : 1ULL;
+        std::vector<workspace_t>        ws          (P);
+        std::vector<scratch_t>          spec        ( P, scratch_t(this->m_bins) );
+
+        auto                job         = [&](const size_type s, const size_type id)
+        {
+            value_type *        r       = this->m_data.data() + s * rec;
+            this->spectrum(r, r + this->off_Ez_F(), ws[id], spec[id].data());
+            if (this->m_keep_H)     { this->spectrum(r + this->off_Hy_T(), r + this->off_Hy_F(), ws[id], spec[id].data()); }
+        };
+
+        if (pool)           { pool->parallel_for_each(frames, job); }
+        else                { for (size_type s = 0ULL; s < frames; ++s) { job(s, 0ULL); } }
+        return;
+    }
+
+    //  "wants"
+    [[nodiscard]] inline bool           wants                   (const size_type q) const override  { return (q % this->m_stride) == 0ULL; }
+
+    //  "store"
+    inline void                         store                   (const size_type q, const value_type * Ez, const value_type * Hy,
+                                                                 const value_type * Ez_F, const value_type * Hy_F) override
+    {
+        const size_type     s           = (this->m_capacity == 0ULL) ? this->m_count : this->m_count % this->m_capacity;
+        const size_type     rec         = this->record_size();
+
+        if ( (s + 1ULL) * rec > this->m_data.size() ) {         //  Only if the solver ran longer than "NT".
+            this->m_data.resize( (s + 1ULL) * rec );
+            this->m_steps.resize( s + 1ULL );
+        }
+
+        this->write_record(this->m_data.data() + s * rec, Ez, Hy, Ez_F, Hy_F);
+        this->m_steps[s]                = q;
+        ++this->m_count;
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "MemoryFrameSink" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 DERIVED CLASS:
+//         Disk-Streaming Sink.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "DiskFrameSink"
+//      Appends every "stride"-th frame to a raw binary file and keeps only ONE frame in memory for reading.
+//
+//      File layout:    [ "CBFDTDFR" | NX (u64) | bins (u64) | keep_H (u64) ]  followed by fixed-size records
+//                      [ Ez_T | Ez_F | (Hy_T | Hy_F) ].     Time-step indices are kept in memory (one integer per frame).
+//      Ownership:      with "owns_file" the file is scratch space and is removed by the destructor;  otherwise it was
+//                      named by the caller and is left on disk.
+//
+template< typename T = double >
+class DiskFrameSink : public FrameSink<T> {
+// *************************************************************************** //
+public:
+    using       base                = FrameSink<T>;
+    using       typename            base::value_type;
+    using       typename            base::size_type;
+    static constexpr char           ms_MAGIC [8]            = { 'C', 'B', 'F', 'D', 'T', 'D', 'F', 'R' };
+    static constexpr size_type      ms_HEADER_BYTES         = sizeof(ms_MAGIC) + 3ULL * sizeof(std::uint64_t);
+
+// *************************************************************************** //
+protected:
+    std::filesystem::path               m_path;
+    bool                                m_owns_file             = false;    //  Scratch file:  removed with the sink.
+    size_type                           m_stride                = 1ULL;
+    std::vector<size_type>              m_steps;
+    std::ofstream                       m_out;
+//
+    mutable std::ifstream               m_in;
+    mutable std::vector<value_type>     m_cache;                //  Most recently read record.
+    mutable size_type                   m_cached                = static_cast<size_type>(-1);
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    //
+    inline explicit                     DiskFrameSink           (std::filesystem::path path, const size_type stride = 1ULL, const bool keep_H = false,
+                                                                 const bool owns_file = false)
+        : base(keep_H), m_path( std::move(path) ), m_owns_file(owns_file), m_stride( std::max<size_type>(stride, 1ULL) )   {   }
+
+    //  Destructor.
+    //
+    inline                              ~DiskFrameSink          (void) override
+    {
+        this->m_out.close();
+        this->m_in.close();
+        if ( this->m_owns_file ) {
+            std::error_code     ec;
+            std::filesystem::remove(this->m_path, ec);      //  Scratch file: never outlives the sink.
+        }
+    }
+
+
+    //  "size"
+    [[nodiscard]] inline size_type      size                    (void) const override               { return this->m_steps.size();                              }
+
+    //  "step"
+    [[nodiscard]] inline size_type      step                    (const size_type i) const override  { return this->m_steps[i];                                  }
+
+    [[nodiscard]] inline const value_type *     Ez_T            (const size_type i) const override  { return this->fetch(i);                                    }
+    [[nodiscard]] inline const value_type *     Ez_F            (const size_type i) const override  { return this->fetch(i) + this->off_Ez_F();                 }
+    [[nodiscard]] inline const value_type *     Hy_T            (const size_type i) const override  { return (this->m_keep_H) ? this->fetch(i) + this->off_Hy_T() : nullptr; }
+    [[nodiscard]] inline const value_type *     Hy_F            (const size_type i) const override  { return (this->m_keep_H) ? this->fetch(i) + this->off_Hy_F() : nullptr; }
+
+    //  "bytes"
+    [[nodiscard]] inline size_type      bytes                   (void) const override
+    { return this->m_cache.capacity() * sizeof(value_type) + this->m_steps.capacity() * sizeof(size_type); }
+
+    //  "name"
+    [[nodiscard]] inline const char *   name                    (void) const noexcept override
+    { return DEF_FRAME_SINK_TYPE_NAMES[ static_cast<std::size_t>(FrameSinkType::Disk) ]; }
+
+    //  "path"
+    [[nodiscard]] inline const std::filesystem::path &  path    (void) const noexcept               { return this->m_path;                                      }
+    [[nodiscard]] inline bool           owns_file               (void) const noexcept               { return this->m_owns_file;                                 }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "on_begin"
+    inline void                         on_begin                (void) override
+    {
+        this->m_steps.clear();
+        this->m_steps.reserve( (this->m_NT + this->m_stride - 1ULL) / this->m_stride );
+        this->m_cached                  = static_cast<size_type>(-1);
+        this->m_cache.assign( this->record_size(), value_type(0) );
+
+        this->m_in.close();
+        this->m_out.close();
+        this->m_out.open(this->m_path, std::ios::binary | std::ios::trunc);
+        if (!this->m_out)   { throw std::runtime_error("DiskFrameSink: cannot open \"" + this->m_path.string() + "\" for writing."); }
+
+        const std::uint64_t     header [3]  = { this->m_NX, this->m_bins, static_cast<std::uint64_t>(this->m_keep_H) };
+        this->m_out.write(ms_MAGIC, sizeof(ms_MAGIC));
+        this->m_out.write(reinterpret_cast<const char *>(header), sizeof(header));
+        return;
+    }
+
+    //  "on_end"
+    //      Streamed records already carry their spectra (computed in "push"), so there is nothing to defer.
+    inline void                         on_end                  (WorkerPool * ) override    { this->m_out.flush(); return; }
+
+    //  "wants"
+    [[nodiscard]] inline bool           wants                   (const size_type q) const override  { return (q % this->m_stride) == 0ULL; }
+
+    //  "store"
+    inline void                         store                   (const size_type q, const value_type * Ez, const value_type * Hy,
+                                                                 const value_type * Ez_F, const value_type * Hy_F) override
+    {
+        //  Written field-by-field straight from the solver's arrays: no staging copy.
+        auto    put     = [this](const value_type * src, const size_type n)
+        { this->m_out.write( reinterpret_cast<const char *>(src), static_cast<std::streamsize>(n * sizeof(value_type)) ); };
+
+        put(Ez, this->m_NX);        put(Ez_F, this->m_bins);
+        if (this->m_keep_H)     { put(Hy, this->m_NX);      put(Hy_F, this->m_bins); }
+        if (!this->m_out)       { throw std::runtime_error("DiskFrameSink: write to \"" + this->m_path.string() + "\" failed."); }
+
+        this->m_steps.push_back(q);
+        return;
+    }
+
+
+    //  "fetch"
+    //      Read record "i" into the cache (no-op if it is already there).
+    [[nodiscard]] inline const value_type *     fetch           (const size_type i) const
+    {
+        if (i == this->m_cached)    { return this->m_cache.data(); }
+        if ( !this->m_in.is_open() ) {
+            this->m_in.open(this->m_path, std::ios::binary);
+            if (!this->m_in)    { throw std::runtime_error("DiskFrameSink: cannot open \"" + this->m_path.string() + "\" for reading."); }
+        }
+
+        const size_type     rec_bytes   = this->record_size() * sizeof(value_type);
+        this->m_in.clear();
+        this->m_in.seekg( static_cast<std::streamoff>(ms_HEADER_BYTES + i * rec_bytes), std::ios::beg );
+        this->m_in.read( reinterpret_cast<char *>(this->m_cache.data()), static_cast<std::streamsize>(rec_bytes) );
+        if (!this->m_in)            { this->m_cached = static_cast<size_type>(-1);  throw std::runtime_error("DiskFrameSink: short read from \"" + this->m_path.string() + "\"."); }
+        this->m_cached              = i;
+        return this->m_cache.data();
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "DiskFrameSink" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//    INLINE FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "frame_sink_scratch_path"
+//      A fresh file name in the temp directory for every Disk sink, so two app instances (or two sinks in one
+//      process) never share -- and never delete -- each other's scratch file.
+//
+[[nodiscard]] inline std::filesystem::path frame_sink_scratch_path(void)
+{
+    static const std::uint64_t          s_SESSION       = ( static_cast<std::uint64_t>( std::random_device{}() ) << 32U )
+                                                          ^ static_cast<std::uint64_t>( std::random_device{}() );
+    static std::atomic<std::uint64_t>   s_counter       { 0ULL };
+    char                                name [64];
+    std::snprintf( name, sizeof(name), "cbapp_fdtd_frames_%016llx_%llu.bin",
+                   static_cast<unsigned long long>( s_SESSION ),
+                   static_cast<unsigned long long>( s_counter.fetch_add(1ULL, std::memory_order_relaxed) ) );
+    return std::filesystem::temp_directory_path() / name;
+}
+
+
+//  "make_frame_sink"
+//
+template< typename T = double >
+[[nodiscard]] inline std::unique_ptr< FrameSink<T> >
+make_frame_sink(const FrameSinkCFG & cfg)
+{
+    switch (cfg.type)
+    {
+        case FrameSinkType::Decimate    : { return std::make_unique< MemoryFrameSink<T> >(cfg.param,    0ULL,       cfg.keep_H); }
+        case FrameSinkType::Ring        : { return std::make_unique< MemoryFrameSink<T> >(1ULL,         cfg.param,  cfg.keep_H); }
+        case FrameSinkType::Disk        : {
+            const bool              scratch     = cfg.path.empty();        //  Only a generated scratch file is ours to delete.
+            std::filesystem::path   p           = (scratch)     ? frame_sink_scratch_path()     : cfg.path;
+            return std::make_unique< DiskFrameSink<T> >(std::move(p), cfg.param, cfg.keep_H, scratch);
+        }
+        default                         : { break; }
+    }
+    return std::make_unique< MemoryFrameSink<T> >(1ULL, 0ULL, cfg.keep_H);
+}
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_FRAME_SINK_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -0,0 +1,527 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****               _ K E R N E L S . H  ____  F I L E           ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/_kernels.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_KERNELS_H
+#define _CB_FDTD_KERNELS_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/_arena.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <atomic>
+#include <type_traits>
+#include <algorithm>
+
+#include <cstdint>
+#include <array>
+
+
+//  0.3     PLATFORM HEADERS...
+#if defined(__x86_64__) || defined(_M_X64)
+#   define CB_FDTD_X86_SIMD         1
+#   include <immintrin.h>
+#   if defined(_MSC_VER) && !defined(__clang__)
+#       include <intrin.h>
+#   endif
+#else
+#   define CB_FDTD_X86_SIMD         0
+#endif
+
+
+
+//  "CB_FDTD_TARGET"
+//      Compile ONE function for a wider ISA than the rest of the translation unit (GCC / Clang).  MSVC needs nothing.
+#if defined(__GNUC__) || defined(__clang__)
+#   define CB_FDTD_TARGET(ISA)      __attribute__((target(ISA)))
+#else
+#   define CB_FDTD_TARGET(ISA)
+#endif
+
+//  "CB_FDTD_NO_CONTRACT"
+//      GCC may fuse  a*b + c*d  into an FMA whenever the ISA has one (AVX-512F does); that rounds ONCE instead of
+//      twice and breaks bit-equality between the kernel paths.  Clang only fuses inside a single expression.
+#if defined(__GNUC__) && !defined(__clang__)
+#   define CB_FDTD_NO_CONTRACT      __attribute__((optimize("fp-contract=off")))
+#else
+#   define CB_FDTD_NO_CONTRACT
+#endif
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      0.      TYPES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "SimdLevel"
+//
+enum class SimdLevel : uint8_t {
+      Scalar = 0
+    , AVX2
+    , AVX512
+//
+    , COUNT
+};
+
+
+//  "DEF_SIMD_LEVEL_NAMES"
+//
+inline constexpr std::array<const char *, static_cast<std::size_t>(SimdLevel::COUNT)>
+DEF_SIMD_LEVEL_NAMES            = { "Scalar", "AVX2", "AVX-512" };
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      RUNTIME DISPATCH...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "detect_simd_level"
+//      Widest kernel path this CPU (and OS) can run.   Evaluated once.
+//
+[[nodiscard]] inline SimdLevel detect_simd_level(void) noexcept
+{
+    static const SimdLevel      s_level     = []() noexcept -> SimdLevel {
+#if CB_FDTD_X86_SIMD
+#   if defined(_MSC_VER) && !defined(__clang__)
+        int                 r [4]       = { };
+        __cpuid(r, 0);
+        if (r[0] < 7)                                       { return SimdLevel::Scalar; }
+        __cpuidex(r, 1, 0);
+        const bool          osxsave     = (r[2] & (1 << 27)) != 0;
+        const bool          avx         = (r[2] & (1 << 28)) != 0;
+        if ( !osxsave || !avx )                             { return SimdLevel::Scalar; }
+        const unsigned long long    xcr0    = _xgetbv(0);
+        __cpuidex(r, 7, 0);
+        const bool          avx2        = (r[1] & (1 << 5))  != 0;
+        const bool          avx512f     = (r[1] & (1 << 16)) != 0;
+        if ( avx512f && (xcr0 & 0xE6ULL) == 0xE6ULL )       { return SimdLevel::AVX512; }
+        if ( avx2    && (xcr0 & 0x06ULL) == 0x06ULL )       { return SimdLevel::AVX2;   }
+#   else
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx512f") )            { return SimdLevel::AVX512; }
+        if ( __builtin_cpu_supports("avx2") )               { return SimdLevel::AVX2;   }
+#   endif
+#endif
+        return SimdLevel::Scalar;
+    }();
+    return s_level;
+}
+
+
+//  "active_simd_level_ref"
+//      Process-wide selection.     Defaults to the widest supported path.
+//
+[[nodiscard]] inline std::atomic<SimdLevel> & active_simd_level_ref(void) noexcept
+{
+    static std::atomic<SimdLevel>   s_active    { detect_simd_level() };
+    return s_active;
+}
+
+
+//  "simd_level"
+//
+[[nodiscard]] inline SimdLevel simd_level(void) noexcept
+{ return active_simd_level_ref().load(std::memory_order_relaxed); }
+
+
+//  "set_simd_level"
+//      Request a kernel path; clamped to what the CPU supports.  Returns the level actually selected.
+//
+inline SimdLevel set_simd_level(const SimdLevel request) noexcept
+{
+    const SimdLevel     level   = std::min(request, detect_simd_level());
+    active_simd_level_ref().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      2.      KERNELS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  Every path evaluates     f[i]  =  ca[i] * f[i]  +  cb[i] * ( hi[i] - lo[i] )
+//  as  SUB, MUL, MUL, ADD  in that order with no fused multiply-add, so all paths are bit-identical.
+//
+//      update_H:   f = Hy,         ca = chyH,      cb = chyE,      hi = Ez + 1,    lo = Ez,        n = NX - 1
+//      update_E:   f = Ez + 1,     ca = cezE + 1,  cb = cezH + 1,  hi = Hy + 1,    lo = Hy,        n = NX - 2
+//
+//  The vector paths finish each row with a MASKED tail (loads and store), so they never read or write past "n":
+//  any array of "n" values is valid input.  "AlignedArena" still pads every array, but only for alignment.
+//
+namespace kernel { //     BEGINNING NAMESPACE "kernel"...
+
+
+//  "yee_scalar"
+//
+template< typename T >
+CB_FDTD_NO_CONTRACT
+inline void yee_scalar(T * f, const T * ca, const T * cb, const T * hi, const T * lo, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0ULL; i < n; ++i) {
+        const T     curl    = hi[i] - lo[i];
+        const T     self    = ca[i] * f[i];
+        const T     drive   = cb[i] * curl;
+        f[i]                = self + drive;         //  Separate statements: never contracted by Clang.
+    }
+    return;
+}
+
+
+//  "yee2_scalar"
+//
+template< typename T >
+CB_FDTD_NO_CONTRACT
+inline void yee2_scalar(T * f, const T * ca, const T * cb, const T * a_hi, const T * a_lo,
+                        const T * b_hi, const T * b_lo, const std::size_t n) noexcept
+{
+    for (std::size_t i = 0ULL; i < n; ++i) {
+        const T     da      = a_hi[i] - a_lo[i];
+        const T     db      = b_hi[i] - b_lo[i];
+        const T     curl    = da - db;
+        const T     self    = ca[i] * f[i];
+        const T     drive   = cb[i] * curl;
+        f[i]                = self + drive;
+    }
+    return;
+}
+
+
+
+#if CB_FDTD_X86_SIMD
+//      2.1.    AVX2  (4 x double,  8 x float).
+// *************************************************************************** //
+
+CB_FDTD_TARGET("avx2") CB_FDTD_NO_CONTRACT
+inline void yee_avx2(double * f, const double * ca, const double * cb, const double * hi, const double * lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 4ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m256d   curl    = _mm256_sub_pd( _mm256_loadu_pd(hi + i), _mm256_loadu_pd(lo + i) );
+        const __m256d   self    = _mm256_mul_pd( _mm256_loadu_pd(ca + i), _mm256_loadu_pd(f + i) );
+        const __m256d   drive   = _mm256_mul_pd( _mm256_loadu_pd(cb + i), curl );
+        _mm256_storeu_pd( f + i, _mm256_add_pd(self, drive) );
+    }
+    if (i < n) {        //  Tail: masked loads and store;  nothing at or past "n" is touched.
+        const __m256i   mask    = _mm256_cmpgt_epi64( _mm256_set1_epi64x( static_cast<long long>(n - i) ), _mm256_setr_epi64x(0, 1, 2, 3) );
+        const __m256d   curl    = _mm256_sub_pd( _mm256_maskload_pd(hi + i, mask), _mm256_maskload_pd(lo + i, mask) );
+        const __m256d   self    = _mm256_mul_pd( _mm256_maskload_pd(ca + i, mask), _mm256_maskload_pd(f + i, mask) );
+        const __m256d   drive   = _mm256_mul_pd( _mm256_maskload_pd(cb + i, mask), curl );
+        _mm256_maskstore_pd( f + i, mask, _mm256_add_pd(self, drive) );
+    }
+    return;
+}
+
+CB_FDTD_TARGET("avx2") CB_FDTD_NO_CONTRACT
+inline void yee_avx2(float * f, const float * ca, const float * cb, const float * hi, const float * lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 8ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m256    curl    = _mm256_sub_ps( _mm256_loadu_ps(hi + i), _mm256_loadu_ps(lo + i) );
+        const __m256    self    = _mm256_mul_ps( _mm256_loadu_ps(ca + i), _mm256_loadu_ps(f + i) );
+        const __m256    drive   = _mm256_mul_ps( _mm256_loadu_ps(cb + i), curl );
+        _mm256_storeu_ps( f + i, _mm256_add_ps(self, drive) );
+    }
+    if (i < n) {
+        const __m256i   mask    = _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast<int>(n - i) ), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) );
+        const __m256    curl    = _mm256_sub_ps( _mm256_maskload_ps(hi + i, mask), _mm256_maskload_ps(lo + i, mask) );
+        const __m256    self    = _mm256_mul_ps( _mm256_maskload_ps(ca + i, mask), _mm256_maskload_ps(f + i, mask) );
+        const __m256    drive   = _mm256_mul_ps( _mm256_maskload_ps(cb + i, mask), curl );
+        _mm256_maskstore_ps( f + i, mask, _mm256_add_ps(self, drive) );
+    }
+    return;
+}
+
+
+
+//      2.2.    AVX-512  (8 x double,  16 x float).
+// *************************************************************************** //
+
+CB_FDTD_TARGET("avx512f") CB_FDTD_NO_CONTRACT
+inline void yee_avx512(double * f, const double * ca, const double * cb, const double * hi, const double * lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 8ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m512d   curl    = _mm512_sub_pd( _mm512_loadu_pd(hi + i), _mm512_loadu_pd(lo + i) );
+        const __m512d   self    = _mm512_mul_pd( _mm512_loadu_pd(ca + i), _mm512_loadu_pd(f + i) );
+        const __m512d   drive   = _mm512_mul_pd( _mm512_loadu_pd(cb + i), curl );
+        _mm512_storeu_pd( f + i, _mm512_add_pd(self, drive) );
+    }
+    if (i < n) {
+        const __mmask8  mask    = static_cast<__mmask8>( (1u << (n - i)) - 1u );
+        const __m512d   curl    = _mm512_sub_pd( _mm512_maskz_loadu_pd(mask, hi + i), _mm512_maskz_loadu_pd(mask, lo + i) );
+        const __m512d   self    = _mm512_mul_pd( _mm512_maskz_loadu_pd(mask, ca + i), _mm512_maskz_loadu_pd(mask, f + i) );
+        const __m512d   drive   = _mm512_mul_pd( _mm512_maskz_loadu_pd(mask, cb + i), curl );
+        _mm512_mask_storeu_pd( f + i, mask, _mm512_add_pd(self, drive) );
+    }
+    return;
+}
+
+CB_FDTD_TARGET("avx512f") CB_FDTD_NO_CONTRACT
+inline void yee_avx512(float * f, const float * ca, const float * cb, const float * hi, const float * lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 16ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m512    curl    = _mm512_sub_ps( _mm512_loadu_ps(hi + i), _mm512_loadu_ps(lo + i) );
+        const __m512    self    = _mm512_mul_ps( _mm512_loadu_ps(ca + i), _mm512_loadu_ps(f + i) );
+        const __m512    drive   = _mm512_mul_ps( _mm512_loadu_ps(cb + i), curl );
+        _mm512_storeu_ps( f + i, _mm512_add_ps(self, drive) );
+    }
+    if (i < n) {
+        const __mmask16 mask    = static_cast<__mmask16>( (1u << (n - i)) - 1u );
+        const __m512    curl    = _mm512_sub_ps( _mm512_maskz_loadu_ps(mask, hi + i), _mm512_maskz_loadu_ps(mask, lo + i) );
+        const __m512    self    = _mm512_mul_ps( _mm512_maskz_loadu_ps(mask, ca + i), _mm512_maskz_loadu_ps(mask, f + i) );
+        const __m512    drive   = _mm512_mul_ps( _mm512_maskz_loadu_ps(mask, cb + i), curl );
+        _mm512_mask_storeu_ps( f + i, mask, _mm512_add_ps(self, drive) );
+    }
+    return;
+}
+
+
+
+//      2.3.    TWO-DIFFERENCE FORM  (2D / 3D curls):   f = ca*f + cb*( (a_hi - a_lo) - (b_hi - b_lo) ).
+//              The tiled engines call these on row segments, so the next cells belong to another tile (or another
+//              thread's slab):  the tails must not read them.
+// *************************************************************************** //
+
+CB_FDTD_TARGET("avx2") CB_FDTD_NO_CONTRACT
+inline void yee2_avx2(double * f, const double * ca, const double * cb, const double * a_hi, const double * a_lo,
+                      const double * b_hi, const double * b_lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 4ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m256d   da      = _mm256_sub_pd( _mm256_loadu_pd(a_hi + i), _mm256_loadu_pd(a_lo + i) );
+        const __m256d   db      = _mm256_sub_pd( _mm256_loadu_pd(b_hi + i), _mm256_loadu_pd(b_lo + i) );
+        const __m256d   self    = _mm256_mul_pd( _mm256_loadu_pd(ca + i), _mm256_loadu_pd(f + i) );
+        const __m256d   drive   = _mm256_mul_pd( _mm256_loadu_pd(cb + i), _mm256_sub_pd(da, db) );
+        _mm256_storeu_pd( f + i, _mm256_add_pd(self, drive) );
+    }
+    if (i < n) {
+        const __m256i   mask    = _mm256_cmpgt_epi64( _mm256_set1_epi64x( static_cast<long long>(n - i) ), _mm256_setr_epi64x(0, 1, 2, 3) );
+        const __m256d   da      = _mm256_sub_pd( _mm256_maskload_pd(a_hi + i, mask), _mm256_maskload_pd(a_lo + i, mask) );
+        const __m256d   db      = _mm256_sub_pd( _mm256_maskload_pd(b_hi + i, mask), _mm256_maskload_pd(b_lo + i, mask) );
+        const __m256d   self    = _mm256_mul_pd( _mm256_maskload_pd(ca + i, mask), _mm256_maskload_pd(f + i, mask) );
+        const __m256d   drive   = _mm256_mul_pd( _mm256_maskload_pd(cb + i, mask), _mm256_sub_pd(da, db) );
+        _mm256_maskstore_pd( f + i, mask, _mm256_add_pd(self, drive) );
+    }
+    return;
+}
+
+CB_FDTD_TARGET("avx2") CB_FDTD_NO_CONTRACT
+inline void yee2_avx2(float * f, const float * ca, const float * cb, const float * a_hi, const float * a_lo,
+                      const float * b_hi, const float * b_lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 8ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m256    da      = _mm256_sub_ps( _mm256_loadu_ps(a_hi + i), _mm256_loadu_ps(a_lo + i) );
+        const __m256    db      = _mm256_sub_ps( _mm256_loadu_ps(b_hi + i), _mm256_loadu_ps(b_lo + i) );
+        const __m256    self    = _mm256_mul_ps( _mm256_loadu_ps(ca + i), _mm256_loadu_ps(f + i) );
+        const __m256    drive   = _mm256_mul_ps( _mm256_loadu_ps(cb + i), _mm256_sub_ps(da, db) );
+        _mm256_storeu_ps( f + i, _mm256_add_ps(self, drive) );
+    }
+    if (i < n) {
+        const __m256i   mask    = _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast<int>(n - i) ), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) );
+        const __m256    da      = _mm256_sub_ps( _mm256_maskload_ps(a_hi + i, mask), _mm256_maskload_ps(a_lo + i, mask) );
+        const __m256    db      = _mm256_sub_ps( _mm256_maskload_ps(b_hi + i, mask), _mm256_maskload_ps(b_lo + i, mask) );
+        const __m256    self    = _mm256_mul_ps( _mm256_maskload_ps(ca + i, mask), _mm256_maskload_ps(f + i, mask) );
+        const __m256    drive   = _mm256_mul_ps( _mm256_maskload_ps(cb + i, mask), _mm256_sub_ps(da, db) );
+        _mm256_maskstore_ps( f + i, mask, _mm256_add_ps(self, drive) );
+    }
+    return;
+}
+
+CB_FDTD_TARGET("avx512f") CB_FDTD_NO_CONTRACT
+inline void yee2_avx512(double * f, const double * ca, const double * cb, const double * a_hi, const double * a_lo,
+                        const double * b_hi, const double * b_lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 8ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m512d   da      = _mm512_sub_pd( _mm512_loadu_pd(a_hi + i), _mm512_loadu_pd(a_lo + i) );
+        const __m512d   db      = _mm512_sub_pd( _mm512_loadu_pd(b_hi + i), _mm512_loadu_pd(b_lo + i) );
+        const __m512d   self    = _mm512_mul_pd( _mm512_loadu_pd(ca + i), _mm512_loadu_pd(f + i) );
+        const __m512d   drive   = _mm512_mul_pd( _mm512_loadu_pd(cb + i), _mm512_sub_pd(da, db) );
+        _mm512_storeu_pd( f + i, _mm512_add_pd(self, drive) );
+    }
+    if (i < n) {
+        const __mmask8  mask    = static_cast<__mmask8>( (1u << (n - i)) - 1u );
+        const __m512d   da      = _mm512_sub_pd( _mm512_maskz_loadu_pd(mask, a_hi + i), _mm512_maskz_loadu_pd(mask, a_lo + i) );
+        const __m512d   db      = _mm512_sub_pd( _mm512_maskz_loadu_pd(mask, b_hi + i), _mm512_maskz_loadu_pd(mask, b_lo + i) );
+        const __m512d   self    = _mm512_mul_pd( _mm512_maskz_loadu_pd(mask, ca + i), _mm512_maskz_loadu_pd(mask, f + i) );
+        const __m512d   drive   = _mm512_mul_pd( _mm512_maskz_loadu_pd(mask, cb + i), _mm512_sub_pd(da, db) );
+        _mm512_mask_storeu_pd( f + i, mask, _mm512_add_pd(self, drive) );
+    }
+    return;
+}
+
+CB_FDTD_TARGET("avx512f") CB_FDTD_NO_CONTRACT
+inline void yee2_avx512(float * f, const float * ca, const float * cb, const float * a_hi, const float * a_lo,
+                        const float * b_hi, const float * b_lo, const std::size_t n) noexcept
+{
+    constexpr std::size_t   L       = 16ULL;
+    std::size_t             i       = 0ULL;
+    for (; i + L <= n; i += L) {
+        const __m512    da      = _mm512_sub_ps( _mm512_loadu_ps(a_hi + i), _mm512_loadu_ps(a_lo + i) );
+        const __m512    db      = _mm512_sub_ps( _mm512_loadu_ps(b_hi + i), _mm512_loadu_ps(b_lo + i) );
+        const __m512    self    = _mm512_mul_ps( _mm512_loadu_ps(ca + i), _mm512_loadu_ps(f + i) );
+        const __m512    drive   = _mm512_mul_ps( _mm512_loadu_ps(cb + i), _mm512_sub_ps(da, db) );
+        _mm512_storeu_ps( f + i, _mm512_add_ps(self, drive) );
+    }
+    if (i < n) {
+        const __mmask16 mask    = static_cast<__mmask16>( (1u << (n - i)) - 1u );
+        const __m512    da      = _mm512_sub_ps( _mm512_maskz_loadu_ps(mask, a_hi + i), _mm512_maskz_loadu_ps(mask, a_lo + i) );
+        const __m512    db      = _mm512_sub_ps( _mm512_maskz_loadu_ps(mask, b_hi + i), _mm512_maskz_loadu_ps(mask, b_lo + i) );
+        const __m512    self    = _mm512_mul_ps( _mm512_maskz_loadu_ps(mask, ca + i), _mm512_maskz_loadu_ps(mask, f + i) );
+        const __m512    drive   = _mm512_mul_ps( _mm512_maskz_loadu_ps(mask, cb + i), _mm512_sub_ps(da, db) );
+        _mm512_mask_storeu_ps( f + i, mask, _mm512_add_ps(self, drive) );
+    }
+    return;
+}
+#endif  //  CB_FDTD_X86_SIMD  //
+
+
+}// END NAMESPACE "kernel".
+
+
+
+//  "yee_update"
+//      f[i] = ca[i]*f[i] + cb[i]*(hi[i] - lo[i])   for  i in [0, n),  on the requested path.
+//
+template< typename T >
+inline void yee_update(T * f, const T * ca, const T * cb, const T * hi, const T * lo, const std::size_t n,
+                       const SimdLevel level = simd_level()) noexcept
+{
+#if CB_FDTD_X86_SIMD
+    if constexpr ( std::is_same_v<T, double> || std::is_same_v<T, float> ) {
+        switch (level) {
+            case SimdLevel::AVX512  : { kernel::yee_avx512(f, ca, cb, hi, lo, n);     return; }
+            case SimdLevel::AVX2    : { kernel::yee_avx2(f, ca, cb, hi, lo, n);       return; }
+            default                 : { break; }
+        }
+    }
+#endif  //  CB_FDTD_X86_SIMD  //
+    (void)level;
+    kernel::yee_scalar(f, ca, cb, hi, lo, n);
+    return;
+}
+
+
+//  "yee_update2"
+//      f[i] = ca[i]*f[i] + cb[i]*( (a_hi[i] - a_lo[i]) - (b_hi[i] - b_lo[i]) )   for  i in [0, n).
+//      Evaluated as  SUB, SUB, MUL, SUB, MUL, ADD  on every path.
+//
+template< typename T >
+inline void yee_update2(T * f, const T * ca, const T * cb, const T * a_hi, const T * a_lo, const T * b_hi, const T * b_lo,
+                        const std::size_t n, const SimdLevel level = simd_level()) noexcept
+{
+#if CB_FDTD_X86_SIMD
+    if constexpr ( std::is_same_v<T, double> || std::is_same_v<T, float> ) {
+        switch (level) {
+            case SimdLevel::AVX512  : { kernel::yee2_avx512(f, ca, cb, a_hi, a_lo, b_hi, b_lo, n);     return; }
+            case SimdLevel::AVX2    : { kernel::yee2_avx2(f, ca, cb, a_hi, a_lo, b_hi, b_lo, n);       return; }
+            default                 : { break; }
+        }
+    }
+#endif  //  CB_FDTD_X86_SIMD  //
+    (void)level;
+    kernel::yee2_scalar(f, ca, cb, a_hi, a_lo, b_hi, b_lo, n);
+    return;
+}
+
+
+//  "update_H_1D"
+//      Hy[m] = chyH[m]*Hy[m] + chyE[m]*(Ez[m+1] - Ez[m])       for  m in [0, NX-1).
+//
+template< typename T >
+inline void update_H_1D(T * Hy, const T * Ez, const T * chyH, const T * chyE, const std::size_t NX,
+                        const SimdLevel level = simd_level()) noexcept
+{
+    if (NX < 2ULL)      { return; }
+    yee_update(Hy, chyH, chyE, Ez + 1, Ez, NX - 1ULL, level);
+    return;
+}
+
+
+//  "update_E_1D"
+//      Ez[m] = cezE[m]*Ez[m] + cezH[m]*(Hy[m] - Hy[m-1])       for  m in [1, NX-1).
+//
+template< typename T >
+inline void update_E_1D(T * Ez, const T * Hy, const T * cezE, const T * cezH, const std::size_t NX,
+                        const SimdLevel level = simd_level()) noexcept
+{
+    if (NX < 3ULL)      { return; }
+    yee_update(Ez + 1, cezE + 1, cezH + 1, Hy + 1, Hy, NX - 2ULL, level);
+    return;
+}
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_KERNELS_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
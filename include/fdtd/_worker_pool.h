@@ -0,0 +1,413 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****           _ W O R K E R _ P O O L . H  ____  F I L E       ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/_worker_pool.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_WORKER_POOL_H
+#define _CB_FDTD_WORKER_POOL_H  1
+
+
+//  0.1     "CBAPP" HEADERS...
+#include "utility/_task_scheduler.h"
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <exception>
+
+#include <cstdint>
+#include <cstddef>
+
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+
+//  0.3     PLATFORM HEADERS...
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      0.      HELPERS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "default_thread_count"
+//
+[[nodiscard]] inline std::size_t default_thread_count(void) noexcept
+{ return std::max<std::size_t>( 1ULL, static_cast<std::size_t>(std::thread::hardware_concurrency()) ); }
+
+
+//  "ScopedPin"
+//      Bind the CALLING thread to logical CPU "cpu" and restore its previous affinity on destruction, so a borrowed
+//      scheduler worker goes back exactly as it came.  Best-effort:  "pinned()" is false where the OS refuses or has
+//      no hard affinity (macOS only offers affinity *hints*, so it is left to the scheduler there).
+//
+class ScopedPin {
+public:
+    inline explicit                     ScopedPin               (const std::size_t cpu, const bool enable = true) noexcept
+    {
+        if ( !enable )      { return; }
+#if defined(_WIN32)
+        if (cpu < 64ULL)    { this->m_saved = ::SetThreadAffinityMask( ::GetCurrentThread(), DWORD_PTR(1) << cpu );  this->m_pinned = (this->m_saved != 0); }
+#elif defined(__linux__)
+        if ( cpu >= CPU_SETSIZE  ||  ::pthread_getaffinity_np(::pthread_self(), sizeof(this->m_saved), &this->m_saved) != 0 )     { return; }
+        cpu_set_t       set;
+        CPU_ZERO(&set);
+        CPU_SET(static_cast<int>(cpu), &set);
+        this->m_pinned      = ( ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0 );
+#else
+        (void)cpu;
+#endif
+    }
+
+    inline                              ~ScopedPin              (void)
+    {
+        if ( !this->m_pinned )  { return; }
+#if defined(_WIN32)
+        ::SetThreadAffinityMask( ::GetCurrentThread(), this->m_saved );
+#elif defined(__linux__)
+        ::pthread_setaffinity_np( ::pthread_self(), sizeof(this->m_saved), &this->m_saved );
+#endif
+    }
+
+    inline                              ScopedPin               (const ScopedPin & )            = delete;
+    inline ScopedPin &                  operator =              (const ScopedPin & )            = delete;
+
+    [[nodiscard]] inline bool           pinned                  (void) const noexcept   { return this->m_pinned; }
+
+private:
+    bool                                m_pinned                = false;
+#if defined(_WIN32)
+    DWORD_PTR                           m_saved                 = 0;
+#elif defined(__linux__)
+    cpu_set_t                           m_saved                 {   };
+#endif
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY CLASS DECLARATION:
+//         Persistent Worker Pool  (resident on the application-wide TaskScheduler).
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "WorkerPool"
+//      "size() - 1" RESIDENT participants plus the CALLING thread.  A resident is one long-lived task on
+//      "utl::TaskScheduler::instance()":  it pins the scheduler worker it runs on to CPU "slot" (restored when it
+//      leaves) and then serves dispatch after dispatch.  No thread is ever created here, so the solvers, the frame
+//      sinks and all other background work share one set of workers and never oversubscribe the cores.
+//
+//      -   "run(fn)" hands ONE job to every participant and returns once all of them have finished it, so each call
+//          is a full barrier.  The solvers issue one "run" per half-step (H, then E).  Jobs are passed by reference:
+//          a half-step allocates nothing.
+//      -   Participant ids are CLAIMED per dispatch, and the caller claims too.  A resident that is not attached yet
+//          (still queued, skipped after "shutdown", or already handed back) simply leaves its ids to whoever is
+//          running, so "run" never waits on a thread that has not started.
+//      -   Between dispatches a resident polls "ms_SPIN" times, then hands its worker back to the scheduler and the
+//          next "run" re-submits it.  Steady stepping therefore keeps the same pinned workers, and an idle engine
+//          holds none of them.  "size()" is capped at the scheduler's worker count, so a solver stepped from the
+//          GUI thread always leaves one worker free for other background work.
+//      -   The first exception thrown by any participant is re-thrown from "run".
+//      -   One job at a time:  concurrent callers are serialised;  "run" must NOT be called from inside a job.
+//
+class WorkerPool {
+// *************************************************************************** //
+public:
+    using       size_type           = std::size_t;
+    using       scheduler_t         = utl::TaskScheduler;
+    static constexpr size_type      ms_SPIN                 = 4096ULL;      //  Idle polls before a resident leaves.
+
+// *************************************************************************** //
+protected:
+    using       invoke_t            = void (*)(const void * job, size_type id, size_type participants);
+    static constexpr unsigned       ms_ID_BITS              = 16U;          //  "ticket" = (epoch << 16) | next id.
+    static constexpr std::uint64_t  ms_ID_MASK              = (std::uint64_t(1) << ms_ID_BITS) - 1ULL;
+
+    //  "Shared"
+    //      Everything a resident touches.  Owned jointly by the pool and its residents, so a resident that only
+    //      starts (or finishes polling) after the pool is gone never dangles.
+    struct Shared {
+        size_type                               size            = 1ULL;
+        bool                                    pin             = true;
+        std::atomic<std::uint64_t>              ticket          { 0ULL };
+        std::atomic<size_type>                  done            { 0ULL };
+        std::atomic<size_type>                  pinned          { 0ULL };
+        std::atomic<bool>                       stop            { false };
+        std::unique_ptr<std::atomic<bool>[]>    attached;                       //  Per slot:  a resident is queued or running.
+        invoke_t                                invoke          = nullptr;
+        const void *                            job             = nullptr;
+        std::exception_ptr                      error;
+        std::mutex                              error_mtx;
+    };
+//
+    scheduler_t &                       m_sched;
+    std::shared_ptr<Shared>             m_shared;
+    std::mutex                          m_submit;
+    utl::CancelToken                    m_token;
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //      "threads" counts the caller too ("1" = everything runs inline).  With "pin", resident "i" binds its worker to
+    //      logical CPU "i" (the caller is left alone).
+    //
+    inline explicit                     WorkerPool              (const size_type threads = default_thread_count(), const bool pin = true,
+                                                                 scheduler_t & sched = scheduler_t::instance())
+        : m_sched(sched), m_shared( std::make_shared<Shared>() ), m_token( sched.make_token() )
+    {
+        Shared &            S       = *this->m_shared;
+        S.size                      = std::clamp<size_type>( threads, 1ULL, std::min<size_type>(sched.size(), ms_ID_MASK) );
+        S.pin                       = pin;
+        S.attached                  = std::make_unique<std::atomic<bool>[]>(S.size);
+        for (size_type i = 0ULL; i < S.size; ++i)   { S.attached[i].store(false, std::memory_order_relaxed); }
+    }
+
+    //  Destructor.
+    //      Residents notice "stop" within one poll and hand their workers back;  nothing here waits for them.
+    //
+    inline                              ~WorkerPool             (void)
+    { this->m_shared->stop.store(true, std::memory_order_release); }
+
+    inline                              WorkerPool              (const WorkerPool & )           = delete;
+    inline WorkerPool &                 operator =              (const WorkerPool & )           = delete;
+
+
+    //  "size" / "pinned"
+    [[nodiscard]] inline size_type      size                    (void) const noexcept   { return this->m_shared->size; }
+    [[nodiscard]] inline size_type      pinned                  (void) const noexcept   { return this->m_shared->pinned.load(std::memory_order_relaxed); }
+
+
+// *************************************************************************** //
+//
+//
+//    DISPATCH...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "run"
+    //      fn(id, participants)  for every participant id;  returns after the last one finishes.
+    //
+    template< typename Fn >
+    inline void                         run                     (Fn && fn)
+    {
+        using       fn_t        = std::remove_reference_t<Fn>;
+        Shared &            S   = *this->m_shared;
+        const size_type     P   = S.size;
+        if (P == 1ULL)      { fn(0ULL, 1ULL);   return; }
+
+        std::lock_guard<std::mutex>     lock    (this->m_submit);
+        S.invoke            = [](const void * job, const size_type id, const size_type n)
+                              { (*static_cast<fn_t *>( const_cast<void *>(job) ))(id, n); };
+        S.job               = static_cast<const void *>( std::addressof(fn) );
+        S.error             = nullptr;
+        S.done.store(0ULL, std::memory_order_relaxed);
+        const std::uint64_t epoch   = (S.ticket.load(std::memory_order_relaxed) >> ms_ID_BITS) + 1ULL;
+        S.ticket.store(epoch << ms_ID_BITS, std::memory_order_release);     //  Publishes the job.
+
+        this->attach();
+        serve(S, epoch);
+
+        for (size_type spin = 0ULL; ; ++spin)                   //  Barrier:  wait for every claimed id.
+        {
+            const size_type     d       = S.done.load(std::memory_order_acquire);
+            if (d == P)                     { break; }
+            if (spin >= ms_SPIN)            { S.done.wait(d, std::memory_order_acquire); }
+        }
+        S.job               = nullptr;
+
+        if (S.error)        { std::rethrow_exception( std::exchange(S.error, nullptr) ); }
+        return;
+    }
+
+
+    //  "parallel_for"
+    //      Split  [0, n)  into at most "size()" contiguous chunks of at least "grain" items and run  fn(begin, end)
+    //      on each.  Chunk boundaries are multiples of "align" (e.g. one cache line of values) so neighbouring
+    //      chunks never write the same line.  Small ranges run inline without waking anybody.
+    //
+    template< typename Fn >
+    inline void                         parallel_for            (const size_type n, Fn && fn, const size_type grain = 1ULL,
+                                                                 const size_type align = 1ULL)
+    {
+        if (n == 0ULL)      { return; }
+        const size_type     a       = std::max<size_type>(align, 1ULL);
+        const size_type     chunks  = std::clamp<size_type>( n / std::max<size_type>(grain, 1ULL), 1ULL, this->size() );
+        if (chunks == 1ULL) { fn(0ULL, n);  return; }
+
+        const size_type     units   = (n + a - 1ULL) / a;
+        this->run([&](const size_type id, const size_type)
+        {
+            if (id >= chunks)   { return; }
+            const size_type     b   = std::min<size_type>(n, (units * id         / chunks) * a);
+            const size_type     e   = std::min<size_type>(n, (units * (id + 1ULL) / chunks) * a);
+            if (b < e)          { fn(b, e); }
+        });
+        return;
+    }
+
+
+    //  "parallel_for_each"
+    //      fn(i, id)  for every  i  in  [0, n),  handed out one at a time (dynamic load-balancing for uneven items).
+    //      "id" identifies the participant, e.g. to index per-thread scratch buffers of size "size()".
+    //
+    template< typename Fn >
+    inline void                         parallel_for_each       (const size_type n, Fn && fn)
+    {
+        if (n == 0ULL)      { return; }
+        std::atomic<size_type>      next    { 0ULL };
+        this->run([&](const size_type id, const size_type)
+        {
+            for (size_type i = next.fetch_add(1ULL, std::memory_order_relaxed); i < n;
+                 i = next.fetch_add(1ULL, std::memory_order_relaxed))
+                { fn(i, id); }
+        });
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "attach"
+    //      Re-submit every resident slot that has gone back to the scheduler.  Allocates only when one has left.
+    //
+    inline void                         attach                  (void)
+    {
+        const std::shared_ptr<Shared> &     S   = this->m_shared;
+        for (size_type slot = 1ULL; slot < S->size; ++slot)
+        {
+            if ( S->attached[slot].exchange(true, std::memory_order_acq_rel) )  { continue; }
+            this->m_sched.submit( [S, slot]{ resident(*S, slot); }, utl::TaskPriority::High, this->m_token );
+        }
+        return;
+    }
+
+    //  "serve"
+    //      Claim and run ids of dispatch "epoch" until none are left.  Returns false once a newer dispatch exists.
+    //
+    static inline bool                  serve                   (Shared & S, const std::uint64_t epoch) noexcept
+    {
+        std::uint64_t       t       = S.ticket.load(std::memory_order_acquire);
+        for (;;)
+        {
+            if ( (t >> ms_ID_BITS) != epoch )           { return false; }
+            const size_type     id      = static_cast<size_type>(t & ms_ID_MASK);
+            if (id >= S.size)                           { return true;  }
+            if ( !S.ticket.compare_exchange_weak(t, t + 1ULL, std::memory_order_acq_rel, std::memory_order_acquire) )
+                { continue; }
+
+            try                 { S.invoke(S.job, id, S.size); }            //  The job outlives every unfinished id.
+            catch (...)         {
+                std::lock_guard<std::mutex>     lock    (S.error_mtx);
+                if (!S.error)       { S.error = std::current_exception(); }
+            }
+            if ( S.done.fetch_add(1ULL, std::memory_order_acq_rel) + 1ULL == S.size )
+                { S.done.notify_one(); }
+            t                   = S.ticket.load(std::memory_order_acquire);
+        }
+    }
+
+    //  "resident"
+    //      Body of one resident task:  pin, serve every new dispatch, hand the worker back once idle or stopped.
+    //
+    static inline void                  resident                (Shared & S, const size_type slot) noexcept
+    {
+        const ScopedPin     pin     ( slot % default_thread_count(), S.pin );
+        if ( pin.pinned() )     { S.pinned.fetch_add(1ULL, std::memory_order_relaxed); }
+
+        std::uint64_t       seen    = S.ticket.load(std::memory_order_acquire) >> ms_ID_BITS;
+        serve(S, seen);                                             //  The current dispatch, if any ids are left.
+        for (;;)
+        {
+            for (size_type spin = 0ULL; spin < ms_SPIN; ++spin)
+            {
+                if ( S.stop.load(std::memory_order_acquire) )      { break; }
+                const std::uint64_t     now     = S.ticket.load(std::memory_order_acquire) >> ms_ID_BITS;
+                if (now != seen)        { seen = now;  serve(S, now);  spin = 0ULL; }
+                else                    { std::this_thread::yield(); }
+            }
+
+            //      Leave, then look once more:  a "run" that still saw us attached did not re-submit this slot.
+            S.attached[slot].store(false, std::memory_order_seq_cst);
+            const bool          open    = ( S.ticket.load(std::memory_order_seq_cst) & ms_ID_MASK ) < S.size;
+            if ( S.stop.load(std::memory_order_acquire)  ||  !open
+                 ||  S.attached[slot].exchange(true, std::memory_order_acq_rel) )   { break; }
+        }
+
+        if ( pin.pinned() )     { S.pinned.fetch_sub(1ULL, std::memory_order_relaxed); }
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "WorkerPool" INLINE CLASS DEFINITION.
+};
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_WORKER_POOL_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
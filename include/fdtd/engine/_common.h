@@ -0,0 +1,231 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****               _ C O M M O N . H  ____  F I L E             ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/engine/_common.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ENGINE_COMMON_H
+#define _CB_FDTD_ENGINE_COMMON_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/_fdtd_impl.h"
+#include "fdtd/_kernels.h"
+#include "fdtd/_worker_pool.h"
+#include "fdtd/entities/_sources.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+
+#include <cmath>
+#include <cstdint>
+
+#include <vector>
+#include <array>
+
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      0.      MATERIALS AND UPDATE COEFFICIENTS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "Material"
+//      Per-cell material, in the same terms the 1D engine uses:    relative permittivity / permeability, and the
+//      dimensionless electric / magnetic loss factors  ( sigma * dt / (2 * eps) ).
+//
+template< typename T = double >
+struct Material {
+    T                   eps_r           = T(1);
+    T                   mu_r            = T(1);
+    T                   loss            = T(0);         //  Electric.
+    T                   mloss           = T(0);         //  Magnetic.
+};
+
+
+//  "YeeCoefficients"
+//      Update coefficients of one cell.    With  Sc = 1  these are exactly the 1D "thin_film" coefficients:
+//
+//          Ce_e = (1 - loss) / (1 + loss)              Ce_h = Sc * eta_0 / eps_r / (1 + loss)
+//          Ch_h = (1 - mloss) / (1 + mloss)            Ch_e = Sc / eta_0 / mu_r  / (1 + mloss)
+//
+template< typename T = double >
+struct YeeCoefficients {
+    T                   ce_e            = T(1);
+    T                   ce_h            = T(0);
+    T                   ch_h            = T(1);
+    T                   ch_e            = T(0);
+};
+
+
+//  "make_coefficients"
+//
+template< typename T >
+[[nodiscard]] inline YeeCoefficients<T> make_coefficients(const Material<T> & mat, const T Sc) noexcept
+{
+    const T                 eta_0       = static_cast<T>(spc::eta_0);
+    YeeCoefficients<T>      c;
+    c.ce_e                  = (T(1) - mat.loss ) / (T(1) + mat.loss );
+    c.ce_h                  = Sc * eta_0 / mat.eps_r / (T(1) + mat.loss );
+    c.ch_h                  = (T(1) - mat.mloss) / (T(1) + mat.mloss);
+    c.ch_e                  = Sc / eta_0 / mat.mu_r  / (T(1) + mat.mloss);
+    return c;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      SOURCES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "WaveformType"
+//
+enum class WaveformType : uint8_t {
+    Gaussian, Ricker, Harmonic,
+//
+    COUNT
+};
+//
+//  "DEF_WAVEFORM_TYPE_NAMES"
+inline static const std::array<const char *, static_cast<size_t>(WaveformType::COUNT)>
+DEF_WAVEFORM_TYPE_NAMES         = {{
+    "Gaussian Pulse",       "Ricker Wavelet",       "Time-Harmonic"
+}};
+
+
+//  "Waveform"
+//      Same three source functions as "FDTD_1D" (gaussian_source, ricker_source, harmonic_source), evaluated at the
+//      source cell ("m = 0").
+//
+template< typename T = double >
+struct Waveform {
+    WaveformType        type            = WaveformType::Gaussian;
+    T                   delay           = T(30);        //  Gaussian: peak time-step.   Harmonic: ramp-up length [steps].
+    T                   width           = T(10);        //  Gaussian: 1/e half-width [steps].
+    T                   wavelen         = T(25);        //  Ricker / Harmonic: points per wavelength.
+    T                   num_periods     = T(10);        //  Harmonic: switches off after  num_periods * delay  steps.
+    T                   Sc              = T(1);
+
+    //  "operator ()"
+    [[nodiscard]] inline T operator ()  (const T q) const noexcept
+    {
+        constexpr T     pi      = static_cast<T>(spc::pi);
+        switch (this->type)
+        {
+            case WaveformType::Ricker   : {
+                const T     pi_2    = pi * pi;
+                const T     term    = std::pow( (this->Sc * q) / this->wavelen - T(1), T(2) );
+                return (T(1) - T(2) * pi_2 * term) * std::exp(-pi_2 * term);
+            }
+            case WaveformType::Harmonic : {
+                const T     q_total = this->num_periods * this->delay;
+                const T     t_soft  = q_total / this->num_periods;
+                const T     ON      = T(1) - static_cast<T>(q >= q_total);
+                const T     ramp    = std::min( q / t_soft, T(1) );
+                return ON * ramp * std::sin( (T(2) * pi / this->wavelen) * (this->Sc * q) );
+            }
+            default                     : { break; }
+        }
+        const T     arg     = (q - this->delay) / this->width;
+        return std::exp( -arg * arg );
+    }
+};
+
+
+//  "PointSource"
+//      One driven cell.    "Hard" sources overwrite the field, "Soft" sources add to it;  "E" sources act after the
+//      E half-step, "B" sources after the H half-step.  "component" selects x / y / z (2D TMz engines only use z).
+//
+template< typename T = double >
+struct PointSource {
+    std::size_t         cell            = 0ULL;         //  Linear cell index ("Engine::index").
+    SourceType          type            = SourceType::SoftE;
+    uint8_t             component       = 2;            //  0 = x,  1 = y,  2 = z.
+    T                   amplitude       = T(1);
+    Waveform<T>         wave            = {};
+};
+
+
+//  "is_E_source" / "is_hard_source"
+[[nodiscard]] inline constexpr bool is_E_source     (const SourceType t) noexcept   { return t == SourceType::HardE || t == SourceType::SoftE; }
+[[nodiscard]] inline constexpr bool is_hard_source  (const SourceType t) noexcept   { return t == SourceType::HardE || t == SourceType::HardB; }
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      2.      DECOMPOSITION...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "TileCFG"
+//      Cache-blocking of one slab.     "rows" = rows per tile (y in 2D / 3D),  "cols" = contiguous values per row
+//      segment (z in 3D;  y in 2D).     A tile of each live array should sit comfortably in L2.
+//
+struct TileCFG {
+    std::size_t         rows            = 16ULL;
+    std::size_t         cols            = 1024ULL;
+};
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ENGINE_COMMON_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -0,0 +1,263 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****          _ E N G I N E _ B A S E . H  ____  F I L E        ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/engine/_engine_base.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ENGINE_BASE_H
+#define _CB_FDTD_ENGINE_BASE_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/engine/_common.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+#include <limits>
+
+#include <cmath>
+#include <cstdint>
+
+#include <vector>
+#include <array>
+#include <span>
+#include <memory>
+
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Common State of the 2D / 3D Yee Engines.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "EngineBase"
+//      Owns the single aligned arena (structure-of-arrays), the per-cell update coefficients, the sources, the
+//      persistent worker pool (resident on the task scheduler) and the tiling settings.  Derived engines only add their
+//      geometry and their update loops.
+//
+//      Arena slots  0 ... 3  are the per-cell coefficients  (Ce_e, Ce_h, Ch_h, Ch_e);  field slots follow.
+//      Materials are isotropic, so every E component of a cell shares  Ce_*  and every H component shares  Ch_*.
+//
+template< typename T = double >
+class EngineBase {
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       size_type           = std::size_t;
+    using       arena_t             = AlignedArena<value_type>;
+    using       material_t          = Material<value_type>;
+    using       coeffs_t            = YeeCoefficients<value_type>;
+    using       source_t            = PointSource<value_type>;
+    using       view_t              = std::span<value_type>;
+    using       const_view_t        = std::span<const value_type>;
+//
+    enum CoeffSlot : size_type { CEE = 0, CEH, CHH, CHE, NUM_COEFFS };
+    static constexpr size_type      npos                    = std::numeric_limits<size_type>::max();
+
+// *************************************************************************** //
+protected:
+    size_type                           m_cells                 = 0ULL;
+    value_type                          m_Sc                    = value_type(0);
+    std::unique_ptr<WorkerPool>         m_pool;
+    TileCFG                             m_tile                  = {};
+    arena_t                             m_arena;
+    std::vector<source_t>               m_sources;
+    size_type                           m_step                  = 0ULL;
+//
+    std::array<size_type, 3>            m_E_slots               = { npos, npos, npos };     //  x, y, z  ===>  arena slot.
+    std::array<size_type, 3>            m_H_slots               = { npos, npos, npos };
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //      "Sc_max" is the Courant limit of the derived geometry (1/sqrt(D)).
+    //
+    inline                              EngineBase              (const size_type cells, const size_type num_fields, const value_type Sc,
+                                                                 const value_type Sc_max, const size_type threads)
+        : m_cells(cells), m_Sc(Sc), m_pool( std::make_unique<WorkerPool>(threads) ),
+          m_arena(NUM_COEFFS + num_fields, cells)
+    {
+        if ( !(Sc > value_type(0)) || Sc > Sc_max * (value_type(1) + std::numeric_limits<value_type>::epsilon()) )
+            { throw std::invalid_argument("EngineBase: Courant number must lie in (0, 1/sqrt(D)]."); }
+        this->fill_material( material_t{} );
+    }
+
+    inline virtual                      ~EngineBase             (void)                          = default;
+
+
+// *************************************************************************** //
+//
+//
+//    SETTINGS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    [[nodiscard]] inline size_type      cells                   (void) const noexcept   { return this->m_cells;     }
+    [[nodiscard]] inline value_type     Sc                      (void) const noexcept   { return this->m_Sc;        }
+    [[nodiscard]] inline size_type      step_count              (void) const noexcept   { return this->m_step;      }
+    [[nodiscard]] inline size_type      threads                 (void) const noexcept   { return this->m_pool->size(); }
+    [[nodiscard]] inline size_type      pinned                  (void) const noexcept   { return this->m_pool->pinned(); }
+    [[nodiscard]] inline const TileCFG & tiling                 (void) const noexcept   { return this->m_tile;      }
+    [[nodiscard]] inline size_type      bytes                   (void) const noexcept   { return this->m_arena.bytes(); }
+
+    //  "set_threads"
+    //      Re-builds the pool.  Its residents are scheduler workers, so no thread is created here either.
+    inline void                         set_threads             (const size_type n)
+    { if ( n != this->threads() )   { this->m_pool = std::make_unique<WorkerPool>(n); } }
+    inline void                         set_tiling              (const TileCFG & t) noexcept
+    { this->m_tile = { std::max<size_type>(t.rows, 1ULL), std::max<size_type>(t.cols, 1ULL) }; }
+
+
+// *************************************************************************** //
+//
+//
+//    MATERIALS / COEFFICIENTS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "set_coefficients"
+    //      Raw per-cell coefficients, for callers that build them the way the 1D engine does.
+    inline void                         set_coefficients        (const size_type cell, const coeffs_t & c) noexcept
+    {
+        this->m_arena.data(CEE)[cell]   = c.ce_e;
+        this->m_arena.data(CEH)[cell]   = c.ce_h;
+        this->m_arena.data(CHH)[cell]   = c.ch_h;
+        this->m_arena.data(CHE)[cell]   = c.ch_e;
+        return;
+    }
+
+    //  "set_material"
+    inline void                         set_material            (const size_type cell, const material_t & mat) noexcept
+    { this->set_coefficients( cell, make_coefficients(mat, this->m_Sc) ); }
+
+    //  "fill_material"
+    inline void                         fill_material           (const material_t & mat) noexcept
+    {
+        const coeffs_t      c       = make_coefficients(mat, this->m_Sc);
+        this->m_arena.fill(CEE, c.ce_e);    this->m_arena.fill(CEH, c.ce_h);
+        this->m_arena.fill(CHH, c.ch_h);    this->m_arena.fill(CHE, c.ch_e);
+        return;
+    }
+
+    //  "coefficient"
+    [[nodiscard]] inline const_view_t   coefficient             (const CoeffSlot s) const noexcept  { return this->m_arena.span(s); }
+
+
+// *************************************************************************** //
+//
+//
+//    SOURCES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    inline void                         add_source              (const source_t & src)
+    {
+        if (src.cell >= this->m_cells)      { throw std::out_of_range("EngineBase: source cell lies outside the grid."); }
+        const auto &    slots   = is_E_source(src.type) ? this->m_E_slots : this->m_H_slots;
+        if ( src.component > 2 || slots[src.component] == npos )
+            { throw std::invalid_argument("EngineBase: this engine has no such field component."); }
+        this->m_sources.push_back(src);
+        return;
+    }
+    inline void                         clear_sources           (void) noexcept     { this->m_sources.clear(); }
+    [[nodiscard]] inline const std::vector<source_t> &  sources (void) const noexcept   { return this->m_sources; }
+
+
+// *************************************************************************** //
+//
+//
+//    FIELDS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "reset"
+    //      Zero every field and the step counter;  materials and sources are kept.
+    inline void                         reset                   (void) noexcept
+    {
+        for (size_type s = NUM_COEFFS; s < this->m_arena.count(); ++s)  { this->m_arena.fill(s, value_type(0)); }
+        this->m_step        = 0ULL;
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "field"
+    [[nodiscard]] inline view_t         field                   (const size_type slot) noexcept         { return this->m_arena.span(slot); }
+    [[nodiscard]] inline const_view_t   field                   (const size_type slot) const noexcept   { return this->m_arena.span(slot); }
+
+    //  "apply_sources"
+    //      Drive every E (or H) source for the current time-step.
+    inline void                         apply_sources           (const bool E) noexcept
+    {
+        const value_type    q       = static_cast<value_type>(this->m_step);
+        for (const source_t & src : this->m_sources)
+        {
+            if ( is_E_source(src.type) != E )   { continue; }
+            value_type &    f       = this->m_arena.data( (E ? this->m_E_slots : this->m_H_slots)[src.component] )[src.cell];
+            const value_type    v   = src.amplitude * src.wave(q);
+            f                       = is_hard_source(src.type) ? v : f + v;
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "EngineBase" INLINE CLASS DEFINITION.
+};
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ENGINE_BASE_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
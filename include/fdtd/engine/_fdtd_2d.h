@@ -0,0 +1,244 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****              _ F D T D _ 2 D . H  ____  F I L E            ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/engine/_fdtd_2d.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ENGINE_FDTD_2D_H
+#define _CB_FDTD_ENGINE_FDTD_2D_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/engine/_engine_base.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         2-Dimensional  TMz  Yee Engine.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FDTD_2D"
+//      TMz polarisation  (Ez, Hx, Hy)  on an  NX x NY  grid;  cell (m, n) lives at  m * NY + n  (y contiguous).
+//
+//          Hx(m,n)  =  Ch_h * Hx  -  Ch_e * ( Ez(m,n+1) - Ez(m,n) )                    m < NX,      n < NY-1
+//          Hy(m,n)  =  Ch_h * Hy  +  Ch_e * ( Ez(m+1,n) - Ez(m,n) )                    m < NX-1,    n < NY
+//          Ez(m,n)  =  Ce_e * Ez  +  Ce_h * ( (Hy(m,n) - Hy(m-1,n)) - (Hx(m,n) - Hx(m,n-1)) )     interior only
+//
+//      Outer Ez is never updated (PEC walls).  Each half-step is ONE dispatch to the persistent worker pool, split into
+//      x-slabs;  each slab walks y in segments of "tiling().cols" so the rows m and m+1 of a segment stay cache-resident.
+//
+template< typename T = double >
+class FDTD_2D : public EngineBase<T> {
+// *************************************************************************** //
+public:
+    using       base                = EngineBase<T>;
+    using       typename            base::value_type;
+    using       typename            base::size_type;
+    using       typename            base::view_t;
+    using       typename            base::const_view_t;
+    using       base::CEE;          using       base::CEH;          using       base::CHH;          using       base::CHE;
+//
+    enum FieldSlot : size_type { EZ = base::NUM_COEFFS, HX, HY, NUM_SLOTS };
+    static constexpr value_type     ms_SC_MAX               = value_type(0.707106781186547524400844362104849039L);
+
+// *************************************************************************** //
+protected:
+    size_type                           m_NX                    = 0ULL;
+    size_type                           m_NY                    = 0ULL;
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //
+    inline                              FDTD_2D                 (const size_type NX, const size_type NY, const value_type Sc = ms_SC_MAX,
+                                                                 const size_type threads = default_thread_count())
+        : base(NX * NY, NUM_SLOTS - EZ, Sc, ms_SC_MAX, threads), m_NX(NX), m_NY(NY)
+    {
+        if (NX < 3ULL || NY < 3ULL)     { throw std::invalid_argument("FDTD_2D: grid must be at least 3 x 3."); }
+        this->m_E_slots     = { base::npos, base::npos, EZ };
+        this->m_H_slots     = { HX, HY, base::npos };
+    }
+
+
+    //  "nx" / "ny" / "index"
+    [[nodiscard]] inline size_type      nx                      (void) const noexcept   { return this->m_NX; }
+    [[nodiscard]] inline size_type      ny                      (void) const noexcept   { return this->m_NY; }
+    [[nodiscard]] inline size_type      index                   (const size_type m, const size_type n) const noexcept   { return m * this->m_NY + n; }
+
+    //  Fields.
+    [[nodiscard]] inline view_t         Ez                      (void) noexcept         { return this->field(EZ); }
+    [[nodiscard]] inline view_t         Hx                      (void) noexcept         { return this->field(HX); }
+    [[nodiscard]] inline view_t         Hy                      (void) noexcept         { return this->field(HY); }
+    [[nodiscard]] inline const_view_t   Ez                      (void) const noexcept   { return this->field(EZ); }
+    [[nodiscard]] inline const_view_t   Hx                      (void) const noexcept   { return this->field(HX); }
+    [[nodiscard]] inline const_view_t   Hy                      (void) const noexcept   { return this->field(HY); }
+
+
+    //  "set_box"
+    //      Material of every cell in  [m0, m1) x [n0, n1)   (2D analogue of "FDTD_1D::create_film").
+    inline void                         set_box                 (const size_type m0, const size_type m1, const size_type n0, const size_type n1,
+                                                                 const typename base::material_t & mat) noexcept
+    {
+        const auto      c       = make_coefficients(mat, this->m_Sc);
+        for (size_type m = m0; m < std::min(m1, this->m_NX); ++m)
+            for (size_type n = n0; n < std::min(n1, this->m_NY); ++n)
+                this->set_coefficients( this->index(m, n), c );
+        return;
+    }
+
+
+    //  "step"
+    //      One full time-step:  H half-step, H sources, E half-step, E sources.
+    inline void                         step                    (void)
+    {
+        this->update_H();
+        this->apply_sources(false);
+        this->update_E();
+        this->apply_sources(true);
+        ++this->m_step;
+        return;
+    }
+
+    //  "run"
+    //      "NT" steps;  "on_step(q, engine)" is called after each one (e.g. to record a probe).
+    template< typename Fn = std::nullptr_t >
+    inline void                         run                     (const size_type NT, Fn && on_step = nullptr)
+    {
+        for (size_type q = 0ULL; q < NT; ++q) {
+            this->step();
+            if constexpr ( !std::is_same_v<std::decay_t<Fn>, std::nullptr_t> )     { on_step(q, *this); }
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    UPDATE LOOPS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "update_H"
+    inline void                         update_H                (void)
+    {
+        const size_type     NX      = this->m_NX,       NY      = this->m_NY,       seg     = this->m_tile.cols;
+        const SimdLevel     lvl     = simd_level();
+        value_type *        Hx      = this->m_arena.data(HX);
+        value_type *        Hy      = this->m_arena.data(HY);
+        const value_type *  Ez      = this->m_arena.data(EZ);
+        const value_type *  Chh     = this->m_arena.data(CHH);
+        const value_type *  Che     = this->m_arena.data(CHE);
+
+        this->m_pool->parallel_for(NX, [=](const size_type m_begin, const size_type m_end) {
+            for (size_type n0 = 0ULL; n0 < NY; n0 += seg)
+            {
+                const size_type     n1      = std::min(n0 + seg, NY);
+                const size_type     nx_end  = std::min<size_type>(n1, NY - 1ULL);  //  Hx:  n < NY-1.
+                for (size_type m = m_begin; m < m_end; ++m)
+                {
+                    const size_type     i       = m * NY + n0;
+                    //  -Ch_e * (Ez(n+1) - Ez(n))   ==   Ch_e * (Ez(n) - Ez(n+1))      (exact in IEEE arithmetic).
+                    if (n0 < nx_end)        { yee_update(Hx + i, Chh + i, Che + i, Ez + i, Ez + i + 1ULL, nx_end - n0, lvl); }
+                    if (m + 1ULL < NX)      { yee_update(Hy + i, Chh + i, Che + i, Ez + i + NY, Ez + i, n1 - n0, lvl);     }
+                }
+            }
+        });
+        return;
+    }
+
+    //  "update_E"
+    inline void                         update_E                (void)
+    {
+        const size_type     NX      = this->m_NX,       NY      = this->m_NY,       seg     = this->m_tile.cols;
+        const SimdLevel     lvl     = simd_level();
+        value_type *        Ez      = this->m_arena.data(EZ);
+        const value_type *  Hx      = this->m_arena.data(HX);
+        const value_type *  Hy      = this->m_arena.data(HY);
+        const value_type *  Cee     = this->m_arena.data(CEE);
+        const value_type *  Ceh     = this->m_arena.data(CEH);
+
+        this->m_pool->parallel_for(NX - 2ULL, [=](const size_type s_begin, const size_type s_end) {
+            for (size_type n0 = 0ULL; n0 < NY; n0 += seg)
+            {
+                const size_type     na      = std::max<size_type>(n0, 1ULL);
+                const size_type     nb      = std::min<size_type>(n0 + seg, NY - 1ULL);
+                if (na >= nb)       { continue; }
+                for (size_type m = s_begin + 1ULL; m < s_end + 1ULL; ++m)
+                {
+                    const size_type     i       = m * NY + na;
+                    yee_update2(Ez + i, Cee + i, Ceh + i, Hy + i, Hy + i - NY, Hx + i, Hx + i - 1ULL, nb - na, lvl);
+                }
+            }
+        });
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "FDTD_2D" INLINE CLASS DEFINITION.
+};
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ENGINE_FDTD_2D_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
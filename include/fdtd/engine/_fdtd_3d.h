@@ -0,0 +1,284 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****              _ F D T D _ 3 D . H  ____  F I L E            ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/engine/_fdtd_3d.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ENGINE_FDTD_3D_H
+#define _CB_FDTD_ENGINE_FDTD_3D_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/engine/_engine_base.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         3-Dimensional Yee Engine.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FDTD_3D"
+//      Full-vector Yee grid  (Ex, Ey, Ez, Hx, Hy, Hz)  on  NX x NY x NZ;  cell (m, n, p) lives at  (m * NY + n) * NZ + p
+//      (z contiguous).     Update equations and index ranges follow the standard staggered layout:
+//
+//          Hx  +=  ( dEy/dz - dEz/dy )     m < NX,      n < NY-1,    p < NZ-1
+//          Hy  +=  ( dEz/dx - dEx/dz )     m < NX-1,    n < NY,      p < NZ-1
+//          Hz  +=  ( dEx/dy - dEy/dx )     m < NX-1,    n < NY-1,    p < NZ
+//          Ex  +=  ( dHz/dy - dHy/dz )     m < NX-1,    0 < n < NY-1,    0 < p < NZ-1
+//          Ey  +=  ( dHx/dz - dHz/dx )     0 < m < NX-1,    n < NY-1,    0 < p < NZ-1
+//          Ez  +=  ( dHy/dx - dHx/dy )     0 < m < NX-1,    0 < n < NY-1,    p < NZ-1
+//
+//      Tangential E on the outer faces is never updated (PEC box).  Each half-step is ONE pool dispatch of x-slabs;
+//      inside a slab the (y, z) plane is walked in tiles of  "tiling().rows" x "tiling().cols"  with x innermost, so
+//      the tile of plane m+1 read by step m is still cached when step m+1 writes it.
+//
+template< typename T = double >
+class FDTD_3D : public EngineBase<T> {
+// *************************************************************************** //
+public:
+    using       base                = EngineBase<T>;
+    using       typename            base::value_type;
+    using       typename            base::size_type;
+    using       typename            base::view_t;
+    using       typename            base::const_view_t;
+    using       base::CEE;          using       base::CEH;          using       base::CHH;          using       base::CHE;
+//
+    enum FieldSlot : size_type { EX = base::NUM_COEFFS, EY, EZ, HX, HY, HZ, NUM_SLOTS };
+    static constexpr value_type     ms_SC_MAX               = value_type(0.577350269189625764509148780501957456L);
+
+// *************************************************************************** //
+protected:
+    size_type                           m_NX                    = 0ULL;
+    size_type                           m_NY                    = 0ULL;
+    size_type                           m_NZ                    = 0ULL;
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //
+    inline                              FDTD_3D                 (const size_type NX, const size_type NY, const size_type NZ,
+                                                                 const value_type Sc = ms_SC_MAX, const size_type threads = default_thread_count())
+        : base(NX * NY * NZ, NUM_SLOTS - EX, Sc, ms_SC_MAX, threads), m_NX(NX), m_NY(NY), m_NZ(NZ)
+    {
+        if (NX < 3ULL || NY < 3ULL || NZ < 3ULL)    { throw std::invalid_argument("FDTD_3D: grid must be at least 3 x 3 x 3."); }
+        this->m_E_slots     = { EX, EY, EZ };
+        this->m_H_slots     = { HX, HY, HZ };
+        this->m_tile        = { 8ULL, 512ULL };
+    }
+
+
+    //  "nx" / "ny" / "nz" / "index"
+    [[nodiscard]] inline size_type      nx                      (void) const noexcept   { return this->m_NX; }
+    [[nodiscard]] inline size_type      ny                      (void) const noexcept   { return this->m_NY; }
+    [[nodiscard]] inline size_type      nz                      (void) const noexcept   { return this->m_NZ; }
+    [[nodiscard]] inline size_type      index                   (const size_type m, const size_type n, const size_type p) const noexcept
+    { return (m * this->m_NY + n) * this->m_NZ + p; }
+
+    //  Fields.
+    [[nodiscard]] inline view_t         Ex                      (void) noexcept         { return this->field(EX); }
+    [[nodiscard]] inline view_t         Ey                      (void) noexcept         { return this->field(EY); }
+    [[nodiscard]] inline view_t         Ez                      (void) noexcept         { return this->field(EZ); }
+    [[nodiscard]] inline view_t         Hx                      (void) noexcept         { return this->field(HX); }
+    [[nodiscard]] inline view_t         Hy                      (void) noexcept         { return this->field(HY); }
+    [[nodiscard]] inline view_t         Hz                      (void) noexcept         { return this->field(HZ); }
+    [[nodiscard]] inline const_view_t   Ex                      (void) const noexcept   { return this->field(EX); }
+    [[nodiscard]] inline const_view_t   Ey                      (void) const noexcept   { return this->field(EY); }
+    [[nodiscard]] inline const_view_t   Ez                      (void) const noexcept   { return this->field(EZ); }
+    [[nodiscard]] inline const_view_t   Hx                      (void) const noexcept   { return this->field(HX); }
+    [[nodiscard]] inline const_view_t   Hy                      (void) const noexcept   { return this->field(HY); }
+    [[nodiscard]] inline const_view_t   Hz                      (void) const noexcept   { return this->field(HZ); }
+
+
+    //  "set_box"
+    //      Material of every cell in  [m0, m1) x [n0, n1) x [p0, p1).
+    inline void                         set_box                 (const size_type m0, const size_type m1, const size_type n0, const size_type n1,
+                                                                 const size_type p0, const size_type p1, const typename base::material_t & mat) noexcept
+    {
+        const auto      c       = make_coefficients(mat, this->m_Sc);
+        for (size_type m = m0; m < std::min(m1, this->m_NX); ++m)
+            for (size_type n = n0; n < std::min(n1, this->m_NY); ++n)
+                for (size_type p = p0; p < std::min(p1, this->m_NZ); ++p)
+                    this->set_coefficients( this->index(m, n, p), c );
+        return;
+    }
+
+
+    //  "step"
+    //      One full time-step:  H half-step, H sources, E half-step, E sources.
+    inline void                         step                    (void)
+    {
+        this->update_H();
+        this->apply_sources(false);
+        this->update_E();
+        this->apply_sources(true);
+        ++this->m_step;
+        return;
+    }
+
+    //  "run"
+    //      "NT" steps;  "on_step(q, engine)" is called after each one.
+    template< typename Fn = std::nullptr_t >
+    inline void                         run                     (const size_type NT, Fn && on_step = nullptr)
+    {
+        for (size_type q = 0ULL; q < NT; ++q) {
+            this->step();
+            if constexpr ( !std::is_same_v<std::decay_t<Fn>, std::nullptr_t> )     { on_step(q, *this); }
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    UPDATE LOOPS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "update_H"
+    inline void                         update_H                (void)
+    {
+        const size_type     NX      = this->m_NX,       NY      = this->m_NY,       NZ      = this->m_NZ;
+        const size_type     SX      = NY * NZ,          rows    = this->m_tile.rows,    seg     = this->m_tile.cols;
+        const SimdLevel     lvl     = simd_level();
+        value_type *        Hx      = this->m_arena.data(HX);
+        value_type *        Hy      = this->m_arena.data(HY);
+        value_type *        Hz      = this->m_arena.data(HZ);
+        const value_type *  Ex      = this->m_arena.data(EX);
+        const value_type *  Ey      = this->m_arena.data(EY);
+        const value_type *  Ez      = this->m_arena.data(EZ);
+        const value_type *  Chh     = this->m_arena.data(CHH);
+        const value_type *  Che     = this->m_arena.data(CHE);
+
+        this->m_pool->parallel_for(NX, [=](const size_type m_begin, const size_type m_end) {
+            for (size_type n0 = 0ULL; n0 < NY; n0 += rows)
+            for (size_type p0 = 0ULL; p0 < NZ; p0 += seg)
+            {
+                const size_type     n1      = std::min(n0 + rows, NY);
+                const size_type     p1      = std::min(p0 + seg,  NZ);
+                const size_type     pz      = std::min<size_type>(p1, NZ - 1ULL);      //  Hx, Hy:  p < NZ-1.
+                const size_type     len_xy  = (p0 < pz) ? pz - p0 : 0ULL;
+                for (size_type m = m_begin; m < m_end; ++m)
+                for (size_type n = n0; n < n1; ++n)
+                {
+                    const size_type     i       = (m * NY + n) * NZ + p0;
+                    const bool          in_x    = (m + 1ULL < NX);
+                    const bool          in_y    = (n + 1ULL < NY);
+                    if (in_y && len_xy)         { yee_update2(Hx + i, Chh + i, Che + i, Ey + i + 1ULL, Ey + i, Ez + i + NZ,    Ez + i, len_xy,  lvl); }
+                    if (in_x && len_xy)         { yee_update2(Hy + i, Chh + i, Che + i, Ez + i + SX,   Ez + i, Ex + i + 1ULL,  Ex + i, len_xy,  lvl); }
+                    if (in_x && in_y)           { yee_update2(Hz + i, Chh + i, Che + i, Ex + i + NZ,   Ex + i, Ey + i + SX,    Ey + i, p1 - p0, lvl); }
+                }
+            }
+        });
+        return;
+    }
+
+    //  "update_E"
+    inline void                         update_E                (void)
+    {
+        const size_type     NX      = this->m_NX,       NY      = this->m_NY,       NZ      = this->m_NZ;
+        const size_type     SX      = NY * NZ,          rows    = this->m_tile.rows,    seg     = this->m_tile.cols;
+        const SimdLevel     lvl     = simd_level();
+        value_type *        Ex      = this->m_arena.data(EX);
+        value_type *        Ey      = this->m_arena.data(EY);
+        value_type *        Ez      = this->m_arena.data(EZ);
+        const value_type *  Hx      = this->m_arena.data(HX);
+        const value_type *  Hy      = this->m_arena.data(HY);
+        const value_type *  Hz      = this->m_arena.data(HZ);
+        const value_type *  Cee     = this->m_arena.data(CEE);
+        const value_type *  Ceh     = this->m_arena.data(CEH);
+
+        this->m_pool->parallel_for(NX - 1ULL, [=](const size_type m_begin, const size_type m_end) {
+            for (size_type n0 = 0ULL; n0 < NY; n0 += rows)
+            for (size_type p0 = 0ULL; p0 < NZ; p0 += seg)
+            {
+                const size_type     n1      = std::min<size_type>(n0 + rows, NY - 1ULL);   //  All E:   n < NY-1.
+                const size_type     pa      = std::max<size_type>(p0, 1ULL);                //  Ex, Ey:  0 < p < NZ-1.
+                const size_type     pb      = std::min<size_type>(p0 + seg, NZ - 1ULL);    //  Ez:      p < NZ-1.
+                const size_type     len_xy  = (pa < pb) ? pb - pa : 0ULL;
+                const size_type     len_z   = (p0 < pb) ? pb - p0 : 0ULL;
+                for (size_type m = m_begin; m < m_end; ++m)
+                for (size_type n = n0; n < n1; ++n)
+                {
+                    const size_type     c       = (m * NY + n) * NZ;
+                    const size_type     i       = c + pa;
+                    const size_type     k       = c + p0;
+                    const bool          in_m    = (m > 0ULL);
+                    const bool          in_n    = (n > 0ULL);
+                    if (in_n && len_xy)         { yee_update2(Ex + i, Cee + i, Ceh + i, Hz + i, Hz + i - NZ, Hy + i, Hy + i - 1ULL, len_xy, lvl); }
+                    if (in_m && len_xy)         { yee_update2(Ey + i, Cee + i, Ceh + i, Hx + i, Hx + i - 1ULL, Hz + i, Hz + i - SX, len_xy, lvl); }
+                    if (in_m && in_n && len_z)  { yee_update2(Ez + k, Cee + k, Ceh + k, Hy + k, Hy + k - SX, Hx + k, Hx + k - NZ, len_z,  lvl); }
+                }
+            }
+        });
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "FDTD_3D" INLINE CLASS DEFINITION.
+};
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ENGINE_FDTD_3D_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
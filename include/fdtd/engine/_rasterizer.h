@@ -0,0 +1,743 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****            _ R A S T E R I Z E R . H  ____  F I L E        ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/fdtd/engine/_rasterizer.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CB_FDTD_ENGINE_RASTERIZER_H
+#define _CB_FDTD_ENGINE_RASTERIZER_H  1
+
+
+//  0.1.        ** MY **  HEADERS...
+#include "fdtd/engine/_engine_base.h"
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <stdexcept>
+#include <limits>
+
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+#include <vector>
+#include <span>
+#include <unordered_map>
+
+#include <utility>
+#include <algorithm>
+
+
+
+
+
+
+namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      0.      GRID / GEOMETRY TYPES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "RasterPoint"
+//      One polygon vertex in WORLD units (whatever the drawing uses).
+//
+struct RasterPoint {
+    double              x               = 0.0;
+    double              y               = 0.0;
+//
+    [[nodiscard]] inline bool   operator == (const RasterPoint & ) const noexcept = default;
+};
+
+
+//  "RasterGrid"
+//      Placement of an  nx x ny  cell grid in world space.     Cell (m, n) covers
+//
+//          x  in  [ x0 + m*h,  x0 + (m+1)*h ),         y  in  [ y0 + n*h,  y0 + (n+1)*h )
+//
+//      and lives at  m * ny + n,  the same layout as "FDTD_2D::index".  "cell_size" and "Sc" tie the grid to physical
+//      units (needed to turn conductivities and source timings into per-step quantities).
+//
+struct RasterGrid {
+    std::size_t         nx              = 0ULL;
+    std::size_t         ny              = 0ULL;
+    double              x0              = 0.0;
+    double              y0              = 0.0;
+    double              h               = 1.0;          //  World units per cell.
+    std::size_t         samples         = 4ULL;         //  Sub-scanlines per cell row (vertical anti-aliasing).
+//
+    double              cell_size       = 1.0e-3;       //  Physical cell size  [m].
+    double              Sc              = 0.707106781186547524400844362104849039;
+
+    //  "dt"            Physical time-step  [s].
+    [[nodiscard]] inline double         dt              (void) const noexcept   { return this->Sc * this->cell_size / static_cast<double>(spc::c); }
+    //  "steps"         Seconds  ===>  time-steps.
+    [[nodiscard]] inline double         steps           (const double seconds) const noexcept   { return seconds / this->dt(); }
+};
+
+
+//  "CellRect"
+//      Half-open block of cells  [m0, m1) x [n0, n1).
+//
+struct CellRect {
+    std::size_t         m0              = 0ULL;
+    std::size_t         m1              = 0ULL;
+    std::size_t         n0              = 0ULL;
+    std::size_t         n1              = 0ULL;
+//
+    [[nodiscard]] inline bool           empty           (void) const noexcept   { return this->m0 >= this->m1 || this->n0 >= this->n1; }
+    [[nodiscard]] inline std::size_t    area            (void) const noexcept   { return this->empty() ? 0ULL : (this->m1 - this->m0) * (this->n1 - this->n0); }
+    [[nodiscard]] inline bool           overlaps        (const CellRect & o) const noexcept
+    { return !this->empty() && !o.empty() && this->m0 < o.m1 && o.m0 < this->m1 && this->n0 < o.n1 && o.n0 < this->n1; }
+
+    //  "merged"        Smallest rect holding both.
+    [[nodiscard]] inline CellRect       merged          (const CellRect & o) const noexcept
+    {
+        if (this->empty())  { return o;     }
+        if (o.empty())      { return *this; }
+        return { std::min(this->m0, o.m0), std::max(this->m1, o.m1), std::min(this->n0, o.n0), std::max(this->n1, o.n1) };
+    }
+    //  "clipped"
+    [[nodiscard]] inline CellRect       clipped         (const CellRect & o) const noexcept
+    { return { std::max(this->m0, o.m0), std::min(this->m1, o.m1), std::max(this->n0, o.n0), std::min(this->n1, o.n1) }; }
+};
+
+
+//  "cell_bounds"
+//      Cells touched by the bounding box of "poly"  (empty when it misses the grid).
+//
+[[nodiscard]] inline CellRect cell_bounds(const std::span<const RasterPoint> poly, const RasterGrid & g) noexcept
+{
+    if ( poly.empty() )     { return {}; }
+    double      xa  = poly[0].x,    xb  = poly[0].x,    ya  = poly[0].y,    yb  = poly[0].y;
+    for (const RasterPoint & p : poly) {
+        xa  = std::min(xa, p.x);    xb  = std::max(xb, p.x);
+        ya  = std::min(ya, p.y);    yb  = std::max(yb, p.y);
+    }
+    auto    lo  = [](const double u, const std::size_t N) -> std::size_t
+    { return static_cast<std::size_t>( std::clamp(std::floor(u), 0.0, static_cast<double>(N)) ); };
+    auto    hi  = [](const double u, const std::size_t N) -> std::size_t      //  Always covers the cell "u" sits in.
+    { return static_cast<std::size_t>( std::clamp(std::floor(u) + 1.0, 0.0, static_cast<double>(N)) ); };
+
+    const double    ih  = 1.0 / g.h;
+    return { lo((xa - g.x0) * ih, g.nx),  hi((xb - g.x0) * ih, g.nx),
+             lo((ya - g.y0) * ih, g.ny),  hi((yb - g.y0) * ih, g.ny) };
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      SCAN-LINE COVERAGE...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "scanline_coverage"
+//      Classic active-edge-table scan conversion of a closed polygon (non-zero winding), restricted to "clip".
+//      Every cell row is sampled by "g.samples" horizontal scan-lines;  along each one the covered interval is
+//      accumulated EXACTLY (partial cells at the span ends get their covered fraction), so a cell's result is the
+//      area fraction of it that lies inside the polygon, to within the vertical sampling.
+//
+//      Calls  fn(m, n, coverage)  once for every cell with  coverage > 0,  row by row.    "row" is caller scratch.
+//
+template< typename Fn >
+inline void scanline_coverage(const std::span<const RasterPoint> poly, const RasterGrid & g, const CellRect & clip,
+                              std::vector<double> & row, Fn && fn)
+{
+    struct Edge { double v0, v1, u0, dudv; int dir; };
+    struct Hit  { double u; int dir; };
+
+    const std::size_t   N       = poly.size();
+    if ( N < 3ULL || clip.empty() )     { return; }
+
+    //  1.  Edges in cell units, sorted by their lower end.     Horizontal edges never cross a scan-line.
+    const double                ih      = 1.0 / g.h;
+    std::vector<Edge>           edges;
+    edges.reserve(N);
+    for (std::size_t i = 0ULL; i < N; ++i)
+    {
+        const RasterPoint & a   = poly[i];
+        const RasterPoint & b   = poly[(i + 1ULL) % N];
+        double  ua  = (a.x - g.x0) * ih,    va  = (a.y - g.y0) * ih;
+        double  ub  = (b.x - g.x0) * ih,    vb  = (b.y - g.y0) * ih;
+        if (va == vb)   { continue; }
+        int     dir = 1;
+        if (va > vb)    { std::swap(ua, ub);    std::swap(va, vb);  dir = -1; }
+        edges.push_back({ va, vb, ua, (ub - ua) / (vb - va), dir });
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge & a, const Edge & b) { return a.v0 < b.v0; });
+
+    const std::size_t   S       = std::max<std::size_t>(g.samples, 1ULL);
+    const double        w       = 1.0 / static_cast<double>(S);
+    const std::size_t   W       = clip.m1 - clip.m0;
+    const double        u_lo    = static_cast<double>(clip.m0),     u_hi    = static_cast<double>(clip.m1);
+    std::vector<const Edge *>   active;
+    std::vector<Hit>            hits;
+    std::size_t                 next    = 0ULL;
+
+    //  2.  Span accumulation:  [ua, ub)  clipped to the columns of "clip".
+    auto    add_span    = [&](double ua, double ub)
+    {
+        ua  = std::max(ua, u_lo);       ub  = std::min(ub, u_hi);
+        if ( !(ua < ub) )   { return; }
+        const std::size_t   ia  = static_cast<std::size_t>(ua);
+        const std::size_t   ib  = std::min<std::size_t>( static_cast<std::size_t>(ub), clip.m1 - 1ULL );
+        if (ia == ib)       { row[ia - clip.m0] += (ub - ua) * w;   return; }
+        row[ia - clip.m0]  += (static_cast<double>(ia + 1ULL) - ua) * w;
+        for (std::size_t k = ia + 1ULL; k < ib; ++k)    { row[k - clip.m0] += w; }
+        row[ib - clip.m0]  += (ub - static_cast<double>(ib)) * w;
+    };
+
+    for (std::size_t n = clip.n0; n < clip.n1; ++n)
+    {
+        row.assign(W, 0.0);
+        for (std::size_t s = 0ULL; s < S; ++s)
+        {
+            const double    v   = static_cast<double>(n) + (static_cast<double>(s) + 0.5) * w;
+
+            //  3.  Update the active-edge table:  edges whose  [v0, v1)  contains "v".
+            while ( next < edges.size() && edges[next].v0 <= v )    { active.push_back(&edges[next++]); }
+            std::erase_if(active, [v](const Edge * e) { return e->v1 <= v; });
+
+            hits.clear();
+            for (const Edge * e : active)   { if (e->v0 <= v)   { hits.push_back({ e->u0 + (v - e->v0) * e->dudv, e->dir }); } }
+            std::sort(hits.begin(), hits.end(), [](const Hit & a, const Hit & b) { return a.u < b.u; });
+
+            int     wind    = 0;
+            for (std::size_t k = 0ULL; k + 1ULL < hits.size(); ++k)
+            {
+                wind   += hits[k].dir;
+                if (wind != 0)  { add_span(hits[k].u, hits[k + 1ULL].u); }
+            }
+        }
+        for (std::size_t k = 0ULL; k < W; ++k)
+            { if (row[k] > 1.0e-12)     { fn(clip.m0 + k, n, std::min(row[k], 1.0)); } }
+    }
+    return;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY TEMPLATE DECLARATION:
+//         Incremental Scene Rasterizer.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "SceneRasterizer"
+//      Turns a drawn scene into what the Yee engines consume:  per-cell  eps_r / mu_r / loss / mloss  arrays and a list
+//      of point sources.   It knows nothing about the editor;  callers hand it polygons keyed by a stable id.
+//
+//      -   Materials:  closed polygons, painted bottom-to-top by (z, id) over the background.  A cell that a shape
+//          only partly covers gets the coverage-weighted average  ( v = v*(1-c) + v_shape*c ).
+//      -   Sources:    a closed polygon drives every cell it covers at least half-way;  an open polyline drives every
+//          cell it passes through;  a single point drives its own cell.
+//      -   Incremental:    "set_shape" / "remove_shape" only mark the bounding boxes (old and new) dirty, and
+//          "rebuild" re-composites just those cells.   Re-sending an unchanged shape is free, so a UI can push its
+//          whole scene every frame via  begin_sync() ... end_sync().
+//
+template< typename T = double >
+class SceneRasterizer {
+// *************************************************************************** //
+public:
+    using       value_type          = T;
+    using       size_type           = std::size_t;
+    using       id_type             = std::uint64_t;
+    using       material_t          = Material<value_type>;
+    using       source_t            = PointSource<value_type>;
+//
+    static constexpr size_type      ms_MAX_RECTS            = 16ULL;    //  Beyond this, dirty rects collapse into one.
+
+// *************************************************************************** //
+protected:
+    struct Shape {
+        std::vector<RasterPoint>            poly;
+        material_t                          mat;
+        std::int64_t                        z                       = 0;
+        id_type                             id                      = 0ULL;
+        CellRect                            bounds;
+        std::uint64_t                       seen                    = 0ULL;
+    };
+    struct SourceShape {
+        std::vector<RasterPoint>            pts;
+        bool                                closed                  = false;
+        source_t                            proto;
+        std::vector<size_type>              cells;
+        std::uint64_t                       seen                    = 0ULL;
+    };
+//
+    RasterGrid                          m_grid;
+    material_t                          m_background            = {};
+    std::vector<value_type>             m_eps_r;
+    std::vector<value_type>             m_mu_r;
+    std::vector<value_type>             m_loss;
+    std::vector<value_type>             m_mloss;
+//
+    std::unordered_map<id_type, Shape>          m_shapes;
+    std::unordered_map<id_type, SourceShape>    m_source_shapes;
+    std::vector<source_t>               m_sources;
+    bool                                m_sources_dirty         = true;
+//
+    std::vector<CellRect>               m_dirty;
+    std::vector<CellRect>               m_updated;
+    std::uint64_t                       m_epoch                 = 0ULL;
+    std::vector<double>                 m_row;
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //
+    inline explicit                     SceneRasterizer         (const RasterGrid & grid, const material_t & background = {})
+        : m_grid(grid), m_background(background)
+    {
+        if (grid.nx == 0ULL || grid.ny == 0ULL || !(grid.h > 0.0) || !(grid.cell_size > 0.0))
+            { throw std::invalid_argument("SceneRasterizer: grid must be non-empty with a positive cell size."); }
+        const size_type     cells   = grid.nx * grid.ny;
+        this->m_eps_r.assign(cells, background.eps_r);      this->m_mu_r.assign(cells, background.mu_r);
+        this->m_loss.assign(cells, background.loss);        this->m_mloss.assign(cells, background.mloss);
+        this->mark_all();
+    }
+
+
+    //  Queries.
+    [[nodiscard]] inline const RasterGrid &     grid        (void) const noexcept   { return this->m_grid;  }
+    [[nodiscard]] inline size_type      cells                   (void) const noexcept   { return this->m_eps_r.size(); }
+    [[nodiscard]] inline size_type      index                   (const size_type m, const size_type n) const noexcept   { return m * this->m_grid.ny + n; }
+    [[nodiscard]] inline bool           dirty                   (void) const noexcept   { return !this->m_dirty.empty() || this->m_sources_dirty; }
+    [[nodiscard]] inline size_type      shape_count             (void) const noexcept   { return this->m_shapes.size(); }
+    [[nodiscard]] inline size_type      source_shape_count      (void) const noexcept   { return this->m_source_shapes.size(); }
+    //
+    [[nodiscard]] inline std::span<const value_type>    eps_r   (void) const noexcept   { return this->m_eps_r; }
+    [[nodiscard]] inline std::span<const value_type>    mu_r    (void) const noexcept   { return this->m_mu_r;  }
+    [[nodiscard]] inline std::span<const value_type>    loss    (void) const noexcept   { return this->m_loss;  }
+    [[nodiscard]] inline std::span<const value_type>    mloss   (void) const noexcept   { return this->m_mloss; }
+    [[nodiscard]] inline const std::vector<source_t> &  sources (void) const noexcept   { return this->m_sources; }
+    //
+    //  "updated"       Rects re-composited by the last "rebuild".
+    [[nodiscard]] inline std::span<const CellRect>      updated (void) const noexcept   { return this->m_updated; }
+
+    //  "material"
+    [[nodiscard]] inline material_t     material                (const size_type cell) const noexcept
+    { return { this->m_eps_r[cell], this->m_mu_r[cell], this->m_loss[cell], this->m_mloss[cell] }; }
+
+
+// *************************************************************************** //
+//
+//
+//    SCENE EDITS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "set_background"
+    inline void                         set_background          (const material_t & mat)
+    {
+        if ( same(mat, this->m_background) )    { return; }
+        this->m_background  = mat;
+        this->mark_all();
+        return;
+    }
+
+    //  "set_shape"
+    //      Add or replace the material polygon "id".  Returns false (and marks nothing) when it is unchanged.
+    //
+    inline bool                         set_shape               (const id_type id, const std::int64_t z, std::vector<RasterPoint> poly,
+                                                                 const material_t & mat)
+    {
+        auto [it, added]        = this->m_shapes.try_emplace(id);
+        Shape &         s       = it->second;
+        s.seen                  = this->m_epoch;
+        if ( !added && s.z == z && same(s.mat, mat) && s.poly == poly )     { return false; }
+
+        const CellRect  old     = added ? CellRect{} : s.bounds;
+        s.poly                  = std::move(poly);
+        s.mat                   = mat;
+        s.z                     = z;
+        s.id                    = id;
+        s.bounds                = (s.poly.size() >= 3ULL) ? cell_bounds(s.poly, this->m_grid) : CellRect{};
+        this->mark(old);
+        this->mark(s.bounds);
+        return true;
+    }
+
+    //  "remove_shape"
+    inline bool                         remove_shape            (const id_type id)
+    {
+        auto    it      = this->m_shapes.find(id);
+        if ( it == this->m_shapes.end() )       { return false; }
+        this->mark(it->second.bounds);
+        this->m_shapes.erase(it);
+        return true;
+    }
+
+    //  "set_source"
+    //      Add or replace the source "id".     "proto" supplies type, component, amplitude and waveform;  its "cell" is
+    //      ignored.    Returns false when unchanged.
+    //
+    inline bool                         set_source              (const id_type id, std::vector<RasterPoint> pts, const bool closed,
+                                                                 const source_t & proto)
+    {
+        auto [it, added]        = this->m_source_shapes.try_emplace(id);
+        SourceShape &   s       = it->second;
+        s.seen                  = this->m_epoch;
+        if ( !added && s.closed == closed && same(s.proto, proto) && s.pts == pts )     { return false; }
+
+        s.pts                   = std::move(pts);
+        s.closed                = closed;
+        s.proto                 = proto;
+        s.cells                 = this->source_cells(s.pts, closed);
+        this->m_sources_dirty   = true;
+        return true;
+    }
+
+    //  "remove_source"
+    inline bool                         remove_source           (const id_type id)
+    {
+        if ( this->m_source_shapes.erase(id) == 0ULL )  { return false; }
+        this->m_sources_dirty   = true;
+        return true;
+    }
+
+    //  "clear"
+    inline void                         clear                   (void)
+    {
+        for (const auto & [id, s] : this->m_shapes)     { this->mark(s.bounds); }
+        this->m_shapes.clear();
+        this->m_source_shapes.clear();
+        this->m_sources_dirty   = true;
+        return;
+    }
+
+
+    //  "begin_sync" / "end_sync"
+    //      Bracket a full re-send of the scene:  anything not set in between is removed by "end_sync".
+    //
+    inline void                         begin_sync              (void) noexcept     { ++this->m_epoch; }
+    inline void                         end_sync                (void)
+    {
+        for (auto it = this->m_shapes.begin(); it != this->m_shapes.end(); )
+        {
+            if (it->second.seen == this->m_epoch)   { ++it; continue; }
+            this->mark(it->second.bounds);
+            it = this->m_shapes.erase(it);
+        }
+        const size_type     before  = this->m_source_shapes.size();
+        std::erase_if(this->m_source_shapes, [this](const auto & kv) { return kv.second.seen != this->m_epoch; });
+        if (this->m_source_shapes.size() != before)     { this->m_sources_dirty = true; }
+        return;
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    REBUILD...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "rebuild"
+    //      Re-composite every dirty cell and re-collect the sources.   Returns the rects that changed (also kept in
+    //      "updated()");  empty when nothing was dirty.
+    //
+    inline std::span<const CellRect>    rebuild                 (void)
+    {
+        this->m_updated.clear();
+        if ( !this->m_dirty.empty() )
+        {
+            this->m_updated     = coalesce( std::exchange(this->m_dirty, {}) );
+
+            std::vector<const Shape *>  order;
+            order.reserve(this->m_shapes.size());
+            for (const auto & [id, s] : this->m_shapes)     { order.push_back(&s); }
+            std::sort(order.begin(), order.end(), [](const Shape * a, const Shape * b)     //  Ties in z go by id, never hash order.
+                      { return (a->z != b->z) ? (a->z < b->z) : (a->id < b->id); });
+
+            for (const CellRect & R : this->m_updated)
+            {
+                this->fill_background(R);
+                for (const Shape * s : order)
+                {
+                    const CellRect  C   = s->bounds.clipped(R);
+                    if ( C.empty() )    { continue; }
+                    scanline_coverage(s->poly, this->m_grid, C, this->m_row, [&](const size_type m, const size_type n, const double c)
+                                      { this->blend(this->index(m, n), s->mat, static_cast<value_type>(c)); });
+                }
+            }
+        }
+
+        if (this->m_sources_dirty)
+        {
+            this->m_sources.clear();
+            std::vector<std::pair<id_type, const SourceShape *>>    order;
+            for (const auto & [id, s] : this->m_source_shapes)  { order.emplace_back(id, &s); }
+            std::sort(order.begin(), order.end(), [](const auto & a, const auto & b) { return a.first < b.first; });
+            for (const auto & [id, s] : order)
+                for (const size_type cell : s->cells)
+                {
+                    source_t    src     = s->proto;
+                    src.cell            = cell;
+                    this->m_sources.push_back(src);
+                }
+            this->m_sources_dirty   = false;
+        }
+        return this->m_updated;
+    }
+
+
+    //  "apply"
+    //      Rebuild, then push the changed cells (or, with "all", every cell) and the full source list into "engine".
+    //      The engine must have the same cell layout (e.g. an  FDTD_2D(nx, ny)).
+    //
+    inline void                         apply                   (EngineBase<value_type> & engine, const bool all = false)
+    {
+        if ( engine.cells() != this->cells() )
+            { throw std::invalid_argument("SceneRasterizer: engine grid does not match the raster grid."); }
+        const bool          sources     = this->m_sources_dirty || all;
+        this->rebuild();
+
+        const CellRect      full        = { 0ULL, this->m_grid.nx, 0ULL, this->m_grid.ny };
+        for (const CellRect & R : (all ? std::span<const CellRect>(&full, 1ULL) : std::span<const CellRect>(this->m_updated)))
+            for (size_type m = R.m0; m < R.m1; ++m)
+                for (size_type n = R.n0; n < R.n1; ++n)
+                    { engine.set_material( this->index(m, n), this->material(this->index(m, n)) ); }
+
+        if (sources)
+        {
+            engine.clear_sources();
+            for (const source_t & src : this->m_sources)    { engine.add_source(src); }
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "same"
+    [[nodiscard]] static inline bool    same                    (const material_t & a, const material_t & b) noexcept
+    { return a.eps_r == b.eps_r && a.mu_r == b.mu_r && a.loss == b.loss && a.mloss == b.mloss; }
+    [[nodiscard]] static inline bool    same                    (const source_t & a, const source_t & b) noexcept
+    {
+        const auto &    p   = a.wave;
+        const auto &    q   = b.wave;
+        return a.type == b.type && a.component == b.component && a.amplitude == b.amplitude
+            && p.type == q.type && p.delay == q.delay && p.width == q.width && p.wavelen == q.wavelen
+            && p.num_periods == q.num_periods && p.Sc == q.Sc;
+    }
+
+    //  "mark" / "mark_all"
+    inline void                         mark                    (const CellRect & r)    { if ( !r.empty() ) { this->m_dirty.push_back(r); } }
+    inline void                         mark_all                (void)
+    { this->m_dirty.assign(1ULL, CellRect{ 0ULL, this->m_grid.nx, 0ULL, this->m_grid.ny }); }
+
+    //  "coalesce"
+    //      Merge overlapping rects until none overlap, so no cell is composited twice.
+    //
+    [[nodiscard]] static inline std::vector<CellRect>   coalesce(std::vector<CellRect> rects)
+    {
+        for (bool again = true; again; )
+        {
+            again   = false;
+            for (size_type i = 0ULL; i < rects.size() && !again; ++i)
+                for (size_type j = i + 1ULL; j < rects.size(); ++j)
+                {
+                    if ( !rects[i].overlaps(rects[j]) )     { continue; }
+                    rects[i]    = rects[i].merged(rects[j]);
+                    rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(j));
+                    again       = true;
+                    break;
+                }
+        }
+        if (rects.size() > ms_MAX_RECTS) {
+            CellRect    u   = {};
+            for (const CellRect & r : rects)    { u = u.merged(r); }
+            rects.assign(1ULL, u);
+        }
+        return rects;
+    }
+
+    //  "fill_background"
+    inline void                         fill_background         (const CellRect & R) noexcept
+    {
+        for (size_type m = R.m0; m < R.m1; ++m)
+        {
+            const size_type     a   = this->index(m, R.n0),     b   = this->index(m, R.n1);
+            std::fill(this->m_eps_r.begin() + a, this->m_eps_r.begin() + b, this->m_background.eps_r);
+            std::fill(this->m_mu_r.begin()  + a, this->m_mu_r.begin()  + b, this->m_background.mu_r);
+            std::fill(this->m_loss.begin()  + a, this->m_loss.begin()  + b, this->m_background.loss);
+            std::fill(this->m_mloss.begin() + a, this->m_mloss.begin() + b, this->m_background.mloss);
+        }
+        return;
+    }
+
+    //  "blend"
+    inline void                         blend                   (const size_type i, const material_t & mat, const value_type c) noexcept
+    {
+        const value_type    k   = value_type(1) - c;
+        this->m_eps_r[i]        = this->m_eps_r[i] * k + mat.eps_r * c;
+        this->m_mu_r[i]         = this->m_mu_r[i]  * k + mat.mu_r  * c;
+        this->m_loss[i]         = this->m_loss[i]  * k + mat.loss  * c;
+        this->m_mloss[i]        = this->m_mloss[i] * k + mat.mloss * c;
+        return;
+    }
+
+    //  "source_cells"
+    //
+    [[nodiscard]] inline std::vector<size_type>     source_cells(const std::vector<RasterPoint> & pts, const bool closed)
+    {
+        const RasterGrid &      g       = this->m_grid;
+        std::vector<size_type>  out;
+        auto    cell_at     = [&](const double x, const double y)
+        {
+            const double    u   = std::floor( (x - g.x0) / g.h ),   v   = std::floor( (y - g.y0) / g.h );
+            if ( u >= 0.0 && v >= 0.0 && u < static_cast<double>(g.nx) && v < static_cast<double>(g.ny) )
+                { out.push_back( this->index(static_cast<size_type>(u), static_cast<size_type>(v)) ); }
+        };
+
+        if ( closed && pts.size() >= 3ULL )
+        {
+            scanline_coverage(pts, g, cell_bounds(pts, g), this->m_row, [&](const size_type m, const size_type n, const double c)
+                              { if (c >= 0.5) { out.push_back( this->index(m, n) ); } });
+            if ( out.empty() ) {                        //  Smaller than a cell:  drive the cell holding its centroid.
+                double  cx  = 0.0,  cy  = 0.0;
+                for (const RasterPoint & p : pts)   { cx += p.x;    cy += p.y; }
+                cell_at( cx / static_cast<double>(pts.size()), cy / static_cast<double>(pts.size()) );
+            }
+        }
+        else
+        {
+            if ( !pts.empty() )     { cell_at(pts.front().x, pts.front().y); }
+            for (size_type i = 0ULL; i + 1ULL < pts.size(); ++i)        //  Walk each segment at quarter-cell steps.
+            {
+                const RasterPoint & a   = pts[i];
+                const RasterPoint & b   = pts[i + 1ULL];
+                const double        len = std::hypot(b.x - a.x, b.y - a.y) / g.h;
+                const size_type     K   = static_cast<size_type>( std::ceil(len * 4.0) );
+                for (size_type k = 1ULL; k <= K; ++k)
+                {
+                    const double    t   = static_cast<double>(k) / static_cast<double>(K);
+                    cell_at( a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t );
+                }
+            }
+        }
+        std::sort(out.begin(), out.end());
+        out.erase( std::unique(out.begin(), out.end()), out.end() );
+        return out;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "SceneRasterizer" INLINE CLASS DEFINITION.
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      2.      PHYSICAL-UNIT HELPERS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "material_from_SI"
+//      Relative constants plus conductivities [S/m]  ===>  "Material" on grid "g"  ( loss = sigma * dt / (2 * eps) ).
+//
+template< typename T = double >
+[[nodiscard]] inline Material<T> material_from_SI(const RasterGrid & g, const double eps_r, const double mu_r,
+                                                  const double sigma_e = 0.0, const double sigma_m = 0.0) noexcept
+{
+    const double    dt      = g.dt();
+    Material<T>     mat;
+    mat.eps_r               = static_cast<T>(eps_r);
+    mat.mu_r                = static_cast<T>(mu_r);
+    mat.loss                = static_cast<T>( sigma_e * dt / (2.0 * static_cast<double>(spc::eps_0) * eps_r) );
+    mat.mloss               = static_cast<T>( sigma_m * dt / (2.0 * static_cast<double>(spc::mu_0)  * mu_r ) );
+    return mat;
+}
+
+
+//  "waveform_from_SI"
+//      Pulse width / delay [s] and frequency [Hz]  ===>  "Waveform" in time-steps on grid "g".
+//
+//      -   Gaussian:   width = tau,  peak at  t0  (or  4 tau  when t0 = 0, so the pulse starts from ~zero).
+//      -   Ricker:     peak frequency  f  (or  1 / (pi tau)  when f = 0).
+//      -   Harmonic:   frequency  f,  ramped up over  tau,  never switched off.
+//
+template< typename T = double >
+[[nodiscard]] inline Waveform<T> waveform_from_SI(const RasterGrid & g, const WaveformType type, const double frequency,
+                                                  const double tau, const double t0) noexcept
+{
+    constexpr double    pi      = static_cast<double>(spc::pi);
+    const double        dt      = g.dt();
+    const double        width   = std::max(tau / dt, 1.0);
+    Waveform<T>         w;
+    w.type                      = type;
+    w.Sc                        = static_cast<T>(g.Sc);
+    w.width                     = static_cast<T>(width);
+    w.delay                     = static_cast<T>( (t0 > 0.0) ? (t0 / dt) : (4.0 * width) );
+
+    const double        f       = (frequency > 0.0) ? frequency : ( (tau > 0.0) ? 1.0 / (pi * tau) : 0.0 );
+    if (f > 0.0)        { w.wavelen = static_cast<T>( g.Sc / (f * dt) ); }     //  Points per wavelength.
+    if (type == WaveformType::Harmonic)
+    {
+        w.delay                 = static_cast<T>(width);
+        w.num_periods           = static_cast<T>( std::numeric_limits<float>::max() / std::max(width, 1.0) );
+    }
+    return w;
+}
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CB_FDTD_ENGINE_RASTERIZER_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -24,9 +24,29 @@
 // *************************************************************************** //
 // *************************************************************************** //
 //              1A.     INDIVIDUAL FILES.
-//      #ifndef _CB_FDTD_ENGINE_MODULE1_H
-//      # include "fdtd/engine/module1.h"
-//      #endif	// _CB_FDTD_ENGINE_MODULE1_H  //
+#ifndef _CB_FDTD_ENGINE_COMMON_H                            //  1.  MATERIALS, SOURCES, DECOMPOSITION.
+# include "fdtd/engine/_common.h"
+#endif	// _CB_FDTD_ENGINE_COMMON_H  //
+
+
+#ifndef _CB_FDTD_ENGINE_BASE_H                              //  2.  SHARED ENGINE STATE.
+# include "fdtd/engine/_engine_base.h"
+#endif	// _CB_FDTD_ENGINE_BASE_H  //
+
+
+#ifndef _CB_FDTD_ENGINE_FDTD_2D_H                           //  3.  2D TMz ENGINE.
+# include "fdtd/engine/_fdtd_2d.h"
+#endif	// _CB_FDTD_ENGINE_FDTD_2D_H  //
+
+
+#ifndef _CB_FDTD_ENGINE_FDTD_3D_H                           //  4.  3D ENGINE.
+# include "fdtd/engine/_fdtd_3d.h"
+#endif	// _CB_FDTD_ENGINE_FDTD_3D_H  //
+
+
+#ifndef _CB_FDTD_ENGINE_RASTERIZER_H                        //  5.  SCENE  ===>  MATERIAL / SOURCE GRID.
+# include "fdtd/engine/_rasterizer.h"
+#endif	// _CB_FDTD_ENGINE_RASTERIZER_H  //
 
 //
 //
@@ -44,6 +64,16 @@ namespace cb { namespace fdtd {//     BEGINNING NAMESPACE "cb" :: "fdtd"...
 
 
 
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "fdtd" NAMESPACE.
+
+
+
 
 
 
@@ -30,13 +30,17 @@
 #endif	// _CB_FDTD_ENTITIES_H  //
 
 #ifndef _CB_FDTD_ENGINE_H
-//# include "fdtd/engine/engine.h"
+# include "fdtd/engine/engine.h"
 #endif	// _CB_FDTD_ENGINE_H  //
 
 
 
 //              1B.     INDIVIDUAL FILES.
 #include "fdtd/_types.h"
+#include "fdtd/_fft.h"
+#include "fdtd/_frame_sink.h"
+#include "fdtd/_arena.h"
+#include "fdtd/_kernels.h"
 #include "fdtd/_fdtd_impl.h"
 #include "fdtd/_fdtd_1d.h"
 
@@ -0,0 +1,313 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****              _ L A T E N C Y . H  ____  F I L E            ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/utility/_latency.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_UTILITY_LATENCY_H
+#define _CBAPP_UTILITY_LATENCY_H  1
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include <array>
+#include <deque>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <filesystem>
+#include <chrono>
+
+#include <bit>
+#include <limits>
+#include <algorithm>
+
+
+
+namespace cb { namespace utl { //     BEGINNING NAMESPACE "cb" :: "utl"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+//  "monotonic_ns"
+//      The one clock every latency stamp is taken on  (steady, so stamps from different threads compare).
+//
+[[nodiscard]] inline std::int64_t monotonic_ns(void) noexcept
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count();
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      LatencyHistogram...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "LatencyHistogram"
+//      HDR-style log-linear histogram of nanosecond latencies.  Values below 32 ns get a bucket each;  above that every
+//      power of two is split into 32 equal sub-buckets, so any reported percentile is within ~3% of the true value.
+//      Fixed size (~9 KiB), "record" is a handful of integer ops and never allocates.  Range:  0 .. ~18 min.
+//
+class LatencyHistogram
+{
+// *************************************************************************** //
+public:
+    using                               value_type          = std::int64_t;
+    using                               size_type           = std::size_t;
+//
+    static constexpr unsigned           ms_SUB_BITS         = 5U;
+    static constexpr value_type         ms_SUB_COUNT        = value_type(1) << ms_SUB_BITS;         //  32.
+    static constexpr unsigned           ms_MAX_EXPONENT     = 40U;                                  //  2^40 ns  ~  18 min.
+    static constexpr size_type          ms_NUM_BUCKETS      = static_cast<size_type>( (ms_MAX_EXPONENT - ms_SUB_BITS + 1U) * ms_SUB_COUNT );
+
+// *************************************************************************** //
+protected:
+    std::array<std::uint64_t, ms_NUM_BUCKETS>   m_counts    {   };
+    std::uint64_t                       m_total             = 0ULL;
+    double                              m_sum               = 0.0;
+    value_type                          m_min               = std::numeric_limits<value_type>::max();
+    value_type                          m_max               = 0;
+
+// *************************************************************************** //
+public:
+
+    //  "index_of"
+    [[nodiscard]] static constexpr size_type    index_of    (value_type v) noexcept
+    {
+        if ( v < ms_SUB_COUNT )     { return static_cast<size_type>( std::max<value_type>(v, 0) ); }
+        const unsigned  e       = static_cast<unsigned>( std::bit_width(static_cast<std::uint64_t>(v)) ) - 1U;
+        if ( e >= ms_MAX_EXPONENT ) { return ms_NUM_BUCKETS - 1ULL; }
+        const unsigned  shift   = e - ms_SUB_BITS;
+        return static_cast<size_type>( (e - ms_SUB_BITS + 1U) * ms_SUB_COUNT + ( (v >> shift) - ms_SUB_COUNT ) );
+    }
+
+    //  "lower_bound"   Smallest value that lands in bucket "i".
+    [[nodiscard]] static constexpr value_type   lower_bound (const size_type i) noexcept
+    {
+        if ( i < static_cast<size_type>(ms_SUB_COUNT) )     { return static_cast<value_type>(i); }
+        const unsigned  e       = static_cast<unsigned>( i / static_cast<size_type>(ms_SUB_COUNT) ) + ms_SUB_BITS - 1U;
+        const value_type sub    = static_cast<value_type>( i % static_cast<size_type>(ms_SUB_COUNT) ) + ms_SUB_COUNT;
+        return sub << (e - ms_SUB_BITS);
+    }
+
+    //  "upper_bound"   Largest value that lands in bucket "i".
+    [[nodiscard]] static constexpr value_type   upper_bound (const size_type i) noexcept
+        { return ( i + 1ULL < ms_NUM_BUCKETS )  ? lower_bound(i + 1ULL) - 1     : std::numeric_limits<value_type>::max(); }
+
+
+    //  "record"    Negative values (clock skew across threads) count as zero.
+    inline void                         record              (value_type v) noexcept
+    {
+        v                   = std::max<value_type>(v, 0);
+        ++this->m_counts[ index_of(v) ];
+        ++this->m_total;
+        this->m_sum        += static_cast<double>(v);
+        this->m_min         = std::min(this->m_min, v);
+        this->m_max         = std::max(this->m_max, v);
+    }
+
+    //  "clear"
+    inline void                         clear               (void) noexcept     { *this = LatencyHistogram{}; }
+
+
+    //  "percentile"
+    //      Value at quantile "q" in [0, 1]:  the upper edge of the bucket holding the ceil(q * count)-th sample,
+    //      clamped to the exact min / max (HDR's "highest equivalent value" convention).
+    [[nodiscard]] inline value_type     percentile          (const double q) const noexcept
+    {
+        if ( this->m_total == 0ULL )    { return 0; }
+        const std::uint64_t     rank    = std::max<std::uint64_t>( 1ULL, static_cast<std::uint64_t>( std::ceil( std::clamp(q, 0.0, 1.0) * static_cast<double>(this->m_total) ) ) );
+        std::uint64_t           seen    = 0ULL;
+        for (size_type i = 0ULL; i < ms_NUM_BUCKETS; ++i) {
+            seen   += this->m_counts[i];
+            if ( seen >= rank )     { return std::clamp( upper_bound(i), this->m_min, this->m_max ); }
+        }
+        return this->m_max;
+    }
+
+    //  GETTERS:
+    [[nodiscard]] inline std::uint64_t  count               (void) const noexcept   { return this->m_total; }
+    [[nodiscard]] inline value_type     min                 (void) const noexcept   { return (this->m_total) ? this->m_min  : 0; }
+    [[nodiscard]] inline value_type     max                 (void) const noexcept   { return this->m_max; }
+    [[nodiscard]] inline double         mean                (void) const noexcept   { return (this->m_total) ? this->m_sum / static_cast<double>(this->m_total)  : 0.0; }
+    [[nodiscard]] inline std::uint64_t  bucket              (const size_type i) const noexcept  { return this->m_counts[i]; }
+
+// *************************************************************************** //
+// *************************************************************************** //   END "LatencyHistogram".
+};
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//      2.      LatencyTracer...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "LatencyTracer"
+//      Named histograms for the app's end-to-end timing, plus "glass" samples:  a sample deferred with a start stamp is
+//      resolved against the end of the next presented frame (the "glfwSwapBuffers" return in "App::run_IMPL"), i.e. the
+//      frame that drew it.  GUI-thread only;  producers carry their stamps through their own queues.
+//
+class LatencyTracer
+{
+// *************************************************************************** //
+public:
+    using                               size_type           = std::size_t;
+    struct Entry {
+        std::string                     name;
+        LatencyHistogram                hist;
+    };
+//
+    static constexpr size_type          ms_MAX_PENDING      = 1ULL << 20;       //  Bound when nothing presents (headless use).
+
+// *************************************************************************** //
+protected:
+    struct Pending {
+        LatencyHistogram *              hist;
+        std::int64_t                    t0_ns;
+    };
+//
+    std::deque<Entry>                   m_entries           {   };              //  deque:  references stay valid as it grows.
+    std::vector<Pending>                m_pending           {   };
+    size_type                           m_overflow          = 0ULL;
+    std::uint64_t                       m_frames            = 0ULL;
+
+// *************************************************************************** //
+public:
+
+    //  "instance"
+    static inline LatencyTracer &       instance            (void)      { static LatencyTracer inst; return inst; }
+
+
+    //  "histogram"
+    //      Find-or-create by name.  The reference stays valid for the life of the program;  cache it.
+    [[nodiscard]] inline LatencyHistogram &     histogram   (const std::string_view name)
+    {
+        for (Entry & e : this->m_entries)
+            { if ( e.name == name )     { return e.hist; } }
+        this->m_entries.push_back( Entry{ std::string(name), {} } );
+        return this->m_entries.back().hist;
+    }
+
+
+    //  "defer"
+    //      Record "present - t0_ns" into "hist" once the frame currently being built has been presented.
+    inline void                         defer               (LatencyHistogram & hist, const std::int64_t t0_ns)
+    {
+        if ( this->m_pending.size() >= ms_MAX_PENDING )     { ++this->m_overflow;  return; }
+        this->m_pending.push_back( Pending{ &hist, t0_ns } );
+    }
+
+
+    //  "frame_presented"
+    //      Call once per frame, right after the swap.  Resolves every deferred sample against "now_ns".
+    inline void                         frame_presented     (const std::int64_t now_ns = monotonic_ns()) noexcept
+    {
+        for (const Pending & p : this->m_pending)   { p.hist->record(now_ns - p.t0_ns); }
+        this->m_pending.clear();                    //  keeps its capacity.
+        ++this->m_frames;
+    }
+
+
+    //  "reset"     Clears every histogram (entries and cached references survive).
+    inline void                         reset               (void) noexcept
+    {
+        for (Entry & e : this->m_entries)           { e.hist.clear(); }
+        this->m_pending.clear();
+        this->m_overflow    = 0ULL;
+    }
+
+
+    //  "export_csv"
+    //      "<path>"            one row per histogram:  count, min, mean, p50, p90, p99, p99.9, max  [ns].
+    //      "<stem>_buckets"    one row per non-empty bucket  (enough to recompute any percentile offline).
+    inline bool                         export_csv          (const std::filesystem::path & path) const
+    {
+        std::filesystem::path   bpath       = path;
+        bpath.replace_filename( path.stem().string() + "_buckets" + path.extension().string() );
+        std::ofstream           summary     (path);
+        std::ofstream           buckets     (bpath);
+        if ( !summary  ||  !buckets )       { return false; }
+
+        summary << "histogram,count,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+        buckets << "histogram,lower_ns,upper_ns,count\n";
+        for (const Entry & e : this->m_entries)
+        {
+            const LatencyHistogram &    h   = e.hist;
+            summary << e.name << ',' << h.count() << ',' << h.min() << ',' << static_cast<std::int64_t>(h.mean()) << ','
+                    << h.percentile(0.50) << ',' << h.percentile(0.90) << ',' << h.percentile(0.99) << ','
+                    << h.percentile(0.999) << ',' << h.max() << '\n';
+            for (size_type i = 0ULL; i < LatencyHistogram::ms_NUM_BUCKETS; ++i) {
+                if ( h.bucket(i) == 0ULL )  { continue; }
+                buckets << e.name << ',' << LatencyHistogram::lower_bound(i) << ',' << LatencyHistogram::upper_bound(i) << ',' << h.bucket(i) << '\n';
+            }
+        }
+        return static_cast<bool>(summary)  &&  static_cast<bool>(buckets);
+    }
+
+
+    //  GETTERS:
+    [[nodiscard]] inline const std::deque<Entry> &  entries (void) const noexcept   { return this->m_entries; }
+    [[nodiscard]] inline size_type      pending             (void) const noexcept   { return this->m_pending.size(); }
+    [[nodiscard]] inline size_type      overflow            (void) const noexcept   { return this->m_overflow; }
+    [[nodiscard]] inline std::uint64_t  frames              (void) const noexcept   { return this->m_frames; }
+
+// *************************************************************************** //
+// *************************************************************************** //   END "LatencyTracer".
+};
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "utl" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CBAPP_UTILITY_LATENCY_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
+// *************************************************************************** //
+// *************************************************************************** //
@@ -35,10 +35,25 @@
 
 #include <chrono>
 #include <ctime>
+#include <cstdint>
+#include <iterator>
+#include <filesystem>
+#include <fstream>
 
 // ---------- compile‑time enable switch ----------
 #define CBAPP_LOG_ENABLED 1
 
+// ---------- compile‑time level floor ----------
+//      "CB_LOG" and the "debug*" helpers below this level compile to nothing (the runtime "set_level" still filters
+//      everything above it).  Debug is only compiled into debug / rel-with-debug-info builds.
+#ifndef CBAPP_LOG_COMPILE_LEVEL
+# if defined(__CBAPP_DEBUG__) || defined(__CBLIB_RELEASE_WITH_DEBUG_INFO__)
+    # define    CBAPP_LOG_COMPILE_LEVEL         10
+# else
+    # define    CBAPP_LOG_COMPILE_LEVEL         20
+# endif  //  __CBAPP_DEBUG__ || __CBLIB_RELEASE_WITH_DEBUG_INFO__  //
+#endif  //  CBAPP_LOG_COMPILE_LEVEL  //
+
 
 #ifdef _WIN32
     #include<windows.h>
@@ -47,12 +62,15 @@
 
 
 #if CBAPP_LOG_ENABLED
-    #include <queue>
+    #include <vector>
+    #include <memory>
+    #include <unordered_map>
     #include <thread>
     #include <mutex>
     #include <condition_variable>
     #include <atomic>
     #include <array>
+    #include "utility/pystream/_spsc_ring.h"
 #endif
 
 #include <format>
@@ -137,19 +155,28 @@ struct LogCounter {
 };
 
 
+//  "log_compiled_in"
+//      True when a record at "lvl" survives the compile-time floor ("CBAPP_LOG_COMPILE_LEVEL").
+[[nodiscard]] inline constexpr bool log_compiled_in(LogLevel lvl) noexcept
+{ return CBAPP_LOG_ENABLED  &&  ( static_cast<int>(lvl) >= CBAPP_LOG_COMPILE_LEVEL ); }
+
+
 //  "LogEvent"
+//      One record as captured on the calling thread.  Only "text" is formatted there;  the timestamp and thread-id
+//      are stored raw and turned into text by the worker.  Records live in per-thread rings and are swapped in and
+//      out of their slots, so "text" keeps its capacity and a warmed-up thread logs without allocating.
 //
 struct LogEvent {
-    LogLevel            level;
-    std::string         text;
-    std::size_t         count;       // running counter
+    LogLevel            level       = LogLevel::None;
+    std::string         text        {   };
+    std::size_t         count       = 0ULL;     // running counter
 
     // optional metadata
-    const char*         file;
-    int                 line;
-    const char*         func;
-    std::thread::id     thread_id;
-    std::string         ts_iso8601;
+    const char*         file        = nullptr;
+    int                 line        = 0;
+    const char*         func        = nullptr;
+    std::uint64_t       thread_id   = 0ULL;     //  std::hash<std::thread::id>.
+    std::int64_t        ts_ns       = 0;        //  system_clock, nanoseconds since the epoch.
 };
 
 
@@ -161,17 +188,24 @@ struct LogEvent {
 // *************************************************************************** //
 // *************************************************************************** //
 
-//  "iso_timestamp"
+//  "now_ns"
 //
-inline std::string iso_timestamp(void)
+inline std::int64_t now_ns(void) noexcept
 {
     using namespace std::chrono;
+    return duration_cast<nanoseconds>( system_clock::now().time_since_epoch() ).count();
+}
 
-    const auto  now   = system_clock::now();
-    const auto  secs  = time_point_cast<seconds>(now);               // truncate
-    const auto  ms    = duration_cast<milliseconds>(now - secs).count(); // 0-999
 
-    std::time_t tt = system_clock::to_time_t(secs);
+//  "iso_timestamp"
+//      Appends "YYYY-MM-DDTHH:MM:SS.mmmZ" for "ns" (see "now_ns") to "out".
+//
+inline void iso_timestamp(std::string & out, std::int64_t ns)
+{
+    const std::int64_t  secs    = ns / 1'000'000'000;
+    const std::int64_t  ms      = (ns / 1'000'000) % 1'000;
+
+    std::time_t tt = static_cast<std::time_t>(secs);
     std::tm      tm;
 #if defined(_WIN32)
     gmtime_s(&tm, &tt);          // Windows
@@ -179,11 +213,19 @@ inline std::string iso_timestamp(void)
     gmtime_r(&tt, &tm);          // POSIX / macOS / Linux
 #endif
 
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%dT%H:%M:%S")
-        << '.' << std::setw(3) << std::setfill('0') << ms
-        << 'Z';
-    return oss.str();
+    std::format_to( std::back_inserter(out), "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z"
+                  , tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, ms );
+    return;
+}
+
+
+//  "iso_timestamp"
+//
+inline std::string iso_timestamp(void)
+{
+    std::string     out;
+    iso_timestamp(out, now_ns());
+    return out;
 }
 /*
 {
@@ -250,14 +292,12 @@ public:
                                     const char* file,
                                     int line,
                                     const char* func,
-                                    std::thread::id tid,
+                                    [[maybe_unused]] std::thread::id tid,
                                     Args&&... args ) {
     #if CBAPP_LOG_ENABLED
-        std::string msg = std::format(fmt, std::forward<Args>(args)...);
-        enqueue_event(LogEvent{
-            lvl, std::move(msg), next_count(lvl),
-            file, line, func, tid, iso_timestamp()
-        });
+        if ( !this->accepts(lvl) )      { return; }
+        this->record( lvl, file, line, func, [&](std::string & out)
+            { std::format_to(std::back_inserter(out), fmt, std::forward<Args>(args)...); } );
     #else
         (void)fmt; (void)lvl; (void)file; (void)line; (void)func; (void)tid;
     #endif
@@ -270,12 +310,10 @@ public:
                                     const char*     file,
                                     int             line,
                                     const char*     func,
-                                    std::thread::id tid ) {
+                                    [[maybe_unused]] std::thread::id tid ) {
         #if CBAPP_LOG_ENABLED
-            enqueue_event(LogEvent{
-                lvl, std::string(msg), next_count(lvl),
-                file, line, func, tid, iso_timestamp()
-            });
+            if ( !this->accepts(lvl) )      { return; }
+            this->record( lvl, file, line, func, [msg](std::string & out) { out.append(msg); } );
         #else
             (void)msg; (void)lvl; (void)file; (void)line; (void)func; (void)tid;
         #endif
@@ -286,12 +324,14 @@ public:
     // *************************************************************************** //
 
     //  "logf"
+    //      Formats straight into the calling thread's ring slot (no temporary string).
     //
     template<class... Args>
     inline void             logf                        (Level lvl, std::format_string<Args...> fmt, Args&&... args) {
     #if CBAPP_LOG_ENABLED
-        std::string msg = std::format(fmt, std::forward<Args>(args)...);
-        log(msg.c_str(), lvl);
+        if ( !this->accepts(lvl) )      { return; }
+        this->record( lvl, nullptr, 0, nullptr, [&](std::string & out)
+            { std::format_to(std::back_inserter(out), fmt, std::forward<Args>(args)...); } );
     #else
             (void)fmt; (void)sizeof...(args);
     #endif
@@ -312,9 +352,12 @@ public:
     void                    log                         (const char * , Level );
     void                    log                         (const std::string & , Level );
     template<class... Args>
-    inline void             debugf                      (std::format_string<Args...> f, Args&&... a)    { logf(Level::Debug,        f, std::forward<Args>(a)...);   }
-    void                    debug                       (const char * );
-    void                    debug                       (const std::string & );
+    inline void             debugf                      (std::format_string<Args...> f, Args&&... a)
+    { if constexpr ( log_compiled_in(Level::Debug) )    { logf(Level::Debug, f, std::forward<Args>(a)...); } }
+    inline void             debug                       (const char * msg)
+    { if constexpr ( log_compiled_in(Level::Debug) )    { enqueue(msg, Level::Debug); } }
+    inline void             debug                       (const std::string & msg)
+    { if constexpr ( log_compiled_in(Level::Debug) )    { enqueue(msg, Level::Debug); } }
     template<class... Args>
     inline void             infof                       (std::format_string<Args...> f, Args&&... a)    { logf(Level::Info,         f, std::forward<Args>(a)...);   }
     void                    info                        (const char * );
@@ -352,6 +395,15 @@ public:
     ConsoleFormat           get_console_format          (void) const;
     void                    set_path_depth              (std::size_t d);              // runtime knob
     std::size_t             get_path_depth              (void) const;
+    //
+    //                      Binary sink:  every record is ALSO appended, unformatted, to a compact binary file.
+    //                      Decode offline with "scripts/python/decode_cblog.py".
+    bool                    open_binary_sink            (const std::filesystem::path & );
+    void                    close_binary_sink           (void);
+    bool                    has_binary_sink             (void) const;
+    //
+    //                      Records dropped because a thread's ring was full for longer than "RING_FULL_SPINS".
+    std::size_t             get_dropped                 (void) const;
 
 
     //  1.4                 Deleted Operators, Functions, etc...
@@ -371,26 +423,54 @@ protected:
     static constexpr const char *           HEADER                      = "CBLOG";      //  prefix
     static constexpr std::size_t            COUNTER_WIDTH               = 3;            //  zero‑pad width
     static constexpr std::size_t            MAX_LEVEL_LEN               = 9;            //  strlen("EXCEPTION")
-    static constexpr std::size_t            QUEUE_CAPACITY              = 1024;         //  bounded queue
+    static constexpr std::size_t            QUEUE_CAPACITY              = 1024;         //  records per thread ring
+    static constexpr std::size_t            RING_FULL_SPINS             = 1u << 16;     //  yields before dropping
+    static constexpr std::size_t            DRAIN_BATCH                 = 256;          //  records per ring per pass
+    static constexpr std::size_t            WAKE_DEPTH                  = QUEUE_CAPACITY / 4;   //  ring depth that wakes the worker
+    static constexpr int                    PARK_MS                     = 5;            //  worker's idle poll period
     static constexpr std::size_t            MAX_COL_WIDTH               = 120;          //  wrap column
     static constexpr const char *           BODY_OPEN_DELIM             = "";
     static constexpr const char *           BODY_CLOSE_DELIM            = "";
+    static constexpr char                   BINARY_MAGIC    [8]         = { 'C','B','L','O','G','B','I','N' };
+    static constexpr std::uint32_t          BINARY_VERSION              = 1u;
+    
+    //  "ThreadRing"
+    //      Each logging thread owns one (created on its first record).  It is the ring's only producer and the
+    //      worker its only consumer, so the caller's path is:  format into the slot, publish, maybe wake the worker.
+    //      A retired ring (its thread exited) is dropped by the worker once empty.
+    struct ThreadRing {
+        utl::SPSCRing<LogEvent>             ring                        { QUEUE_CAPACITY };
+        std::uint64_t                       thread_id                   = 0ULL;
+        std::atomic<bool>                   retired                     { false };
+    };
     
     //  DATA...
-    std::array< std::size_t, static_cast<int>(Level::Count) >
+    std::array< std::atomic<std::size_t>, static_cast<int>(Level::Count) >
                                             m_counts                    = { };
-    std::queue<LogEvent>                    m_queue;
+    std::vector< std::shared_ptr<ThreadRing> >
+                                            m_rings;                                    //  Guarded by "m_mtx".
     std::mutex                              m_mtx;
     std::condition_variable                 m_cv;
     std::thread                             m_worker;
     std::atomic<bool>                       m_running                   {false};
+    std::atomic<bool>                       m_sleeping                  {false};        //  Worker is parked on "m_cv".
+    std::atomic<std::size_t>                m_dropped                   { 0ULL };
+    std::mutex                              m_sync_mtx;                                 //  Serializes writes once the worker is gone.
     std::atomic<bool>                       m_vt_enabled                {false};        //  set once in ctor
     std::atomic<std::size_t>                m_path_depth                { 2ULL };       //  default “.../dir/file.cpp”
+    //
+    std::mutex                              m_bin_mtx;
+    std::ofstream                           m_bin;
+    std::unordered_map<const void *, std::uint32_t>
+                                            m_bin_strings;                              //  Interned "file" / "func" pointers.
+    std::atomic<bool>                       m_bin_open                  {false};
+    //
+    std::string                             m_line;                                     //  Worker's reusable output buffer.
 #if defined(__CBAPP_DEBUG__) || defined(__CBLIB_RELEASE_WITH_DEBUG_INFO__)
-    Level                                   m_threshold                 = Level::Debug;
+    std::atomic<Level>                      m_threshold                 { Level::Debug };
     std::atomic<ConsoleFormat>              m_console_fmt               { CF_DEFAULT };
 # else
-    Level                                   m_threshold                 = Level::Info;
+    std::atomic<Level>                      m_threshold                 { Level::Info };
     std::atomic<ConsoleFormat>              m_console_fmt               { CF_DEFAULT };
 #endif  //  __CBAPP_DEBUG__ || __CBLIB_RELEASE_WITH_DEBUG_INFO__  //
     
@@ -422,22 +502,80 @@ protected:
             default                 : { return "UNKNOWN";   }
         }
     }
-    [[nodiscard]] inline std::size_t    next_count                      (Level lvl)     { return ++m_counts[static_cast<int>(lvl)]; }
+    [[nodiscard]] inline std::size_t    next_count                      (Level lvl)     { return m_counts[static_cast<int>(lvl)].fetch_add(1ULL, std::memory_order_relaxed) + 1ULL; }
+    [[nodiscard]] inline bool           accepts                         (Level lvl) const noexcept
+    { return static_cast<int>(lvl) >= static_cast<int>( m_threshold.load(std::memory_order_relaxed) ); }
+    
+    
+    //  "record"
+    //      Caller-side hot path.  "fill(std::string &)" appends the message text into the ring slot.
+    //
+    template< typename Fill >
+    inline void                         record                          (Level lvl, const char * file, int line, const char * func, Fill && fill)
+    {
+        if ( !m_running.load(std::memory_order_acquire) )   { this->record_sync(lvl, file, line, func, fill);  return; }
+
+        ThreadRing &        tr          = this->local_ring();
+        for (std::size_t spins = 0; tr.ring.size() >= tr.ring.capacity(); ++spins)
+        {
+            //  Block while the ring is full (the ring itself would drop the oldest record);  give up eventually.
+            if ( spins == RING_FULL_SPINS )     { m_dropped.fetch_add(1ULL, std::memory_order_relaxed);  return; }
+            this->wake_worker();
+            std::this_thread::yield();
+        }
+
+        tr.ring.emplace_with( [&](LogEvent & ev)
+        {
+            ev.level        = lvl;
+            ev.count        = this->next_count(lvl);
+            ev.file         = file;
+            ev.line         = line;
+            ev.func         = func;
+            ev.thread_id    = tr.thread_id;
+            ev.ts_ns        = now_ns();
+            ev.text.clear();
+            fill(ev.text);
+        } );
+        //      The parked worker wakes on its own every few ms;  only pay for a wake-up when it matters.
+        if ( m_sleeping.load(std::memory_order_relaxed)  &&
+             ( lvl >= Level::Error  ||  tr.ring.size() >= WAKE_DEPTH ) )    { this->wake_worker(); }
+        return;
+    }
+    
+    //  "record_sync"
+    //      Before "start_worker" / after "stop_worker":  format and write on the caller.
+    template< typename Fill >
+    inline void                         record_sync                     (Level lvl, const char * file, int line, const char * func, Fill & fill)
+    {
+        LogEvent        ev{ lvl, {}, this->next_count(lvl), file, line, func
+                          , std::hash<std::thread::id>{}(std::this_thread::get_id()), now_ns() };
+        fill(ev.text);
+        std::lock_guard<std::mutex>     lock    (m_sync_mtx);
+        this->write_event(ev);
+        std::cout.flush();
+        return;
+    }
                         
     
     //  2B.3                            Class Utility Functions.        [Logger.cpp]...
     void                                enqueue                         (const char * , Level );
-    void                                enqueue_event                   (LogEvent && );
+    void                                enqueue                         (const std::string & , Level );
+    ThreadRing &                        local_ring                      (void);
+    void                                wake_worker                     (void);
     void                                start_worker                    (void);
     void                                stop_worker                     (void);
+    void                                worker_loop                     (void);
+    std::size_t                         drain                           (std::vector<LogEvent> & );
     //
     //
     void                                write_event                     (const LogEvent & ev);
+    void                                write_binary                    (const LogEvent & ev);
+    std::uint32_t                       binary_string_id                (const char * );
     //
-    std::string                         build_header                    (const LogEvent & );
-    void                                write_body                      (const std::string & , std::ostream & out, std::size_t ) const;
-    std::string                         build_metadata                  (const LogEvent & , std::size_t );
-    static std::string                  path_tail                       (std::string_view full, std::size_t depth);
+    void                                build_header                    (const LogEvent & , std::string & out) const;
+    void                                write_body                      (std::string_view , std::string & out, std::size_t ) const;
+    void                                build_metadata                  (const LogEvent & , std::size_t , std::string & out) const;
+    static std::string_view             path_tail                       (std::string_view full, std::size_t depth);
     //
     TermColor                           level_to_color                  (Level lvl);
     void                                enable_vt_win                   (void);
@@ -0,0 +1,506 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****       _ T A S K _ S C H E D U L E R . H  ____  F I L E      ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/utility/_task_scheduler.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_UTILITY_TASK_SCHEDULER_H
+#define _CBAPP_UTILITY_TASK_SCHEDULER_H  1
+
+
+//  0.2     STANDARD LIBRARY HEADERS...
+#include <exception>
+#include <cstdint>
+#include <cstddef>
+
+#include <array>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+
+
+namespace cb { namespace utl { //     BEGINNING NAMESPACE "cb" :: "utl"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//      1.      HELPER TYPES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "TaskPriority"
+//
+enum class TaskPriority : std::uint8_t {
+    High = 0,           //  User is waiting on it (project save / load).
+    Normal,
+    Low,                //  Long-running background work (simulation warm-up).
+    COUNT
+};
+
+
+//  "CancelToken"
+//      Shared, cooperative cancellation flag.  A token is cancelled when it, or any token it was derived from, is
+//      cancelled.  A default-constructed token is empty and never reports cancellation.
+//
+class CancelToken
+{
+    struct State {
+        std::atomic<bool>               flag            { false };
+        std::shared_ptr<State>          parent          {   };
+    };
+    std::shared_ptr<State>              m_state;
+public:
+
+    //  "make"
+    [[nodiscard]] static inline CancelToken     make        (const CancelToken & parent = {})
+    {
+        CancelToken     t;
+        t.m_state           = std::make_shared<State>();
+        t.m_state->parent   = parent.m_state;
+        return t;
+    }
+
+    inline void                         cancel              (void) const noexcept
+        { if ( m_state )  { m_state->flag.store(true, std::memory_order_release); } }
+
+    [[nodiscard]] inline bool           cancelled           (void) const noexcept
+    {
+        for (const State * s = m_state.get(); s; s = s->parent.get())
+            { if ( s->flag.load(std::memory_order_acquire) )  { return true; } }
+        return false;
+    }
+
+    [[nodiscard]] inline explicit       operator bool       (void) const noexcept   { return static_cast<bool>(m_state); }
+};
+
+
+//  "Task"
+//      Move-only, type-erased  void()  callable paired with the token that may skip it.
+//
+class Task
+{
+    struct Base {
+        virtual                         ~Base           (void) = default;
+        virtual void                    invoke          (void) = 0;
+    };
+    template< typename F >
+    struct Impl final : Base {
+        F                               fn;
+        explicit                        Impl            (F && f) : fn( std::move(f) )    {   }
+        void                            invoke          (void) override                 { fn(); }
+    };
+    std::unique_ptr<Base>               m_fn            {   };
+    CancelToken                         m_token         {   };
+public:
+    inline                              Task            (void) noexcept     = default;
+
+    template< typename F >
+        requires ( !std::is_same_v<std::decay_t<F>, Task> )
+    inline                              Task            (F && f, CancelToken token = {})
+        : m_fn( std::make_unique< Impl<std::decay_t<F>> >( std::decay_t<F>( std::forward<F>(f) ) ) )
+        , m_token( std::move(token) )   {   }
+
+    [[nodiscard]] inline bool           cancelled       (void) const noexcept   { return m_token.cancelled(); }
+    [[nodiscard]] inline explicit       operator bool   (void) const noexcept   { return static_cast<bool>(m_fn); }
+    inline void                         operator ()     (void)                  { m_fn->invoke(); }
+};
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                 PRIMARY CLASS DECLARATION:
+//         Application-Wide Task Scheduler.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "TaskScheduler"
+//      One process-wide pool of worker threads for ALL background work, plus a queue of continuations that must run
+//      on the GUI thread.
+//
+//      -   Every worker owns one deque per priority.  It pops its own work newest-first and, when idle, steals the
+//          oldest task from a sibling, always draining higher priorities first.
+//      -   "submit" never creates a thread.  When "ms_MAX_PENDING" tasks are already queued the caller runs the task
+//          itself (back-pressure instead of unbounded growth).
+//      -   "post_main" is a lock-free multi-producer push;  "drain_main" (GUI thread, once per frame) runs everything
+//          posted so far in FIFO order.
+//      -   "shutdown" cancels every token derived from "make_token", lets the workers finish what is already queued
+//          (un-tokened tasks such as saves still complete), joins them and discards pending continuations.
+//          Anything submitted afterwards runs inline.
+//      -   "parallel_for" splits a range across the pool;  the caller takes part, so it is safe to nest inside a task.
+//
+class TaskScheduler
+{
+// *************************************************************************** //
+public:
+    using       size_type                   = std::size_t;
+    static constexpr size_type              ms_PRIORITIES       = static_cast<size_type>(TaskPriority::COUNT);
+    static constexpr size_type              ms_MAX_PENDING      = 1024ULL;
+
+    //  "Stats"
+    struct Stats {
+        size_type                           workers             = 0ULL;
+        size_type                           pending             = 0ULL;
+        size_type                           submitted           = 0ULL;
+        size_type                           completed           = 0ULL;
+        size_type                           cancelled           = 0ULL;     //  Skipped because their token fired.
+        size_type                           stolen              = 0ULL;
+        size_type                           inlined             = 0ULL;     //  Ran on the caller (back-pressure / after shutdown).
+        size_type                           failed              = 0ULL;     //  Escaped with an exception.
+    };
+
+// *************************************************************************** //
+protected:
+    struct alignas(64) Worker {
+        std::mutex                                      mtx;
+        std::array<std::deque<Task>, ms_PRIORITIES>     q;
+    };
+    struct MainNode {
+        Task                                task;
+        MainNode *                          next                = nullptr;
+    };
+    struct Counters {
+        std::atomic<size_type>              submitted           { 0ULL };
+        std::atomic<size_type>              completed           { 0ULL };
+        std::atomic<size_type>              cancelled           { 0ULL };
+        std::atomic<size_type>              stolen              { 0ULL };
+        std::atomic<size_type>              inlined             { 0ULL };
+        std::atomic<size_type>              failed              { 0ULL };
+    };
+//
+    std::vector<std::unique_ptr<Worker>>    m_workers;
+    std::vector<std::thread>                m_threads;
+    std::atomic<size_type>                  m_pending           { 0ULL };
+    std::atomic<std::uint64_t>              m_signal            { 0ULL };   //  Bumped on every submit;  idle workers wait on it.
+    std::atomic<size_type>                  m_next              { 0ULL };   //  Round-robin target for external submits.
+    std::atomic<bool>                       m_stop              { false };  //  Refuses new queued work.
+    std::atomic<bool>                       m_closed            { false };  //  No "submit" can still be pushing;  workers may exit.
+    std::atomic<size_type>                  m_submitting        { 0ULL };   //  "submit" calls between the stop-check and the push.
+    std::mutex                              m_shutdown_mtx;
+    CancelToken                             m_root              = CancelToken::make();
+    std::atomic<MainNode *>                 m_main_head         { nullptr };
+    Counters                                m_count;
+//
+    static inline thread_local TaskScheduler *  tl_owner        = nullptr;
+    static inline thread_local size_type        tl_index        = 0ULL;
+
+// *************************************************************************** //
+public:
+
+    //  "instance"
+    static inline TaskScheduler &       instance                (void)      { static TaskScheduler inst; return inst; }
+
+    //  Parametric Constructor.
+    //      "workers" background threads;  the GUI thread is NOT counted (it only posts and drains).
+    //
+    inline explicit                     TaskScheduler           (size_type workers = 0ULL)
+    {
+        if ( workers == 0ULL )
+            { workers = std::max<size_type>( 1ULL, static_cast<size_type>(std::thread::hardware_concurrency()) - 1ULL ); }
+
+        this->m_workers.reserve(workers);
+        for (size_type i = 0ULL; i < workers; ++i)  { this->m_workers.push_back( std::make_unique<Worker>() ); }
+        this->m_threads.reserve(workers);
+        for (size_type i = 0ULL; i < workers; ++i)  { this->m_threads.emplace_back( [this, i]{ this->worker_loop(i); } ); }
+    }
+
+    //  Destructor.
+    inline                              ~TaskScheduler          (void)      { this->shutdown(); }
+
+    inline                              TaskScheduler           (const TaskScheduler & )        = delete;
+    inline TaskScheduler &              operator =              (const TaskScheduler & )        = delete;
+
+
+    //  "size"
+    [[nodiscard]] inline size_type      size                    (void) const noexcept   { return this->m_workers.size(); }
+
+    //  "make_token"
+    //      Fresh token that is also cancelled by "shutdown".
+    [[nodiscard]] inline CancelToken    make_token              (void) const            { return CancelToken::make(this->m_root); }
+
+    //  "stats"
+    [[nodiscard]] inline Stats          stats                   (void) const noexcept
+    {
+        return Stats{ this->size(), this->m_pending.load(std::memory_order_relaxed)
+                    , m_count.submitted.load(std::memory_order_relaxed),  m_count.completed.load(std::memory_order_relaxed)
+                    , m_count.cancelled.load(std::memory_order_relaxed),  m_count.stolen.load(std::memory_order_relaxed)
+                    , m_count.inlined.load(std::memory_order_relaxed),    m_count.failed.load(std::memory_order_relaxed) };
+    }
+
+
+// *************************************************************************** //
+//
+//
+//    SUBMISSION...
+// *************************************************************************** //
+// *************************************************************************** //
+
+    //  "submit"
+    //      Run "fn" on a worker.  Skipped (never invoked) if "token" is cancelled before it starts.
+    //
+    template< typename Fn >
+    inline void                         submit                  (Fn && fn, const TaskPriority prio = TaskPriority::Normal, CancelToken token = {})
+    {
+        Task            task    ( std::forward<Fn>(fn), std::move(token) );
+        m_count.submitted.fetch_add(1ULL, std::memory_order_relaxed);
+
+        //      Announce the push BEFORE checking "m_stop" (both seq_cst):  either we see the stop and run inline, or
+        //      "shutdown" sees us and waits until the task is queued, so the workers drain it before exiting.
+        this->m_submitting.fetch_add(1ULL);
+        if ( this->m_stop.load()  ||  this->m_pending.load(std::memory_order_relaxed) >= ms_MAX_PENDING )
+        {
+            this->m_submitting.fetch_sub(1ULL, std::memory_order_release);
+            m_count.inlined.fetch_add(1ULL, std::memory_order_relaxed);
+            this->execute(task);
+            return;
+        }
+
+        const size_type     w       = ( tl_owner == this )  ? tl_index
+                                                            : this->m_next.fetch_add(1ULL, std::memory_order_relaxed) % this->size();
+        this->m_pending.fetch_add(1ULL, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex>     lock    (this->m_workers[w]->mtx);
+            this->m_workers[w]->q[ static_cast<size_type>(prio) ].push_back( std::move(task) );
+        }
+        this->m_submitting.fetch_sub(1ULL, std::memory_order_release);
+        this->m_signal.fetch_add(1ULL, std::memory_order_release);
+        this->m_signal.notify_one();
+        return;
+    }
+
+
+    //  "post_main"
+    //      Queue "fn" for the next "drain_main".  Safe from any thread;  never blocks.
+    //
+    template< typename Fn >
+    inline void                         post_main               (Fn && fn)
+    {
+        MainNode *      node    = new MainNode{ Task( std::forward<Fn>(fn) ), nullptr };
+        node->next              = this->m_main_head.load(std::memory_order_relaxed);
+        while ( !this->m_main_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed) )
+            {   }
+        return;
+    }
+
+
+    //  "drain_main"
+    //      GUI thread only.  Runs every continuation posted before the call;  ones posted meanwhile wait a frame.
+    //
+    inline size_type                    drain_main              (void)
+    {
+        MainNode *      list    = this->m_main_head.exchange(nullptr, std::memory_order_acquire);
+        MainNode *      fifo    = nullptr;
+        while ( list )          { MainNode * n = list->next;  list->next = fifo;  fifo = list;  list = n; }
+
+        size_type       ran     = 0ULL;
+        while ( fifo )
+        {
+            std::unique_ptr<MainNode>   node    ( fifo );
+            fifo                                = node->next;
+            node->task();
+            ++ran;
+        }
+        return ran;
+    }
+
+
+    //  "parallel_for"
+    //      fn(begin, end)  over  [0, n)  in chunks of at least "grain" items.  Returns once every chunk has run;  the
+    //      first exception thrown by any chunk is re-thrown here.
+    //
+    template< typename Fn >
+    inline void                         parallel_for            (const size_type n, Fn && fn, const size_type grain = 1ULL)
+    {
+        using       fn_t        = std::remove_reference_t<Fn>;
+        if ( n == 0ULL )        { return; }
+
+        const size_type     P       = this->size() + 1ULL;
+        const size_type     chunks  = std::clamp<size_type>( n / std::max<size_type>(grain, 1ULL), 1ULL, 4ULL * P );
+        if ( chunks == 1ULL  ||  this->m_stop.load(std::memory_order_acquire) )    { fn(0ULL, n);  return; }
+
+        //      Shared with helper tasks, which may start after we return;  they only touch "fn" after claiming a chunk.
+        struct Job {
+            std::atomic<size_type>          next        { 0ULL };
+            std::atomic<size_type>          done        { 0ULL };
+            size_type                       n           = 0ULL;
+            size_type                       chunks      = 0ULL;
+            void *                          fn          = nullptr;
+            void (*                         call)(void *, size_type, size_type) = nullptr;
+            std::mutex                      err_mtx;
+            std::exception_ptr              err;
+        //
+            void                            work        (void) noexcept
+            {
+                for (size_type c = next.fetch_add(1ULL, std::memory_order_relaxed); c < chunks;
+                     c = next.fetch_add(1ULL, std::memory_order_relaxed))
+                {
+                    try             { call( fn, (n * c) / chunks, (n * (c + 1ULL)) / chunks ); }
+                    catch (...)     { std::lock_guard<std::mutex> lock(err_mtx);  if ( !err ) { err = std::current_exception(); } }
+                    if ( done.fetch_add(1ULL, std::memory_order_acq_rel) + 1ULL == chunks )     { done.notify_all(); }
+                }
+            }
+        };
+        auto        job         = std::make_shared<Job>();
+        job->n                  = n;
+        job->chunks             = chunks;
+        job->fn                 = const_cast<void *>( static_cast<const void *>( std::addressof(fn) ) );
+        job->call               = [](void * f, const size_type b, const size_type e) { (*static_cast<fn_t *>(f))(b, e); };
+
+        const size_type     helpers = std::min<size_type>( chunks - 1ULL, this->size() );
+        for (size_type i = 0ULL; i < helpers; ++i)
+            { this->submit( [job]{ job->work(); }, TaskPriority::High ); }
+
+        job->work();
+        for (size_type d = job->done.load(std::memory_order_acquire); d != chunks; d = job->done.load(std::memory_order_acquire))
+            { job->done.wait(d, std::memory_order_acquire); }
+
+        if ( job->err )         { std::rethrow_exception(job->err); }
+        return;
+    }
+
+
+    //  "shutdown"
+    //      Idempotent.  Call from the GUI thread before tearing down anything a task may reference.
+    //
+    inline void                         shutdown                (void)
+    {
+        std::lock_guard<std::mutex>     lock    (this->m_shutdown_mtx);
+        if ( this->m_stop.exchange(true) )      { return; }
+
+        //      Let every "submit" that passed its stop-check finish queueing before the workers may leave.
+        while ( this->m_submitting.load() != 0ULL )     { std::this_thread::yield(); }
+        this->m_closed.store(true, std::memory_order_release);
+
+        this->m_root.cancel();
+        this->m_signal.fetch_add(1ULL, std::memory_order_release);
+        this->m_signal.notify_all();
+        for (std::thread & th : this->m_threads)    { if ( th.joinable() ) { th.join(); } }
+
+        MainNode *      list    = this->m_main_head.exchange(nullptr, std::memory_order_acquire);
+        while ( list )          { std::unique_ptr<MainNode> node(list);  list = node->next; }
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "execute"
+    inline void                         execute                 (Task & task) noexcept
+    {
+        if ( task.cancelled() )         { m_count.cancelled.fetch_add(1ULL, std::memory_order_relaxed);  return; }
+        try                             { task();  m_count.completed.fetch_add(1ULL, std::memory_order_relaxed); }
+        catch (...)                     { m_count.failed.fetch_add(1ULL, std::memory_order_relaxed); }
+        return;
+    }
+
+    //  "try_pop"
+    //      Own deque newest-first, then the oldest task of each sibling, one priority level at a time.
+    //
+    inline bool                         try_pop                 (const size_type self, Task & out)
+    {
+        const size_type     W       = this->size();
+        for (size_type p = 0ULL; p < ms_PRIORITIES; ++p)
+        {
+            {
+                Worker &                        me      = *this->m_workers[self];
+                std::lock_guard<std::mutex>     lock    (me.mtx);
+                if ( !me.q[p].empty() )         { out = std::move(me.q[p].back());  me.q[p].pop_back();  return true; }
+            }
+            for (size_type k = 1ULL; k < W; ++k)
+            {
+                Worker &                        victim  = *this->m_workers[ (self + k) % W ];
+                std::unique_lock<std::mutex>    lock    (victim.mtx, std::try_to_lock);
+                if ( lock  &&  !victim.q[p].empty() ) {
+                    out = std::move(victim.q[p].front());  victim.q[p].pop_front();
+                    m_count.stolen.fetch_add(1ULL, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    //  "worker_loop"
+    inline void                         worker_loop             (const size_type id) noexcept
+    {
+        tl_owner                = this;
+        tl_index                = id;
+        Task                    task;
+
+        for (;;)
+        {
+            const std::uint64_t     seen    = this->m_signal.load(std::memory_order_acquire);
+            if ( this->try_pop(id, task) )
+            {
+                this->m_pending.fetch_sub(1ULL, std::memory_order_acq_rel);
+                this->execute(task);
+                task                = Task{};
+                continue;
+            }
+            //      Steals use "try_to_lock", so only sleep once nothing at all is queued.
+            if ( this->m_pending.load(std::memory_order_acquire) != 0ULL )  { std::this_thread::yield();  continue; }
+            if ( this->m_closed.load(std::memory_order_acquire) )           { return; }
+            this->m_signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//    END "TaskScheduler" INLINE CLASS DEFINITION.
+};
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "utl" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CBAPP_UTILITY_TASK_SCHEDULER_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
+// *************************************************************************** //
+// *************************************************************************** //
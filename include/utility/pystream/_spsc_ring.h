@@ -0,0 +1,254 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****            _ S P S C _ R I N G . H  ____  F I L E          ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [include/utility/pystream/_spsc_ring.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBAPP_UTILITY_PYSTREAM_SPSC_RING_H
+#define _CBAPP_UTILITY_PYSTREAM_SPSC_RING_H  1
+
+
+
+//  1.  INCLUDES    | Headers, Modules, etc...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  1.2     STANDARD LIBRARY HEADERS...
+#include <cstdint>
+#include <cstddef>
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <new>
+
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <span>
+#include <bit>
+
+
+
+
+
+namespace cb { namespace utl { //     BEGINNING NAMESPACE "cb" :: "utl"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                PRIMARY TEMPLATE INTERFACE:
+// 		Bounded Single-Producer / Single-Consumer Ring.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "SPSCRing"
+//      Fixed-capacity queue between ONE producer thread and ONE consumer thread.  No locks and no allocation after
+//      construction:  slots are constructed once and then assigned into, so element types that own storage (e.g.
+//      "std::string") keep their capacity and stop allocating once warmed up.
+//
+//      -   Drop-oldest when full:  "push" never blocks on a slow consumer;  it retires the oldest unread element
+//          (counted by "dropped()") so the consumer always sees the freshest data.
+//      -   Each slot carries a sequence number (Vyukov-style), so the producer can never overwrite a slot the
+//          consumer is still copying out of, and vice versa.
+//      -   Head, tail and the slot array live on separate cache lines.
+//      -   "try_pop" swaps owning element types out of their slot, so the consumer's old buffer is recycled by the
+//          producer's next assignment and a steady stream of strings allocates nothing.
+//      -   "high_water()" is the largest depth seen by the producer since the last "reset_high_water()".
+//
+template< typename T >
+class SPSCRing
+{
+// *************************************************************************** //
+public:
+    using                                   value_type                      = T;
+    using                                   size_type                       = std::size_t;
+    static constexpr size_type              ms_CACHE_LINE                   = 64ULL;
+
+// *************************************************************************** //
+protected:
+    struct alignas(ms_CACHE_LINE) Slot {
+        std::atomic<std::uint64_t>          seq                             { 0ULL };
+        value_type                          value                           {   };
+    };
+    //
+    size_type                               m_mask                          = 0ULL;
+    std::unique_ptr<Slot[]>                 m_slots                         {   };
+    //
+    alignas(ms_CACHE_LINE) std::atomic<std::uint64_t>   m_head              { 0ULL };   //  Next index to read.
+    alignas(ms_CACHE_LINE) std::atomic<std::uint64_t>   m_tail              { 0ULL };   //  Next index to write (producer-owned).
+    std::atomic<std::uint64_t>                          m_dropped           { 0ULL };
+    std::atomic<std::uint64_t>                          m_high_water        { 0ULL };
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    //      "capacity" is rounded up to a power of two.
+    explicit inline                         SPSCRing                        (const size_type capacity)
+        : m_mask( std::bit_ceil(std::max<size_type>(capacity, 2ULL)) - 1ULL ),
+          m_slots( std::make_unique<Slot[]>(m_mask + 1ULL) )
+    {
+        for (size_type i = 0ULL; i <= this->m_mask; ++i)    { this->m_slots[i].seq.store(i, std::memory_order_relaxed); }
+    }
+
+                                            SPSCRing                        (const SPSCRing & )     = delete;
+    SPSCRing &                              operator =                      (const SPSCRing & )     = delete;
+
+
+    //  Queries.
+    [[nodiscard]] inline size_type          capacity                        (void) const noexcept   { return this->m_mask + 1ULL; }
+    [[nodiscard]] inline std::uint64_t      dropped                         (void) const noexcept   { return this->m_dropped.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline std::uint64_t      high_water                      (void) const noexcept   { return this->m_high_water.load(std::memory_order_relaxed); }
+    inline void                             reset_high_water                (void) noexcept         { this->m_high_water.store(this->size(), std::memory_order_relaxed); }
+    //
+    //  "size"      Snapshot of the current depth (exact only from the producer or consumer thread).
+    [[nodiscard]] inline size_type          size                            (void) const noexcept
+    {
+        const std::uint64_t     h   = this->m_head.load(std::memory_order_acquire);
+        const std::uint64_t     t   = this->m_tail.load(std::memory_order_acquire);
+        return static_cast<size_type>( (t > h) ? std::min<std::uint64_t>(t - h, this->capacity()) : 0ULL );
+    }
+
+
+    //  "clear"
+    //      Discard every element;  only valid while NO producer is running (e.g. after joining it).
+    //      Counters ("dropped", "high_water") are kept.
+    inline void                             clear                           (void) noexcept
+    {
+        for (size_type i = 0ULL; i <= this->m_mask; ++i)    { this->m_slots[i].seq.store(i, std::memory_order_relaxed); }
+        this->m_head.store(0ULL, std::memory_order_relaxed);
+        this->m_tail.store(0ULL, std::memory_order_release);
+        return;
+    }
+
+
+    //  "push"          [ PRODUCER ]
+    //      Returns false when an unread element had to be dropped to make room.
+    //
+    template< typename U >
+    inline bool                             push                            (U && v)
+    { return this->emplace_with( [&v](value_type & slot) { slot = std::forward<U>(v); } ); }
+
+
+    //  "emplace_with"  [ PRODUCER ]
+    //      Like "push", but lets "fill(T &)" write straight into the slot (no temporary).
+    //
+    template< typename Fn >
+    inline bool                             emplace_with                    (Fn && fill)
+    {
+        const std::uint64_t     t       = this->m_tail.load(std::memory_order_relaxed);
+        Slot &                  s       = this->m_slots[ t & this->m_mask ];
+        bool                    kept    = true;
+
+        if ( s.seq.load(std::memory_order_acquire) != t )       //  1.  Slot still holds element  t - capacity.
+        {
+            std::uint64_t   h       = t - this->capacity();
+            if ( this->m_head.compare_exchange_strong(h, h + 1ULL, std::memory_order_acq_rel) ) {
+                s.seq.store(t, std::memory_order_relaxed);      //      We retired it ourselves:  the slot is ours.
+                this->m_dropped.fetch_add(1ULL, std::memory_order_relaxed);
+                kept        = false;
+            }
+            while ( s.seq.load(std::memory_order_acquire) != t )    { std::this_thread::yield(); }  //  Consumer mid-copy.
+        }
+
+        fill(s.value);                                          //  2.  Fill, then publish.
+        s.seq.store(t + 1ULL, std::memory_order_release);
+        this->m_tail.store(t + 1ULL, std::memory_order_release);
+
+        const std::uint64_t     depth   = t + 1ULL - this->m_head.load(std::memory_order_relaxed);
+        if ( depth > this->m_high_water.load(std::memory_order_relaxed) )   { this->m_high_water.store(depth, std::memory_order_relaxed); }
+        return kept;
+    }
+
+
+    //  "try_pop"       [ CONSUMER ]
+    //      Take the oldest element into "out";  false when empty.
+    //
+    inline bool                             try_pop                         (value_type & out)
+    { return this->try_pop_many( std::span<value_type>(&out, 1ULL) ) == 1ULL; }
+
+
+    //  "try_pop_many"  [ CONSUMER ]
+    //      Take up to "out.size()" of the oldest elements with a single claim on the head;  returns how many.
+    //
+    inline size_type                        try_pop_many                    (std::span<value_type> out)
+    {
+        std::uint64_t       h       = this->m_head.load(std::memory_order_acquire);
+        for (;;)
+        {
+            size_type           n       = 0ULL;                 //  1.  Count the published run starting at "h".
+            while ( n < out.size()  &&  this->m_slots[ (h + n) & this->m_mask ].seq.load(std::memory_order_acquire) == h + n + 1ULL )
+                { ++n; }
+            if (n == 0ULL)      { return 0ULL; }
+
+            if ( !this->m_head.compare_exchange_weak(h, h + n, std::memory_order_acq_rel) )
+                { continue; }                                   //  The producer retired "h" to make room;  "h" now holds the new head.
+
+            for (size_type i = 0ULL; i < n; ++i)                //  2.  Copy out, then hand every slot back.
+            {
+                Slot &          s       = this->m_slots[ (h + i) & this->m_mask ];
+                take(out[i], s.value);
+                s.seq.store(h + i + this->capacity(), std::memory_order_release);
+            }
+            return n;
+        }
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "take"
+    //      Owning types are swapped so both buffers keep their capacity;  plain data is copied.
+    static inline void                      take                            (value_type & dst, value_type & src)
+    {
+        if constexpr ( std::is_trivially_copyable_v<value_type> )   { dst = src; }
+        else                                                        { using std::swap;  swap(dst, src); }
+        return;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+};//	END "SPSCRing" INLINE CLASS DEFINITION.
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb" :: "utl" NAMESPACE.
+
+
+
+
+
+
+
+
+
+
+
+
+#endif      //  _CBAPP_UTILITY_PYSTREAM_SPSC_RING_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -29,6 +29,8 @@
 //#include "widgets/widgets.h"
 //  #include "app/_init.h"
 #include "app/state/state.h"
+#include "utility/pystream/_spsc_ring.h"
+#include "utility/_latency.h"
 
 
 
@@ -40,6 +42,9 @@
 #include <string>           //  <======| std::string, ...
 #include <string_view>
 #include <vector>           //  <======| std::vector, ...
+#include <array>
+#include <span>
+#include <cstddef>
 #include <initializer_list>
 
 #include <limits.h>
@@ -138,6 +143,52 @@ struct ProcessInfo
 
 
 
+//  "Framing"
+//      How the child's stdout is split into messages.
+//
+enum class Framing : uint8_t
+{
+      Lines = 0                     //  '\n'-terminated text (JSON, etc.)  -->  "try_receive".
+    , Binary                        //  "CBFR" u16 version, u16 size, payload  -->  "try_receive_frame".
+    , COUNT
+};
+//
+//  "DEF_FRAMING_NAMES"
+static constexpr cblib::EnumArray< Framing, const char * >
+    DEF_FRAMING_NAMES           = { { "Text Lines"    , "Binary Frames" } };
+
+
+
+//  "BinaryFrame"
+//      One fixed-size binary message, stored in-place (the frame ring never allocates).
+//      Wire format, little-endian:     "CBFR"  |  u16 version  |  u16 size  |  size bytes of payload.
+//
+struct BinaryFrame
+{
+    static constexpr size_t             ms_HEADER_SIZE      = 8ULL;
+    static constexpr size_t             ms_MAX_PAYLOAD      = 248ULL;
+    static constexpr char               ms_MAGIC [4]        = { 'C', 'B', 'F', 'R' };
+//
+    uint16_t                            version             = 0U;
+    uint16_t                            size                = 0U;
+    int64_t                             t_read_ns           = 0;            //  "utl::monotonic_ns" when read off the pipe  (not on the wire).
+    std::array<std::byte, ms_MAX_PAYLOAD>   payload         {   };
+//
+    [[nodiscard]] inline std::span<const std::byte>     bytes       (void) const noexcept   { return { this->payload.data(), this->size }; }
+};
+
+
+//  "Line"
+//      One complete text message  [ Framing::Lines ],  stamped like "BinaryFrame".
+//
+struct Line
+{
+    std::string                         text                {   };
+    int64_t                             t_read_ns           = 0;            //  "utl::monotonic_ns" when its '\n' was read.
+};
+
+
+
 // *************************************************************************** //
 //      "process" |     FUNCTIONS.
 // *************************************************************************** //
@@ -257,6 +308,11 @@ public:
     //  using                               MyAlias                         = MyTypename_t;
     using                                   ProcessState                    = process::ProcessState;
     using                                   ProcessInfo                     = process::ProcessInfo;
+    using                                   Framing                         = process::Framing;
+    using                                   BinaryFrame                     = process::BinaryFrame;
+    using                                   Line                            = process::Line;
+    using                                   LineRing                        = SPSCRing<Line>;
+    using                                   FrameRing                       = SPSCRing<BinaryFrame>;
     using                                   path_t                          = std::filesystem::path;
     
     // *************************************************************************** //
@@ -280,6 +336,7 @@ public:
     //      0. |    REFERENCES TO GLOBAL ARRAYS.
     // *************************************************************************** //
     static constexpr auto &                 ms_PROCESS_STATE_NAMES          = process::DEF_PROCESS_STATE_NAMES;
+    static constexpr auto &                 ms_FRAMING_NAMES                = process::DEF_FRAMING_NAMES;
     
 //
 //
@@ -310,6 +367,7 @@ protected:
     //
     //
     size_t                                  m_queue_capacity                = ms_DEF_QUEUE_CAPACITY;    //  cap; tune as needed
+    Framing                                 m_framing                       = Framing::Lines;
 
 
     // *************************************************************************** //
@@ -317,9 +375,10 @@ protected:
     // *************************************************************************** //
     //      1. |    IMPORTANT DATA-MEMBERS.
     // *************************************************************************** //
-    std::deque<std::string>                 m_recv_queue                    ;      //   pending messages
+    std::unique_ptr<LineRing>               m_line_ring                     = nullptr;      //  [ Framing::Lines  ]  pending messages;  built by "start".
+    std::unique_ptr<FrameRing>              m_frame_ring                    = nullptr;      //  [ Framing::Binary ]  built by "start".
     std::thread                             m_reader_thread                 ;
-    std::mutex                              m_queue_mutex                   ;
+    Line                                    m_rx_line                       {   };          //  consumer-side scratch for "try_receive".
     //
     std::mutex                              m_write_mutex                   ;
     
@@ -352,6 +411,8 @@ protected:
     // *************************************************************************** //
     std::atomic_bool                        m_running                       { false };
     std::atomic<size_t>                     m_dropped_lines                 { 0 };          //  drop-old counter
+    std::atomic<size_t>                     m_dropped_frames                { 0 };
+    std::atomic<size_t>                     m_bad_frames                    { 0 };          //  bytes skipped re-synchronizing on "CBFR"
     //
     //                                  TELEMETRY ACCESSORS:
     std::atomic<int>                        m_last_exit_code                { INT_MIN };    //  POSIX: WEXITSTATUS or -1;       Windows: GetExitCodeProcess
@@ -410,6 +471,9 @@ public:
     //
     bool                                        send                                (const std::string & msg);          //  write msg + \n
     bool                                        try_receive                         (std::string & out);                //  pop next complete line
+    size_t                                      try_receive_many                    (std::span<Line> out);              //  pop up to out.size() lines
+    bool                                        try_receive_frame                   (BinaryFrame & out);                //  pop next binary frame
+    size_t                                      try_receive_many                    (std::span<BinaryFrame> out);       //  pop up to out.size() frames
     
     
 //
@@ -433,6 +497,8 @@ protected:
     // *************************************************************************** //
     bool                                        launch_process                      (void);
     void                                        reader_thread_func                  (void);
+    void                                        frame_reader_func                   (void);             //  [ Framing::Binary ].
+    void                                        consume_frames_                     (std::vector<std::byte> & pending, const int64_t t_read_ns);
 #ifdef _WIN32
     bool                                        write_pipe                          (const char * data, size_t n);
 #else
@@ -683,6 +749,10 @@ public:
     inline void                                     clear_working_directory         (void)                      { this->_enforce_not_running("clear_working_directory()");  this->m_cwd.clear(); }
 
 
+    //  "set_framing"
+    inline void                                     set_framing                     (const Framing f)           { this->_enforce_not_running("set_framing()");  this->m_framing = f; }
+    
+    
     //  "set_queue_capacity"
     inline void                                     set_queue_capacity              (const size_t cap) {
         if ( (cap < PyStream::ms_MIN_QUEUE_CAPACITY)  ||  (cap > PyStream::ms_MAX_QUEUE_CAPACITY) ) {
@@ -716,6 +786,26 @@ public:
     //  "get_queue_capacity"
     [[nodiscard]] inline size_t                     get_queue_capacity              (void) const noexcept   { return this->m_queue_capacity;            }
     [[nodiscard]] inline size_t                     get_dropped_lines               (void) const noexcept   { return this->m_dropped_lines.load();      }
+    //  "get_framing"
+    [[nodiscard]] inline Framing                    get_framing                     (void) const noexcept   { return this->m_framing;                   }
+    [[nodiscard]] inline size_t                     get_dropped_frames              (void) const noexcept   { return this->m_dropped_frames.load();     }
+    [[nodiscard]] inline size_t                     get_bad_frames                  (void) const noexcept   { return this->m_bad_frames.load();         }
+    //
+    //  "get_queue_depth"           BACK-PRESSURE  (of whichever queue the current framing feeds)...
+    [[nodiscard]] inline size_t                     get_queue_depth                 (void) const noexcept {
+        if ( this->m_framing == Framing::Binary )   { return (this->m_frame_ring)   ? this->m_frame_ring->size()    : 0ULL; }
+        return (this->m_line_ring)  ? this->m_line_ring->size()     : 0ULL;
+    }
+    //  "get_queue_high_water"      largest depth since "start" (or the last reset).
+    [[nodiscard]] inline size_t                     get_queue_high_water            (void) const noexcept {
+        if ( this->m_framing == Framing::Binary )   { return (this->m_frame_ring)   ? static_cast<size_t>(this->m_frame_ring->high_water())    : 0ULL; }
+        return (this->m_line_ring)  ? static_cast<size_t>(this->m_line_ring->high_water())  : 0ULL;
+    }
+    inline void                                     reset_queue_high_water          (void) noexcept {
+        if ( this->m_frame_ring )       { this->m_frame_ring->reset_high_water(); }
+        if ( this->m_line_ring  )       { this->m_line_ring ->reset_high_water(); }
+        return;
+    }
 
     //  "get_last_exit_code"        TELEMETRY ACCESSORS...
     [[nodiscard]] inline int                        get_last_exit_code              (void) const noexcept   { return this->m_last_exit_code.load();     }
@@ -747,17 +837,26 @@ protected:
     // *************************************************************************** //
     
     //  "enqueue_line_"
-    inline void                                     enqueue_line_                   (std::string && s)
+    //      Copy into the ring slot (the slot keeps its capacity, so the caller's buffer can be re-used as well).
+    //      "t_read_ns" is the stamp of the "read" that completed the line.
+    inline void                                     enqueue_line_                   (std::string_view s, const int64_t t_read_ns = monotonic_ns())
     {
-        std::lock_guard<std::mutex>     lock    (this->m_queue_mutex);
-        if ( this->m_recv_queue.size() >= this->m_queue_capacity ) {
-            this->m_recv_queue.pop_front(); ++this->m_dropped_lines;    // drop-old policy
-        }
-        this->m_recv_queue.emplace_back(std::move(s));
+        if ( !this->m_line_ring->emplace_with( [s, t_read_ns](Line & slot) { slot.text.assign(s);  slot.t_read_ns = t_read_ns; } ) )
+            { ++this->m_dropped_lines; }                            // drop-old policy
         return;
     }
-
-
+    
+    
+    //  "enqueue_frame_"
+    template< typename Fn >
+    inline void                                     enqueue_frame_                  (Fn && fill)
+    {
+        if ( !this->m_frame_ring->emplace_with( std::forward<Fn>(fill) ) )
+            { ++this->m_dropped_frames; }
+        return;
+    }
+    
+    
     // *************************************************************************** //
     //
     //
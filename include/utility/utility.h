@@ -33,6 +33,8 @@
 #include "utility/_constants.h"
 #include "utility/_templates.h"
 #include "utility/_logger.h"
+#include "utility/_task_scheduler.h"
+#include "utility/_latency.h"
 #ifdef _WIN32
     # include "utility/resource_loader.h"
 #endif  //  _WIN32  //
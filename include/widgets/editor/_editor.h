@@ -197,6 +197,7 @@ public:
     static constexpr version_type                   ms_EDITOR_JSON_MIN_VERSION      = 1;
     //
     static constexpr cblib::SchemaVersion           ms_EDITOR_SCHEMA                { ms_EDITOR_JSON_MAJ_VERSION, ms_EDITOR_JSON_MIN_VERSION };
+    static constexpr const char *                   ms_EDITOR_BINARY_EXTENSION      = ".cbproj";        //  Native binary project;  ".json" exports.
     
 //
 //
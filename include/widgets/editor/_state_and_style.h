@@ -1674,9 +1674,6 @@ public:
     // *************************************************************************** //
     //                  SERIALIZATION STUFF...
     // *************************************************************************** //
-    std::mutex                              m_task_mtx;
-    std::vector<std::function<void()>>      m_main_tasks;
-    //
     std::atomic<bool>                       m_io_busy                       { false };
     IOResult                                m_io_last                       { IOResult::Ok };
     std::string                             m_io_msg                        {   };
@@ -2005,6 +2002,8 @@ struct EditorStyle
     int                         ms_BEZIER_SEGMENTS              = 0;                    //  ms_BEZIER_SEGMENTS
     int                         ms_BEZIER_HIT_STEPS             = 15;   //    20;       //  ms_BEZIER_HIT_STEPS
     int                         ms_BEZIER_FILL_STEPS            = 15;   //    24;       //  ms_BEZIER_FILL_STEPS
+    cblib::math::triangulate::FillRule
+                                ms_FILL_RULE                    = cblib::math::triangulate::FillRule::NonZero;  //  Closed-path fills.
     
 // *************************************************************************** //
 //
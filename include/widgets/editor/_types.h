@@ -52,6 +52,7 @@
 #include <vector>           //  <======| std::vector, ...
 #include <stdexcept>        //  <======| ...
 #include <limits.h>
+#include <limits>
 #include <math.h>
 #include <bit>
 
@@ -1769,6 +1770,333 @@ struct IndexState_t {
 };
 
 
+//  "VertexIndex_t"
+//      Dense lookup tables for the Editor's entity store, keyed by VertexID:
+//          - "vertex"  position of the vertex inside "m_vertices".
+//          - "path"    position of its (first) parent inside "m_paths".
+//
+//      The table is rebuilt lazily, in one pass over both containers, the first time it is queried after
+//      "invalidate()" or after either bound container was resized / re-allocated.  Every hit is checked against
+//      the element's own id, so a mutation that forgets to invalidate costs one linear scan, never a wrong answer.
+//
+//      Also serves as the render context's "get_vertex" callback:  "operator()" keeps the shape of the old
+//      "find_vertex(verts, id)" and falls back to a linear scan for any container it is not bound to.
+//
+template< typename V, typename P >
+class VertexIndex_t
+{
+// *************************************************************************** //
+public:
+    using                               Vertex                          = V;
+    using                               Path                            = P;
+    using                               VertexID                        = typename V::id_type;
+    using                               PathID                          = typename P::id_type;
+    using                               slot_type                       = std::uint32_t;
+    static constexpr slot_type          ms_NONE                         = std::numeric_limits<slot_type>::max();
+
+// *************************************************************************** //
+protected:
+    struct Entry {
+        slot_type                       vertex                          = ms_NONE;
+        slot_type                       path                            = ms_NONE;
+        PathID                          pid                             = PathID{ };
+    };
+    //
+    const std::vector<V> *              m_vertices                      = nullptr;
+    const std::vector<P> *              m_paths                         = nullptr;
+    //
+    mutable std::vector<Entry>          m_table                         {   };
+    mutable const V *                   m_vdata                         = nullptr;     //  Shape of the containers at the last rebuild.
+    mutable std::size_t                 m_vsize                         = 0ULL;
+    mutable const P *                   m_pdata                         = nullptr;
+    mutable std::size_t                 m_psize                         = 0ULL;
+    mutable bool                        m_dirty                         = true;
+    mutable std::uint64_t               m_generation                    = 0ULL;         //  Bumped by every rebuild.
+
+// *************************************************************************** //
+public:
+
+    //  Parametric Constructor.
+    inline                              VertexIndex_t                   (const std::vector<V> & verts, const std::vector<P> & paths) noexcept
+        : m_vertices(&verts), m_paths(&paths)   {   }
+    //
+                                        VertexIndex_t                   (const VertexIndex_t & )    = delete;
+    VertexIndex_t &                     operator =                      (const VertexIndex_t & )    = delete;
+
+
+    //  "invalidate"
+    //      Call after any edit that changes which vertices exist, or which path owns them.
+    inline void                         invalidate                      (void) const noexcept   { this->m_dirty = true; }
+
+
+    //  "generation"
+    //      Changes whenever the store's structure did;  lets derived caches (e.g. the spatial index) detect edits.
+    [[nodiscard]] inline std::uint64_t  generation                      (void) const noexcept   { this->_refresh();  return this->m_generation; }
+
+
+    //  "operator()"        | Vertex lookup.
+    [[nodiscard]] inline const V *      operator ()                     (const std::vector<V> & verts, VertexID id) const noexcept
+    {
+        if ( &verts != this->m_vertices )               { return s_find_linear(verts, id); }
+        this->_refresh();
+
+        if ( static_cast<std::size_t>(id) < this->m_table.size() )
+        {
+            const slot_type     s       = this->m_table[id].vertex;
+            if ( s == ms_NONE )                                         { return nullptr; }
+            if ( s < verts.size()  &&  verts[s].id == id )              { return std::addressof(verts[s]); }
+        }
+        this->m_dirty   = true;                         //  Stale entry:  answer correctly now, rebuild on the next query.
+        return s_find_linear(verts, id);
+    }
+    //
+    [[nodiscard]] inline V *            operator ()                     (std::vector<V> & verts, VertexID id) const noexcept
+        { return const_cast<V *>( (*this)(std::as_const(verts), id) ); }
+
+
+    //  "path_slot"         | Parent-path lookup.
+    //      Position of the first path in "m_paths" that contains "id";  "ms_NONE" if the vertex is free-standing.
+    //      A free-standing vertex always pays the linear scan;  such vertices only exist transiently while editing.
+    [[nodiscard]] inline slot_type      path_slot                       (VertexID id) const noexcept
+    {
+        this->_refresh();
+        const std::vector<P> &          paths   = *this->m_paths;
+
+        if ( static_cast<std::size_t>(id) < this->m_table.size() )
+        {
+            const Entry &       e       = this->m_table[id];
+            if ( e.path != ms_NONE  &&  e.path < paths.size()  &&  paths[e.path].id == e.pid )     { return e.path; }
+        }
+
+        //  Miss or stale entry:  the table cannot tell "free-standing" from "added to a path without invalidate()",
+        //  so confirm with a scan, and only schedule a rebuild when the scan disagrees with the table.
+        const slot_type     slot    = s_path_linear(paths, id);
+        if ( slot != ms_NONE )      { this->m_dirty = true; }
+        return slot;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "_refresh"
+    inline void                         _refresh                        (void) const noexcept
+    {
+        const bool      same    = ( this->m_vdata == this->m_vertices->data()  &&  this->m_vsize == this->m_vertices->size()   &&
+                                    this->m_pdata == this->m_paths->data()     &&  this->m_psize == this->m_paths->size()      );
+        if ( !this->m_dirty  &&  same )     { return; }
+        this->_rebuild();
+        return;
+    }
+
+    //  "_rebuild"
+    //      "assign" keeps the table's capacity, so steady-state rebuilds do not allocate.
+    inline void                         _rebuild                        (void) const noexcept
+    {
+        const std::vector<V> &          verts   = *this->m_vertices;
+        const std::vector<P> &          paths   = *this->m_paths;
+        std::size_t                     n       = 0ULL;
+
+        for (const V & v : verts)                               { n = std::max<std::size_t>(n, static_cast<std::size_t>(v.id) + 1ULL); }
+        for (const P & p : paths)   { for (const auto vid : p.verts)    { n = std::max<std::size_t>(n, static_cast<std::size_t>(vid) + 1ULL); } }
+
+        this->m_table.assign(n, Entry{ });
+        for (std::size_t i = 0ULL; i < verts.size(); ++i)       { this->m_table[ verts[i].id ].vertex = static_cast<slot_type>(i); }
+        for (std::size_t i = 0ULL; i < paths.size(); ++i)
+        {
+            for (const auto vid : paths[i].verts)
+            {
+                Entry &     e       = this->m_table[ vid ];
+                if ( e.path == ms_NONE )    { e.path = static_cast<slot_type>(i);  e.pid = paths[i].id; }
+            }
+        }
+
+        this->m_vdata   = verts.data();     this->m_vsize   = verts.size();
+        this->m_pdata   = paths.data();     this->m_psize   = paths.size();
+        this->m_dirty   = false;
+        ++this->m_generation;
+        return;
+    }
+
+    //  "s_find_linear"
+    [[nodiscard]] static inline const V *   s_find_linear               (const std::vector<V> & verts, VertexID id) noexcept
+        { for (const V & v : verts) { if (v.id == id) { return std::addressof(v); } }   return nullptr; }
+
+    //  "s_path_linear"
+    [[nodiscard]] static inline slot_type   s_path_linear               (const std::vector<P> & paths, VertexID id) noexcept
+    {
+        for (std::size_t i = 0ULL; i < paths.size(); ++i) {
+            for (const auto vid : paths[i].verts)   { if (vid == id) { return static_cast<slot_type>(i); } }
+        }
+        return ms_NONE;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+};//	END "VertexIndex_t" INLINE CLASS DEFINITION.
+
+
+//  "SpatialItem_t"
+//      Payload of one leaf in the Editor's spatial index.
+//
+template< typename VID >
+struct SpatialItem_t {
+    enum class Kind : uint8_t { Point, Segment, Surface };
+//
+    Kind                        kind                                    = Kind::Point;
+    uint32_t                    index                                   = 0;        //  Point:  slot in "m_points".     Segment / Surface:  slot in "m_paths".
+    uint32_t                    seg                                     = 0;        //  Segment:  index of its first vertex within the path.
+};
+
+
+//  "SpatialIndex_t"
+//      World-space dynamic AABB tree over point glyphs, path segments (control-hull boxes) and closed-path surfaces.
+//
+//      -   Rebuilt from scratch when the entity store's "generation" (or the glyph array) changes.
+//      -   Refit incrementally for every vertex queued in "dirty" (drags, handle edits).
+//      -   "adjacency" maps a VertexID to every leaf whose box depends on it, sorted by VertexID.
+//
+template< typename VID >
+struct SpatialIndex_t {
+    using                       Item                                    = SpatialItem_t<VID>;
+    using                       Tree                                    = cblib::DynamicAABBTree<Item>;
+    using                       Box                                     = typename Tree::Box;
+    using                       proxy_type                              = typename Tree::proxy_type;
+//
+    static constexpr float      ms_MARGIN_FRAC                          = 0.125f;   //  Fat-box margin, as a fraction of the item's extent...
+    static constexpr float      ms_MARGIN_MIN                           = 0.5f;     //  ...but never less than this (world units).
+//
+    Tree                                            tree                {   };
+    std::vector< std::pair<VID, proxy_type> >       adjacency           {   };
+    std::vector<proxy_type>                         surfaces            {   };      //  Per path slot;  "ms_NULL" for open paths.
+    std::vector<VID>                                dirty               {   };
+    std::vector<Item>                               hits                {   };      //  Scratch output of the last query.
+    std::vector<uint32_t>                           scratch             {   };
+//
+    std::uint64_t               generation                              = ~0ULL;
+    const void *                points_data                             = nullptr;
+    std::size_t                 points_size                             = 0ULL;
+//
+    [[nodiscard]] static inline float   margin                          (const Box & b) noexcept
+        { return std::max( ms_MARGIN_MIN, ms_MARGIN_FRAC * std::max(b.max_x - b.min_x, b.max_y - b.min_y) ); }
+};
+
+
+//  "CurveCache_t"
+//      Per-path, world-space polyline of every segment, flattened adaptively to within "tol" world units.
+//      Shared by the fill / stroke renderers, the hit-tests and the lasso.
+//
+//      -   "tol" follows the zoom:  "ms_TOL_PX" pixels at the current scale, snapped DOWN to a power of two so that
+//          small zoom changes reuse the cached polyline.
+//      -   An entry is rebuilt when its revision ("rev", bumped for every dirty vertex the spatial index refits) or
+//          the tolerance changes;  all entries are dropped when the entity store's "generation" changes.
+//      -   Opening / closing a path bumps "rev" on the next lookup (its "closed" flag is part of the key), so call
+//          sites that only flip "Path::closed" need not touch the cache.
+//      -   Screen projection is the affine map  px = offset + scale * ws  (ImPlot's linear axes), one pass per path.
+//
+template< typename V2 >
+struct CurveCache_t {
+    struct Span { uint32_t first = 0;  uint32_t last = 0; };   //  Segment "si" covers pts[first .. last] (inclusive).
+//
+    struct Entry {
+        std::uint64_t           rev                                     = 1ULL;
+        std::uint64_t           built                                   = 0ULL;     //  "rev" at the last rebuild.
+        float                   tol                                     = 0.0f;
+        bool                    closed                                  = false;    //  "Path::closed" at the last rebuild.
+        bool                    contiguous                              = true;     //  False if a segment was skipped (missing vertex).
+    //
+        std::vector<V2>         pts                                     {   };      //  World-space;  closed paths repeat the first point.
+        std::vector<float>      ts                                      {   };      //  Bézier parameter of each point within its segment.
+        std::vector<Span>       spans                                   {   };      //  One per segment.
+        float                   min_x = 0.0f,   min_y = 0.0f,   max_x = 0.0f,   max_y = 0.0f;   //  World bounds, padded by "tol".
+    //
+        [[nodiscard]] inline bool           contains                    (const V2 p, const float pad) const noexcept
+            { return ( p.x >= min_x - pad  &&  p.x <= max_x + pad  &&  p.y >= min_y - pad  &&  p.y <= max_y + pad ); }
+        [[nodiscard]] inline bool           overlaps                    (const V2 lo, const V2 hi) const noexcept
+            { return !( hi.x < min_x  ||  lo.x > max_x  ||  hi.y < min_y  ||  lo.y > max_y ); }
+    };
+//
+    static constexpr float      ms_TOL_PX                               = 0.25f;    //  Max. chord deviation on screen (pixels).
+    static constexpr int        ms_MAX_DEPTH                            = 10;       //  At most 2^10 pieces per segment.
+//
+    std::vector<Entry>                              entries             {   };      //  Per path slot.
+    std::vector<V2>                                 px                  {   };      //  Scratch output of the last projection.
+    std::uint64_t               generation                              = ~0ULL;
+    V2                          scale                                   {   };
+    V2                          offset                                  {   };
+    float                       tol                                     = 1.0f;
+    V2                          view_min                                {   };      //  World-space rect of the plot area.
+    V2                          view_max                                {   };
+//
+    [[nodiscard]] inline V2             project                         (const V2 ws) const noexcept
+        { return V2{ offset.x + scale.x * ws.x,  offset.y + scale.y * ws.y }; }
+    inline void                         touch                           (const std::size_t pi) noexcept
+        { if ( pi < entries.size() ) { ++entries[pi].rev; } }
+    inline void                         touch_all                       (void) noexcept
+        { for (Entry & e : entries) { ++e.rev; } }
+};
+
+
+//  "RetainedGeometry_t"
+//      Per-path tessellated fill and stroke meshes, kept across frames.  Every vertex is stored as a world-space
+//      anchor plus a pixel-space offset (AA fringe, half stroke-width), so a camera pan or zoom only re-projects:
+//          px  =  CurveCache::project(ws)  +  off.
+//
+//      -   A mesh is re-tessellated when its path's flattened curve is rebuilt, the path is opened / closed, its style
+//          (colour, width, AA) changes, or the view's aspect ratio changes (the offsets are built from screen-space
+//          directions).
+//      -   "out" holds the last projection;  an unchanged camera re-emits it verbatim.
+//      -   All entries are dropped whenever "RenderCache::dirty" is raised (structural edits, z-order changes).
+//      -   Closed fills are triangulated in WORLD space ("tris"), so that step only reruns when the flattened curve or
+//          the fill rule changes;  an aspect change merely rebuilds the AA fringe around the cached triangles.
+//
+template< typename V2 >
+struct RetainedGeometry_t {
+    using                       FillRule                                = cblib::math::triangulate::FillRule;
+    using                       Triangulation                           = cblib::math::triangulate::Triangulation<V2>;
+//
+    struct Vert { V2 ws;  V2 off;  ImU32 col; };
+//
+    struct Mesh {
+        std::vector<Vert>           vtx                                 {   };
+        std::vector<uint32_t>       idx                                 {   };      //  Mesh-local vertex indices.
+        std::vector<ImDrawVert>     out                                 {   };      //  Pixel-space cache of the last projection.
+    //
+        bool                        valid                               = false;
+        std::uint64_t               curve_built                         = 0ULL;     //  Stamps of the tessellated input...
+        float                       curve_tol                           = 0.0f;
+        bool                        closed                              = false;
+        ImU32                       col                                 = 0;
+        float                       width                               = 0.0f;
+        bool                        aa                                  = false;
+        float                       aspect                              = 0.0f;
+        V2                          cam_scale                           {   };      //  ...and of the projection in "out".
+        V2                          cam_offset                          {   };
+        bool                        projected                           = false;
+    //
+        inline void                 clear                               (void) noexcept
+            { vtx.clear();  idx.clear();  valid = false;  projected = false; }
+    };
+//
+    struct Fill {
+        Triangulation               tris                                {   };
+        std::uint64_t               built                               = 0ULL;     //  Stamps of the triangulated curve.
+        float                       tol                                 = 0.0f;
+        bool                        closed                              = false;
+        FillRule                    rule                                = FillRule::COUNT;
+        bool                        valid                               = false;
+    };
+//
+    struct Entry { Mesh fill;  Mesh stroke;  Fill tess; };
+//
+    static constexpr float      ms_ASPECT_EPS                           = 1e-4f;    //  Relative change of sx/sy that forces re-tessellation.
+//
+    std::vector<Entry>                              entries             {   };      //  Per path slot.
+    std::vector<V2>                                 normals             {   };      //  Scratch:  per-edge / per-point screen normals.
+};
+
+
 
 // *************************************************************************** //
 //      4B. AUXILIARY |         SELECTION STATE.
@@ -81,6 +81,8 @@ namespace cb { //     BEGINNING NAMESPACE "cb"...
 
 namespace                       app                         { class     AppState;       }
 namespace                       app                         { struct    MenuState_t;    }
+namespace                       fdtd                        { template<typename T> class SceneRasterizer; }
+namespace                       fdtd                        { struct    RasterGrid;     }
 //
 struct                          EditorSnapshot;
 class                           History;
@@ -135,6 +137,7 @@ public:
     static constexpr auto               ms_MAJOR_VERSION                = EditorIMPL::ms_EDITOR_JSON_MAJ_VERSION;
     static constexpr auto               ms_MINOR_VERSION                = EditorIMPL::ms_EDITOR_JSON_MIN_VERSION;
     static constexpr auto               ms_EDITOR_SCHEMA                = EditorIMPL::ms_EDITOR_SCHEMA;
+    static constexpr auto               ms_EDITOR_BINARY_EXTENSION      = EditorIMPL::ms_EDITOR_BINARY_EXTENSION;
     //
     //                              MISC. DIMENSIONS:
     static constexpr float              ms_LIST_COLUMN_WIDTH            = 340.0f;   // px width of point‑list column
@@ -354,6 +357,14 @@ protected:
     std::vector<Point>                  m_points;
     std::vector<Path>                   m_paths;                //  New path container
     std::unordered_set<HandleID>        m_show_handles;         //  List of which glyphs we WANT to display Bezier points for.
+    VertexIndex                         m_vindex                { m_vertices, m_paths };    //  VertexID --> slot in "m_vertices" / parent in "m_paths".
+    mutable SpatialIndex                m_spatial               {   };                      //  World-space AABB tree for hit-testing and lasso.
+    mutable CurveCache                  m_curves                {   };                      //  Flattened per-path polylines (render, fill, hit-test, lasso).
+    //
+    //                              BLOCK-SHARED DOCUMENT MIRROR  ("make_snapshot" syncs it;  snapshots copy it in O(blocks)):
+    mutable cblib::CowChunkedVector<Vertex>     m_doc_vertices  {   };
+    mutable cblib::CowChunkedVector<Path>       m_doc_paths     {   };
+    mutable cblib::CowChunkedVector<Point>      m_doc_points    {   };
     //
     //
     OverlayManager                      m_ov_manager;      //  formerly: "m_overlays".
@@ -367,9 +378,9 @@ protected:
     FileDialog::Initializer             m_SAVE_DIALOG_DATA              = {
         /* type               = */  FileDialog::Type::Save,
         /* window_name        = */  "Save Editor Session",
-        /* default_filename   = */  "canvas_settings.json",
-        /* required_extension = */  "json",
-        /* valid_extensions   = */  {".json", ".txt"},
+        /* default_filename   = */  "canvas_settings.cbproj",
+        /* required_extension = */  "",
+        /* valid_extensions   = */  {".cbproj", ".json", ".txt"},
         /* starting_dir       = */  std::filesystem::current_path()
     };
     FileDialog::Initializer         m_OPEN_DIALOG_DATA              = {
@@ -377,7 +388,7 @@ protected:
         /* window_name        = */  "Open Editor Session",
         /* default_filename   = */  "",
         /* required_extension = */  "",
-        /* valid_extensions   = */  {".json", ".cbjson", ".txt"},
+        /* valid_extensions   = */  {".cbproj", ".json", ".cbjson", ".txt"},
         /* starting_dir       = */  std::filesystem::current_path()
     };
     FileDialog                          m_save_dialog;
@@ -562,6 +573,14 @@ public:
     //
     void                                Begin                               (const char * id = "##EditorCanvas");
     void                                DrawBrowser                         (void);
+    //
+    //
+    //
+    // *************************************************************************** //
+    //      FDTD EXPORT.                    |   "fdtd_export.cpp" ...
+    // *************************************************************************** //
+    void                                SyncFDTDScene                       (fdtd::SceneRasterizer<double> & ) const;
+    [[nodiscard]] fdtd::RasterGrid      FDTDGrid                            (const double cell) const;
     
     // *************************************************************************** //
     //
@@ -617,7 +636,6 @@ protected:
     //
     //                              LOCATED ELSEWHERE:
     void                                _MECH_render_frame                  ([[maybe_unused]] const Interaction & ) const;  //  * NEW  _MECH  FUNCTION *    location: "render.cpp".
-    void                                _MECH_pump_main_tasks               (void);                     //  formerly "pump_main_tasks".                     location: "serialization.cpp".
     void                                _MECH_draw_controls                 (void);                     //  formerly "_draw_controls".                      location: "browser.cpp".
     void                                _MECH_process_selection             (const Interaction & );     //  formerly "_process_selection".                  location: "selection.cpp".
     void                                _MECH_query_shortcuts               ([[maybe_unused]] const Interaction & );        //  * NEW  _MECH  FUNCTION *    location: "shortcuts.cpp".
@@ -821,6 +839,8 @@ protected:
         std::vector<size_t>     z_view;                 // indices into m_paths
         size_t                  n_paths_last    = 0;
         bool                    dirty           = true;
+        std::uint64_t           generation      = ~0ULL;    // entity-store generation the view was built for
+        RetainedGeometry        retained        {   };      // per-path tessellation, dropped whenever "dirty"
     };
     mutable RenderCache                 m_render_cache                      {   };      //  mutable if _MECH_render_frame() is const
     //
@@ -843,6 +863,13 @@ protected:
     inline void                         _RENDER_top_channel                 (std::span<const size_t> , const RenderCTX & ) const noexcept;
     //
     //
+    //                              RETAINED GEOMETRY:
+    void                                _retained_fill                      (const size_t , const RenderCTX & ) const;
+    void                                _retained_stroke                    (const size_t , const RenderCTX & ) const;
+    void                                _retained_build_fill                (RetainedGeometry::Mesh & , const RetainedGeometry::Triangulation & , const ImU32 , const bool , const float ) const;
+    void                                _retained_build_stroke              (RetainedGeometry::Mesh & , const CurveCache::Entry & , const bool , const ImU32 , const float , const bool , const float ) const;
+    void                                _retained_emit                      (ImDrawList * , RetainedGeometry::Mesh & ) const;
+    //
     //                              PRIMARY RENDERING:
 #ifndef _EDITOR_REMOVE_DEPRECATED_CODE
     void                                _render_paths                       (ImDrawList * dl) const;
@@ -876,6 +903,23 @@ protected:
     //                              HIT-DETECTION UTILITIES:
     inline void                         _dispatch_cursor_hint               (const Hit::Type) const noexcept; 
     inline void                         _dispatch_cursor_icon               ([[maybe_unused]] const Interaction & ) const;
+    //
+    //                              SPATIAL INDEX:
+    void                                _spatial_sync                       (void) const;
+    void                                _spatial_rebuild                    (void) const;
+    [[nodiscard]] bool                  _spatial_segment_box                (const Path & , const size_t , SpatialIndex::Box & ) const noexcept;
+    std::vector<SpatialIndex::Item> &   _spatial_query                      (ImVec2 , ImVec2 ) const;
+    std::vector<SpatialIndex::Item> &   _spatial_query_px                   (const ImVec2 , const float ) const;
+    //
+    //  "_spatial_touch"
+    //      Queue a refit for every leaf that depends on "vid";  call after moving a vertex or editing its handles.
+    inline void                         _spatial_touch                      (const VertexID vid)    { this->m_spatial.dirty.push_back(vid); }
+    //
+    //                              FLATTENED CURVE CACHE:
+    void                                _curve_sync                         (void) const;
+    const CurveCache::Entry &           _curve_flat                         (const size_t ) const;
+    [[nodiscard]] bool                  _curve_culled                       (const size_t , const float ) const;
+    std::span<const ImVec2>             _curve_px                           (const size_t ) const;
     
     // *************************************************************************** //
     //
@@ -1203,11 +1247,20 @@ protected:
     
     
     //  "find_vertex"
-    static inline Vertex *              find_vertex                             (std::vector<Vertex> & verts, VertexID id) noexcept
-        { for (auto & v : verts) {  if (v.id == id) {return &v;}  } return nullptr; }
+    //      O(1) through "m_vindex" when "verts" is "m_vertices";  linear scan for any other container.
+    inline Vertex *                     find_vertex                             (std::vector<Vertex> & verts, VertexID id) const noexcept
+        { return this->m_vindex(verts, id); }
+    //
+    inline const Vertex *               find_vertex                             (const std::vector<Vertex> & verts, VertexID id) const noexcept
+        { return this->m_vindex(verts, id); }
     //
-    static inline const Vertex *        find_vertex                             (const std::vector<Vertex> & verts, VertexID id) noexcept
-        { for (auto & v : verts) if (v.id == id) return &v; return nullptr; }
+    //  "find_vertex_mut"
+    //      Hides the free-function template of the same name inside Editor members.
+    inline Vertex *                     find_vertex_mut                         (std::vector<Vertex> & verts, VertexID id) const noexcept
+        { return this->m_vindex(verts, id); }
+    //
+    inline const Vertex *               find_vertex_mut                         (const std::vector<Vertex> & verts, VertexID id) const noexcept
+        { return this->m_vindex(verts, id); }
     
     
     
@@ -1266,6 +1319,7 @@ protected:
             new_paths           .push_back( std::move(m_paths[old_i]) );
         }
         m_paths.swap(new_paths);
+        m_vindex.invalidate();
 
 
         //  Reassign sequential z so top row = greatest z
@@ -1385,6 +1439,7 @@ protected:
         Path                            temp        = std::move(m_paths[src]);
         m_paths.erase( m_paths.begin() + src );
         m_paths.insert( m_paths.begin() + (src < dst ? dst - 1 : dst), std::move(temp) );
+        m_vindex.invalidate();
 
 
         //      2.      REBUILD Z-INDEX     [ TOP-ROW = HIGHEST Z-INDEX.  BOTTOM-ROW = LOWEST Z-INDEX ]...
@@ -1455,28 +1510,21 @@ protected:
     //  "parent_path_of_vertex"
     //
     [[nodiscard]] inline const Path *   parent_path_of_vertex               (VertexID vid) const noexcept {
-        for (const Path & p : this->m_paths) {
-            for (VertexID v : p.verts) {
-                if (v == vid)   { return &p; }
-            }
-        }
-        return nullptr;                     // not found
+        const auto      idx     = this->m_vindex.path_slot(vid);
+        return ( idx == VertexIndex::ms_NONE )  ? nullptr   : &this->m_paths[idx];
     }
     
     //  "parent_path_of_vertex_mut"
     //      Mutable variant – returns nullptr if not found
     [[nodiscard]] inline Path *         parent_path_of_vertex_mut           (VertexID vid) {
-        for (Path & p : m_paths) {
-            for (VertexID v : p.verts) {
-                if (v == vid)   { return &p; }
-            }
-        }
-        return nullptr;
+        const auto      idx     = this->m_vindex.path_slot(vid);
+        return ( idx == VertexIndex::ms_NONE )  ? nullptr   : &this->m_paths[idx];
     }
     
     //  "_erase_vertex_record_only"
     inline void                         _erase_vertex_record_only           (VertexID vid) {
         m_vertices.erase(std::remove_if(m_vertices.begin(), m_vertices.end(), [vid](const Vertex& v){ return v.id == vid; }), m_vertices.end());
+        m_vindex.invalidate();
     }
     
     //  "_prune_selection_mutability"
@@ -1596,6 +1644,7 @@ protected:
 
         p.verts             = verts;                        // freshly-built vertex list
         m_paths.push_back(std::move(p));
+        m_vindex.invalidate();
         return m_paths.back();                              // reference for caller tweaks
     }
     
@@ -1621,6 +1670,7 @@ protected:
             dup.verts.push_back(vid_map[old]); // map to duplicated verts
 
         m_paths.push_back(std::move(dup));
+        m_vindex.invalidate();
         return m_paths.back();
     }
     
@@ -1748,6 +1798,10 @@ public:
     // *************************************************************************** //
     static constexpr uint8_t            ms_MAJOR_VERSION                = EditorIMPL::ms_EDITOR_JSON_MAJ_VERSION;
     static constexpr uint8_t            ms_MINOR_VERSION                = EditorIMPL::ms_EDITOR_JSON_MIN_VERSION;
+    //
+    //                              DOCUMENT STORAGE:
+    template< typename T >
+    using                               cow_vector                      = cblib::CowChunkedVector<T>;     //  Copy = O(blocks);  blocks shared.
     
 //
 //
@@ -1767,9 +1821,11 @@ public:
     // *************************************************************************** //
     //      CORE DATA...
     // *************************************************************************** //
-    std::vector<Vertex>                 vertices    ;
-    std::vector<Path>                   paths       ;
-    std::vector<Point>                  points      ;
+    //      Structurally shared with "Editor::m_doc":  copying a snapshot never deep-copies the document, and the
+    //      shared blocks are immutable, so a copy may be handed to a worker thread.
+    cow_vector<Vertex>                  vertices    ;
+    cow_vector<Path>                    paths       ;
+    cow_vector<Point>                   points      ;
     std::vector<Line>                   lines       ;
     
     // *************************************************************************** //
@@ -1876,9 +1932,9 @@ public:
     inline void                         copy_from               (const Editor & e)
     {
         //      1.      CORE DATA...
-        this->vertices                  = e.m_vertices              ;
-        this->paths                     = e.m_paths                 ;
-        this->points                    = e.m_points                ;
+        this->vertices                  .assign( e.m_vertices.begin(),  e.m_vertices.end()  );
+        this->paths                     .assign( e.m_paths.begin(),     e.m_paths.end()     );
+        this->points                    .assign( e.m_points.begin(),    e.m_points.end()    );
         //  this->lines                     = e.m_lines                 ;
         //
         //
@@ -1963,9 +2019,9 @@ public:
 inline void to_json(nlohmann::json & j, const EditorSnapshot & s)
 {
     j   = nlohmann::json{
-        { "vertices",               s.vertices              },
-        { "paths",                  s.paths                 },
-        { "points",                 s.points                },
+        { "vertices",               s.vertices  .to_vector()    },
+        { "paths",                  s.paths     .to_vector()    },
+        { "points",                 s.points    .to_vector()    },
         { "selection",              s.selection             }
         //
         //  add grid / view / mode when you serialize them
@@ -1980,9 +2036,13 @@ inline void to_json(nlohmann::json & j, const EditorSnapshot & s)
 //
 inline void from_json(const nlohmann::json & j, EditorSnapshot & s)
 {
-    j.at(   "vertices"              )       .get_to (   s.vertices             );
-    j.at(   "paths"                 )       .get_to (   s.paths                );
-    j.at(   "points"                )       .get_to (   s.points               );
+    using   Snap    = EditorSnapshot;
+    auto    vs      = j.at( "vertices"  ).get< std::vector<Snap::Vertex>   >();
+    auto    ps      = j.at( "paths"     ).get< std::vector<Snap::Path>     >();
+    auto    pts     = j.at( "points"    ).get< std::vector<Snap::Point>    >();
+    s.vertices      .assign( std::make_move_iterator(vs.begin()),   std::make_move_iterator(vs.end())   );
+    s.paths         .assign( std::make_move_iterator(ps.begin()),   std::make_move_iterator(ps.end())   );
+    s.points        .assign( std::make_move_iterator(pts.begin()),  std::make_move_iterator(pts.end())  );
     j.at(   "selection"             )       .get_to (   s.selection            );
     
     return;
@@ -46,6 +46,7 @@
 #include <string_view>
 #include <vector>           //                          //  <======| std::vector, ...
 #include <array>
+#include <span>
 #include <unordered_set>
 
 #include <stdexcept>        //                          //  <======| ...
@@ -1240,8 +1241,8 @@ public:
             }
         }
 
-        //  Fill the constructed outline
-        dl->PathFillConvex(this->style.fill_color);
+        //  Fill the constructed outline  (concave-safe;  ImGui's convex fan mis-fills non-convex shapes)
+        dl->PathFillConcave(this->style.fill_color);
     
         return;
     }
@@ -1278,6 +1279,44 @@ public:
     }
     
     
+    //  "render_fill_area"
+    //      Same, from an outline already flattened and projected to pixels (no closing duplicate).
+    //      Falls back to per-segment sampling when no outline is available.
+    //
+    template<class CTX>
+    inline void                         render_fill_area                    (const CTX & ctx, std::span<const ImVec2> px) const noexcept
+    {
+        if ( px.size() < 3 )                { this->render_fill_area(ctx);  return; }
+
+        ctx.args.dl->AddConcavePolyFilled( px.data(), static_cast<int>(px.size()), this->style.fill_color );
+        return;
+    }
+    
+    
+    //  "render_stroke"
+    //      Same, as a single polyline through the pre-projected points.
+    //
+    template<class CTX>
+    inline void	                        render_stroke                       (const CTX & ctx, std::span<const ImVec2> px) const noexcept
+    {
+        if ( px.size() < 2 )                { this->render_stroke(ctx);  return; }
+        this->_draw_polyline(px, this->style, ctx);
+        return;
+    }
+    
+    
+    //  "render_highlight"
+    //      Same, as a single polyline through the pre-projected points.
+    //
+    template<class CTX>
+    inline void	                        render_highlight                    (const PathStyle & style_, const CTX & ctx, std::span<const ImVec2> px) const noexcept
+    {
+        if ( px.size() < 2 )                { this->render_highlight(style_, ctx);  return; }
+        this->_draw_polyline(px, style_, ctx);
+        return;
+    }
+    
+    
     //  "render_vertices"
     //
     template<class CTX, class VStyle>
@@ -1320,6 +1359,18 @@ public:
     //      SUBSIDIARY RENDER FUNCTIONS.
     // *************************************************************************** //
     
+    //  "_draw_polyline"
+    //      Local helper: stroke the whole (pre-projected) outline in one call;  closed paths join back to the start.
+    //
+    template<class CTX>
+    inline void	                        _draw_polyline                      (std::span<const ImVec2> px, const PathStyle & style_, const CTX & ctx) const noexcept
+    {
+        ctx.args.dl->AddPolyline( px.data(), static_cast<int>(px.size()), style_.stroke_color,
+                                  (this->closed) ? ImDrawFlags_Closed : ImDrawFlags_None, style_.stroke_width );
+        return;
+    }
+    
+    
     //  "_draw_segment"
     //      Local helper: draw one segment a -> b (straight or cubic)
     //
@@ -27,6 +27,7 @@
 //  2.  Math, Numerics.
 #include <cmath>                    //  std::nextafter
 #include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <limits>
 
@@ -96,6 +97,17 @@ struct Action
     //      ADVANCED VIRTUAL METHODS.       |   "..."
     // *************************************************************************** //
     virtual bool                        merge_with              (const Action & ) noexcept      { return false; }   //  Optional: merge consecutive edits (drag/typing)
+    //
+    //  "merge_key"
+    //      Non-zero key of a COALESCIBLE kind of action (e.g. "drag the current selection").  "Orchid::push" only
+    //      offers "merge_with" to the previous entry when both keys match and the edits fall inside its merge window;
+    //      "merge_with" must then fold the newer action (already applied) into this one and return true.
+    virtual std::uint64_t               merge_key               (void) const noexcept           { return 0; }
+    //
+    //  "byte_size"
+    //      Bytes this action holds, INCLUDING its own object and any heap data it owns.  Counted against the
+    //      "Orchid" memory budget;  override whenever a derived type stores more than a few scalars.
+    virtual std::size_t                 byte_size               (void) const noexcept           { return sizeof(Action); }
     
     
     
@@ -33,6 +33,11 @@
 
 #include <array>
 #include <vector>
+#include <deque>
+#include <memory>
+#include <memory_resource>          //  std::pmr::unsynchronized_pool_resource
+#include <chrono>
+#include <optional>
 #include <initializer_list>
 #include <string>
 #include <string_view>
@@ -80,7 +85,60 @@ public:
     //
     using                                       Item                            = ABC                                                   ;
     using                                       smart_pointer                   = std::unique_ptr<Item>                                 ;
-    using                                       container_type                  = std::vector<smart_pointer>                            ;
+    using                                       clock_type                      = std::chrono::steady_clock                             ;
+    
+    //  "Deleter"
+    //      Destroys an action that was either heap-allocated by the caller ("push")  OR  carved from the history's
+    //      own pool ("emplace");  "res == nullptr"  selects the former.  Pooled actions are released through "destroy",
+    //      stamped out per concrete type, so the pool always gets back the exact MOST-DERIVED address, size and
+    //      alignment it handed out (never a base-subobject pointer).
+    struct Deleter {
+        using                                   destroy_fn                      = void (*)(Item *, std::pmr::memory_resource *) noexcept;
+    //
+        std::pmr::memory_resource *             res                             = nullptr;
+        destroy_fn                              destroy                         = nullptr;
+    //
+        template< typename A >
+        [[nodiscard]] static inline Deleter     pooled                          (std::pmr::memory_resource * r) noexcept {
+            return Deleter{ r, [](Item * p, std::pmr::memory_resource * m) noexcept {
+                A *         d       = static_cast<A *>(p);
+                d->~A();
+                m->deallocate(d, sizeof(A), alignof(A));
+            } };
+        }
+    //
+        inline void                             operator ()                     (Item * p) const noexcept {
+            if ( !res )     { delete p;  return; }
+            destroy(p, res);
+        }
+    };
+    using                                       owned_pointer                   = std::unique_ptr<Item, Deleter>                        ;
+    
+    //  "Entry"
+    struct Entry {
+        owned_pointer                           act                             ;
+        std::size_t                             bytes                           = 0;            //  "act->byte_size()"  when last (re)measured.
+        clock_type::time_point                  stamp                           {   };          //  Time of the most recent edit folded into "act".
+    };
+    
+    //  "Budget"
+    //      Upper bounds on the retained history.  Whichever limit is crossed first evicts the OLDEST entries;
+    //      the most recent entry is always kept, however large it is.
+    struct Budget {
+        std::size_t                             max_entries                     = 4096;
+        std::size_t                             max_bytes                       = std::size_t(64) << 20;    //  64 MiB.
+    };
+    
+    //  "Stats"
+    struct Stats {
+        std::size_t                             bytes_held                      = 0;            //  Sum of "byte_size()" over every retained entry.
+        std::size_t                             entries                         = 0;
+        std::size_t                             merged                          = 0;            //  Pushes folded into the previous entry.
+        std::size_t                             evicted                         = 0;            //  Entries dropped to honour the budget.
+        std::size_t                             pooled                          = 0;            //  Live entries allocated from the pool.
+    };
+    //
+    using                                       container_type                  = std::deque<Entry>                                     ;
     //
     //
     //
@@ -112,6 +170,7 @@ public:
     // *************************************************************************** //
     //      STATIC CONSTEXPR CONSTANTS.
     // *************************************************************************** //
+    static constexpr std::chrono::milliseconds  ms_DEFAULT_MERGE_WINDOW         = std::chrono::milliseconds(500);
     
 //
 //
@@ -131,11 +190,17 @@ protected:
     // *************************************************************************** //
     //      IMPORTANT DATA-MEMBERS.
     // *************************************************************************** //
+    std::pmr::unsynchronized_pool_resource  m_pool                  {   };              //  Backs "emplace".  Declared BEFORE "m_history" so it outlives every entry.
     container_type                      m_history                       {   };              //  [ 0, 1, 2, ‥. , (cursor - 1) ] are PAST-ENTRIES (Undos).
                                                                                             //  [ past, ≥ cursor             ] are FUTURE-ENTRIES (Redos).
                                                                                         
     size_type                           m_cursor                        = size_type(0);     //  index of next entry to redo
     size_type                           m_uuid                          = size_type(0);     //  monotonic counter of all UNDO/REDO actions.
+    //
+    Budget                              m_budget                        {   };
+    clock_type::duration                m_merge_window                  = ms_DEFAULT_MERGE_WINDOW;
+    bool                                m_sealed                        = true;             //  Next push may NOT merge into the top entry.
+    Stats                               m_stats                         {   };
     
 //
 //
@@ -182,27 +247,31 @@ public:
     inline void                                 push                            (smart_pointer act) noexcept
     {
         assert(act != nullptr);
-        
-        //      Discard any redoable commands beyond the cursor
-        this->m_history.erase(
-              this->m_history.begin() + static_cast<std::ptrdiff_t>( this->m_cursor )
-            , this->m_history.end()
-        );
-        
-        
-        //      *APPLY* THE CHANGE AS WE PUSH IT TO THE STACK.  This is a  *POLICY DECISION*  we have to make...
-        //          The reason we want to apply it from the Action itself is because it will be immediately obvious
-        //          if there is an error in our Action class implementation if we apply it from here instead
-        //          of having to notice the error IF/WHEN we use the UNDO action.
-        act->redo();
-    
+        this->_push( owned_pointer( act.release(), Deleter{} ) );
+        return;
+    }
     
-        this->m_history.emplace_back( std::move(act) );
-        ++this->m_cursor;
-        ++this->m_uuid;
+    //  "emplace"
+    //      Construct the action inside the history's pool allocator and push it.  Prefer this over "push" for
+    //      high-frequency edits:  small actions are recycled from per-size free lists instead of hitting the heap.
+    //
+    template< typename A, typename... Args >
+        requires std::derived_from<A, Item>
+    inline void                                 emplace                         (Args &&... args)
+    {
+        void *          mem     = this->m_pool.allocate( sizeof(A), alignof(A) );
+        Item *          p       = nullptr;
+        try                     { p = ::new (mem) A( std::forward<Args>(args)... ); }
+        catch (...)             { this->m_pool.deallocate( mem, sizeof(A), alignof(A) );  throw; }
         
+        ++this->m_stats.pooled;
+        this->_push( owned_pointer( p, Deleter::pooled<A>(&this->m_pool) ) );
         return;
     }
+    
+    //  "seal"
+    //      Close the top entry so the next push starts a new undo step even if it could merge (e.g. on mouse-up).
+    inline void                                 seal                            (void) noexcept         { this->m_sealed = true; }
 
     //  "undo"
     //
@@ -210,7 +279,8 @@ public:
     {
         if ( !this->can_undo() )        { return; }
     
-        this->m_history[ --this->m_cursor ]->undo();
+        this->m_history[ --this->m_cursor ].act->undo();
+        this->m_sealed      = true;
         ++this->m_uuid;
         return;
     }
@@ -221,7 +291,8 @@ public:
     {
         if ( !this->can_redo() )        { return; }
         
-        m_history[ m_cursor++ ]->redo();
+        m_history[ m_cursor++ ].act->redo();
+        this->m_sealed      = true;
         ++this->m_uuid;
         return;
     }
@@ -261,6 +332,100 @@ protected:
     // *************************************************************************** //
     void                                        _do_some_math                   (void);
     
+    //  "_push"
+    //
+    inline void                                 _push                           (owned_pointer act) noexcept
+    {
+        const auto      now     = clock_type::now();
+        
+        //      Discard any redoable commands beyond the cursor
+        this->_erase( this->m_cursor, this->m_history.size() );
+        
+        
+        //      *APPLY* THE CHANGE AS WE PUSH IT TO THE STACK.  This is a  *POLICY DECISION*  we have to make...
+        //          The reason we want to apply it from the Action itself is because it will be immediately obvious
+        //          if there is an error in our Action class implementation if we apply it from here instead
+        //          of having to notice the error IF/WHEN we use the UNDO action.
+        act->redo();
+        
+        
+        //      CASE 1 :    COALESCE INTO THE PREVIOUS ENTRY  (same non-zero key, inside the merge window).
+        if ( !this->m_sealed  &&  this->m_cursor > 0 )
+        {
+            Entry &             top     = this->m_history[ this->m_cursor - 1 ];
+            const auto          key     = act->merge_key();
+            
+            if ( key != 0  &&  key == top.act->merge_key()  &&  (now - top.stamp) <= this->m_merge_window
+                 &&  top.act->merge_with(*act) )
+            {
+                const std::size_t   bytes   = top.act->byte_size();
+                this->m_stats.bytes_held   += bytes;
+                this->m_stats.bytes_held   -= top.bytes;
+                top.bytes                   = bytes;
+                top.stamp                   = now;
+                ++this->m_stats.merged;
+                ++this->m_uuid;
+                
+                this->_release( std::move(act) );
+                this->_enforce_budget();
+                return;
+            }
+        }
+        
+        
+        //      CASE 2 :    NEW UNDO STEP.
+        const std::size_t   bytes   = act->byte_size();
+        this->m_history.push_back( Entry{ std::move(act), bytes, now } );
+        this->m_stats.bytes_held   += bytes;
+        this->m_sealed              = false;
+        ++this->m_cursor;
+        ++this->m_uuid;
+        
+        this->_enforce_budget();
+        return;
+    }
+    
+    //  "_enforce_budget"
+    //      Evict from the FRONT (oldest undo steps).  Future entries were already discarded by the push, so every
+    //      eviction is a past entry and the cursor moves down with it.
+    //
+    inline void                                 _enforce_budget                 (void) noexcept
+    {
+        while ( this->m_cursor > 1  &&
+                ( this->m_history.size() > this->m_budget.max_entries  ||  this->m_stats.bytes_held > this->m_budget.max_bytes ) )
+        {
+            this->_erase(0, 1);
+            --this->m_cursor;
+            ++this->m_stats.evicted;
+        }
+        return;
+    }
+    
+    //  "_erase"
+    inline void                                 _erase                          (size_type first, size_type last) noexcept
+    {
+        if ( first >= last )        { return; }
+        
+        for (size_type i = first; i < last; ++i) {
+            this->m_stats.bytes_held   -= this->m_history[i].bytes;
+            this->m_stats.pooled       -= ( this->m_history[i].act.get_deleter().res != nullptr );
+        }
+        this->m_history.erase(
+              this->m_history.begin() + static_cast<difference_type>( first )
+            , this->m_history.begin() + static_cast<difference_type>( last  )
+        );
+        return;
+    }
+    
+    //  "_release"
+    //      Drop an action that never entered the history (merged away).
+    inline void                                 _release                        (owned_pointer act) noexcept
+    {
+        this->m_stats.pooled       -= ( act.get_deleter().res != nullptr );
+        act.reset();
+        return;
+    }
+    
 //
 //
 //
@@ -303,18 +468,38 @@ public:
     //  "get_undo_label"
     [[nodiscard]] inline std::optional< std::string_view >      get_undo_label  (void) const noexcept       {
         if ( !this->can_undo() )    { return std::nullopt; }
-        return ( this->m_history[ m_cursor - 1 ]->label() );
+        return ( this->m_history[ m_cursor - 1 ].act->label() );
     }
     //
     [[nodiscard]] inline std::optional< std::string_view >      get_redo_label  (void) const noexcept       {
         if ( !this->can_redo() )    { return std::nullopt; }
-        return ( this->m_history[ m_cursor ]->label() );
+        return ( this->m_history[ m_cursor ].act->label() );
     }
     
     
     //  "undo_count"
     [[nodiscard]] inline size_type              undo_count                      (void) const noexcept       { return this->m_cursor;                                }
     [[nodiscard]] inline size_type              redo_count                      (void) const noexcept       { return this->m_history.size() - this->m_cursor;       }
+    
+    
+    //  "stats"
+    [[nodiscard]] inline Stats                  stats                           (void) const noexcept
+        { Stats s = this->m_stats;  s.entries = this->m_history.size();  return s; }
+    
+    
+    //  "set_budget"
+    [[nodiscard]] inline const Budget &         get_budget                      (void) const noexcept       { return this->m_budget; }
+    inline void                                 set_budget                      (const Budget & b) noexcept
+    {
+        this->m_budget      = b;
+        this->_enforce_budget();
+        return;
+    }
+    
+    //  "set_merge_window"
+    //      Consecutive same-key edits closer together than this collapse into one undo step.  Zero disables merging.
+    [[nodiscard]] inline clock_type::duration   get_merge_window                (void) const noexcept       { return this->m_merge_window; }
+    inline void                                 set_merge_window                (clock_type::duration w) noexcept   { this->m_merge_window = w; }
 
 
 
@@ -326,7 +511,14 @@ public:
     // *************************************************************************** //
     
     //  "clear"
-    inline void                                 clear                           (void) noexcept             { this->m_history.clear(); this->m_cursor = 0;          }
+    inline void                                 clear                           (void) noexcept
+    {
+        this->_erase( 0, this->m_history.size() );
+        this->m_cursor      = 0;
+        this->m_sealed      = true;
+        ++this->m_uuid;
+        return;
+    }
     
     
     
@@ -35,6 +35,14 @@
 # include "templates/containers/utility/utility/_ndring_buffer.h"
 #endif	//  _CBLIB_CONTAINERS_NDRINGBUFFER_H  //
 
+#ifndef _CBLIB_CONTAINERS_AABBTREE_H
+# include "templates/containers/utility/utility/_aabb_tree.h"
+#endif	//  _CBLIB_CONTAINERS_AABBTREE_H  //
+
+#ifndef _CBLIB_CONTAINERS_COWVECTOR_H
+# include "templates/containers/utility/utility/_cow_vector.h"
+#endif	//  _CBLIB_CONTAINERS_COWVECTOR_H  //
+
 
 
 //
@@ -0,0 +1,429 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****          _ A A B B _ T R E E . H  ____  F I L E            ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [templates/containers/utility/utility/_aabb_tree.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBLIB_CONTAINERS_AABBTREE_H
+#define _CBLIB_CONTAINERS_AABBTREE_H 1
+
+
+//      1.          SYSTEM HEADERS...
+#include <cstddef>          //  std::size_t
+#include <cstdint>          //  std::int32_t
+#include <vector>           //  std::vector
+#include <algorithm>        //  std::min, std::max
+#include <utility>          //  std::forward
+#include <type_traits>      //  std::is_same_v, std::invoke_result_t
+#include <functional>       //  std::invoke
+
+
+
+
+namespace cblib {   //     BEGINNING NAMESPACE "cblib"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                PRIMARY CLASS INTERFACE:
+// 		Dynamic (incrementally balanced) 2D AABB Tree.
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "DynamicAABBTree"
+//      Bounding-volume hierarchy over 2D boxes that supports insert / remove / move in O(log N) and box queries
+//      whose cost depends on the number of overlapping leaves, not on the number of stored items.
+//
+//      -   Each leaf stores a "fat" box:  the caller's tight box grown by a margin.  "move" only re-inserts the
+//          leaf once the tight box escapes its fat box, so small drags cost a containment test.
+//      -   Branches are kept balanced with AVL-style rotations after every insert / remove.
+//      -   Nodes live in one vector with an intrusive free-list;  proxies stay valid until "remove" / "clear".
+//      -   "query" is const but uses a member stack:  do not query one tree from two threads at once.
+//
+template< typename T, typename Real = float >
+class DynamicAABBTree
+{
+// *************************************************************************** //
+public:
+    using                                   value_type                      = T;
+    using                                   real_type                       = Real;
+    using                                   size_type                       = std::size_t;
+    using                                   proxy_type                      = std::int32_t;
+    static constexpr proxy_type             ms_NULL                         = -1;
+
+    //  "Box"
+    struct Box {
+        Real                                min_x                           = Real(0);
+        Real                                min_y                           = Real(0);
+        Real                                max_x                           = Real(0);
+        Real                                max_y                           = Real(0);
+    //
+        [[nodiscard]] inline bool           overlaps                        (const Box & o) const noexcept
+            { return !( o.min_x > max_x  ||  o.max_x < min_x  ||  o.min_y > max_y  ||  o.max_y < min_y ); }
+        [[nodiscard]] inline bool           contains                        (const Box & o) const noexcept
+            { return min_x <= o.min_x  &&  min_y <= o.min_y  &&  o.max_x <= max_x  &&  o.max_y <= max_y; }
+        [[nodiscard]] inline Real           perimeter                       (void) const noexcept
+            { return Real(2) * ( (max_x - min_x) + (max_y - min_y) ); }
+        [[nodiscard]] inline Box            expanded                        (const Real m) const noexcept
+            { return Box{ min_x - m, min_y - m, max_x + m, max_y + m }; }
+        [[nodiscard]] static inline Box     merge                           (const Box & a, const Box & b) noexcept
+            { return Box{ std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y), std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y) }; }
+    };
+
+// *************************************************************************** //
+protected:
+    struct Node {
+        Box                                 box                             {   };
+        value_type                          data                            {   };
+        proxy_type                          parent                          = ms_NULL;      //  Doubles as "next" while on the free-list.
+        proxy_type                          child1                          = ms_NULL;
+        proxy_type                          child2                          = ms_NULL;
+        int                                 height                          = -1;           //  Leaf = 0,  free = -1.
+    //
+        [[nodiscard]] inline bool           is_leaf                         (void) const noexcept   { return child1 == ms_NULL; }
+    };
+    //
+    std::vector<Node>                       m_nodes                         {   };
+    proxy_type                              m_root                          = ms_NULL;
+    proxy_type                              m_free                          = ms_NULL;
+    size_type                               m_count                         = 0ULL;         //  Live leaves.
+    mutable std::vector<proxy_type>         m_stack                         {   };
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    inline                                  DynamicAABBTree                 (void) noexcept         = default;
+
+
+    //  Queries.
+    [[nodiscard]] inline size_type          size                            (void) const noexcept   { return this->m_count; }
+    [[nodiscard]] inline bool               empty                           (void) const noexcept   { return this->m_count == 0ULL; }
+    [[nodiscard]] inline int                height                          (void) const noexcept   { return (this->m_root == ms_NULL) ? 0 : this->m_nodes[this->m_root].height; }
+    [[nodiscard]] inline value_type &       data                            (proxy_type id) noexcept        { return this->m_nodes[id].data; }
+    [[nodiscard]] inline const value_type & data                            (proxy_type id) const noexcept  { return this->m_nodes[id].data; }
+    [[nodiscard]] inline const Box &        fat_box                         (proxy_type id) const noexcept  { return this->m_nodes[id].box; }
+
+
+    //  "clear"
+    //      Drop every proxy;  node storage keeps its capacity.
+    inline void                             clear                           (void) noexcept
+    {
+        this->m_nodes.clear();
+        this->m_root    = ms_NULL;
+        this->m_free    = ms_NULL;
+        this->m_count   = 0ULL;
+        return;
+    }
+
+
+    //  "reserve"
+    inline void                             reserve                         (size_type leaves)      { this->m_nodes.reserve(2ULL * leaves); }
+
+
+    //  "insert"
+    //      Add a leaf for "tight" (grown by "margin") and return its proxy.
+    inline proxy_type                       insert                          (const Box & tight, const value_type & data, const Real margin = Real(0))
+    {
+        const proxy_type    id          = this->_alloc_node();
+        Node &              n           = this->m_nodes[id];
+        n.box                           = tight.expanded(margin);
+        n.data                          = data;
+        n.height                        = 0;
+        this->_insert_leaf(id);
+        ++this->m_count;
+        return id;
+    }
+
+
+    //  "remove"
+    inline void                             remove                          (const proxy_type id) noexcept
+    {
+        this->_remove_leaf(id);
+        this->_free_node(id);
+        --this->m_count;
+        return;
+    }
+
+
+    //  "move"
+    //      Refit a leaf after its object changed.  Returns true when the leaf had to be re-inserted;  false when
+    //      "tight" still fits inside the current fat box (nothing to do).
+    inline bool                             move                            (const proxy_type id, const Box & tight, const Real margin = Real(0))
+    {
+        if ( this->m_nodes[id].box.contains(tight) )    { return false; }
+
+        this->_remove_leaf(id);
+        this->m_nodes[id].box           = tight.expanded(margin);
+        this->_insert_leaf(id);
+        return true;
+    }
+
+
+    //  "query"
+    //      Invoke "fn(proxy)" for every leaf whose fat box overlaps "box".  If "fn" returns bool, returning false
+    //      stops the traversal early.
+    template< typename Fn >
+    inline void                             query                           (const Box & box, Fn && fn) const
+    {
+        if ( this->m_root == ms_NULL )      { return; }
+
+        this->m_stack.clear();
+        this->m_stack.push_back(this->m_root);
+        while ( !this->m_stack.empty() )
+        {
+            const proxy_type    id      = this->m_stack.back();     this->m_stack.pop_back();
+            const Node &        n       = this->m_nodes[id];
+            if ( !n.box.overlaps(box) )         { continue; }
+
+            if ( n.is_leaf() )
+            {
+                if constexpr ( std::is_same_v<std::invoke_result_t<Fn &, proxy_type>, bool> ) {
+                    if ( !std::invoke(fn, id) )     { return; }
+                }
+                else    { std::invoke(fn, id); }
+                continue;
+            }
+            this->m_stack.push_back(n.child1);
+            this->m_stack.push_back(n.child2);
+        }
+        return;
+    }
+
+
+// *************************************************************************** //
+protected:
+
+    //  "_alloc_node"
+    inline proxy_type                       _alloc_node                     (void)
+    {
+        if ( this->m_free != ms_NULL ) {
+            const proxy_type    id      = this->m_free;
+            this->m_free                = this->m_nodes[id].parent;
+            this->m_nodes[id]           = Node{ };
+            return id;
+        }
+        this->m_nodes.emplace_back();
+        return static_cast<proxy_type>( this->m_nodes.size() - 1ULL );
+    }
+
+    //  "_free_node"
+    inline void                             _free_node                      (const proxy_type id) noexcept
+    {
+        Node &              n           = this->m_nodes[id];
+        n.parent                        = this->m_free;
+        n.child1                        = ms_NULL;
+        n.child2                        = ms_NULL;
+        n.height                        = -1;
+        this->m_free                    = id;
+        return;
+    }
+
+
+    //  "_insert_leaf"
+    //      Descend by the surface-area heuristic (perimeter in 2D), splice in a new parent next to the chosen
+    //      sibling, then refit and rebalance back up to the root.
+    inline void                             _insert_leaf                    (const proxy_type leaf)
+    {
+        if ( this->m_root == ms_NULL ) {
+            this->m_root                    = leaf;
+            this->m_nodes[leaf].parent      = ms_NULL;
+            return;
+        }
+
+        //      1.      FIND THE BEST SIBLING...
+        const Box           leaf_box    = this->m_nodes[leaf].box;
+        proxy_type          idx         = this->m_root;
+        while ( !this->m_nodes[idx].is_leaf() )
+        {
+            const Node &    n           = this->m_nodes[idx];
+            const Real      area        = n.box.perimeter();
+            const Real      combined    = Box::merge(n.box, leaf_box).perimeter();
+            const Real      cost        = Real(2) * combined;               //  Cost of a new parent here.
+            const Real      inherit     = Real(2) * (combined - area);      //  Cost pushed down to the children.
+
+            auto            child_cost  = [&](const proxy_type c) noexcept -> Real {
+                const Node &    cn      = this->m_nodes[c];
+                const Real      grown   = Box::merge(leaf_box, cn.box).perimeter();
+                return cn.is_leaf()     ? (grown + inherit)     : (grown - cn.box.perimeter() + inherit);
+            };
+            const Real      cost1       = child_cost(n.child1);
+            const Real      cost2       = child_cost(n.child2);
+
+            if ( cost < cost1  &&  cost < cost2 )   { break; }
+            idx                         = (cost1 < cost2)   ? n.child1  : n.child2;
+        }
+
+
+        //      2.      SPLICE IN A NEW PARENT  ("_alloc_node" may re-allocate:  no references held across it)...
+        const proxy_type    sibling     = idx;
+        const proxy_type    old_parent  = this->m_nodes[sibling].parent;
+        const proxy_type    new_parent  = this->_alloc_node();
+        {
+            Node &          np          = this->m_nodes[new_parent];
+            np.parent                   = old_parent;
+            np.box                      = Box::merge(leaf_box, this->m_nodes[sibling].box);
+            np.height                   = this->m_nodes[sibling].height + 1;
+            np.child1                   = sibling;
+            np.child2                   = leaf;
+        }
+        if ( old_parent != ms_NULL ) {
+            Node &          op          = this->m_nodes[old_parent];
+            if ( op.child1 == sibling )     { op.child1 = new_parent; }
+            else                            { op.child2 = new_parent; }
+        }
+        else    { this->m_root = new_parent; }
+        this->m_nodes[sibling].parent   = new_parent;
+        this->m_nodes[leaf].parent      = new_parent;
+
+
+        //      3.      REFIT + REBALANCE ANCESTORS...
+        this->_refit_upwards( this->m_nodes[leaf].parent );
+        return;
+    }
+
+
+    //  "_remove_leaf"
+    inline void                             _remove_leaf                    (const proxy_type leaf) noexcept
+    {
+        if ( leaf == this->m_root ) {
+            this->m_root    = ms_NULL;
+            return;
+        }
+
+        const proxy_type    parent      = this->m_nodes[leaf].parent;
+        const proxy_type    grand       = this->m_nodes[parent].parent;
+        const proxy_type    sibling     = ( this->m_nodes[parent].child1 == leaf )  ? this->m_nodes[parent].child2
+                                                                                    : this->m_nodes[parent].child1;
+        if ( grand != ms_NULL )
+        {
+            Node &          g           = this->m_nodes[grand];
+            if ( g.child1 == parent )       { g.child1 = sibling; }
+            else                            { g.child2 = sibling; }
+            this->m_nodes[sibling].parent   = grand;
+            this->_free_node(parent);
+            this->_refit_upwards(grand);
+        }
+        else
+        {
+            this->m_root                    = sibling;
+            this->m_nodes[sibling].parent   = ms_NULL;
+            this->_free_node(parent);
+        }
+        return;
+    }
+
+
+    //  "_refit_upwards"
+    inline void                             _refit_upwards                  (proxy_type idx) noexcept
+    {
+        while ( idx != ms_NULL )
+        {
+            idx                         = this->_balance(idx);
+            Node &          n           = this->m_nodes[idx];
+            const Node &    c1          = this->m_nodes[n.child1];
+            const Node &    c2          = this->m_nodes[n.child2];
+            n.height                    = 1 + std::max(c1.height, c2.height);
+            n.box                       = Box::merge(c1.box, c2.box);
+            idx                         = n.parent;
+        }
+        return;
+    }
+
+
+    //  "_balance"
+    //      If the subtree at "a" is unbalanced, rotate its taller child up.  Returns the subtree's new root.
+    inline proxy_type                       _balance                        (const proxy_type a) noexcept
+    {
+        Node &              A           = this->m_nodes[a];
+        if ( A.is_leaf()  ||  A.height < 2 )        { return a; }
+
+        const proxy_type    b           = A.child1;
+        const proxy_type    c           = A.child2;
+        const int           balance     = this->m_nodes[c].height - this->m_nodes[b].height;
+
+        if ( balance >  1 )     { return this->_rotate_up(a, c, /*replaces_child2=*/true);  }
+        if ( balance < -1 )     { return this->_rotate_up(a, b, /*replaces_child2=*/false); }
+        return a;
+    }
+
+
+    //  "_rotate_up"
+    //      Promote child "up" of "a" (its child2 when "replaces_child2", else its child1).  "up" keeps its taller
+    //      child and hands the shorter one down to "a" in the slot "up" used to occupy.
+    inline proxy_type                       _rotate_up                      (const proxy_type a, const proxy_type up, const bool replaces_child2) noexcept
+    {
+        Node &              A           = this->m_nodes[a];
+        Node &              U           = this->m_nodes[up];
+        const proxy_type    f           = U.child1;
+        const proxy_type    g           = U.child2;
+        const proxy_type    other       = replaces_child2   ? A.child1  : A.child2;     //  "a"'s child that stays.
+
+        //      1.      "up" takes "a"'s place under "a"'s parent.
+        U.child1                        = a;
+        U.parent                        = A.parent;
+        A.parent                        = up;
+        if ( U.parent != ms_NULL ) {
+            Node &          P           = this->m_nodes[U.parent];
+            if ( P.child1 == a )            { P.child1 = up; }
+            else                            { P.child2 = up; }
+        }
+        else    { this->m_root = up; }
+
+        //      2.      Keep the taller grandchild on "up";  the shorter one goes to "a".
+        const bool          keep_f      = this->m_nodes[f].height > this->m_nodes[g].height;
+        const proxy_type    keep        = keep_f    ? f     : g;
+        const proxy_type    give        = keep_f    ? g     : f;
+
+        U.child2                        = keep;
+        if ( replaces_child2 )          { A.child2 = give; }
+        else                            { A.child1 = give; }
+        this->m_nodes[give].parent      = a;
+
+        A.box                           = Box::merge( this->m_nodes[other].box, this->m_nodes[give].box );
+        A.height                        = 1 + std::max( this->m_nodes[other].height, this->m_nodes[give].height );
+        U.box                           = Box::merge( A.box, this->m_nodes[keep].box );
+        U.height                        = 1 + std::max( A.height, this->m_nodes[keep].height );
+        return up;
+    }
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+};//	END "DynamicAABBTree" INLINE CLASS DEFINITION.
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF "cblib" NAMESPACE.
+
+
+
+
+
+
+#endif  //  _CBLIB_CONTAINERS_AABBTREE_H  //
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
@@ -0,0 +1,234 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****          _ C O W _ V E C T O R . H  ____  F I L E          ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [templates/containers/utility/utility/_cow_vector.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBLIB_CONTAINERS_COWVECTOR_H
+#define _CBLIB_CONTAINERS_COWVECTOR_H 1
+
+
+//      1.          SYSTEM HEADERS...
+#include <cstddef>          //  std::size_t, std::ptrdiff_t
+#include <iterator>         //  std::random_access_iterator_tag
+#include <memory>           //  std::shared_ptr
+#include <vector>           //  std::vector
+#include <algorithm>        //  std::min
+#include <utility>          //  std::forward
+
+
+
+
+namespace cblib {   //     BEGINNING NAMESPACE "cblib"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//                PRIMARY CLASS INTERFACE:
+// 		Copy-on-write chunked vector (structural sharing).
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "CowChunkedVector"
+//      Sequence stored as fixed-size blocks of  2^ChunkBits  elements, each held by a shared pointer.  Copying the
+//      container copies the block table only (O(N / chunk)), and the copies share every block.
+//
+//      -   A block is only ever written in place while this container is its sole owner;  otherwise it is cloned
+//          first.  Shared blocks are therefore immutable, and a copy may be read on another thread while the
+//          original keeps being edited.
+//      -   "sync" mirrors an external  std::vector<T>,  replacing only the blocks whose contents differ (as judged by
+//          a caller-supplied predicate), so repeated snapshots of a mostly unchanged array allocate O(changed blocks).
+//      -   Elements are read-only through the public interface except through "emplace_back" / "push_back".
+//
+template< typename T, std::size_t ChunkBits = 6 >
+class CowChunkedVector
+{
+// *************************************************************************** //
+public:
+    using                                   value_type                      = T;
+    using                                   size_type                       = std::size_t;
+    using                                   chunk_type                      = std::vector<T>;
+    static constexpr size_type              ms_CHUNK                        = size_type(1) << ChunkBits;
+    static constexpr size_type              ms_MASK                         = ms_CHUNK - 1;
+
+    //  "const_iterator"
+    class const_iterator {
+    public:
+        using                               iterator_category               = std::random_access_iterator_tag;
+        using                               value_type                      = T;
+        using                               difference_type                 = std::ptrdiff_t;
+        using                               pointer                         = const T *;
+        using                               reference                       = const T &;
+    //
+        inline                              const_iterator                  (void) noexcept                                 = default;
+        inline                              const_iterator                  (const CowChunkedVector * o, size_type i) noexcept  : m_owner(o), m_i(i) {   }
+    //
+        [[nodiscard]] inline reference      operator *                      (void) const noexcept   { return (*m_owner)[m_i]; }
+        [[nodiscard]] inline pointer        operator ->                     (void) const noexcept   { return &(*m_owner)[m_i]; }
+        [[nodiscard]] inline reference      operator []                     (difference_type n) const noexcept  { return (*m_owner)[m_i + n]; }
+        inline const_iterator &             operator ++                     (void) noexcept         { ++m_i;  return *this; }
+        inline const_iterator               operator ++                     (int) noexcept          { auto t = *this;  ++m_i;  return t; }
+        inline const_iterator &             operator --                     (void) noexcept         { --m_i;  return *this; }
+        inline const_iterator               operator --                     (int) noexcept          { auto t = *this;  --m_i;  return t; }
+        inline const_iterator &             operator +=                     (difference_type n) noexcept    { m_i += n;  return *this; }
+        inline const_iterator &             operator -=                     (difference_type n) noexcept    { m_i -= n;  return *this; }
+        [[nodiscard]] friend inline const_iterator  operator +              (const_iterator a, difference_type n) noexcept  { return a += n; }
+        [[nodiscard]] friend inline const_iterator  operator +              (difference_type n, const_iterator a) noexcept  { return a += n; }
+        [[nodiscard]] friend inline const_iterator  operator -              (const_iterator a, difference_type n) noexcept  { return a -= n; }
+        [[nodiscard]] friend inline difference_type operator -              (const const_iterator & a, const const_iterator & b) noexcept
+            { return static_cast<difference_type>(a.m_i) - static_cast<difference_type>(b.m_i); }
+        [[nodiscard]] friend inline bool    operator ==                     (const const_iterator & a, const const_iterator & b) noexcept   { return a.m_i == b.m_i; }
+        [[nodiscard]] friend inline auto    operator <=>                    (const const_iterator & a, const const_iterator & b) noexcept   { return a.m_i <=> b.m_i; }
+    private:
+        const CowChunkedVector *            m_owner                         = nullptr;
+        size_type                           m_i                             = 0;
+    };
+
+// *************************************************************************** //
+protected:
+    std::vector<std::shared_ptr<chunk_type>>    m_chunks                    {   };
+    size_type                                   m_size                      = 0;
+
+    //  "_mutable_last"
+    //      Last block, cloned first if anybody else still holds it.
+    inline chunk_type &                     _mutable_last                   (void)
+    {
+        if ( m_chunks.empty()  ||  m_chunks.back()->size() == ms_CHUNK ) {
+            m_chunks.push_back( std::make_shared<chunk_type>() );
+            m_chunks.back()->reserve(ms_CHUNK);
+        }
+        else if ( m_chunks.back().use_count() > 1 ) {
+            auto    fresh   = std::make_shared<chunk_type>();
+            fresh->reserve(ms_CHUNK);
+            fresh->assign( m_chunks.back()->begin(), m_chunks.back()->end() );
+            m_chunks.back() = std::move(fresh);
+        }
+        return *m_chunks.back();
+    }
+
+// *************************************************************************** //
+public:
+
+    //  Default Constructor.
+    inline                                  CowChunkedVector                (void) noexcept         = default;
+
+    //  Range Constructor.
+    template< typename It >
+    inline                                  CowChunkedVector                (It first, It last)     { this->assign(first, last); }
+
+
+    //  Queries.
+    [[nodiscard]] inline size_type          size                            (void) const noexcept   { return this->m_size; }
+    [[nodiscard]] inline bool               empty                           (void) const noexcept   { return this->m_size == 0; }
+    [[nodiscard]] inline size_type          chunk_count                     (void) const noexcept   { return this->m_chunks.size(); }
+    [[nodiscard]] inline const T &          operator []                     (size_type i) const noexcept
+        { return (*this->m_chunks[i >> ChunkBits])[i & ms_MASK]; }
+    [[nodiscard]] inline const T &          back                            (void) const noexcept   { return this->m_chunks.back()->back(); }
+    [[nodiscard]] inline const_iterator     begin                           (void) const noexcept   { return const_iterator(this, 0); }
+    [[nodiscard]] inline const_iterator     end                             (void) const noexcept   { return const_iterator(this, this->m_size); }
+
+    //  "shares_chunk"
+    //      True if block "c" is the very same allocation in both containers.
+    [[nodiscard]] inline bool               shares_chunk                    (const CowChunkedVector & o, size_type c) const noexcept
+        { return c < m_chunks.size()  &&  c < o.m_chunks.size()  &&  m_chunks[c] == o.m_chunks[c]; }
+
+
+    //  Modifiers.
+    inline void                             clear                           (void) noexcept         { m_chunks.clear();  m_size = 0; }
+    inline void                             reserve                         (size_type n)           { m_chunks.reserve( (n + ms_MASK) >> ChunkBits ); }
+
+    template< typename... Args >
+    inline T &                              emplace_back                    (Args &&... args)
+    {
+        chunk_type &    c   = this->_mutable_last();
+        ++m_size;
+        return c.emplace_back( std::forward<Args>(args)... );
+    }
+    inline void                             push_back                       (const T & v)           { this->emplace_back(v); }
+    inline void                             push_back                       (T && v)                { this->emplace_back( std::move(v) ); }
+
+    template< typename It >
+    inline void                             assign                          (It first, It last)
+    {
+        this->clear();
+        for (; first != last; ++first)      { this->emplace_back(*first); }
+    }
+
+    //  "to_vector"
+    [[nodiscard]] inline std::vector<T>     to_vector                       (void) const
+    {
+        std::vector<T>  out;
+        out.reserve(m_size);
+        for (const auto & c : m_chunks)     { out.insert( out.end(), c->begin(), c->end() ); }
+        return out;
+    }
+
+
+    //  "sync"
+    //      Make this container equal to "src".  A block is kept (still shared with earlier copies) when every element
+    //      satisfies  same(src[i], block[i]);  otherwise a fresh block is built.  Returns the number of blocks rebuilt.
+    //
+    template< typename Same >
+    inline size_type                        sync                            (const std::vector<T> & src, Same && same)
+    {
+        const size_type     n_chunks    = ( src.size() + ms_MASK ) >> ChunkBits;
+        size_type           rebuilt     = 0;
+
+        m_chunks.resize(n_chunks);
+        for (size_type c = 0; c < n_chunks; ++c)
+        {
+            const size_type     first   = c << ChunkBits;
+            const size_type     last    = std::min( first + ms_CHUNK, src.size() );
+            auto &              blk     = m_chunks[c];
+
+            bool                keep    = ( blk  &&  blk->size() == last - first );
+            for (size_type i = first; keep  &&  i < last; ++i)
+                { keep = same( src[i], (*blk)[i - first] ); }
+            if ( keep )         { continue; }
+
+            auto    fresh   = std::make_shared<chunk_type>();
+            fresh->reserve(ms_CHUNK);
+            fresh->assign( src.begin() + static_cast<std::ptrdiff_t>(first), src.begin() + static_cast<std::ptrdiff_t>(last) );
+            blk             = std::move(fresh);
+            ++rebuilt;
+        }
+        m_size      = src.size();
+        return rebuilt;
+    }
+};
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF "cblib" NAMESPACE.
+
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+#endif  //  _CBLIB_CONTAINERS_COWVECTOR_H  //
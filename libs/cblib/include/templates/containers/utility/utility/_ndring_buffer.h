@@ -52,6 +52,9 @@
 #include <stdexcept>        //  std::out_of_range
 #include <algorithm>        //  std::min
 #include <iterator>         //  std::make_reverse_iterator
+#include <span>             //  std::span
+#include <cstring>          //  std::memcpy
+#include <functional>       //  std::identity, std::invoke
 
 
 
@@ -119,6 +122,10 @@ public:
     //                              CUSTOM ALIASES:
     using                               Alloc                           = allocator_type;
     using	                            This				            = ndRingBuffer<T, Allocator>;
+    using                               span_type                       = std::span<value_type>;
+    using                               const_span_type                 = std::span<const value_type>;
+    using                               span_pair                       = std::pair<span_type, span_type>;
+    using                               const_span_pair                 = std::pair<const_span_type, const_span_type>;
     
     
     // *************************************************************************** //
@@ -246,6 +253,25 @@ public:
     [[nodiscard]] inline const_pointer              data                (void) const noexcept;
     
     
+    //  "as_spans"      The two contiguous segments, oldest first  (second is empty when the data does not wrap).
+    [[nodiscard]] inline span_pair                  as_spans            (void)       noexcept;
+    [[nodiscard]] inline const_span_pair            as_spans            (void) const noexcept;
+    [[nodiscard]] inline bool                       is_linear           (void) const noexcept   { return this->offset() + m_count <= m_capacity; }
+    //
+    //  "linearize"     Rotate in place so the elements are chronological from "data()";  returns that single span.
+    inline span_type                                linearize           (void);
+    
+    
+    // *************************************************************************** //
+    //      2B. |  SEARCH.
+    // *************************************************************************** //
+    //  "time_lower_bound"
+    //      Logical index of the first element whose key ("proj(e)", e.g. "&ImVec2::x") is not less than "t";  "size()" if none.
+    //      Requires keys that never decrease from oldest to newest.  O(log N), no modulo per probe.
+    template<typename Key, typename Proj = std::identity>
+    [[nodiscard]] inline size_type                  time_lower_bound    (const Key & t, Proj proj = {}) const;
+    
+    
     // *************************************************************************** //
     //      2B. |  ELEMENT ACCESSORS.
     // *************************************************************************** //
@@ -283,6 +309,9 @@ public:
     inline void                                     pop_front           (void) noexcept;
     inline void                                     pop_back            (void) noexcept;
     //
+    //  "push_back_bulk"    Append a whole block (oldest first) in at most two block copies;  keeps the newest "capacity()".
+    void                                            push_back_bulk      (const_span_type src)   noexcept(std::is_nothrow_copy_assignable_v<value_type>);
+    //
     void                                            set_capacity        (const size_type new_cap, const Preserve policy = Preserve::Latest);
     
     
@@ -394,6 +423,16 @@ protected:
     //      2C. |  CENTRALIZED STATE MANAGEMENT FUNCTIONS.
     // *************************************************************************** //
     
+    //  "_copy_n"
+    //      Block copy;  a single "memcpy" for trivially-copyable types.
+    static inline void                              _copy_n             (pointer dst, const_pointer src, const size_type n)
+        noexcept(std::is_nothrow_copy_assignable_v<value_type>)
+    {
+        if (n == 0)     { return; }
+        if constexpr ( std::is_trivially_copyable_v<value_type> )   { std::memcpy( static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(value_type) ); }
+        else                                                        { std::copy_n(src, n, dst); }
+        return;
+    }
     
     
     // *************************************************************************** //
@@ -959,6 +998,28 @@ inline void ndRingBuffer<T,Allocator>::pop_back(void) noexcept
 }
 
 
+//  "push_back_bulk"
+//
+template<class T, class Allocator>
+void ndRingBuffer<T,Allocator>::push_back_bulk(const_span_type src) noexcept(std::is_nothrow_copy_assignable_v<value_type>)
+{
+    T * const       base        = std::to_address(m_storage);
+
+    if ( m_capacity == 0  ||  src.empty() )     { return; }
+    if ( src.size() > m_capacity )              { src = src.last(m_capacity); }             //  older items would be overwritten anyway.
+
+
+    const size_type     n           = src.size();
+    const size_type     first       = std::min<size_type>(n, m_capacity - m_head);          //  up to the physical end...
+    _copy_n( base + m_head, src.data(),         first       );
+    _copy_n( base,          src.data() + first, n - first   );                              //  ...then wrap to the front.
+
+    m_head          = (m_head + n) % m_capacity;
+    m_count         = std::min<size_type>(m_count + n, m_capacity);
+    return;
+}
+
+
 //  "set_capacity"
 //
 template<class T, class Allocator>
@@ -1086,6 +1147,70 @@ void ndRingBuffer<T,Allocator>::set_capacity(const size_type new_cap, const Pres
 
 
 
+// *************************************************************************** //
+//      2B. API |  CONTIGUOUS ACCESS / SEARCH.
+// *************************************************************************** //
+
+//  "as_spans"
+//
+template<class T, class Allocator>
+inline auto ndRingBuffer<T,Allocator>::as_spans(void) noexcept -> span_pair
+{
+    T * const           base    = std::to_address(m_storage);
+    const size_type     start   = this->offset();
+    const size_type     first   = std::min<size_type>(m_count, m_capacity - start);
+    
+    if (m_count == 0)   { return { span_type{}, span_type{} }; }
+    return { span_type(base + start, first), span_type(base, m_count - first) };
+}
+
+//  "as_spans"
+template<class T, class Allocator>
+inline auto ndRingBuffer<T,Allocator>::as_spans(void) const noexcept -> const_span_pair
+{
+    const auto      [a, b]      = const_cast<This *>(this)->as_spans();
+    return { const_span_type(a), const_span_type(b) };
+}
+
+
+//  "linearize"
+//      No-op when the elements already start at "data()".
+//
+template<class T, class Allocator>
+inline auto ndRingBuffer<T,Allocator>::linearize(void) -> span_type
+{
+    T * const           base    = std::to_address(m_storage);
+    const size_type     start   = this->offset();
+    
+    if (m_capacity == 0)    { return span_type{}; }
+    if (start != 0)         { std::rotate(base, base + start, base + m_capacity); }
+    m_head          = (m_count == m_capacity)   ? 0     : m_count;
+    return span_type(base, m_count);
+}
+
+
+//  "time_lower_bound"
+//
+template<class T, class Allocator>
+template<typename Key, typename Proj>
+inline auto ndRingBuffer<T,Allocator>::time_lower_bound(const Key & t, Proj proj) const -> size_type
+{
+    const auto      [a, b]      = this->as_spans();
+    auto            less        = [&](const value_type & v) { return std::invoke(proj, v) < t; };
+    
+    //      1.      THE OLDER SEGMENT HOLDS THE ANSWER UNLESS ALL OF IT LIES BEFORE "t"...
+    if ( !a.empty()  &&  !less(a.back()) )
+        { return static_cast<size_type>( std::partition_point(a.begin(), a.end(), less) - a.begin() ); }
+    
+    //      2.      ...OTHERWISE SEARCH THE WRAPPED SEGMENT.
+    return a.size() + static_cast<size_type>( std::partition_point(b.begin(), b.end(), less) - b.begin() );
+}
+
+
+
+
+
+
 // *************************************************************************** //
 //      2B. API |  ITERATORS.
 // *************************************************************************** //
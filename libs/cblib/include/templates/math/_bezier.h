@@ -325,6 +325,32 @@ inline void sample_quadratic_polyline_push(const V2& A, const V2& C, const V2& B
 }
 
 
+//  "flatten_quadratic_adaptive"
+//      Adaptive polyline of a quadratic Bézier:  halves the curve (de Casteljau) until each piece deviates
+//      from its chord by at most "tol", then calls emit(P, t) for every piece's END point (t in (0,1]).
+//      The start point A is NOT emitted, so consecutive segments can be appended without duplicates.
+//      The chord deviation of a quadratic is |A - 2C + B| / 4;  "max_depth" caps the output at 2^max_depth pieces.
+//
+template<typename V2, typename T, typename Emit>
+inline void flatten_quadratic_adaptive(const V2& A, const V2& C, const V2& B,
+                                       T tol, Emit&& emit, int max_depth = 10,
+                                       T t0 = T(0), T t1 = T(1)) noexcept
+{
+    const T     dx      = A.x - T(2)*C.x + B.x;
+    const T     dy      = A.y - T(2)*C.y + B.y;
+
+    if ( max_depth <= 0  ||  (dx*dx + dy*dy) <= T(16)*tol*tol )     { emit(B, t1); return; }
+
+    const V2    AC      = v2_mul<V2,T>( v2_add<V2>(A, C), T(0.5) );
+    const V2    CB      = v2_mul<V2,T>( v2_add<V2>(C, B), T(0.5) );
+    const V2    M       = v2_mul<V2,T>( v2_add<V2>(AC, CB), T(0.5) );
+    const T     tm      = T(0.5) * (t0 + t1);
+
+    flatten_quadratic_adaptive<V2,T>(A, AC, M, tol, emit, max_depth - 1, t0, tm);
+    flatten_quadratic_adaptive<V2,T>(M, CB, B, tol, emit, max_depth - 1, tm, t1);
+}
+
+
 
 // *************************************************************************** //
 //              2C.     PIXEL-SPACE HELPERS FOR QUADRATIC BEZIER.
@@ -602,6 +628,34 @@ inline void sample_cubic_polyline(const V2& A,const V2& C1,const V2& C2,const V2
 }
 
 
+//  "flatten_cubic_adaptive"
+//      Adaptive polyline of a cubic Bézier;  same contract as "flatten_quadratic_adaptive".
+//      A cubic deviates from its chord by at most 3/4 * max( |A - 2C1 + C2|, |C1 - 2C2 + B| ).
+//
+template<typename V2, typename T, typename Emit>
+inline void flatten_cubic_adaptive(const V2& A, const V2& C1, const V2& C2, const V2& B,
+                                   T tol, Emit&& emit, int max_depth = 10,
+                                   T t0 = T(0), T t1 = T(1)) noexcept
+{
+    const T     ax      = A.x  - T(2)*C1.x + C2.x,      ay      = A.y  - T(2)*C1.y + C2.y;
+    const T     bx      = C1.x - T(2)*C2.x + B.x,       by      = C1.y - T(2)*C2.y + B.y;
+    const T     m2      = std::max(ax*ax + ay*ay, bx*bx + by*by);
+
+    if ( max_depth <= 0  ||  T(9)*m2 <= T(16)*tol*tol )             { emit(B, t1); return; }
+
+    const V2    P01     = v2_mul<V2,T>( v2_add<V2>(A,  C1), T(0.5) );
+    const V2    P12     = v2_mul<V2,T>( v2_add<V2>(C1, C2), T(0.5) );
+    const V2    P23     = v2_mul<V2,T>( v2_add<V2>(C2, B ), T(0.5) );
+    const V2    P012    = v2_mul<V2,T>( v2_add<V2>(P01, P12), T(0.5) );
+    const V2    P123    = v2_mul<V2,T>( v2_add<V2>(P12, P23), T(0.5) );
+    const V2    M       = v2_mul<V2,T>( v2_add<V2>(P012, P123), T(0.5) );
+    const T     tm      = T(0.5) * (t0 + t1);
+
+    flatten_cubic_adaptive<V2,T>(A, P01, P012, M, tol, emit, max_depth - 1, t0, tm);
+    flatten_cubic_adaptive<V2,T>(M, P123, P23, B, tol, emit, max_depth - 1, tm, t1);
+}
+
+
 //  "cubic_deriv_quad_coeffs"
 //      Given A,C1,C2,B, return qa, qb, qc so that for each axis:
 //          (Q'_3/3)(t) = qa * t^2 + qb * t + qc
@@ -0,0 +1,760 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****         _ T R I A N G U L A T E . H  ____  F I L E         ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [templates/math/_triangulate.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBLIB_MATH_TRIANGULATE_H
+#define _CBLIB_MATH_TRIANGULATE_H 1
+
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+
+namespace cblib { namespace math {   //     BEGINNING NAMESPACE "cblib" :: "math"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+namespace triangulate { //     BEGINNING NAMESPACE "triangulate"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1.      TYPES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FillRule"
+//      Which points of a (possibly self-intersecting) closed outline are "inside".
+//
+enum class FillRule : uint8_t {
+      EvenOdd = 0           //  Odd number of crossings to infinity.
+    , NonZero               //  Non-zero winding number  (SVG / PostScript default).
+    , COUNT
+};
+
+
+//  "Triangulation"
+//      Output of "triangulate()".
+//
+//      -   "points" holds every ring, back-to-back;  a point shared by two rings is stored once PER ring.
+//      -   Rings are oriented so the filled side is on the LEFT of each edge  (outer rings CCW, holes CW, in a
+//          y-up frame).  They are the exact boundary of the filled area, e.g. for anti-aliasing fringes.
+//      -   "indices" are triangles (3 per) into "points".
+//
+template< typename V2 >
+struct Triangulation {
+    struct Ring { uint32_t first = 0;  uint32_t count = 0;  bool hole = false; };
+//
+    std::vector<V2>                 points                  {   };
+    std::vector<Ring>               rings                   {   };
+    std::vector<uint32_t>           indices                 {   };
+//
+    inline void                     clear                   (void) noexcept     { points.clear();  rings.clear();  indices.clear(); }
+    [[nodiscard]] inline bool       empty                   (void) const noexcept   { return indices.empty(); }
+};
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 1.  "TYPES" ]].
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      2.      POLYGON PRIMITIVES...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "signed_area"
+//      Shoelace area;  positive for CCW in a y-up frame.
+//
+template< typename V2 >
+[[nodiscard]] inline double signed_area(const V2 * p, const std::size_t n) noexcept
+{
+    double      a       = 0.0;
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+        { a += (static_cast<double>(p[j].x) * p[i].y) - (static_cast<double>(p[i].x) * p[j].y); }
+    return 0.5 * a;
+}
+
+
+//  "winding_number"
+//      Winding number of the closed outline p[0..n) around q  (Sunday's crossing-sign test).
+//
+template< typename V2 >
+[[nodiscard]] inline int winding_number(const V2 * p, const std::size_t n, const V2 q) noexcept
+{
+    int         wn      = 0;
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++)
+    {
+        const double    ax  = p[j].x,   ay  = p[j].y;
+        const double    bx  = p[i].x,   by  = p[i].y;
+        const double    c   = (bx - ax) * (q.y - ay) - (q.x - ax) * (by - ay);
+
+        if ( ay <= q.y ) {
+            if ( by >  q.y  &&  c > 0.0 )   { ++wn; }
+        }
+        else {
+            if ( by <= q.y  &&  c < 0.0 )   { --wn; }
+        }
+    }
+    return wn;
+}
+
+
+//  "contains"
+//      Point-in-outline under a fill rule.
+//
+template< typename V2 >
+[[nodiscard]] inline bool contains(const V2 * p, const std::size_t n, const V2 q, const FillRule rule) noexcept
+{
+    if ( n < 3 )        { return false; }
+    const int   wn      = winding_number(p, n, q);
+    return ( rule == FillRule::NonZero )  ? (wn != 0)  : ((wn & 1) != 0);
+}
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 2.  "PRIMITIVES" ]].
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      3.      INTERNAL HELPERS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+namespace detail { //     BEGINNING NAMESPACE "detail"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+struct P2   { double x = 0.0;  double y = 0.0; };
+
+
+//  "cross"
+[[nodiscard]] inline double cross(const P2 & o, const P2 & a, const P2 & b) noexcept
+    { return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x); }
+
+//  "same"
+[[nodiscard]] inline bool same(const P2 & a, const P2 & b) noexcept
+    { return ( a.x == b.x  &&  a.y == b.y ); }
+
+
+//  "in_triangle"
+//      Inclusive test (points on an edge count as inside).
+//
+[[nodiscard]] inline bool in_triangle(const P2 & a, const P2 & b, const P2 & c, const P2 & p) noexcept
+{
+    return ( cross(a, b, p) >= 0.0  &&  cross(b, c, p) >= 0.0  &&  cross(c, a, p) >= 0.0 );
+}
+
+
+//  "area"
+[[nodiscard]] inline double area(const std::vector<P2> & r) noexcept
+    { return signed_area(r.data(), r.size()); }
+
+
+//  "inside_simple"
+//      Even-odd test against ONE simple ring.
+//
+[[nodiscard]] inline bool inside_simple(const std::vector<P2> & r, const P2 & q) noexcept
+{
+    bool        in      = false;
+    for (std::size_t i = 0, j = r.size() - 1; i < r.size(); j = i++)
+    {
+        if ( (r[i].y > q.y) != (r[j].y > q.y)  &&
+             q.x < (r[j].x - r[i].x) * (q.y - r[i].y) / (r[j].y - r[i].y) + r[i].x )
+            { in = !in; }
+    }
+    return in;
+}
+
+
+//  "simplify"
+//      Drop repeated points and collinear pass-through points from a closed ring.
+//
+inline void simplify(std::vector<P2> & r) noexcept
+{
+    std::size_t     w       = 0;
+    for (std::size_t i = 0; i < r.size(); ++i)
+        { if ( w == 0  ||  !same(r[i], r[w - 1]) ) { r[w++] = r[i]; } }
+    while ( w > 1  &&  same(r[0], r[w - 1]) )   { --w; }
+    r.resize(w);
+
+    bool            changed = true;
+    while ( changed  &&  r.size() >= 3 )
+    {
+        changed = false;
+        for (std::size_t i = 0; i < r.size() && r.size() >= 3; )
+        {
+            const P2 &  a   = r[(i + r.size() - 1) % r.size()];
+            const P2 &  b   = r[i];
+            const P2 &  c   = r[(i + 1) % r.size()];
+            const double dot = (b.x - a.x) * (c.x - b.x) + (b.y - a.y) * (c.y - b.y);
+            if ( cross(a, b, c) == 0.0  &&  dot >= 0.0 )    { r.erase(r.begin() + static_cast<std::ptrdiff_t>(i));  changed = true; }
+            else                                            { ++i; }
+        }
+    }
+    if ( r.size() < 3 )     { r.clear(); }
+}
+
+
+//  "Crossing"
+//      A proper crossing between edges "ea" and "eb" at parameters "ta", "tb".
+//
+struct Crossing { uint32_t ea;  uint32_t eb;  double ta;  double tb;  P2 at; };
+
+
+//  "find_crossings"
+//      Every proper crossing between non-adjacent edges of the closed ring "r".  Edges are swept in order of
+//      their min-x, so only pairs that overlap in x are tested.
+//
+inline void find_crossings(const std::vector<P2> & r, std::vector<Crossing> & out)
+{
+    const uint32_t          n       = static_cast<uint32_t>( r.size() );
+    std::vector<uint32_t>   order   ( n );
+    for (uint32_t i = 0; i < n; ++i)    { order[i] = i; }
+
+    auto    lo_x    = [&](uint32_t e) { return std::min(r[e].x, r[(e + 1) % n].x); };
+    auto    hi_x    = [&](uint32_t e) { return std::max(r[e].x, r[(e + 1) % n].x); };
+    std::sort( order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return lo_x(a) < lo_x(b); } );
+
+    out.clear();
+    for (uint32_t oi = 0; oi < n; ++oi)
+    {
+        const uint32_t  e1      = order[oi];
+        const P2 &      a       = r[e1];
+        const P2 &      b       = r[(e1 + 1) % n];
+        const double    e1_hi   = hi_x(e1);
+
+        for (uint32_t oj = oi + 1; oj < n  &&  lo_x(order[oj]) <= e1_hi; ++oj)
+        {
+            const uint32_t  e2      = order[oj];
+            if ( e2 == (e1 + 1) % n  ||  e1 == (e2 + 1) % n )                       { continue; }   //  Adjacent.
+
+            const P2 &      c       = r[e2];
+            const P2 &      d       = r[(e2 + 1) % n];
+            if ( std::max(a.y, b.y) < std::min(c.y, d.y)  ||  std::max(c.y, d.y) < std::min(a.y, b.y) )     { continue; }
+
+            const double    d1      = cross(c, d, a),   d2  = cross(c, d, b);
+            const double    d3      = cross(a, b, c),   d4  = cross(a, b, d);
+            if ( !( ((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0))  &&
+                    ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0)) ) )          { continue; }   //  Not a proper crossing.
+
+            const double    ta      = d1 / (d1 - d2);
+            const double    tb      = d3 / (d3 - d4);
+            const P2        at      { a.x + (b.x - a.x) * ta,  a.y + (b.y - a.y) * ta };
+            out.push_back( (e1 < e2)  ? Crossing{ e1, e2, ta, tb, at }  : Crossing{ e2, e1, tb, ta, at } );
+        }
+    }
+}
+
+
+//  "uncross"
+//      Split the closed ring "r" into loops that touch but never cross, by re-wiring both strands at every crossing
+//      (in_a -> out_b,  in_b -> out_a).  Edge orientations are kept, so winding numbers are unchanged.
+//
+inline void uncross(const std::vector<P2> & r, std::vector< std::vector<P2> > & loops)
+{
+    std::vector<Crossing>   xs;
+    find_crossings(r, xs);
+    loops.clear();
+    if ( xs.empty() )       { loops.push_back(r);  return; }
+
+
+    //      1.      NODES ALONG THE OUTLINE  (each vertex, then its edge's crossings by parameter)...
+    struct Node { P2 at;  double t;  uint32_t edge; };
+    std::vector<Node>       nodes;
+    nodes.reserve( r.size() + 2 * xs.size() );
+    for (uint32_t e = 0; e < r.size(); ++e)     { nodes.push_back( Node{ r[e], -1.0, e } ); }
+    for (uint32_t k = 0; k < xs.size(); ++k)
+    {
+        nodes.push_back( Node{ xs[k].at, xs[k].ta, xs[k].ea } );
+        nodes.push_back( Node{ xs[k].at, xs[k].tb, xs[k].eb } );
+    }
+
+    std::vector<uint32_t>   order   ( nodes.size() );
+    for (uint32_t i = 0; i < order.size(); ++i)     { order[i] = i; }
+    std::sort( order.begin(), order.end(), [&](uint32_t a, uint32_t b)
+        { return (nodes[a].edge != nodes[b].edge) ? (nodes[a].edge < nodes[b].edge) : (nodes[a].t < nodes[b].t); } );
+
+
+    //      2.      NEXT-POINTERS, THEN SWAP AT EVERY CROSSING...
+    const uint32_t          base    = static_cast<uint32_t>( r.size() );        //  Node id of crossing-occurrence "2k" is  base + 2k.
+    std::vector<uint32_t>   next    ( nodes.size() );
+    for (uint32_t i = 0; i < order.size(); ++i)     { next[ order[i] ] = order[ (i + 1) % order.size() ]; }
+    for (uint32_t k = 0; k < xs.size(); ++k)        { std::swap( next[base + 2 * k], next[base + 2 * k + 1] ); }
+
+
+    //      3.      TRACE THE CYCLES...
+    std::vector<uint8_t>    seen    ( nodes.size(), 0 );
+    for (uint32_t s = 0; s < nodes.size(); ++s)
+    {
+        if ( seen[s] )      { continue; }
+        std::vector<P2>     loop;
+        for (uint32_t i = s; !seen[i]; i = next[i])     { seen[i] = 1;  loop.push_back( nodes[i].at ); }
+        simplify(loop);
+        if ( !loop.empty() )    { loops.push_back( std::move(loop) ); }
+    }
+}
+
+
+//  "in_wedge"
+//      True if "d" lies inside the interior wedge  (a -> q -> b)  of a CCW polygon at vertex q.
+//
+[[nodiscard]] inline bool in_wedge(const P2 & a, const P2 & q, const P2 & b, const P2 & d) noexcept
+{
+    const bool      left_in     = ( cross(a, q, d) > 0.0 );
+    const bool      left_out    = ( cross(q, b, d) > 0.0 );
+    return ( cross(a, q, b) >= 0.0 )  ? (left_in && left_out)  : (left_in || left_out);
+}
+
+
+//  "splice"
+//      Insert the hole (starting and ending at hole[mi]) after poly[at], then return to poly[at].
+//
+inline void splice(std::vector<uint32_t> & poly, const std::size_t at, const std::vector<uint32_t> & hole, const std::size_t mi)
+{
+    std::vector<uint32_t>   seam;
+    seam.reserve( hole.size() + 2 );
+    for (std::size_t k = 0; k <= hole.size(); ++k)      { seam.push_back( hole[(mi + k) % hole.size()] ); }
+    seam.push_back( poly[at] );
+    poly.insert( poly.begin() + static_cast<std::ptrdiff_t>(at + 1), seam.begin(), seam.end() );
+}
+
+
+//  "bridge_hole"
+//      Splice the hole ring into the outer polygon list "poly" (Eberly's method):  a seam from the hole's right-most
+//      vertex M to a mutually visible outer vertex P.  Holes produced by "uncross" may TOUCH the outer ring at a
+//      junction;  such a shared point is used directly (zero-length seam), which keeps the polygon weakly simple.
+//
+inline void bridge_hole(const std::vector<P2> & pts, std::vector<uint32_t> & poly, const std::vector<uint32_t> & hole)
+{
+    const std::size_t   n       = poly.size();
+    const std::size_t   h       = hole.size();
+
+
+    //      0.      SHARED JUNCTION POINT  (the hole must leave it INTO the outer ring's wedge)...
+    for (std::size_t mi = 0; mi < h; ++mi)
+    {
+        const P2 &      M       = pts[ hole[mi] ];
+        const P2 &      D       = pts[ hole[(mi + 1) % h] ];
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if ( !same(pts[poly[i]], M) )   { continue; }
+            const P2 &  a       = pts[ poly[(i + n - 1) % n] ];
+            const P2 &  b       = pts[ poly[(i + 1) % n] ];
+            if ( in_wedge(a, M, b, D) )     { splice(poly, i, hole, mi);  return; }
+        }
+    }
+
+
+    //      1.      RIGHT-MOST HOLE VERTEX...
+    std::size_t     mi      = 0;
+    for (std::size_t i = 1; i < h; ++i)
+        { if ( pts[hole[i]].x > pts[hole[mi]].x )   { mi = i; } }
+    const P2        M       = pts[ hole[mi] ];
+
+
+    //      2.      NEAREST OUTER EDGE HIT BY THE RAY  M + t*(1,0);  P = THAT EDGE'S RIGHT END (OR THE VERTEX HIT)...
+    double          best_x  = std::numeric_limits<double>::infinity();
+    std::size_t     best    = n;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const P2 &  a       = pts[ poly[i] ];
+        const P2 &  b       = pts[ poly[(i + 1) % n] ];
+        if ( (a.y > M.y) == (b.y > M.y)  &&  a.y != M.y  &&  b.y != M.y )      { continue; }
+        if ( a.y == b.y )                                                       { continue; }
+
+        const double x      = a.x + (M.y - a.y) * (b.x - a.x) / (b.y - a.y);
+        if ( x < M.x  ||  x >= best_x )                                         { continue; }
+        best_x  = x;
+        if      ( a.y == M.y )      { best = i; }
+        else if ( b.y == M.y )      { best = (i + 1) % n; }
+        else                        { best = ( a.x > b.x )  ? i  : (i + 1) % n; }
+    }
+    if ( best == n )        { best = 0; }                       //  Degenerate:  no hit, seam to the first vertex.
+
+
+    //      3.      A REFLEX VERTEX INSIDE TRIANGLE (M, I, P) BLOCKS P:  USE THE ONE CLOSEST IN ANGLE...
+    const P2        I       { best_x, M.y };
+    const P2        Pb      = pts[ poly[best] ];
+    if ( std::isfinite(best_x)  &&  !same(I, Pb) )
+    {
+        double      best_tan = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const P2 &  q       = pts[ poly[i] ];
+            if ( i == best  ||  q.x < M.x )                     { continue; }
+            if ( !in_triangle(M, I, Pb, q)  &&  !in_triangle(M, Pb, I, q) )     { continue; }   //  Either winding.
+
+            const P2 &  a       = pts[ poly[(i + n - 1) % n] ];
+            const P2 &  c       = pts[ poly[(i + 1) % n] ];
+            if ( cross(a, q, c) > 0.0 )                         { continue; }   //  Convex:  cannot block.
+
+            const double tn     = std::abs(q.y - M.y) / std::max(q.x - M.x, 1e-300);
+            if ( tn < best_tan )    { best_tan = tn;  best = i; }
+        }
+    }
+
+
+    //      4.      SPLICE:  ... P, M, hole..., M, P, ...
+    splice(poly, best, hole, mi);
+}
+
+
+//  "ear_clip"
+//      Triangulate the (weakly) simple CCW polygon "poly" (indices into "pts").  Only reflex vertices can lie inside a
+//      candidate ear, so just those are tested.  If a full lap finds no ear (numerical degeneracy), the most convex
+//      vertex is clipped anyway so the loop always terminates.
+//
+inline void ear_clip(const std::vector<P2> & pts, const std::vector<uint32_t> & poly, std::vector<uint32_t> & out)
+{
+    const uint32_t          n       = static_cast<uint32_t>( poly.size() );
+    if ( n < 3 )            { return; }
+
+    std::vector<uint32_t>   prev    ( n ),  next    ( n );
+    std::vector<uint8_t>    alive   ( n, 1 ),   reflex  ( n, 0 );
+    std::vector<uint32_t>   reflexes;
+    for (uint32_t i = 0; i < n; ++i)    { prev[i] = (i + n - 1) % n;  next[i] = (i + 1) % n; }
+
+    auto    P           = [&](uint32_t i) -> const P2 & { return pts[ poly[i] ]; };
+    auto    convexity   = [&](uint32_t i) { return cross( P(prev[i]), P(i), P(next[i]) ); };
+    for (uint32_t i = 0; i < n; ++i)
+        { if ( convexity(i) <= 0.0 ) { reflex[i] = 1;  reflexes.push_back(i); } }
+
+    auto    is_ear      = [&](uint32_t i) -> bool
+    {
+        if ( convexity(i) <= 0.0 )          { return false; }
+        const P2 &  a   = P(prev[i]);
+        const P2 &  b   = P(i);
+        const P2 &  c   = P(next[i]);
+        for (const uint32_t r : reflexes)
+        {
+            if ( !alive[r]  ||  !reflex[r]  ||  r == prev[i]  ||  r == i  ||  r == next[i] )   { continue; }
+            const P2 &  q   = P(r);
+            if ( same(q, a)  ||  same(q, b)  ||  same(q, c) )                               { continue; }
+            if ( in_triangle(a, b, c, q) )                                                  { return false; }
+        }
+        return true;
+    };
+    auto    clip        = [&](uint32_t i)
+    {
+        out.push_back( poly[prev[i]] );  out.push_back( poly[i] );  out.push_back( poly[next[i]] );
+        alive[i]            = 0;
+        next[prev[i]]       = next[i];
+        prev[next[i]]       = prev[i];
+        for (const uint32_t j : { prev[i], next[i] })
+            { if ( reflex[j]  &&  convexity(j) > 0.0 ) { reflex[j] = 0; } }
+    };
+
+
+    uint32_t        left    = n;
+    uint32_t        i       = 0;
+    uint32_t        misses  = 0;
+    while ( left > 3 )
+    {
+        if ( is_ear(i) ) {
+            const uint32_t nx = next[i];
+            clip(i);  --left;  misses = 0;  i = nx;
+            continue;
+        }
+        i = next[i];
+        if ( ++misses < left )      { continue; }
+
+        //  No ear in a full lap:  force the most convex vertex.
+        uint32_t    pick    = i;
+        double      best    = -std::numeric_limits<double>::infinity();
+        for (uint32_t k = 0, j = i; k < left; ++k, j = next[j])
+            { const double cv = convexity(j);  if ( cv > best ) { best = cv;  pick = j; } }
+        i = next[pick];
+        clip(pick);  --left;  misses = 0;
+    }
+    out.push_back( poly[prev[i]] );  out.push_back( poly[i] );  out.push_back( poly[next[i]] );
+}
+
+
+//  "ear_clip_pinched"
+//      Split "poly" at every PINCH (the same point visited twice, left by zero-length seams and by loops that touch at
+//      a junction) into positively oriented pieces, then ear-clip each piece.  A split is taken only when both halves
+//      keep a positive area, so self-touching lobes that enclose a hole stay in one piece.
+//
+inline void ear_clip_pinched(const std::vector<P2> & pts, const std::vector<uint32_t> & poly, std::vector<uint32_t> & out)
+{
+    std::vector<std::vector<uint32_t>>  stack   { poly };
+    std::vector<uint32_t>               order;
+    std::vector<double>                 prefix;
+
+    while ( !stack.empty() )
+    {
+        std::vector<uint32_t>   cur     = std::move( stack.back() );
+        stack.pop_back();
+        const std::size_t       n       = cur.size();
+        if ( n < 3 )            { continue; }
+
+        //  Shoelace prefix sums:  the piece  cur[i .. j-1]  (with cur[i] == cur[j])  has twice-area  prefix[j] - prefix[i].
+        prefix.assign( n + 1, 0.0 );
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const P2 &  a   = pts[ cur[k] ];
+            const P2 &  b   = pts[ cur[(k + 1) % n] ];
+            prefix[k + 1]   = prefix[k] + (a.x * b.y - a.y * b.x);
+        }
+        const double            total   = prefix[n];
+        if ( !(total > 0.0) )   { continue; }
+
+        order.resize( n );
+        for (uint32_t k = 0; k < n; ++k)    { order[k] = k; }
+        std::sort( order.begin(), order.end(), [&](uint32_t x, uint32_t y) {
+            const P2 & a = pts[ cur[x] ];  const P2 & b = pts[ cur[y] ];
+            return ( a.x != b.x ) ? (a.x < b.x)  : ( a.y != b.y ) ? (a.y < b.y)  : (x < y);
+        } );
+
+        std::size_t             cut_i   = n,    cut_j   = n;
+        for (std::size_t k = 1; k < n  &&  cut_i == n; ++k)
+        {
+            const uint32_t      i       = order[k - 1];
+            const uint32_t      j       = order[k];
+            if ( !same(pts[cur[i]], pts[cur[j]]) )              { continue; }
+            const double        inner   = prefix[j] - prefix[i];
+            if ( j - i < n - 1  &&  ( j - i < 3  ||  inner > 0.0 )  &&  ( n - (j - i) < 3  ||  total - inner > 0.0 ) )
+                { cut_i = i;  cut_j = j; }
+        }
+
+        if ( cut_i == n )       { ear_clip(pts, cur, out);  continue; }
+
+        stack.emplace_back( cur.begin() + static_cast<std::ptrdiff_t>(cut_i), cur.begin() + static_cast<std::ptrdiff_t>(cut_j) );
+        std::vector<uint32_t>   rest    ( cur.begin() + static_cast<std::ptrdiff_t>(cut_j), cur.end() );
+        rest.insert( rest.end(), cur.begin(), cur.begin() + static_cast<std::ptrdiff_t>(cut_i) );
+        stack.push_back( std::move(rest) );
+    }
+}
+
+// *************************************************************************** //
+//
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF "detail" NAMESPACE.
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 3.  "INTERNAL HELPERS" ]].
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      4.      MAIN TRIANGULATION...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "triangulate"
+//      Triangulate the closed outline p[0..n)  (no repeated closing point)  under "rule".
+//
+//      1.  Split the outline at its self-intersections into loops that touch but never cross.
+//      2.  Nest the loops;  each one's inside has winding  = its orientation + its parent's winding.
+//      3.  Keep only loops whose two sides differ in fill state:  the filled-inside ones are outer rings, their
+//          nearest such descendants are holes.
+//      4.  Bridge the holes into their outer ring and ear-clip.
+//
+template< typename V2 >
+inline void triangulate(const V2 * p, const std::size_t n, const FillRule rule, Triangulation<V2> & out)
+{
+    using                           detail::P2;
+    using                           Ring            = typename Triangulation<V2>::Ring;
+    out.clear();
+    if ( n < 3 )                    { return; }
+
+
+    //      1.      CLEAN + UNCROSS...
+    std::vector<P2>                 ring            ( n );
+    for (std::size_t i = 0; i < n; ++i)     { ring[i] = P2{ static_cast<double>(p[i].x), static_cast<double>(p[i].y) }; }
+    detail::simplify(ring);
+    if ( ring.empty() )             { return; }
+
+    std::vector< std::vector<P2> >  loops;
+    detail::uncross(ring, loops);
+    const std::size_t               L               = loops.size();
+
+
+    //      2.      NESTING  (parent = smallest containing loop), PROCESSED OUTERMOST-FIRST...
+    std::vector<double>             area            ( L );
+    std::vector<int32_t>            parent          ( L, -1 );
+    std::vector<uint32_t>           order           ( L );
+    for (std::size_t i = 0; i < L; ++i)     { area[i] = detail::area(loops[i]);  order[i] = static_cast<uint32_t>(i); }
+    std::sort( order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return std::abs(area[a]) > std::abs(area[b]); } );
+
+    for (std::size_t oi = 0; oi < L; ++oi)
+    {
+        const uint32_t      a       = order[oi];
+        const P2 &          u       = loops[a][0];
+        const P2 &          v       = loops[a][1];
+        const P2            probe   { 0.5 * (u.x + v.x),  0.5 * (u.y + v.y) };
+        for (std::size_t oj = oi; oj-- > 0; )                   //  Smaller-to-larger:  first hit is the tightest.
+        {
+            const uint32_t  b       = order[oj];
+            if ( detail::inside_simple(loops[b], probe) )   { parent[a] = static_cast<int32_t>(b);  break; }
+        }
+    }
+
+
+    //      3.      FILL STATE, BOUNDARY LOOPS, NEAREST BOUNDARY ANCESTOR...
+    std::vector<int32_t>            wind            ( L, 0 );
+    std::vector<int32_t>            depth           ( L, 0 );
+    std::vector<uint8_t>            filled          ( L, 0 ),   boundary    ( L, 0 );
+    std::vector<int32_t>            owner           ( L, -1 );      //  Nearest boundary ancestor.
+    for (const uint32_t a : order)
+    {
+        const int32_t       pa      = parent[a];
+        const int32_t       sgn     = (area[a] > 0.0)  ? 1  : -1;
+        wind[a]             = sgn + ( (pa >= 0) ? wind[pa]  : 0 );
+        depth[a]            = 1   + ( (pa >= 0) ? depth[pa] : 0 );
+        filled[a]           = ( rule == FillRule::NonZero )  ? (wind[a] != 0)  : ((depth[a] & 1) != 0);
+
+        const bool          outside = ( pa >= 0 )  ? (filled[pa] != 0)  : false;
+        boundary[a]         = ( filled[a] != static_cast<uint8_t>(outside) );
+        owner[a]            = ( pa < 0 )  ? -1  : ( boundary[pa] ? pa : owner[pa] );
+    }
+
+
+    //      4.      EMIT RINGS, BRIDGE HOLES, EAR-CLIP...
+    std::vector<P2>                 pool;
+    std::vector<uint32_t>           poly,   hole;
+    std::vector<uint32_t>           holes;
+    for (std::size_t a = 0; a < L; ++a)
+    {
+        if ( !boundary[a]  ||  !filled[a] )     { continue; }
+
+        pool.clear();
+        auto    emit_ring   = [&](const std::vector<P2> & r, const bool ccw, const bool is_hole, std::vector<uint32_t> & idx)
+        {
+            const bool          flip    = ( (detail::area(r) > 0.0) != ccw );
+            const uint32_t      first   = static_cast<uint32_t>( out.points.size() );
+            idx.clear();
+            for (std::size_t k = 0; k < r.size(); ++k)
+            {
+                const P2 &      q       = flip ? r[r.size() - 1 - k]  : r[k];
+                idx.push_back( static_cast<uint32_t>(pool.size()) );
+                pool.push_back(q);
+                V2              w       {   };
+                w.x             = static_cast<decltype(w.x)>(q.x);
+                w.y             = static_cast<decltype(w.y)>(q.y);
+                out.points.push_back(w);
+            }
+            out.rings.push_back( Ring{ first, static_cast<uint32_t>(r.size()), is_hole } );
+        };
+
+        const uint32_t      base    = static_cast<uint32_t>( out.points.size() );
+        emit_ring(loops[a], true, false, poly);
+
+        holes.clear();
+        for (std::size_t h = 0; h < L; ++h)
+            { if ( boundary[h]  &&  !filled[h]  &&  owner[h] == static_cast<int32_t>(a) )  { holes.push_back( static_cast<uint32_t>(h) ); } }
+        std::sort( holes.begin(), holes.end(), [&](uint32_t x, uint32_t y) {
+            auto mx = [&](uint32_t k) { double m = loops[k][0].x;  for (const P2 & q : loops[k]) { m = std::max(m, q.x); }  return m; };
+            return mx(x) > mx(y);
+        } );
+        for (const uint32_t h : holes)
+        {
+            emit_ring(loops[h], false, true, hole);
+            detail::bridge_hole(pool, poly, hole);
+        }
+
+        const std::size_t   first_tri   = out.indices.size();
+        detail::ear_clip_pinched(pool, poly, out.indices);
+        for (std::size_t k = first_tri; k < out.indices.size(); ++k)    { out.indices[k] += base; }
+    }
+}
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 4.  "MAIN TRIANGULATION" ]].
+
+
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF "triangulate" NAMESPACE.
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cblib" :: "math" NAMESPACE.
+
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+#endif  //  _CBLIB_MATH_TRIANGULATE_H  //
@@ -57,6 +57,10 @@
 # include "templates/math/_bezier.h"
 #endif	// _CBLIB_MATH_BEZIER_H  //
 
+#ifndef _CBLIB_MATH_TRIANGULATE_H
+# include "templates/math/_triangulate.h"
+#endif	// _CBLIB_MATH_TRIANGULATE_H  //
+
 //
 //
 //
@@ -0,0 +1,217 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****        _ M A P P E D _ F I L E . H  ____  F I L E          ****
+*       ********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+*       ********************************************************************
+*                FILE:      [templates/utility/_mapped_file.h]
+*
+*
+*
+**************************************************************************************
+**************************************************************************************/
+#ifndef _CBLIB_UTILITY_MAPPED_FILE_H
+#define _CBLIB_UTILITY_MAPPED_FILE_H 1
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>          //  POSIX:  open(), mmap(), ...
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+
+namespace cblib { namespace utl {   //     BEGINNING NAMESPACE "cblib" :: "utl"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1.      READ-ONLY MEMORY-MAPPED FILE...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "MappedFile"
+//      Move-only RAII view of a whole file, mapped read-only and private.  Pages are faulted in by the kernel on first
+//      touch, so "open()" is O(1) in the file size and nothing is copied into the heap.
+//
+//      -   An empty file opens successfully with  size() == 0  and  data() == nullptr.
+//      -   Failure leaves the object closed;  "open()" returns false and never throws.
+//
+class MappedFile
+{
+public:
+    inline                              MappedFile                          (void) noexcept                 = default;
+    inline explicit                     MappedFile                          (const std::filesystem::path & path) noexcept
+        { this->open(path); }
+    inline                              ~MappedFile                         (void) noexcept                 { this->close(); }
+    //
+    inline                              MappedFile                          (const MappedFile & )           = delete;
+    MappedFile &                        operator =                          (const MappedFile & )           = delete;
+    inline                              MappedFile                          (MappedFile && o) noexcept
+        : m_data( std::exchange(o.m_data, nullptr) ), m_size( std::exchange(o.m_size, 0) ), m_open( std::exchange(o.m_open, false) )  {   }
+    inline MappedFile &                 operator =                          (MappedFile && o) noexcept
+    {
+        if ( this != &o ) {
+            this->close();
+            m_data  = std::exchange(o.m_data, nullptr);
+            m_size  = std::exchange(o.m_size, 0);
+            m_open  = std::exchange(o.m_open, false);
+        }
+        return *this;
+    }
+
+
+    //  "open"
+    inline bool                         open                                (const std::filesystem::path & path) noexcept
+    {
+        this->close();
+
+        const int           fd      = ::open( path.c_str(), O_RDONLY );
+        if ( fd < 0 )                               { return false; }
+
+        struct stat         st      {   };
+        if ( ::fstat(fd, &st) != 0  ||  st.st_size < 0 )
+            { ::close(fd);  return false; }
+
+        m_size                      = static_cast<std::size_t>( st.st_size );
+        if ( m_size > 0 )
+        {
+            void *          p       = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( p == MAP_FAILED )                  { ::close(fd);  m_size = 0;  return false; }
+            ::madvise( p, m_size, MADV_SEQUENTIAL );
+            m_data                  = static_cast<const std::byte *>( p );
+        }
+
+        ::close(fd);                                //  The mapping keeps its own reference to the file.
+        m_open                      = true;
+        return true;
+    }
+
+
+    //  "close"
+    inline void                         close                               (void) noexcept
+    {
+        if ( m_data )       { ::munmap( const_cast<std::byte *>(m_data), m_size ); }
+        m_data      = nullptr;
+        m_size      = 0;
+        m_open      = false;
+        return;
+    }
+
+
+    [[nodiscard]] inline bool                       is_open             (void) const noexcept   { return m_open; }
+    [[nodiscard]] inline const std::byte *          data                (void) const noexcept   { return m_data; }
+    [[nodiscard]] inline std::size_t                size                (void) const noexcept   { return m_size; }
+    [[nodiscard]] inline std::span<const std::byte> bytes               (void) const noexcept   { return { m_data, m_size }; }
+
+
+// *************************************************************************** //
+private:
+    const std::byte *                   m_data                              = nullptr;
+    std::size_t                         m_size                              = 0;
+    bool                                m_open                              = false;
+};
+
+
+
+//  "write_file_atomic"
+//      Write "bytes" to a fresh temporary next to "path", fsync it, rename it over "path" and fsync the directory, so
+//      a crash mid-write (e.g. during autosave) never leaves a truncated project behind and a completed save survives
+//      power loss.  The temporary is unique per call ("mkstemp"), so concurrent saves of one path never share it;  the
+//      last rename wins.  An existing file keeps its permission bits.  Returns false on any I/O failure;  never throws.
+//
+inline bool write_file_atomic(const std::filesystem::path & path, std::span<const std::byte> bytes) noexcept
+{
+    std::string                 tmp;
+    std::filesystem::path       dir;
+    try {
+        tmp                                 = path.string() + ".XXXXXX";
+        dir                                 = path.parent_path();
+        if ( dir.empty() )                          { dir = "."; }
+    }
+    catch (...)                                     { return false; }
+
+    const int                   fd          = ::mkstemp( tmp.data() );
+    if ( fd < 0 )                                   { return false; }
+    auto                        fail        = [&](void) noexcept -> bool { ::close(fd);  ::unlink( tmp.c_str() );  return false; };
+
+    struct stat                 st          {   };
+    const ::mode_t              mode        = ( ::stat(path.c_str(), &st) == 0 )    ? (st.st_mode & 07777)  : 0644;
+    if ( ::fchmod(fd, mode) != 0 )                  { return fail(); }
+
+    const std::byte *           p           = bytes.data();
+    std::size_t                 left        = bytes.size();
+    while ( left > 0 )
+    {
+        const ::ssize_t         n           = ::write( fd, p, left );
+        if ( n < 0  &&  errno == EINTR )            { continue; }
+        if ( n <= 0 )                               { return fail(); }
+        p                                  += n;
+        left                               -= static_cast<std::size_t>(n);
+    }
+    if ( ::fsync(fd) != 0 )                         { return fail(); }
+    if ( ::close(fd) != 0 )                         { ::unlink( tmp.c_str() );  return false; }
+
+    if ( ::rename( tmp.c_str(), path.c_str() ) != 0 )   { ::unlink( tmp.c_str() );  return false; }
+
+    //      Persist the rename itself.  The new contents are already in place, so a directory that refuses "fsync"
+    //      (some network file systems) does not fail the save.
+    const int                   dfd         = ::open( dir.c_str(), O_RDONLY | O_DIRECTORY );
+    if ( dfd >= 0 )                                 { ::fsync(dfd);  ::close(dfd); }
+    return true;
+}
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 1.  "MEMORY-MAPPED FILE" ]].
+
+
+
+
+
+
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cblib" :: "utl" NAMESPACE.
+
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+#endif  //  _CBLIB_UTILITY_MAPPED_FILE_H  //
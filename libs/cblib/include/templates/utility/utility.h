@@ -42,6 +42,10 @@
 # include "templates/utility/_helper.h"
 #endif	//  _CBLIB_HELPER_H  //
 
+#ifndef _CBLIB_UTILITY_MAPPED_FILE_H
+# include "templates/utility/_mapped_file.h"
+#endif	//  _CBLIB_UTILITY_MAPPED_FILE_H  //
+
 
 
 //  #include "templates/utility/type_traits.h"
@@ -49,6 +53,7 @@
 //  #include "templates/utility/_strings.h"
 //  #include "templates/utility/_time.h"
 //  #include "templates/utility/_helper.h"
+//  #include "templates/utility/_mapped_file.h"
 
 
 
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+#   decode_cblog.py  --  print a binary log written by  cb::utl::Logger::open_binary_sink().
+#
+#       usage:  decode_cblog.py  <file.cblog>  [--csv]
+#
+#   Layout (native byte-order, see "src/utility/logger.cpp"):
+#       header      char[8] "CBLOGBIN",  u32 version,  u32 reserved
+#       'S'         u32 id,  u32 length,  bytes                         (file / function string)
+#       'E'         i32 level,  u64 count,  i64 ts_ns,  u64 thread,  u32 file-id,  u32 func-id,  i32 line,
+#                   u32 length,  bytes                                  (one record;  id 0 = none)
+import sys, struct, csv, datetime, signal
+
+signal.signal(signal.SIGPIPE, signal.SIG_DFL)   # quiet exit when piped into "head"
+
+MAGIC   = b"CBLOGBIN"
+LEVELS  = { 0: "NONE", 10: "DEBUG", 20: "INFO", 30: "WARNING", 35: "EXCEPTION",
+            40: "ERROR", 45: "NOTIFY", 50: "CRITICAL" }
+EVENT   = struct.Struct("<iQqQIIiI")
+STRING  = struct.Struct("<II")
+
+
+def records(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != MAGIC:
+        raise SystemExit(f"{path}: not a CBLOG binary file")
+    (version, _) = struct.unpack_from("<II", data, 8)
+    if version != 1:
+        raise SystemExit(f"{path}: unsupported version {version}")
+
+    strings = { 0: None }
+    pos     = 16
+    while pos < len(data):
+        tag  = data[pos:pos + 1];  pos += 1
+        if tag == b"S":
+            (sid, n) = STRING.unpack_from(data, pos);  pos += STRING.size
+            strings[sid] = data[pos:pos + n].decode("utf-8", "replace");  pos += n
+        elif tag == b"E":
+            if pos + EVENT.size > len(data):
+                break                                   # truncated tail (crash mid-write)
+            (lvl, count, ts, tid, fid, gid, line, n) = EVENT.unpack_from(data, pos);  pos += EVENT.size
+            text = data[pos:pos + n].decode("utf-8", "replace");  pos += n
+            yield { "level": LEVELS.get(lvl, "UNKNOWN"), "count": count,
+                    "time": datetime.datetime.fromtimestamp(ts / 1e9, datetime.timezone.utc).isoformat(timespec="microseconds"),
+                    "thread": f"0x{tid:X}", "file": strings.get(fid), "func": strings.get(gid),
+                    "line": line if fid else None, "text": text }
+        else:
+            raise SystemExit(f"{path}: bad record tag {tag!r} at offset {pos - 1}")
+
+
+def main(argv):
+    if len(argv) < 2:
+        raise SystemExit("usage: decode_cblog.py <file.cblog> [--csv]")
+    rows = records(argv[1])
+
+    if "--csv" in argv[2:]:
+        out = csv.DictWriter(sys.stdout, fieldnames=["time", "level", "count", "thread", "file", "line", "func", "text"])
+        out.writeheader()
+        for r in rows:
+            out.writerow(r)
+        return
+
+    for r in rows:
+        where = f"  ({r['func']} @ {r['file']}:{r['line']})" if r["file"] else ""
+        sys.stdout.write(f"{r['time']}  [CBLOG {r['level']:<9} {r['count']:03}]  thread {r['thread']}  : {r['text']}{where}\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv)
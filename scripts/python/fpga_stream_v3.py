@@ -17,8 +17,14 @@ COMMANDS VIA STDIN:
     window      <clks>          #   coincidence‑window register
     quit                        #   clean exit
 
+
+BINARY FRAMING (--binary):
+-------------------------
+    Every record is one little-endian frame instead of a JSON line:
+        "CBFR"  u16 version  u16 payload-size  |  u32 seq  i64 cycles  i32 counts[16]
+
 """
-import sys, time, json, threading, queue, signal, datetime, argparse, random
+import sys, time, json, struct, threading, queue, signal, datetime, argparse, random
 from typing import List, Tuple
 #
 #   from _FPGA_SAMPLE_DATA import SAMPLE_DATA0 as SAMPLE_PACKETS
@@ -48,6 +54,13 @@ RESOURCE                = r"rio://172.22.11.2/RIO0"
 USE_HARDWARE            = False
 
 
+#   Binary framing (must match "BinaryFrame::ms_MAGIC" and "ccounter::DEF_PACKET_VERSION").
+FRAME_MAGIC             = b"CBFR"
+FRAME_VERSION           = 1
+FRAME_PAYLOAD           = struct.Struct("<Iq16i")
+FRAME_HEADER            = struct.Struct("<4sHH")
+
+
 #  Import NI‑FPGA only if available
 try:
     from nifpga import Session
@@ -188,6 +201,29 @@ def mock_packets():
 
 
 
+#   "emit_record"
+#       Write one record to stdout, as a JSON line or as a binary frame.
+#
+def emit_record(counts, cycles, seq, binary):
+    if binary:
+        payload = FRAME_PAYLOAD.pack(seq & 0xFFFFFFFF, int(cycles), *[int(c) for c in counts])
+        sys.stdout.buffer.write(FRAME_HEADER.pack(FRAME_MAGIC, FRAME_VERSION, len(payload)) + payload)
+        sys.stdout.buffer.flush()
+        return
+
+    record = {
+        "t": datetime.datetime.utcnow().isoformat(timespec="seconds") + "Z",
+        "cycles": cycles,
+        "counts": counts,
+    }
+    print(json.dumps(record), flush=True)
+    return
+
+
+
+
+
+
 ################################################################################
 #
 #
@@ -202,7 +238,10 @@ def main():
     parser = argparse.ArgumentParser()
     parser.add_argument("--mock", action="store_true",
                         help="Force mock‑data mode even if hardware present")
+    parser.add_argument("--binary", action="store_true",
+                        help="Emit fixed-size binary frames instead of JSON lines")
     args = parser.parse_args()
+    seq  = 0
 
     mock_mode = args.mock or not _nifpga_available
     if not mock_mode:
@@ -235,12 +274,8 @@ def main():
                 pass
 
             counts, cycles = next(pkt_iter)
-            record = {
-                "t": datetime.datetime.utcnow().isoformat(timespec="seconds") + "Z",
-                "cycles": cycles,
-                "counts": counts,
-            }
-            print(json.dumps(record), flush=True)
+            emit_record(counts, cycles, seq, args.binary)
+            seq += 1
             time.sleep(integration_window)
 
     else:
@@ -265,13 +300,8 @@ def main():
                 start_measure(session, coincidence_window)
                 time.sleep(integration_window)
                 counts, cycles = finish_measure(session)
-
-                record = {
-                    "t": datetime.datetime.utcnow().isoformat(timespec="seconds") + "Z",
-                    "cycles": cycles,
-                    "counts": counts,
-                }
-                print(json.dumps(record), flush=True)
+                emit_record(counts, cycles, seq, args.binary)
+                seq += 1
 
 
 
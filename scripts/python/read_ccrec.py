@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#   read_ccrec.py  --  print / export a coincidence-counter recording written by  cb::ccounter::Recorder.
+#
+#       usage:  read_ccrec.py  <file.ccrec>  [--csv]
+#
+#   Layout (native byte-order, see "include/app/c_counter/_recorder.h"):
+#       header      char[8] "CCRECORD",  u32 version,  u32 flags,  i64 wall-clock start (ns),  u32 channels,  u32 chunk size
+#       chunk       char[4] "CHNK",  u32 packets,  u32 codec,  u32 payload bytes,  payload
+#       payload     i64 t_ns[n]  |  i32 cycles[n]  |  i32 counts[16][n]         codec 0 = raw,  1 = delta + zig-zag varint
+import sys, struct, csv, datetime, signal
+
+signal.signal(signal.SIGPIPE, signal.SIG_DFL)   # quiet exit when piped into "head"
+
+MAGIC       = b"CCRECORD"
+HEADER      = struct.Struct("<IIqII")
+CHUNK       = struct.Struct("<III")
+CHANNELS    = ["UNUSED", "D", "C", "CD", "B", "BD", "BC", "BCD", "A", "AD", "AC", "ACD", "AB", "ABD", "ABC", "ABCD"]
+
+
+def varints(buf, pos, n):
+    out, prev = [], 0
+    for _ in range(n):
+        u, shift = 0, 0
+        while True:
+            b = buf[pos];  pos += 1
+            u |= (b & 0x7F) << shift;  shift += 7
+            if not b & 0x80:
+                break
+        prev += (u >> 1) ^ -(u & 1)
+        out.append(prev)
+    return out, pos
+
+
+def columns(buf, n, codec):
+    pos, cols = 0, []
+    for fmt in ["q"] + ["i"] * (1 + len(CHANNELS)):
+        if codec == 0:
+            size = struct.calcsize(fmt) * n
+            cols.append(list(struct.unpack_from(f"<{n}{fmt}", buf, pos)));  pos += size
+        elif codec == 1:
+            col, pos = varints(buf, pos, n)
+            cols.append(col)
+        else:
+            raise SystemExit(f"unknown codec {codec}")
+    return cols
+
+
+def records(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != MAGIC:
+        raise SystemExit(f"{path}: not a CCRECORD file")
+    (version, flags, wall_ns, channels, _) = HEADER.unpack_from(data, 8)
+    if version != 1 or channels != len(CHANNELS):
+        raise SystemExit(f"{path}: unsupported version {version} / {channels} channels")
+
+    pos = 8 + HEADER.size
+    while pos + 4 + CHUNK.size <= len(data) and data[pos:pos + 4] == b"CHNK":
+        (n, codec, size) = CHUNK.unpack_from(data, pos + 4);  pos += 4 + CHUNK.size
+        if pos + size > len(data):
+            break                                       # truncated tail (crash mid-write)
+        cols = columns(data[pos:pos + size], n, codec);  pos += size
+        for i in range(n):
+            t = wall_ns + cols[0][i]
+            yield { "time": datetime.datetime.fromtimestamp(t / 1e9, datetime.timezone.utc).isoformat(timespec="microseconds"),
+                    "t_s": cols[0][i] / 1e9, "cycles": cols[1][i],
+                    **{ name: cols[2 + c][i] for c, name in enumerate(CHANNELS) if name != "UNUSED" } }
+
+
+def main(argv):
+    if len(argv) < 2:
+        raise SystemExit("usage: read_ccrec.py <file.ccrec> [--csv]")
+    rows = records(argv[1])
+
+    if "--csv" in argv[2:]:
+        out = csv.DictWriter(sys.stdout, fieldnames=["time", "t_s", "cycles"] + CHANNELS[1:])
+        out.writeheader()
+        for r in rows:
+            out.writerow(r)
+        return
+
+    for r in rows:
+        counts = "  ".join(f"{name}={r[name]}" for name in CHANNELS[1:])
+        sys.stdout.write(f"{r['time']}  (+{r['t_s']:.6f} s)  cycles={r['cycles']}  {counts}\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -98,6 +98,7 @@ void App::run(void)
             glfwMakeContextCurrent(backup);
         }
         glfwSwapBuffers(this->S.m_glfw_window);
+        utl::LatencyTracer::instance().frame_presented();      //  Resolve this frame's "glass" samples  (see "_latency.h").
         
         
         
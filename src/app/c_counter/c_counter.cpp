@@ -244,7 +244,10 @@ inline void CCounterApp::_MECH_per_frame_cache(void) noexcept
     const float grace                = std::max(0.10f, 0.25f * min_period);// floor + fractional
     static float s_crawl_until       = 0.0f;                               // TODO: make a member if preferred
 
-    if (this->m_process_running && this->m_counter_running && this->m_smooth_scroll) {
+    //    A replay feeds the plots like a live run, on its own clock ("PF.clock").
+    const bool feeding               = this->m_process_running || this->m_replay.active();
+
+    if (feeding && this->m_counter_running && this->m_smooth_scroll) {
         if (got_packet) {
             // Extend the crawl window into the future
             s_crawl_until          = this->m_last_packet_time + k_slack * min_period + grace;
@@ -253,14 +256,14 @@ inline void CCounterApp::_MECH_per_frame_cache(void) noexcept
         // it will be set on the first arrival.
     } else {
         // Not in a state to crawl → stop immediately
-        s_crawl_until              = PF.now;
+        s_crawl_until              = PF.clock;
     }
 
     // 4) Final crawl gate (persist between packets until the deadline passes)
     const bool crawling             = ( this->m_smooth_scroll
                                      && this->m_counter_running
-                                     && this->m_process_running
-                                     && (PF.now <= s_crawl_until) );
+                                     && feeding
+                                     && (PF.clock <= s_crawl_until) );
 
     // Expose for plot logic (axis limits / AutoFit gating)
     PF.crawling                     = crawling;
@@ -268,18 +271,18 @@ inline void CCounterApp::_MECH_per_frame_cache(void) noexcept
     // 5) Latch freeze reference exactly when crawl turns off
     static bool s_was_crawling      = false;
     if (!crawling && s_was_crawling) {
-        this->m_freeze_now          = PF.now;
+        this->m_freeze_now          = PF.clock;
     }
     s_was_crawling                  = crawling;
 
     // 6) Spark timing
     PF.spark_now                    = (!this->m_counter_running)          ? this->m_freeze_now
                                     : ( this->m_smooth_scroll
-                                            ? (crawling ? PF.now : this->m_freeze_now)
+                                            ? (crawling ? PF.clock : this->m_freeze_now)
                                             :  this->m_last_packet_time );
 
     // 7) “Streaming active” for UI: true while we’re within the crawl window
-    this->m_streaming_active        = (PF.now <= s_crawl_until);
+    this->m_streaming_active        = (PF.clock <= s_crawl_until);
 
     // 8) Colormap cache
     if (this->m_colormap_cache_invalid) {
@@ -544,6 +547,7 @@ inline void CCounterApp::_FetchData(void) noexcept
     PerFrame &              PF                  = this->m_perframe;
     //
     PF.got_packet                 = false;
+    PF.clock                      = PF.now;
     PF.xmin                       = 0.0f;
     PF.xmax                       = m_history_length.value;
     //  float                   xmin                = 0.0f,
@@ -551,46 +555,61 @@ inline void CCounterApp::_FetchData(void) noexcept
                                     
           
     //      1.      POLL THE CHILD-PROCESS.  PUSH NEW DATA-POINTS...
+    //              Each packet is timed from its read stamp:  queue wait, decode + ingest, and (deferred) the frame that shows it.
+    Ingestor::channel_map   channels            {   };
+    for (size_t i = 0ULL; i < ms_NUM; ++i)
+    {
+        channels[i]                 = static_cast<ChIndex>( ms_channels[i].idx );
+        this->m_stats[i]            .set_window( m_avg_mode, m_avg_window_samp.Value(), m_avg_window_sec.Value() );
+    }
+    Ingestor                core                (
+          { this->m_buffers, this->m_avg_counts, this->m_stats, this->m_history, this->m_avg_history, &this->m_max_counts }
+        , channels
+        , { &this->m_recorder, this->m_lat_queue, this->m_lat_ingest, this->m_lat_glass }
+    );
+    auto                    ingest              = [&core, &PF](const Packet & packet, const std::int64_t read_ns, const std::int64_t recv_ns)
+        { core.received(packet, PF.now, read_ns, recv_ns); };
+    //
+    //              1A.     PYTHON SCRIPT  [ binary frames, else JSON lines;  see "drain_stream" ].
+    size_t                  taken               = cc::drain_stream( this->m_python, std::span(this->m_frames), std::span(this->m_lines), m_use_mutex_count, ingest );
     //
-    while ( this->m_python.try_receive( PF.raw ) )
+    //              1B.     SYNTHETIC SOURCE  [ load test;  same rings, same decode ].
+    taken                                      += cc::drain_stream( this->m_synth,  std::span(this->m_frames), std::span(this->m_lines), m_use_mutex_count, ingest );
+    PF.got_packet                               = (taken > 0ULL);
+    this->m_num_packets                        += taken;
+    //
+    //              1C.     REPLAY  [ a recording, through the same ingest path;  paced by "m_replay_speed" ].
+    //                      Plotted at its recorded times, rebased to the replay start (so the spacing inside a frame survives);
+    //                      the view follows the replay clock, which runs ahead of "PF.now" in "Max".
+    if ( this->m_replay.active() )
     {
-        PF.got_packet = true;
-        ++this->m_num_packets;
+        const size_t    n       = this->m_replay.drain( cc::steady_ns(), [this, &core](const Packet & packet, const std::int64_t t_ns)
+            { core.push( packet, this->m_replay_x0 + 1e-9f * static_cast<float>(t_ns) ); } );
+        PF.clock                = this->m_replay_x0 + 1e-9f * static_cast<float>( this->m_replay.clock_ns() );
+        PF.got_packet          |= (n > 0ULL);
+        this->m_num_packets    += n;
+        taken                  += n;
         
-        //  if ( auto packet = cc::parse_packet(raw, m_use_mutex_count) )
-        if ( auto packet_ptr = cc::parse_packet(PF.raw, m_use_mutex_count) )
-        {
-            //  const auto &    counts      = packet->counts;
-            const Packet &  packet  = *packet_ptr;
-            
-            for (size_t i = 0ULL; i < ms_NUM; ++i)
-            {
-                //  const size_t        ch_idx          = ms_channels[i].idx;
-                const ChIndex       ch_idx          = static_cast<ChIndex>( ms_channels[i].idx );
-                const float         current         = static_cast<float>( packet[ch_idx] );
-                const float         avg             = this->ComputeAverage(
-                      m_buffers[i]
-                    , m_avg_mode
-                    , m_avg_window_samp.Value()
-                    , m_avg_window_sec.Value()
-                    , PF.spark_now    //    spark_now
-                );
-                    
-                
-                m_buffers[i]        .push_back({ PF.now, current });               //  1.  PUSH-BACK MOST RECENT FPGA DATA PACKET.
-                m_max_counts[i]     = std::max(m_max_counts[i], current);       //  2.  COMPUTE CURRENT MAX VALUE FOR THIS COUNTER.
-                m_avg_counts[i]     .push_back({ PF.now, avg });                   //  3.
-            }
+        if ( !this->m_replay.active() ) {
+            const auto &    st      = this->m_replay.stats();
+            this->S.m_logger.info( std::format(
+                  "[[CCounter]] replay finished:  {} packets in {:.2f} s  ({:.0f} packets/s, {:.0f} ns/packet ingest, {} frames)"
+                , st.packets, 1e-9 * static_cast<double>(st.wall_ns), st.rate(), st.ns_per_packet(), st.frames
+            ));
         }
     }
     //
+    //              1D.     KEEP EVERY SERIES CONTIGUOUS, SO THE PLOTS CAN HAND IMPLOT A SINGLE POINTER.
+    if ( core.commit(taken) )
+        { ++this->m_data_version; }                 //  Invalidates the plots' decimation caches.
+    //
     //  if (got_packet)     { this->m_last_packet_time = now; }
-    if (PF.got_packet)        { this->m_last_packet_time = PF.now; }
+    if (PF.got_packet)        { this->m_last_packet_time = PF.clock; }
 
 
     //      streaming considered active if we’ve received data within timeout
     //  m_streaming_active  = (now - m_last_packet_time) < m_stream_timeout;
-    m_streaming_active  = (PF.now - m_last_packet_time) < m_stream_timeout;
+    m_streaming_active  = (PF.clock - m_last_packet_time) < m_stream_timeout;
 
 
 
@@ -605,8 +624,8 @@ inline void CCounterApp::_FetchData(void) noexcept
     }
     else if (this->m_smooth_scroll)
     {
-        if ( this->m_process_running  &&  this->m_streaming_active ) {
-            PF.xmin             = PF.now - this->ms_CENTER * this->m_history_length.Value();
+        if ( (this->m_process_running || this->m_replay.active())  &&  this->m_streaming_active ) {
+            PF.xmin             = PF.clock - this->ms_CENTER * this->m_history_length.Value();
             PF.xmax             = PF.xmin + this->m_history_length.Value();
             m_freeze_xmin       = PF.xmin;                 // keep cache fresh while crawling
             m_freeze_xmax       = PF.xmax;
@@ -652,46 +671,7 @@ inline void CCounterApp::_FetchData(void) noexcept
 }
 
 
-//  "ComputeAverage"
-//      Helper to compute localized average
-//
-inline float CCounterApp::ComputeAverage(const buffer_type &buf, AvgMode mode, ImU64 N_samples, double seconds, float now) const
-{
-    const std::size_t   size        = buf.size();
-    float               sum         = 0.0f;
-    std::size_t         count       = 0;
-    
-    
-    
-    if (size == 0)      { return 0.0f; }
-
-
 
-    //      CASE 1 :    COUNT-BASED AVERAGE...
-    if (mode == AvgMode::Samples)
-    {
-        const ImU64         N       = std::min<ImU64>(N_samples, size);
-        const std::size_t   start   = size - static_cast<std::size_t>(N);
-        for (std::size_t i = start; i < size; ++i)
-        {
-            sum += buf[i].y;
-            ++count;
-        }
-    }
-    //
-    //      CASE 2 :    TIME-BASED AVERAGE...
-    else
-    {
-        for (std::size_t i = size; i-- > 0; )
-        {
-            const float     dt      = now - buf[i].x;
-            if (dt > seconds)       { break; }
-            sum += buf[i].y;
-            ++count;
-        }
-    }
-    return (count)    ? sum / static_cast<float>(count)     : 0.0f;
-}
 
 
 
@@ -513,7 +513,8 @@ void CCounterApp::init_ctrl_rows(void)
                     if (m_process_running) {
                         char cmd[ms_CMD_MSG_SIZE];
                         std::snprintf(cmd, ms_CMD_MSG_SIZE, "integration_window %.3f\n", m_integration_window.value);
-                        m_python.send(cmd);
+                        if (m_synthetic_source)     { m_synth.send(cmd);    }
+                        else                        { m_python.send(cmd);   }
                     }
                 }
                 ImGui::SameLine(0.0f, pad);
@@ -530,14 +531,12 @@ void CCounterApp::init_ctrl_rows(void)
             {// BEGIN.
                 ImGui::SetNextItemWidth( margin * ImGui::GetColumnWidth() );
                 ImGui::SliderScalar("##HistoryLength",                  ImGuiDataType_Double,           &m_history_length.value,
-                                    &m_history_length.limits.min,       &m_history_length.limits.max,   "%.1f seconds", SLIDER_FLAGS);
+                                    &m_history_length.limits.min,       &m_history_length.limits.max,   "%.1f seconds", SLIDER_FLAGS | ImGuiSliderFlags_Logarithmic);
                 ImGui::SameLine(0.0f, pad);
                 
                 if ( ImGui::Button("Clear Plot", ImVec2(ImGui::GetContentRegionAvail().x - pad, 0)) ) {
-                    for (auto & b : m_buffers) {
-                        b.clear(); //b.Erase();
-                    }
-                    std::fill(std::begin(m_max_counts), std::end(m_max_counts), 0.f);
+                    this->_clear_plot_data();
+                    for (auto & s : m_stats)    { s.clear(); }
                 }
                 ImGui::Dummy( ImVec2(pad, 0.0f) );
             }// END.
@@ -575,6 +574,95 @@ void CCounterApp::init_ctrl_rows(void)
             }// END.
         },
     //
+    //
+        {"Replay",                              [this]
+            {// BEGIN.
+                using               Speed           = cc::ReplaySource::Speed;
+                const bool          active          = this->m_replay.active();
+                int                 speed_idx       = static_cast<int>( this->m_replay_speed );
+                const float         width           = ImGui::GetColumnWidth();
+            //
+            //
+                //  1.  RECORDING FILE, SPEED...
+                ImGui::BeginDisabled( active  ||  this->m_process_running );
+                    ImGui::SetNextItemWidth( 0.45f * width );
+                    ImGui::InputTextWithHint("##ReplayPath", "recording.ccrec", m_replay_path, ms_CMD_MSG_SIZE);
+                    ImGui::SameLine(0.0f, pad);
+                    ImGui::SetNextItemWidth( 0.12f * width );
+                    if ( ImGui::Combo("##ReplaySpeed", &speed_idx, cc::ReplaySource::ms_SPEED_NAMES.data(), static_cast<int>(Speed::COUNT)) )
+                        { this->m_replay_speed = static_cast<Speed>(speed_idx); }
+                    if ( this->m_replay_speed == Speed::Scaled ) {
+                        ImGui::SameLine(0.0f, pad);
+                        ImGui::SetNextItemWidth( 0.15f * width );
+                        ImGui::SliderScalar("##ReplayFactor",               ImGuiDataType_Double,           &m_replay_factor.value,
+                                            &m_replay_factor.limits.min,    &m_replay_factor.limits.max,    "%.0fx", SLIDER_FLAGS | ImGuiSliderFlags_Logarithmic);
+                    }
+                    ImGui::SameLine(0.0f, pad);
+                ImGui::EndDisabled();
+                //
+                //
+                //  2.  START / STOP...
+                ImGui::BeginDisabled( this->m_process_running );
+                    if ( ImGui::Button( (active) ? "Stop Replay" : "Replay", ImVec2(ImGui::GetContentRegionAvail().x - pad, 0) ) ) {
+                        if ( active )   { this->m_replay.stop(); }
+                        else            { this->_start_replay(); }
+                    }
+                ImGui::EndDisabled();
+                ImGui::Dummy( ImVec2(pad, 0.0f) );
+                //
+                //
+                //  3.  THROUGHPUT  ("Max" measures the whole ingest -> statistics -> plot pipeline)...
+                if ( this->m_replay.is_open() ) {
+                    const auto &    st      = this->m_replay.stats();
+                    ImGui::TextDisabled( "%zu / %zu packets  |  %.0f packets/s  |  %.0f ns/packet ingest  |  %.2f ms/frame"
+                                       , st.packets, st.total, st.rate(), st.ns_per_packet()
+                                       , (st.frames > 0ULL)   ? 1e-6 * static_cast<double>(st.wall_ns) / static_cast<double>(st.frames)   : 0.0 );
+                }
+            }// END.
+        },
+    //
+    //
+        {"Load Test",                           [this]
+            {// BEGIN.
+                using               Pattern         = cc::SyntheticStream::Pattern;
+                const float         width           = ImGui::GetColumnWidth();
+                double              rate            = this->m_synth.get_rate();
+                int                 pattern_idx     = static_cast<int>( this->m_synth.get_pattern() );
+                static double       s_min_rate      = cc::SyntheticStream::ms_MIN_RATE;
+                static double       s_max_rate      = cc::SyntheticStream::ms_MAX_RATE;
+            //
+            //
+                //  1.  SOURCE  [ fixed for the life of the process, like the framing ]...
+                ImGui::BeginDisabled( this->m_process_running );
+                    ImGui::Checkbox("Synthetic Source", &m_synthetic_source);
+                ImGui::EndDisabled();
+                if ( ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled) )
+                    { ImGui::SetTooltip( "Generate packets in-process instead of running the Python script (takes effect on the next start)." ); }
+                //
+                //
+                //  2.  RATE, PATTERN  [ live ]...
+                ImGui::SameLine(0.0f, pad);
+                ImGui::SetNextItemWidth( 0.35f * width );
+                if ( ImGui::SliderScalar("##SyntheticRate",     ImGuiDataType_Double,       &rate,
+                                         &s_min_rate,           &s_max_rate,                "%.0f packets/s", SLIDER_FLAGS | ImGuiSliderFlags_Logarithmic) )
+                    { this->m_synth.set_rate(rate); }
+                ImGui::SameLine(0.0f, pad);
+                ImGui::SetNextItemWidth( ImGui::GetContentRegionAvail().x - pad );
+                if ( ImGui::Combo("##SyntheticPattern", &pattern_idx, cc::SyntheticStream::ms_PATTERN_NAMES.data(), static_cast<int>(Pattern::COUNT)) )
+                    { this->m_synth.set_pattern( static_cast<Pattern>(pattern_idx) ); }
+                ImGui::Dummy( ImVec2(pad, 0.0f) );
+                //
+                //
+                //  3.  BACK-PRESSURE...
+                if ( this->m_synth.is_running() ) {
+                    ImGui::TextDisabled( "%zu generated  |  queue: %zu / %zu  (peak %zu)  |  dropped: %zu"
+                                       , this->m_synth.get_generated()
+                                       , this->m_synth.get_queue_depth(), this->m_synth.get_queue_capacity(), this->m_synth.get_queue_high_water()
+                                       , this->m_synth.get_dropped_frames() + this->m_synth.get_dropped_lines() );
+                }
+            }// END.
+        },
+    //
     //
         {"Misc.",                          [this]
             {// BEGIN.
@@ -591,6 +679,18 @@ void CCounterApp::init_ctrl_rows(void)
                 ImGui::SameLine();
                 ImGui::Checkbox("Plot Crawling", &m_smooth_scroll);
                 
+                ImGui::SameLine();
+                ImGui::BeginDisabled(this->m_process_running);          //  framing is fixed for the life of the process.
+                    ImGui::Checkbox("Binary Stream", &m_binary_stream);
+                ImGui::EndDisabled();
+                if ( ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled) ) {
+                    ImGui::SetTooltip( "%s  |  queue: %zu / %zu  (peak %zu)  |  dropped: %zu  |  bad bytes: %zu"
+                                     , utl::PyStream::ms_FRAMING_NAMES[ this->m_python.get_framing() ]
+                                     , this->m_python.get_queue_depth(), this->m_python.get_queue_capacity(), this->m_python.get_queue_high_water()
+                                     , (this->m_binary_stream) ? this->m_python.get_dropped_frames() : this->m_python.get_dropped_lines()
+                                     , this->m_python.get_bad_frames() );
+                }
+                
                 
             }// END.
         }
@@ -137,14 +137,11 @@ void CCounterApp::TAB_NewControls(void) noexcept
             {// BEGIN.
                 ImGui::SetNextItemWidth( margin * ImGui::GetColumnWidth() );
                 ImGui::SliderScalar("##HistoryLength",                  ImGuiDataType_Double,           &m_history_length.value,
-                                    &m_history_length.limits.min,       &m_history_length.limits.max,   "%.1f seconds", SLIDER_FLAGS);
+                                    &m_history_length.limits.min,       &m_history_length.limits.max,   "%.1f seconds", SLIDER_FLAGS | ImGuiSliderFlags_Logarithmic);
                 ImGui::SameLine(0.0f, pad);
                 
                 if ( ImGui::Button("Clear Plot", ImVec2(ImGui::GetContentRegionAvail().x - pad, 0)) ) {
-                    for (auto & b : m_buffers) {
-                        b.clear(); //b.Erase();
-                    }
-                    std::fill(std::begin(m_max_counts), std::end(m_max_counts), 0.f);
+                    this->_clear_plot_data();
                 }
                 ImGui::Dummy( ImVec2(pad, 0.0f) );
             }// END.
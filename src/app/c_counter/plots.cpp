@@ -29,6 +29,34 @@ namespace cb { //     BEGINNING NAMESPACE "cb"...
 
 
 
+namespace { //     BEGINNING ANONYMOUS NAMESPACE...
+
+//  "plot_decimated"
+//      Draw the part of "buf" inside [xmin, xmax] through "m4":  at most ~4 points per pixel column of the current
+//      plot (first / min / max / last), re-used as-is while neither the view nor the data changed.  Must be called
+//      between "BeginPlot" and "EndPlot" (the pixel width comes from the plot area).
+//
+template<typename RB>
+inline void plot_decimated( const char * label, const RB & buf, ccounter::M4Decimator<ImVec2> & m4, const float xmin, const float xmax
+                          , const std::uint64_t version, const std::uint64_t generation, const ImPlotLineFlags flags ) noexcept
+{
+    constexpr int                   stride      = static_cast<int>( sizeof(ImVec2) );
+    static constexpr ImVec2         none        = { 0.0f, 0.0f };
+    const int                       px          = static_cast<int>( ImPlot::GetPlotSize().x );
+    const std::span<const ImVec2>   pts         = m4.update(buf, xmin, xmax, px, version, generation);
+    const ImVec2 *                  first       = ( pts.empty() )   ? &none     : pts.data();
+    
+    ImPlot::PlotLine( label, &first->x, &first->y, static_cast<int>( pts.size() ), flags, 0, stride );
+    return;
+}
+
+} //   END OF ANONYMOUS NAMESPACE.
+
+
+
+
+
+
 // *************************************************************************** //
 //
 //
@@ -77,9 +105,12 @@ void CCounterApp::_PlotMaster(void) const noexcept
     
         for (int k = 0; k < static_cast<int>(ms_NUM); ++k)
         {
-            const auto &        buf         = m_buffers[k];
-            const auto &        avg         = m_avg_counts[k];
+            const auto [buf_p, buf_gen]     = this->_plot_source( m_buffers[k]      , m_history[k]      , PF.xmin );
+            const auto [avg_p, avg_gen]     = this->_plot_source( m_avg_counts[k]   , m_avg_history[k]  , PF.xmin );
+            const auto &        buf         = *buf_p;
+            const auto &        avg         = *avg_p;
             auto &              channel     = ms_channels[k];
+            const auto          version     = this->m_data_version;
             //
             const float         avg_lw      = this->m_avg_linewidth.Value();
             const float         plot_lw     = this->m_plot_linewidth.Value();
@@ -95,15 +126,7 @@ void CCounterApp::_PlotMaster(void) const noexcept
             //
                 if ( !channel.vis.average )     { ImPlot::HideNextItem( true    , ImGuiCond_Always );   }
                 else                            { ImPlot::HideNextItem( false   , ImGuiCond_Always );   }
-                ImPlot::PlotLine(
-                      ""
-                    , &avg.raw()[0].x
-                    , &avg.raw()[0].y
-                    , static_cast<int>( avg.size() )
-                    , ImPlotLineFlags_Shaded
-                    , static_cast<int>( avg.offset() )
-                    , sizeof(ImVec2)
-                );
+                plot_decimated( "", avg, this->m_m4_average[k], PF.xmin, PF.xmax, version, avg_gen, ImPlotLineFlags_Shaded );
             //
             ImPlot::PopStyleVar();
             
@@ -116,15 +139,7 @@ void CCounterApp::_PlotMaster(void) const noexcept
             //
                 if (!channel.vis.master)        { ImPlot::HideNextItem( true    , ImGuiCond_Always ); }
                 else                            { ImPlot::HideNextItem( false   , ImGuiCond_Always ); }
-                ImPlot::PlotLine(
-                      ms_channels[k].name
-                    , &buf.raw()[0].x
-                    , &buf.raw()[0].y
-                    , static_cast<int>( buf.size() )
-                    , ImPlotLineFlags_Shaded
-                    , static_cast<int>( buf.offset() )
-                    , sizeof(ImVec2)
-                );
+                plot_decimated( ms_channels[k].name, buf, this->m_m4_master[k], PF.xmin, PF.xmax, version, buf_gen, ImPlotLineFlags_Shaded );
             //
             ImPlot::PopStyleVar();
         //
@@ -197,6 +212,11 @@ void CCounterApp::_PlotSingles(void) const noexcept
             //      4.      COLUMN 4.       AVERAGE VALUE...
             ImGui::TableSetColumnIndex(3);
             ImGui::Text("%.2f", (is_empty)  ? 0.0f  : m_avg_counts[row].top().y );
+            if ( ImGui::IsItemHovered() ) {
+                const RunningStats &    stats   = m_stats[row];
+                ImGui::SetTooltip("Window:  %zu samples\nMean:    %.2f\nStd.:    %.2f\nMin:     %.0f\nMax:     %.0f",
+                                  stats.count(), stats.mean(), stats.stddev(), stats.min(), stats.max());
+            }
 
 
             //      5.      COLUMN 5.       CURRENT VALUE...
@@ -212,12 +232,16 @@ void CCounterApp::_PlotSingles(void) const noexcept
                 ImGui::PushID( static_cast<int>(row) );
                 if ( !is_empty  &&  channel.vis.single )
                 {
+                    const float     window          = this->m_history_length.Value();
+                    const auto [src, generation]    = this->_plot_source( buf, m_history[row], PF.spark_now - this->ms_CENTER * window );
                     this->plot_sparkline(
-                          buf
+                          *src
+                        , this->m_m4_single[row]
+                        , generation
                         , this->m_plot_colors[row]
                         , ImVec2(-1, cc::row_height_px)
                         , PF.spark_now
-                        , this->m_history_length.Value()
+                        , window
                         , this->ms_CENTER
                         , CS.m_ind_pline_flags
                     );
@@ -273,6 +297,8 @@ void CCounterApp::_PlotSingles(void) const noexcept
 template<typename RB>
 inline void CCounterApp::plot_sparkline(
       const RB &                data
+    , Decimator &               m4
+    , const std::uint64_t       generation
     , const ImVec4 &            color
     , const ImVec2              size
     , const float               time
@@ -303,16 +329,8 @@ inline void CCounterApp::plot_sparkline(
             ImPlot::SetNextLineStyle    (color);
             ImPlot::SetNextFillStyle    (color, fill_alpha);
 
-            //      IMPORTANT:      base pointer + offset + stride (no &data.front())
-            ImPlot::PlotLine(
-                  "##data"
-                , &data.raw()[0].x
-                , &data.raw()[0].y
-                , static_cast<int>( data.size() )
-                , ImPlotLineFlags_Shaded
-                , static_cast<int>( data.offset() )
-                , static_cast<int>( sizeof(ImVec2) )
-            );
+            //      IMPORTANT:      only the visible window  (Y auto-fit then follows what is on screen).
+            plot_decimated( "##data", data, m4, xmin, xmax, this->m_data_version, generation, ImPlotLineFlags_Shaded );
         }
 
         ImPlot::EndPlot();
@@ -327,6 +345,24 @@ inline void CCounterApp::plot_sparkline(
 }
 
 
+//  "_plot_source"
+//      Series to draw for a view starting at "xmin":  the raw ring while it still reaches back that far, else the
+//      finest tier of "hist" that does.  The tier is folded into the decimator generation so switching source
+//      re-scans instead of mixing columns from two series;  so is the tier's own generation, which moves whenever
+//      a bucket closes and shifts its point back to the bucket centre.
+//
+inline std::pair<const CCounterApp::buffer_type *, std::uint64_t>
+CCounterApp::_plot_source(const buffer_type & raw, const TieredHistory & hist, const float xmin) const noexcept
+{
+    const size_t            tier            = hist.select(raw, xmin);
+    std::uint64_t           generation      = (this->m_data_generation << 2ULL) | static_cast<std::uint64_t>(tier);
+    
+    if ( tier == TieredHistory::ms_RAW )    { return { &raw, generation }; }
+    generation                             ^= hist.generation(tier) << 32ULL;
+    return { &hist.series(tier), generation };
+}
+
+
 
 
 //
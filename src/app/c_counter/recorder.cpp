@@ -0,0 +1,425 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****           R E C O R D E R . C P P  ____  F I L E           ****
+*       ********************************************************************
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+**************************************************************************************
+**************************************************************************************/
+#include "app/c_counter/_recorder.h"
+#include "utility/_task_scheduler.h"
+
+#include <cstring>
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+//  0.      STATIC HELPER FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "put_pod" / "get_pod"
+//      Raw native-order field.
+template< typename T >
+static void put_pod(std::ofstream & os, const T & v) { os.write(reinterpret_cast<const char *>(&v), sizeof(T)); }
+template< typename T >
+static bool get_pod(std::ifstream & is, T & v) { return static_cast<bool>( is.read(reinterpret_cast<char *>(&v), sizeof(T)) ); }
+
+
+//  "put_varint" / "get_varint"
+//      Zig-zag, then LEB128 (7 bits per byte, high bit = more).
+static void put_varint(std::vector<std::byte> & out, const std::int64_t v)
+{
+    std::uint64_t   u   = ( static_cast<std::uint64_t>(v) << 1 ) ^ static_cast<std::uint64_t>(v >> 63);
+    while ( u >= 0x80ULL ) {
+        out.push_back( static_cast<std::byte>( (u & 0x7FULL) | 0x80ULL ) );
+        u >>= 7;
+    }
+    out.push_back( static_cast<std::byte>(u) );
+}
+static bool get_varint(std::span<const std::byte> in, std::size_t & pos, std::int64_t & v)
+{
+    std::uint64_t   u       = 0ULL;
+    for (unsigned shift = 0U; shift < 64U; shift += 7U)
+    {
+        if ( pos >= in.size() )     { return false; }
+        const auto      b       = std::to_integer<std::uint64_t>( in[pos++] );
+        u                      |= (b & 0x7FULL) << shift;
+        if ( !(b & 0x80ULL) ) {
+            v                   = static_cast<std::int64_t>( (u >> 1) ^ (~(u & 1ULL) + 1ULL) );
+            return true;
+        }
+    }
+    return false;
+}
+
+
+//  "put_column" / "get_column"
+template< typename T >
+static void put_column(std::vector<std::byte> & out, const std::vector<T> & col, const RecordCodec codec)
+{
+    if ( codec == RecordCodec::Raw ) {
+        const auto *    p   = reinterpret_cast<const std::byte *>( col.data() );
+        out.insert(out.end(), p, p + col.size() * sizeof(T));
+        return;
+    }
+    std::int64_t    prev    = 0;
+    for (const T v : col) {
+        put_varint( out, static_cast<std::int64_t>(v) - prev );
+        prev                = static_cast<std::int64_t>(v);
+    }
+}
+template< typename T >
+static bool get_column(std::span<const std::byte> in, std::size_t & pos, std::vector<T> & col, const RecordCodec codec)
+{
+    if ( codec == RecordCodec::Raw ) {
+        const std::size_t   bytes   = col.size() * sizeof(T);
+        if ( in.size() - pos < bytes )      { return false; }
+        std::memcpy( col.data(), in.data() + pos, bytes );
+        pos                        += bytes;
+        return true;
+    }
+    std::int64_t    prev    = 0;
+    for (T & v : col) {
+        std::int64_t    d   = 0;
+        if ( !get_varint(in, pos, d) )      { return false; }
+        prev               += d;
+        v                   = static_cast<T>(prev);
+    }
+    return true;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//  1.      FILE FORMAT...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "encode_block"
+//
+void encode_block(const RecordBlock & block, const RecordCodec codec, std::vector<std::byte> & out)
+{
+    out.clear();
+    put_column(out, block.t_ns,     codec);
+    put_column(out, block.cycles,   codec);
+    for (const auto & col : block.counts)   { put_column(out, col, codec); }
+    return;
+}
+
+
+//  "decode_block"
+//
+bool decode_block(std::span<const std::byte> in, const std::size_t n, const RecordCodec codec, RecordBlock & block)
+{
+    std::size_t     pos     = 0ULL;
+
+    if ( codec != RecordCodec::Raw  &&  codec != RecordCodec::Delta )   { return false; }
+
+    //      Every packet costs at least one byte per column (a varint), or its full width when raw:  reject an "n" the
+    //      payload cannot hold BEFORE sizing the block to it.
+    constexpr std::size_t   columns     = 2ULL + RecordBlock::ms_CHANNELS;
+    constexpr std::size_t   raw_width   = sizeof(std::int64_t) + sizeof(std::int32_t) * (1ULL + RecordBlock::ms_CHANNELS);
+    const std::size_t       min_bytes   = ( codec == RecordCodec::Raw )     ? raw_width     : columns;
+    if ( n > in.size() / min_bytes )    { return false; }
+
+    block.resize(n);
+    if ( !get_column(in, pos, block.t_ns,   codec) )        { return false; }
+    if ( !get_column(in, pos, block.cycles, codec) )        { return false; }
+    for (auto & col : block.counts)
+        { if ( !get_column(in, pos, col, codec) )   { return false; } }
+
+    return ( pos == in.size() );
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//  2.      "Recorder"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "open"
+//
+bool Recorder::open(const std::filesystem::path & path, const RecordCodec codec, const std::uint32_t flags)
+{
+    using namespace std::chrono;
+    this->close();
+
+    this->m_file.open(path, std::ios::binary | std::ios::trunc);
+    if ( !this->m_file )    { return false; }
+
+    const std::int64_t      wall_ns     = duration_cast<nanoseconds>( system_clock::now().time_since_epoch() ).count();
+    this->m_file.write( REC_MAGIC, sizeof(REC_MAGIC) );
+    put_pod( this->m_file, REC_VERSION );
+    put_pod( this->m_file, flags );
+    put_pod( this->m_file, wall_ns );
+    put_pod( this->m_file, static_cast<std::uint32_t>(RecordBlock::ms_CHANNELS) );
+    put_pod( this->m_file, static_cast<std::uint32_t>(ms_BLOCK_PACKETS) );
+
+    this->m_path            = path;
+    this->m_codec           = codec;
+    this->m_t0              = steady_ns();
+    this->m_packets         = 0ULL;
+    this->m_stalls          = 0ULL;
+    this->m_chunks          .store(0ULL,    std::memory_order_relaxed);
+    this->m_raw_bytes       .store(0ULL,    std::memory_order_relaxed);
+    this->m_file_bytes      .store(static_cast<std::size_t>( this->m_file.tellp() ), std::memory_order_relaxed);
+    this->m_failed          .store(!this->m_file, std::memory_order_relaxed);
+    this->m_front.clear();      this->m_front.reserve(ms_BLOCK_PACKETS);
+    this->m_back .clear();      this->m_back .reserve(ms_BLOCK_PACKETS);
+    this->m_open            = true;
+    return true;
+}
+
+
+//  "flush"
+//      Hand the front block to the writer (waiting for the previous write first).
+//
+void Recorder::flush(void)
+{
+    if ( !this->m_open  ||  this->m_front.empty() )     { return; }
+
+    if ( this->m_busy.load(std::memory_order_acquire) )     { ++this->m_stalls;  this->wait_idle(); }
+
+    std::swap(this->m_front, this->m_back);
+    this->m_front.clear();
+    this->m_busy.store(true, std::memory_order_release);
+    utl::TaskScheduler::instance().submit( [this]{ this->write_back(); }, utl::TaskPriority::Normal );
+    return;
+}
+
+
+//  "close"
+//
+void Recorder::close(void)
+{
+    if ( !this->m_open )    { return; }
+
+    this->flush();
+    this->wait_idle();
+    this->m_file.close();
+    this->m_open            = false;
+    return;
+}
+
+
+//  "stats"
+//
+Recorder::Stats Recorder::stats(void) const noexcept
+{
+    return Stats{
+          this->m_packets
+        , this->m_chunks        .load(std::memory_order_relaxed)
+        , this->m_raw_bytes     .load(std::memory_order_relaxed)
+        , this->m_file_bytes    .load(std::memory_order_relaxed)
+        , this->m_stalls
+        , this->m_failed        .load(std::memory_order_relaxed)
+    };
+}
+
+
+//  "wait_idle"
+//
+void Recorder::wait_idle(void) noexcept
+{
+    while ( this->m_busy.load(std::memory_order_acquire) )
+        { this->m_busy.wait(true, std::memory_order_acquire); }
+    return;
+}
+
+
+//  "write_back"
+//      Writer side (runs on the scheduler):  encode and append "m_back" as one chunk.
+//
+void Recorder::write_back(void)
+{
+    struct Idle {                       //  Cleared on every path out, or "wait_idle" (and "close") would spin forever.
+        Recorder &          r;
+        bool                written     = false;
+        ~Idle(void) {
+            if ( !written )     { r.m_failed.store(true, std::memory_order_relaxed); }
+            r.m_busy.store(false, std::memory_order_release);
+            r.m_busy.notify_all();
+        }
+    }                       idle        { *this };
+
+    const RecordBlock &     block       = this->m_back;
+    const std::size_t       n           = block.size();
+    const std::size_t       raw         = n * ( sizeof(std::int64_t) + sizeof(std::int32_t) * (1ULL + RecordBlock::ms_CHANNELS) );
+
+    encode_block( block, this->m_codec, this->m_scratch );
+
+    this->m_file.write( REC_CHUNK, sizeof(REC_CHUNK) );
+    put_pod( this->m_file, static_cast<std::uint32_t>(n) );
+    put_pod( this->m_file, static_cast<std::uint32_t>(this->m_codec) );
+    put_pod( this->m_file, static_cast<std::uint32_t>(this->m_scratch.size()) );
+    this->m_file.write( reinterpret_cast<const char *>(this->m_scratch.data()), static_cast<std::streamsize>(this->m_scratch.size()) );
+    this->m_file.flush();
+
+    if ( !this->m_file )    { this->m_failed.store(true, std::memory_order_relaxed); }
+    this->m_chunks          .fetch_add(1ULL, std::memory_order_relaxed);
+    this->m_raw_bytes       .fetch_add(raw, std::memory_order_relaxed);
+    this->m_file_bytes      .fetch_add(sizeof(REC_CHUNK) + 3ULL * sizeof(std::uint32_t) + this->m_scratch.size(), std::memory_order_relaxed);
+    idle.written            = true;
+    return;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//  3.      "ReplaySource"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "open"
+//      Validate the header and count the packets (chunk headers only).
+//
+bool ReplaySource::open(const std::filesystem::path & path)
+{
+    char                magic [sizeof(REC_MAGIC)]   = {   };
+    std::uint32_t       version                     = 0U;
+    std::uint32_t       flags                       = 0U;
+    std::int64_t        wall_ns                     = 0;
+    std::uint32_t       channels                    = 0U;
+    std::uint32_t       block                       = 0U;
+
+    this->close();
+    this->m_file.open(path, std::ios::binary);
+    if ( !this->m_file )    { return false; }
+
+    this->m_file.read(magic, sizeof(magic));
+    const bool          ok      = this->m_file  &&  std::memcmp(magic, REC_MAGIC, sizeof(magic)) == 0
+                               && get_pod(this->m_file, version)   &&  version == REC_VERSION
+                               && get_pod(this->m_file, flags)     &&  get_pod(this->m_file, wall_ns)
+                               && get_pod(this->m_file, channels)  &&  channels == RecordBlock::ms_CHANNELS
+                               && get_pod(this->m_file, block)     &&  block > 0U  &&  block <= ms_MAX_CHUNK_PACKETS;
+    std::error_code         ec;
+    const auto              size        = static_cast<std::streamoff>( std::filesystem::file_size(path, ec) );
+    if ( !ok  ||  ec )      { this->close();  return false; }
+
+    this->m_path            = path;
+    this->m_flags           = flags;
+    this->m_chunk_packets   = block;
+    this->m_size            = size;
+    this->m_data_begin      = this->m_file.tellg();
+    this->m_stats           = {   };
+
+    //      COUNT PACKETS  (a truncated or oversized chunk ends the file, as on playback).
+    for (;;)
+    {
+        char            tag [sizeof(REC_CHUNK)]     = {   };
+        std::uint32_t   n = 0U, codec = 0U, bytes = 0U;
+        if ( !this->m_file.read(tag, sizeof(tag))  ||  std::memcmp(tag, REC_CHUNK, sizeof(tag)) != 0 )        { break; }
+        if ( !get_pod(this->m_file, n)  ||  !get_pod(this->m_file, codec)  ||  !get_pod(this->m_file, bytes) )  { break; }
+
+        const std::streamoff    end     = static_cast<std::streamoff>( this->m_file.tellg() ) + bytes;
+        if ( n > block  ||  end > size  ||  !this->m_file.seekg(end) )  { break; }
+        this->m_stats.total    += n;
+    }
+    this->m_file.clear();
+    this->m_file.seekg(this->m_data_begin);
+    return true;
+}
+
+
+//  "close"
+//
+void ReplaySource::close(void) noexcept
+{
+    this->m_file.close();
+    this->m_file.clear();
+    this->m_path.clear();
+    this->m_block.clear();
+    this->m_chunk_packets   = 0ULL;
+    this->m_size            = 0;
+    this->m_pos             = 0ULL;
+    this->m_active          = false;
+    return;
+}
+
+
+//  "start"
+//      (Re)start from the first packet;  the first packet is due immediately.
+//
+void ReplaySource::start(const Speed speed, const double factor)
+{
+    if ( !this->is_open() )     { return; }
+
+    this->m_file.clear();
+    this->m_file.seekg(this->m_data_begin);
+    this->m_block.clear();
+    this->m_pos             = 0ULL;
+    this->m_speed           = speed;
+    this->m_factor          = (factor > 0.0)    ? factor    : 1.0;
+
+    const std::size_t   total   = this->m_stats.total;
+    this->m_stats           = {   };
+    this->m_stats.total     = total;
+
+    this->m_active          = this->next_block();
+    this->m_first_t         = (this->m_active)  ? this->m_block.t_ns.front()    : 0;
+    this->m_clock_ns        = 0;
+    this->m_start_ns        = steady_ns();
+    return;
+}
+
+
+//  "next_block"
+//      Read and decode the next non-empty chunk into "m_block";  false at the end of the file (or a damaged chunk).
+//      "n" and "bytes" come from the file, so both are bounded (by the header and by what is left) before any resize.
+//
+bool ReplaySource::next_block(void)
+{
+    char                tag [sizeof(REC_CHUNK)]     = {   };
+    std::uint32_t       n = 0U, codec = 0U, bytes = 0U;
+
+    do {
+        if ( !this->m_file.read(tag, sizeof(tag))  ||  std::memcmp(tag, REC_CHUNK, sizeof(tag)) != 0 )     { return false; }
+        if ( !get_pod(this->m_file, n)  ||  !get_pod(this->m_file, codec)  ||  !get_pod(this->m_file, bytes) )  { return false; }
+
+        const std::streamoff    left    = this->m_size - static_cast<std::streamoff>( this->m_file.tellg() );
+        if ( n > this->m_chunk_packets  ||  static_cast<std::streamoff>(bytes) > left )                  { return false; }
+
+        this->m_payload.resize(bytes);
+        if ( !this->m_file.read(reinterpret_cast<char *>(this->m_payload.data()), bytes) )               { return false; }
+        if ( !decode_block(this->m_payload, n, static_cast<RecordCodec>(codec), this->m_block) )         { return false; }
+    } while ( this->m_block.empty() );
+
+    this->m_pos             = 0ULL;
+    return true;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
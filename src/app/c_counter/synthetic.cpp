@@ -0,0 +1,283 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****          S Y N T H E T I C . C P P  ____  F I L E          ****
+*       ********************************************************************
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+**************************************************************************************
+**************************************************************************************/
+#include "app/c_counter/_synthetic.h"
+
+#include <cmath>
+#include <charconv>
+#include <chrono>
+#include <numbers>
+#include <bit>
+
+
+
+namespace cb { namespace ccounter { //     BEGINNING NAMESPACE "cb::ccounter"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+//  0.      STATIC HELPER FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+static constexpr std::size_t    NUM_CHANNELS        = static_cast<std::size_t>(ChannelID::COUNT);
+static constexpr double         CLOCK_HZ            = 100e6;        //  "cycles" per second of integration.
+static constexpr double         DRIFT_PERIOD        = 20.0;         //  Seconds per cycle of the slow modulation.
+
+
+//  "Xorshift"
+//      Cheap PRNG for the producer thread  (xorshift64*;  a few ns per draw, no shared state).
+struct Xorshift
+{
+    std::uint64_t                   s;
+    inline std::uint64_t            next        (void) noexcept
+    {
+        s      ^= s >> 12;   s ^= s << 25;   s ^= s >> 27;
+        return s * 0x2545F4914F6CDD1DULL;
+    }
+    //  "uniform"   [0, 1).
+    inline double                   uniform     (void) noexcept     { return static_cast<double>( this->next() >> 11 ) * 0x1.0p-53; }
+    //  "noise"     Zero mean, unit variance  (triangular:  sum of two uniforms -- plenty for plot jitter).
+    inline double                   noise       (void) noexcept     { return (this->uniform() + this->uniform() - 1.0) * 2.449489742783178; }
+    //  "poisson"   Knuth for small means, normal approximation above.
+    inline std::size_t              poisson     (const double mean) noexcept
+    {
+        if ( mean <= 0.0 )          { return 0ULL; }
+        if ( mean > 30.0 )          { return static_cast<std::size_t>( std::max(0.0, std::round(mean + std::sqrt(mean) * this->noise())) ); }
+        const double    limit   = std::exp(-mean);
+        double          p       = this->uniform();
+        std::size_t     k       = 0ULL;
+        for (; p > limit; ++k)      { p *= this->uniform(); }
+        return k;
+    }
+};
+
+
+//  "store_le"
+template< typename T >
+static inline void store_le(std::byte * dst, const T v) noexcept
+{
+    const auto      u   = static_cast<std::make_unsigned_t<T>>(v);
+    for (std::size_t b = 0ULL; b < sizeof(T); ++b)      { dst[b] = static_cast<std::byte>( (u >> (8ULL * b)) & 0xFFU ); }
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1.      OPERATION FUNCTIONS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "start"
+//      Build the ring for the current framing and launch the producer.  Returns false when already running.
+//
+bool SyntheticStream::start(void)
+{
+    if ( this->m_running.load() )       { return false; }
+
+    if ( this->m_framing == Framing::Binary )   { this->m_frame_ring    = std::make_unique<FrameRing>(this->m_queue_capacity);   this->m_line_ring .reset(); }
+    else                                        { this->m_line_ring     = std::make_unique<LineRing >(this->m_queue_capacity);   this->m_frame_ring.reset(); }
+
+    this->m_generated       .store(0ULL);
+    this->m_dropped_lines   .store(0ULL);
+    this->m_dropped_frames  .store(0ULL);
+    this->m_running         .store(true);
+    this->m_thread          = std::thread(&SyntheticStream::producer_func, this);
+    return true;
+}
+
+
+//  "stop"
+void SyntheticStream::stop(void)
+{
+    if ( !this->m_running.exchange(false) )     { return; }
+    if ( this->m_thread.joinable() )            { this->m_thread.join(); }
+    return;
+}
+
+
+//  "send"
+//      Accepts the same commands as "fpga_stream_v3.py";  "integration_window <s>" sets the rate to 1 / s,
+//      anything else is acknowledged and ignored.
+//
+bool SyntheticStream::send(const std::string & msg)
+{
+    constexpr std::string_view      KEY     = "integration_window";
+    if ( !this->is_running() )      { return false; }
+
+    if ( msg.starts_with(KEY) )
+    {
+        const char *    first   = msg.data() + KEY.size();
+        const char *    last    = msg.data() + msg.size();
+        double          window  = 0.0;
+        while ( first != last  &&  *first == ' ' )      { ++first; }
+        if ( std::from_chars(first, last, window).ec == std::errc()  &&  window > 0.0 )
+            { this->set_rate( 1.0 / window ); }
+    }
+    return true;
+}
+
+
+//  "try_receive_many"
+size_t SyntheticStream::try_receive_many(std::span<Line> out)
+{
+    return ( this->m_line_ring )    ? this->m_line_ring->try_pop_many(out)  : 0ULL;
+}
+
+
+//  "try_receive_many"
+size_t SyntheticStream::try_receive_many(std::span<BinaryFrame> out)
+{
+    return ( this->m_frame_ring )   ? this->m_frame_ring->try_pop_many(out) : 0ULL;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      2.      PRODUCER THREAD...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "producer_func"
+//      Every tick:  work out how many packets the clock owes (by pattern), then emit them back-to-back.  More than
+//      a ring's worth in one tick would only overwrite itself, so the excess is counted as dropped straight away
+//      (and its sequence numbers skipped, as a real overrun would).  Every packet of a tick carries the tick's stamp,
+//      as everything completed by one "read" does in "utl::PyStream".
+//
+void SyntheticStream::producer_func(void)
+{
+    const std::int64_t                      t0          = steady_ns();
+    const bool                              binary      = ( this->m_framing == Framing::Binary );
+    const std::size_t                       capacity    = ( binary ) ? this->m_frame_ring->capacity() : this->m_line_ring->capacity();
+    Xorshift                                rng         { 0x9E3779B97F4A7C15ULL ^ static_cast<std::uint64_t>(t0) };
+    std::array<double, NUM_CHANNELS>        level       = {   };
+    std::array<double, NUM_CHANNELS>        mean        = {   };
+    std::array<std::int32_t, NUM_CHANNELS>  counts      = {   };
+    std::int64_t                            last        = t0;
+    double                                  budget      = 0.0;
+    std::uint32_t                           seq         = 0U;
+
+
+    //      0.      RELATIVE LEVEL OF EACH CHANNEL  [ index bits = detectors;  each extra detector ~10x fewer ].
+    for (std::size_t i = 1ULL; i < NUM_CHANNELS; ++i)
+        { level[i] = std::pow( 0.1, std::popcount(static_cast<unsigned>(i)) - 1 ); }
+
+
+    while ( this->m_running.load(std::memory_order_relaxed) )
+    {
+        std::this_thread::sleep_for( std::chrono::nanoseconds(ms_TICK_NS) );
+
+        const std::int64_t  now         = steady_ns();
+        const double        t           = 1e-9 * static_cast<double>(now - t0);
+        const double        dt          = 1e-9 * static_cast<double>(now - last);
+        const double        rate        = this->m_rate.load(std::memory_order_relaxed);
+        const double        counts_n    = this->m_mean_counts.load(std::memory_order_relaxed);
+        const std::int64_t  cycles      = static_cast<std::int64_t>( CLOCK_HZ / rate );
+        std::size_t         n           = 0ULL;
+        last                            = now;
+
+
+        //      1.      PACKETS OWED THIS TICK...
+        switch ( this->m_pattern.load(std::memory_order_relaxed) )
+        {
+            case Pattern::Poisson :     { n = rng.poisson(rate * dt);       break; }
+            case Pattern::Bursty  : {
+                const double    duty        = this->m_burst_duty  .load(std::memory_order_relaxed);
+                const double    period      = this->m_burst_period.load(std::memory_order_relaxed);
+                if ( std::fmod(t, period) < duty * period )     { budget += rate / duty * dt; }
+                break;
+            }
+            default :                   { budget += rate * dt;              break; }
+        }
+        if ( n == 0ULL  &&  budget >= 1.0 ) {
+            n           = static_cast<std::size_t>(budget);
+            budget     -= static_cast<double>(n);
+        }
+        if ( n == 0ULL )                { continue; }
+
+        this->m_generated.fetch_add(n, std::memory_order_relaxed);
+        if ( n > capacity ) {
+            const std::size_t   excess  = n - capacity;
+            ( binary ? this->m_dropped_frames : this->m_dropped_lines ).fetch_add(excess);
+            seq        += static_cast<std::uint32_t>(excess);
+            n           = capacity;
+        }
+
+
+        //      2.      SLOW DRIFT  [ per tick, not per packet ].
+        for (std::size_t i = 1ULL; i < NUM_CHANNELS; ++i)
+            { mean[i] = counts_n * level[i] * ( 1.0 + 0.25 * std::sin(2.0 * std::numbers::pi * t / DRIFT_PERIOD + static_cast<double>(i)) ); }
+
+
+        //      3.      EMIT...
+        for (std::size_t k = 0ULL; k < n; ++k, ++seq)
+        {
+            for (std::size_t i = 1ULL; i < NUM_CHANNELS; ++i)
+                { counts[i] = static_cast<std::int32_t>( std::max(0.0, std::round(mean[i] + std::sqrt(mean[i]) * rng.noise())) ); }
+
+            if ( binary )
+            {
+                const bool  kept    = this->m_frame_ring->emplace_with( [&](BinaryFrame & slot) {
+                    slot.version        = DEF_PACKET_VERSION;
+                    slot.size           = static_cast<std::uint16_t>(DEF_PACKET_SIZE);
+                    slot.t_read_ns      = now;
+                    std::byte *     p   = slot.payload.data();
+                    store_le(p, seq);
+                    store_le(p + 4, cycles);
+                    for (std::size_t i = 0ULL; i < NUM_CHANNELS; ++i)   { store_le(p + 12 + 4 * i, counts[i]); }
+                });
+                if ( !kept )        { ++this->m_dropped_frames; }
+                continue;
+            }
+
+            const bool      kept    = this->m_line_ring->emplace_with( [&](Line & line) {
+                std::string &   slot    = line.text;
+                char            num [24];
+                auto            put     = [&slot, &num](const auto v) { slot.append( num, std::to_chars(num, num + sizeof(num), v).ptr ); };
+                slot.assign("{\"counts\":[");                  //  keeps the slot's capacity.
+                for (std::size_t i = 0ULL; i < NUM_CHANNELS; ++i) {
+                    if ( i )        { slot.push_back(','); }
+                    put(counts[i]);
+                }
+                slot.append("],\"cycles\":");
+                put(cycles);
+                slot.push_back('}');
+                line.t_read_ns          = now;
+            });
+            if ( !kept )            { ++this->m_dropped_lines; }
+        }
+    }
+    return;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+} }//   END OF "cb::ccounter" NAMESPACE.
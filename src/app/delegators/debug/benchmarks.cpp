@@ -0,0 +1,645 @@
+/***********************************************************************************
+*
+*       ********************************************************************
+*       ****         B E N C H M A R K S . C P P  ____  F I L E         ****
+*       ********************************************************************
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+**************************************************************************************
+**************************************************************************************/
+#include "app/app.h"
+#include "app/delegators/_detail_view.h"
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <type_traits>
+
+#include <array>
+#include <vector>
+#include <string>
+
+
+
+namespace cb { //     BEGINNING NAMESPACE "cb"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1A.     PERIPHERAL DEFINITIONS FOR "BENCHMARKS"...
+// *************************************************************************** //
+// *************************************************************************** //
+namespace bench { //     BEGINNING NAMESPACE "bench"...
+
+
+// *************************************************************************** //
+//      "bench" |    TYPES.
+// *************************************************************************** //
+
+using       Clock               = std::chrono::steady_clock;
+
+
+//  "BenchResult"
+//
+struct BenchResult {
+    std::string     name        {};
+    std::size_t     N           { 0 };
+    double          ref_ms      { 0.0 };        //  Per-call time of the reference implementation.
+    double          opt_ms      { 0.0 };        //  Per-call time of the optimized implementation.
+    double          max_err     { 0.0 };        //  Max. abs. error (relative to the reference peak).
+};
+
+
+//  "KernelResult"
+//
+struct KernelResult {
+    const char *    path        = "";           //  Kernel path ("Scalar", "AVX2", ...).
+    const char *    type        = "";           //  "float" / "double".
+    std::size_t     N           { 0 };
+    double          cells_per_s { 0.0 };        //  Yee cells advanced per second (one H + one E update each).
+    double          speedup     { 0.0 };        //  Relative to the scalar path at the same N and type.
+    bool            bit_exact   { false };      //  Fields identical to the scalar path after "ms_CHECK_STEPS".
+};
+
+
+//  "ScalingResult"
+//
+struct ScalingResult {
+    std::size_t     threads     { 0 };          //  Pool size (caller included).
+    std::size_t     pinned      { 0 };          //  Residents the OS actually pinned.
+    double          cells_per_s { 0.0 };
+    double          speedup     { 0.0 };        //  Relative to one thread.
+    bool            bit_exact   { false };      //  Fields identical to the one-thread run.
+};
+
+
+//  "BackgroundRun"
+//      One benchmark run on "utl::TaskScheduler" (Low priority, abandoned by "shutdown").  Nothing ever blocks on it:
+//      the GUI polls "take" once per frame, and a run still queued or running at exit is simply dropped with its
+//      shared state.  "fn(token)" should check "token.cancelled()" between its stages.
+//
+template< typename T >
+class BackgroundRun {
+    struct State {
+        std::atomic<bool>           done        { false };
+        T                           value       {   };
+    };
+    std::shared_ptr<State>          m_state     {   };
+public:
+    [[nodiscard]] inline bool       running     (void) const noexcept
+    { return this->m_state  &&  !this->m_state->done.load(std::memory_order_acquire); }
+
+    template< typename Fn >
+    inline void                     start       (Fn && fn)
+    {
+        utl::TaskScheduler &        sched       = utl::TaskScheduler::instance();
+        utl::CancelToken            token       = sched.make_token();
+        this->m_state                           = std::make_shared<State>();
+        sched.submit( [state = this->m_state, token, fn = std::forward<Fn>(fn)]() mutable
+        {
+            try             { state->value = fn(token); }
+            catch (...)     { state->value = T{}; }             //  A failed run reports nothing, but still finishes.
+            state->done.store(true, std::memory_order_release);
+        }, utl::TaskPriority::Low, token );
+        return;
+    }
+
+    //  "take"
+    //      Moves the result of a finished run into "out";  false while nothing new has finished.
+    inline bool                     take        (T & out)
+    {
+        if ( !this->m_state  ||  !this->m_state->done.load(std::memory_order_acquire) )     { return false; }
+        out                                     = std::move(this->m_state->value);
+        this->m_state.reset();
+        return true;
+    }
+};
+
+
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [ 1.0.  "TYPES" ].
+
+
+
+// *************************************************************************** //
+//      "bench" |    FUNCTIONS.
+// *************************************************************************** //
+
+/// \brief Call "fn" repeatedly until at least "budget_ms" has elapsed; return the mean time per call [ms].
+template<typename Fn>
+[[nodiscard]] inline double time_per_call(Fn && fn, const double budget_ms = 200.0, const std::size_t max_reps = 100000)
+{
+    std::size_t             reps    = 0;
+    const auto              t0      = Clock::now();
+    double                  elapsed = 0.0;
+
+    do {
+        fn();
+        ++reps;
+        elapsed = std::chrono::duration<double, std::milli>( Clock::now() - t0 ).count();
+    } while ( elapsed < budget_ms && reps < max_reps );
+
+    return elapsed / static_cast<double>(reps);
+}
+
+
+//  "bench_fft_vs_dft"
+//
+[[nodiscard]] inline BenchResult bench_fft_vs_dft(const std::size_t N)
+{
+    using                   complex_t   = std::complex<double>;
+    std::mt19937            rng         (1234u);
+    std::normal_distribution<double>    dist;
+    std::vector<double>     sig_t       (N);
+    for (auto & x : sig_t)  { x = dist(rng); }
+
+    std::vector<complex_t>  ref, opt;
+    BenchResult             r;
+    r.name                  = "real_DFT  vs.  real_FFT";
+    r.N                     = N;
+
+    //  Reference O(N^2) DFT is far too slow to repeat at N = 65536; one call is enough there.
+    r.ref_ms                = time_per_call( [&]{ ref = fdtd::real_DFT<double>(sig_t);  }, 200.0, (N > 8192) ? 1 : 100000 );
+    r.opt_ms                = time_per_call( [&]{ opt = fdtd::real_FFT<double>(sig_t);  } );
+
+    double                  peak        = 0.0;
+    for (std::size_t k = 0; k < opt.size(); ++k) {
+        peak                = std::max( peak,       std::abs(ref[k]) );
+        r.max_err           = std::max( r.max_err,  std::abs(ref[k] - opt[k]) );
+    }
+    if (peak > 0.0)         { r.max_err /= peak; }
+    return r;
+}
+
+
+//  "bench_yee_kernels"
+//      Every kernel path this CPU supports, for one element type and grid size.
+//
+template<typename T>
+[[nodiscard]] inline std::vector<KernelResult> bench_yee_kernels(const std::size_t N)
+{
+    using                   arena_t     = fdtd::AlignedArena<T>;
+    enum : std::size_t      { EZ = 0, HY, CEZE, CEZH, CHYE, CHYH, NUM_SLOTS };
+    constexpr std::size_t   ms_CHECK_STEPS  = 64;
+    constexpr const char *  ms_TYPE         = std::is_same_v<T, float> ? "float" : "double";
+
+    //      1.      RANDOM, STABLE INITIAL STATE  (|coeff| < 1 keeps the fields bounded over many steps)...
+    std::mt19937                        rng         (1234u);
+    std::uniform_real_distribution<T>   field       (T(-1), T(1));
+    std::uniform_real_distribution<T>   coeff       (T(0.25), T(0.5));
+    arena_t                             init        (NUM_SLOTS, N);
+    for (std::size_t m = 0; m < N; ++m) {
+        init.data(EZ)[m]    = field(rng);       init.data(HY)[m]    = field(rng);
+        init.data(CEZE)[m]  = coeff(rng);       init.data(CEZH)[m]  = coeff(rng);
+        init.data(CHYE)[m]  = coeff(rng);       init.data(CHYH)[m]  = coeff(rng);
+    }
+
+    auto                    step        = [N](arena_t & g, const fdtd::SimdLevel lvl) {
+        fdtd::update_H_1D( g.data(HY), g.data(EZ), g.data(CHYH), g.data(CHYE), N, lvl );
+        fdtd::update_E_1D( g.data(EZ), g.data(HY), g.data(CEZE), g.data(CEZH), N, lvl );
+    };
+
+
+    //      2.      SCALAR REFERENCE STATE...
+    arena_t                 ref         (init);
+    for (std::size_t q = 0; q < ms_CHECK_STEPS; ++q)    { step(ref, fdtd::SimdLevel::Scalar); }
+
+
+    //      3.      TIME + VERIFY EACH PATH...
+    std::vector<KernelResult>   out;
+    double                      scalar_cps  = 0.0;
+    const auto                  top         = static_cast<std::size_t>( fdtd::detect_simd_level() );
+    for (std::size_t l = 0; l <= top; ++l)
+    {
+        const auto          lvl         = static_cast<fdtd::SimdLevel>(l);
+        KernelResult        r;
+        r.path              = fdtd::DEF_SIMD_LEVEL_NAMES[l];
+        r.type              = ms_TYPE;
+        r.N                 = N;
+
+        arena_t             g           (init);
+        for (std::size_t q = 0; q < ms_CHECK_STEPS; ++q)    { step(g, lvl); }
+        r.bit_exact         = ( std::memcmp(g.data(0), ref.data(0), g.bytes()) == 0 );
+
+        const double        ms          = time_per_call( [&]{ step(g, lvl); } );
+        r.cells_per_s       = (ms > 0.0) ? static_cast<double>(N) / (ms * 1e-3) : 0.0;
+        if (l == 0)         { scalar_cps = r.cells_per_s; }
+        r.speedup           = (scalar_cps > 0.0) ? r.cells_per_s / scalar_cps : 0.0;
+        out.push_back(r);
+    }
+    return out;
+}
+
+
+//  "bench_thread_scaling"
+//      3D engine throughput on the persistent worker pool, for 1, 2, 4, ... threads up to the hardware count.
+//
+[[nodiscard]] inline std::vector<ScalingResult> bench_thread_scaling(const std::size_t N)
+{
+    using                   engine_t        = fdtd::FDTD_3D<double>;
+    constexpr std::size_t   ms_CHECK_STEPS  = 16;
+    const std::size_t       hw              = fdtd::default_thread_count();
+    const std::size_t       cells           = N * N * N;
+
+    std::vector<std::size_t>    counts;
+    for (std::size_t t = 1; t < hw; t *= 2)     { counts.push_back(t); }
+    counts.push_back(hw);
+
+    auto                    make            = [N](const std::size_t threads) {
+        auto    e   = std::make_unique<engine_t>(N, N, N, engine_t::ms_SC_MAX, threads);
+        e->set_box(N / 4, N / 2, N / 4, N / 2, 0, N, fdtd::Material<double>{ 4.0, 1.0, 0.01, 0.0 });
+        fdtd::PointSource<double>   src;
+        src.cell        = e->index(N / 2, N / 2, N / 2);
+        e->add_source(src);
+        return e;
+    };
+
+    std::vector<double>         ref;
+    std::vector<ScalingResult>  out;
+    for (const std::size_t t : counts)
+    {
+        auto                e           = make(t);
+        for (std::size_t q = 0; q < ms_CHECK_STEPS; ++q)    { e->step(); }
+        std::vector<double> Ez          ( e->Ez().begin(), e->Ez().end() );
+        if (ref.empty())    { ref = Ez; }
+
+        ScalingResult       r;
+        r.threads           = e->threads();
+        r.pinned            = e->pinned();
+        r.bit_exact         = (Ez == ref);
+        const double        ms          = time_per_call( [&]{ e->step(); }, 500.0 );
+        r.cells_per_s       = (ms > 0.0) ? static_cast<double>(cells) / (ms * 1e-3) : 0.0;
+        r.speedup           = (out.empty() || out.front().cells_per_s <= 0.0) ? 1.0 : r.cells_per_s / out.front().cells_per_s;
+        out.push_back(r);
+    }
+    return out;
+}
+
+
+//  "draw_scaling_results"
+//
+inline void draw_scaling_results(const char * uuid, const std::vector<ScalingResult> & results)
+{
+    if ( !ImGui::BeginTable(uuid, 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp) )
+        return;
+
+    ImGui::TableSetupColumn("Threads");
+    ImGui::TableSetupColumn("Pinned");
+    ImGui::TableSetupColumn("Cells / s");
+    ImGui::TableSetupColumn("Speed-Up");
+    ImGui::TableSetupColumn("Efficiency");
+    ImGui::TableSetupColumn("Bit-Exact");
+    ImGui::TableHeadersRow();
+
+    for (const auto & r : results) {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);      ImGui::Text("%zu",      r.threads);
+        ImGui::TableSetColumnIndex(1);      ImGui::Text("%zu",      r.pinned);
+        ImGui::TableSetColumnIndex(2);      ImGui::Text("%.3e",     r.cells_per_s);
+        ImGui::TableSetColumnIndex(3);      ImGui::Text("%.2fx",    r.speedup);
+        ImGui::TableSetColumnIndex(4);      ImGui::Text("%.0f%%",   100.0 * r.speedup / static_cast<double>(r.threads));
+        ImGui::TableSetColumnIndex(5);      ImGui::TextUnformatted( (r.bit_exact) ? "yes" : "NO" );
+    }
+    ImGui::EndTable();
+    return;
+}
+
+
+//  "draw_kernel_results"
+//
+inline void draw_kernel_results(const char * uuid, const std::vector<KernelResult> & results)
+{
+    if ( !ImGui::BeginTable(uuid, 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp) )
+        return;
+
+    ImGui::TableSetupColumn("Kernel");
+    ImGui::TableSetupColumn("Type");
+    ImGui::TableSetupColumn("N");
+    ImGui::TableSetupColumn("Cells / s");
+    ImGui::TableSetupColumn("vs. Scalar");
+    ImGui::TableSetupColumn("Bit-Exact");
+    ImGui::TableHeadersRow();
+
+    for (const auto & r : results) {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);      ImGui::TextUnformatted(r.path);
+        ImGui::TableSetColumnIndex(1);      ImGui::TextUnformatted(r.type);
+        ImGui::TableSetColumnIndex(2);      ImGui::Text("%zu",      r.N);
+        ImGui::TableSetColumnIndex(3);      ImGui::Text("%.3e",     r.cells_per_s);
+        ImGui::TableSetColumnIndex(4);      ImGui::Text("%.2fx",    r.speedup);
+        ImGui::TableSetColumnIndex(5);      ImGui::TextUnformatted( (r.bit_exact) ? "yes" : "NO" );
+    }
+    ImGui::EndTable();
+    return;
+}
+
+
+//  "draw_results"
+//
+inline void draw_results(const char * uuid, const std::vector<BenchResult> & results)
+{
+    if ( !ImGui::BeginTable(uuid, 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp) )
+        return;
+
+    ImGui::TableSetupColumn("Benchmark");
+    ImGui::TableSetupColumn("N");
+    ImGui::TableSetupColumn("Reference [ms]");
+    ImGui::TableSetupColumn("Optimized [ms]");
+    ImGui::TableSetupColumn("Speed-Up");
+    ImGui::TableSetupColumn("Rel. Error");
+    ImGui::TableHeadersRow();
+
+    for (const auto & r : results) {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);      ImGui::TextUnformatted(r.name.c_str());
+        ImGui::TableSetColumnIndex(1);      ImGui::Text("%zu",      r.N);
+        ImGui::TableSetColumnIndex(2);      ImGui::Text("%.4f",     r.ref_ms);
+        ImGui::TableSetColumnIndex(3);      ImGui::Text("%.4f",     r.opt_ms);
+        ImGui::TableSetColumnIndex(4);      ImGui::Text("%.1fx",    (r.opt_ms > 0.0) ? r.ref_ms / r.opt_ms : 0.0);
+        ImGui::TableSetColumnIndex(5);      ImGui::Text("%.2e",     r.max_err);
+    }
+    ImGui::EndTable();
+    return;
+}
+
+
+
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [ 1.1.  "FUNCTIONS" ].
+}// END NAMESPACE "bench".
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 1A.  "PERIPHERALS" ]].
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1B.     FDTD BENCHMARKS...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "BenchmarkFFT"
+//      Runs on a background task so the O(N^2) reference at N = 65536 does not stall the UI.
+//
+void CBDebugger::BenchmarkFFT(void) noexcept
+{
+    static constexpr std::array<std::size_t, 3>         ms_SIZES        = { 512ULL, 4096ULL, 65536ULL };
+    static bench::BackgroundRun< std::vector<bench::BenchResult> >  s_task;
+    static std::vector<bench::BenchResult>              s_results;
+
+
+    //      1.      COLLECT RESULTS OF A FINISHED RUN...
+    s_task.take(s_results);
+    const bool                                          running         = s_task.running();
+
+
+    //      2.      CONTROLS...
+    ImGui::SeparatorText("FFT  vs.  DFT  (N = 512, 4096, 65536)");
+    ImGui::BeginDisabled(running);
+        if ( ImGui::Button("Run \"real_FFT\" Benchmark") )
+        {
+            s_task.start( [](const utl::CancelToken & token) {
+                std::vector<bench::BenchResult>     out;
+                for (std::size_t N : ms_SIZES)
+                    { if ( token.cancelled() ) { break; }   out.push_back( bench::bench_fft_vs_dft(N) ); }
+                return out;
+            } );
+        }
+    ImGui::EndDisabled();
+    if (running)    { ImGui::SameLine();    ImGui::TextDisabled("Running...  (the N = 65536 DFT takes a while)"); }
+
+
+    //      3.      RESULTS...
+    if ( !s_results.empty() )   { bench::draw_results("fft_bench_tbl", s_results); }
+
+    return;
+}
+
+
+
+//  "BenchmarkYeeKernels"
+//      1D Yee update throughput for every supported kernel path, in L1-resident and DRAM-sized grids.
+//
+void CBDebugger::BenchmarkYeeKernels(void) noexcept
+{
+    static constexpr std::array<std::size_t, 2>         ms_SIZES        = { 4096ULL, 4194304ULL };
+    static bench::BackgroundRun< std::vector<bench::KernelResult> > s_task;
+    static std::vector<bench::KernelResult>             s_results;
+
+
+    //      1.      COLLECT RESULTS OF A FINISHED RUN...
+    s_task.take(s_results);
+    const bool                                          running         = s_task.running();
+
+
+    //      2.      CONTROLS...
+    ImGui::SeparatorText("1D Yee Update Kernels  (update_H + update_E)");
+    ImGui::BeginDisabled(running);
+        if ( ImGui::Button("Run Kernel Benchmark") )
+        {
+            s_task.start( [](const utl::CancelToken & token) {
+                std::vector<bench::KernelResult>    out;
+                for (std::size_t N : ms_SIZES) {
+                    if ( token.cancelled() )        { break; }
+                    for (auto & r : bench::bench_yee_kernels<float>(N))     { out.push_back(r); }
+                    for (auto & r : bench::bench_yee_kernels<double>(N))    { out.push_back(r); }
+                }
+                return out;
+            } );
+        }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::TextDisabled("Active path: %s", fdtd::DEF_SIMD_LEVEL_NAMES[ static_cast<std::size_t>(fdtd::simd_level()) ]);
+    if (running)    { ImGui::SameLine();    ImGui::TextDisabled("Running..."); }
+
+
+    //      3.      RESULTS...
+    if ( !s_results.empty() )   { bench::draw_kernel_results("yee_bench_tbl", s_results); }
+
+    return;
+}
+
+
+
+//  "BenchmarkThreadScaling"
+//      One 3D time-step per call on the persistent worker pool, from one thread up to every hardware thread.
+//
+void CBDebugger::BenchmarkThreadScaling(void) noexcept
+{
+    static constexpr std::size_t                        ms_N            = 96ULL;
+    static bench::BackgroundRun< std::vector<bench::ScalingResult> >    s_task;
+    static std::vector<bench::ScalingResult>            s_results;
+
+
+    //      1.      COLLECT RESULTS OF A FINISHED RUN...
+    s_task.take(s_results);
+    const bool                                          running         = s_task.running();
+
+
+    //      2.      CONTROLS...
+    ImGui::SeparatorText("Worker-Pool Scaling  (FDTD_3D, 96^3 cells)");
+    ImGui::BeginDisabled(running);
+        if ( ImGui::Button("Run Scaling Benchmark") )
+            { s_task.start( [](const utl::CancelToken & ) { return bench::bench_thread_scaling(ms_N); } ); }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::TextDisabled("Hardware threads: %zu", fdtd::default_thread_count());
+    if (running)    { ImGui::SameLine();    ImGui::TextDisabled("Running..."); }
+
+
+    //      3.      RESULTS...
+    if ( !s_results.empty() )   { bench::draw_scaling_results("pool_bench_tbl", s_results); }
+
+    return;
+}
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 1B.  "FDTD BENCHMARKS" ]].
+
+
+
+
+
+
+
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      1C.     END-TO-END LATENCY...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "LatencyPanel"
+//      Every "utl::LatencyTracer" histogram:  count and percentiles in ms.  "Export CSV" writes the summary and the raw
+//      buckets to the working directory.
+//
+void CBDebugger::LatencyPanel(void) noexcept
+{
+    static constexpr std::array<double, 4>  ms_QUANTILES    = { 0.50, 0.90, 0.99, 0.999 };
+    static constexpr double                 ms_TO_MS        = 1e-6;
+    utl::LatencyTracer &                    tracer          = utl::LatencyTracer::instance();
+
+
+    //      1.      CONTROLS...
+    ImGui::SeparatorText("End-To-End Latency  (pipe read  -->  presented frame)");
+    if ( ImGui::Button("Reset") )           { tracer.reset(); }
+    ImGui::SameLine();
+    if ( ImGui::Button("Export CSV") )
+    {
+        char                name [64]   = { '\0' };
+        const std::time_t   now         = std::time(nullptr);
+        std::strftime( name, sizeof(name), "latency_%Y%m%d_%H%M%S.csv", std::localtime(&now) );
+        
+        if ( tracer.export_csv(name) )      { this->S.m_logger.info( std::format("[[CBDebugger]] latency histograms written to \"{}\"", name) ); }
+        else                                { this->S.m_logger.error( std::format("[[CBDebugger]] unable to write \"{}\"", name) ); }
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("%llu frames,  %zu pending", static_cast<unsigned long long>(tracer.frames()), tracer.pending());
+    if ( tracer.overflow() > 0ULL ) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%zu samples dropped)", tracer.overflow());
+    }
+
+
+    //      2.      ONE ROW PER HISTOGRAM...
+    if ( !ImGui::BeginTable("latency_tbl", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp) )
+        { return; }
+
+    ImGui::TableSetupColumn("Stage");
+    ImGui::TableSetupColumn("Samples");
+    ImGui::TableSetupColumn("Mean [ms]");
+    ImGui::TableSetupColumn("p50 [ms]");
+    ImGui::TableSetupColumn("p90 [ms]");
+    ImGui::TableSetupColumn("p99 [ms]");
+    ImGui::TableSetupColumn("p99.9 [ms]");
+    ImGui::TableSetupColumn("Max [ms]");
+    ImGui::TableHeadersRow();
+
+    for (const auto & e : tracer.entries())
+    {
+        const utl::LatencyHistogram &   h   = e.hist;
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);      ImGui::TextUnformatted(e.name.c_str());
+        ImGui::TableSetColumnIndex(1);      ImGui::Text("%llu",     static_cast<unsigned long long>(h.count()));
+        ImGui::TableSetColumnIndex(2);      ImGui::Text("%.3f",     ms_TO_MS * h.mean());
+        for (std::size_t q = 0ULL; q < ms_QUANTILES.size(); ++q) {
+            ImGui::TableSetColumnIndex( static_cast<int>(3ULL + q) );
+            ImGui::Text("%.3f", ms_TO_MS * static_cast<double>( h.percentile(ms_QUANTILES[q]) ));
+        }
+        ImGui::TableSetColumnIndex(7);      ImGui::Text("%.3f",     ms_TO_MS * static_cast<double>(h.max()));
+    }
+    ImGui::EndTable();
+
+    return;
+}
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END [[ 1C.  "END-TO-END LATENCY" ]].
+
+
+
+
+
+
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF "cb" NAMESPACE.
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
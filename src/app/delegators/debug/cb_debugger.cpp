@@ -158,7 +158,38 @@ inline void CBDebugger::Begin_IMPL(void)
 
     //  this->TestOrchid();
 
-    this->TestndRingBuffer();
+    if ( !ImGui::BeginTabBar("##CBDebuggerTabs") )  { return; }
+    
+        if ( ImGui::BeginTabItem("ndRingBuffer") ) {
+            this->TestndRingBuffer();
+            ImGui::EndTabItem();
+        }
+        
+        if ( ImGui::BeginTabItem("Rasterizer") ) {
+            this->TestFDTDRasterizer();
+            ImGui::EndTabItem();
+        }
+        
+        if ( ImGui::BeginTabItem("Orchid") ) {
+            this->TestOrchidHistory();
+            ImGui::EndTabItem();
+        }
+        
+        if ( ImGui::BeginTabItem("Benchmarks") ) {
+            this->BenchmarkFFT();
+            ImGui::Spacing();
+            this->BenchmarkYeeKernels();
+            ImGui::Spacing();
+            this->BenchmarkThreadScaling();
+            ImGui::EndTabItem();
+        }
+        
+        if ( ImGui::BeginTabItem("Latency") ) {
+            this->LatencyPanel();
+            ImGui::EndTabItem();
+        }
+    
+    ImGui::EndTabBar();
 
     return;
 }
@@ -51,9 +51,19 @@ struct IncrementAction : orchid::ABC
     {   }
         
 
-    void                undo    (void)  noexcept override           { target -= delta;      }
-    void                redo    (void)  noexcept override           { target += delta;      }
-    std::string_view    label   (void)  const noexcept override     { return "Increment";   }
+    void                undo        (void)  noexcept override           { target -= delta;      }
+    void                redo        (void)  noexcept override           { target += delta;      }
+    std::string_view    label       (void)  const noexcept override     { return "Increment";   }
+    std::uint64_t       merge_key   (void)  const noexcept override     { return 1;             }
+    std::size_t         byte_size   (void)  const noexcept override     { return sizeof(*this); }
+    
+    //  Repeated clicks on the same counter collapse into one undo step.
+    bool                merge_with  (const orchid::Action & o) noexcept override {
+        const auto *    other   = dynamic_cast<const IncrementAction *>(&o);
+        if ( !other  ||  &other->target != &target )    { return false; }
+        delta          += other->delta;
+        return true;
+    }
 
 private:
     int &       target      ;
@@ -151,11 +161,16 @@ void CBDebugger::TestOrchid(void) noexcept
     ImGui::Indent();
     //
     //
+        const auto      stats   = this->S.Orchid_stats();
         ImGui::Text(
               "Undoable:\t%zu \nRedoable:\t%zu"
              , this->S.Orchid_undo_count()
              , this->S.Orchid_redo_count()
         );
+        ImGui::Text(
+              "Bytes:\t\t%zu \nMerged:\t\t%zu \nEvicted:\t%zu \nPooled:\t\t%zu"
+             , stats.bytes_held, stats.merged, stats.evicted, stats.pooled
+        );
     //
     //
     ImGui::Unindent();
@@ -170,19 +185,19 @@ void CBDebugger::TestOrchid(void) noexcept
     //
         if ( ImGui::Button("Add  +1") )
         {
-            this->S.OrchidPush( std::make_unique<IncrementAction>(value, 1) );
+            this->S.OrchidEmplace<IncrementAction>(value, 1);
         }
 
         ImGui::SameLine();
         if ( ImGui::Button("Add  +5") )
         {
-            this->S.OrchidPush( std::make_unique<IncrementAction>(value, 5) );
+            this->S.OrchidEmplace<IncrementAction>(value, 5);
         }
 
         ImGui::SameLine();
         if ( ImGui::Button("Toggle Flag") )
         {
-            this->S.OrchidPush( std::make_unique<ToggleFlagAction>(flag) );
+            this->S.OrchidEmplace<ToggleFlagAction>(flag);
         }
     //
     //
@@ -643,6 +658,47 @@ template<typename T, typename Alloc>
 
 
 
+//  "test_t10_bulk_and_spans"
+//
+[[nodiscard]] inline TestResult test_t10_bulk_and_spans()
+{
+    using RB = ContainerType<int>;
+    RB rb{5};
+    const std::vector<int>  a   = {0, 1, 2};
+    const std::vector<int>  b   = {3, 4, 5, 6};
+
+    rb.push_back_bulk(a);
+    rb.push_back_bulk(b);            // [2,3,4,5,6]  wraps:  physical [5,6,2,3,4]
+    const bool ok_seq   = equals_seq(rb, {2,3,4,5,6});
+
+    const auto [s0, s1] = rb.as_spans();
+    const bool ok_span  = (s0.size() == 3 && s1.size() == 2 && s0[0] == 2 && s1[0] == 5 && !rb.is_linear());
+
+    const auto lin      = rb.linearize();
+    const bool ok_lin   = ( rb.is_linear() && lin.data() == rb.data() && std::equal(lin.begin(), lin.end(), std::vector<int>({2,3,4,5,6}).begin()) );
+
+    rb.push_back(7);                 // [3,4,5,6,7]  after linearize:  still chronological
+    const bool ok_push  = equals_seq(rb, {3,4,5,6,7});
+
+    const bool ok_lb    = ( rb.time_lower_bound(3) == 0 && rb.time_lower_bound(6) == 3 && rb.time_lower_bound(8) == 5 );
+
+    TestResult r;
+    r.name = "T10 --- push_back_bulk / as_spans / linearize / time_lower_bound";
+    r.pass = ok_seq && ok_span && ok_lin && ok_push && ok_lb;
+    if (!r.pass) {
+        auto cur = snapshot(rb);
+        r.note = std::string("got=") + to_string_seq(cur.begin(), cur.end())
+               + " seq=" + (ok_seq ? "ok" : "FAIL") + " spans=" + (ok_span ? "ok" : "FAIL")
+               + " linearize=" + (ok_lin ? "ok" : "FAIL") + " push=" + (ok_push ? "ok" : "FAIL") + " lower_bound=" + (ok_lb ? "ok" : "FAIL");
+    }
+    return r;
+}
+
+
+
+
+
+
 // *************************************************************************** //
 //      "tests" |    MAIN TABLE.
 // *************************************************************************** //
@@ -669,6 +725,7 @@ inline void draw_ndringbuffer_basic_tests()
             , test_t7_iterators()
             , test_t8_invalidation_info()
             , test_t9_zero_capacity()
+            , test_t10_bulk_and_spans()
         };
         s_ran = true;
     }
@@ -676,7 +733,7 @@ inline void draw_ndringbuffer_basic_tests()
     int passed = 0;
     for (const auto & r : s_results) { if (r.pass) ++passed; }
 
-    ImGui::SeparatorText("Unit-Testing for \"ndRingBuffer\" | T0---T9 (cached)");
+    ImGui::SeparatorText("Unit-Testing for \"ndRingBuffer\" | T0---T10 (cached)");
     ImGui::Text("Passed %d / %d", passed, (int)s_results.size());
 
     if (ImGui::BeginTable("ndrb_tests_tbl", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
@@ -699,6 +756,389 @@ inline void draw_ndringbuffer_basic_tests()
 
 
 
+// *************************************************************************** //
+//      "tests" |    FDTD SCENE RASTERIZER.
+// *************************************************************************** //
+
+using       Raster          = fdtd::SceneRasterizer<double>;
+using       RasterMat       = fdtd::Material<double>;
+
+
+//  "raster_grid_10x10"     10 x 10 unit cells at the origin.
+[[nodiscard]] inline fdtd::RasterGrid raster_grid_10x10()
+{
+    fdtd::RasterGrid    g;
+    g.nx = 10;      g.ny = 10;      g.h = 1.0;      g.samples = 4;
+    return g;
+}
+
+//  "raster_rect"           Axis-aligned rectangle  [x0, x1] x [y0, y1]  as a polygon.
+[[nodiscard]] inline std::vector<fdtd::RasterPoint> raster_rect(double x0, double y0, double x1, double y1)
+{ return { {x0, y0}, {x1, y0}, {x1, y1}, {x0, y1} }; }
+
+//  "count_eps"             Cells whose eps_r equals "v".
+[[nodiscard]] inline std::size_t count_eps(const Raster & r, const double v)
+{
+    std::size_t     k   = 0;
+    for (const double e : r.eps_r())    { if (e == v) ++k; }
+    return k;
+}
+
+
+//  "test_r0_square"
+//
+[[nodiscard]] inline TestResult test_r0_square()
+{
+    Raster      r       (raster_grid_10x10());
+    r.set_shape(1, 0, raster_rect(2, 3, 6, 7), RasterMat{4.0});
+    r.rebuild();
+
+    bool        inside  = true;
+    for (std::size_t m = 2; m < 6; ++m)
+        for (std::size_t n = 3; n < 7; ++n)     { inside = inside && r.eps_r()[r.index(m, n)] == 4.0; }
+    const std::size_t   n4  = count_eps(r, 4.0);
+    const std::size_t   n1  = count_eps(r, 1.0);
+
+    TestResult  t;
+    t.name  = "R0 --- cell-aligned square fills exactly its 4 x 4 cells";
+    t.pass  = inside && n4 == 16 && n1 == 84;
+    if (!t.pass)    { t.note = "eps=4 cells: " + std::to_string(n4) + ",  eps=1 cells: " + std::to_string(n1); }
+    return t;
+}
+
+
+//  "test_r1_partial_coverage"
+//
+[[nodiscard]] inline TestResult test_r1_partial_coverage()
+{
+    Raster      r       (raster_grid_10x10());
+    r.set_shape(1, 0, raster_rect(2.5, 3, 4.5, 5), RasterMat{4.0});
+    r.rebuild();
+
+    const double    e2  = r.eps_r()[r.index(2, 3)];
+    const double    e3  = r.eps_r()[r.index(3, 4)];
+    const double    e4  = r.eps_r()[r.index(4, 4)];
+
+    TestResult  t;
+    t.name  = "R1 --- half-covered edge cells blend to the coverage-weighted mean";
+    t.pass  = std::abs(e2 - 2.5) < 1e-12 && e3 == 4.0 && std::abs(e4 - 2.5) < 1e-12;
+    if (!t.pass)    { t.note = "eps(2,3)=" + std::to_string(e2) + "  eps(3,4)=" + std::to_string(e3) + "  eps(4,4)=" + std::to_string(e4); }
+    return t;
+}
+
+
+//  "test_r2_z_order_and_remove"
+//
+[[nodiscard]] inline TestResult test_r2_z_order_and_remove()
+{
+    Raster      r       (raster_grid_10x10());
+    r.set_shape(1, 0, raster_rect(2, 2, 6, 6), RasterMat{4.0});
+    r.set_shape(2, 1, raster_rect(4, 4, 8, 8), RasterMat{9.0});
+    r.rebuild();
+    const bool  top     = r.eps_r()[r.index(5, 5)] == 9.0  &&  r.eps_r()[r.index(3, 3)] == 4.0;
+
+    //  Removing the top shape re-composites only its (conservative) bounding block.
+    const auto  block   = fdtd::cell_bounds(raster_rect(4, 4, 8, 8), r.grid());
+    r.remove_shape(2);
+    const auto  upd     = r.rebuild();
+    const bool  local   = upd.size() == 1  &&  upd[0].area() == block.area()  &&  block.area() < r.cells();
+    const bool  back    = r.eps_r()[r.index(5, 5)] == 4.0  &&  r.eps_r()[r.index(7, 7)] == 1.0;
+
+    TestResult  t;
+    t.name  = "R2 --- higher z paints on top;  remove_shape rebuilds just its cells";
+    t.pass  = top && local && back;
+    if (!t.pass)    { t.note = std::string("z-order=") + (top ? "ok" : "FAIL") + " incremental=" + (local ? "ok" : "FAIL")
+                             + " restored=" + (back ? "ok" : "FAIL"); }
+    return t;
+}
+
+
+//  "test_r3_sources"
+//
+[[nodiscard]] inline TestResult test_r3_sources()
+{
+    Raster      r       (raster_grid_10x10());
+    r.set_source(1, raster_rect(1, 1, 3, 3), true, fdtd::PointSource<double>{});
+    r.set_source(2, { {0.5, 8.5}, {3.5, 8.5} }, false, fdtd::PointSource<double>{});
+    r.rebuild();
+
+    std::size_t     in_area = 0,    on_line = 0;
+    for (const auto & src : r.sources())
+    {
+        const std::size_t   m   = src.cell / 10,    n   = src.cell % 10;
+        if (m >= 1 && m < 3 && n >= 1 && n < 3)     { ++in_area; }
+        if (m <= 3 && n == 8)                       { ++on_line; }
+    }
+
+    TestResult  t;
+    t.name  = "R3 --- closed source drives its 2 x 2 cells, open polyline the 4 cells it crosses";
+    t.pass  = r.sources().size() == 8 && in_area == 4 && on_line == 4;
+    if (!t.pass)    { t.note = "sources=" + std::to_string(r.sources().size()) + " area=" + std::to_string(in_area)
+                             + " line=" + std::to_string(on_line); }
+    return t;
+}
+
+
+//  "test_r4_apply_to_engine"
+//
+[[nodiscard]] inline TestResult test_r4_apply_to_engine()
+{
+    using           Engine  = fdtd::FDTD_2D<double>;
+    Raster          r       (raster_grid_10x10());
+    Engine          E       (10, 10, Engine::ms_SC_MAX, 1);
+    r.set_shape(1, 0, raster_rect(2, 3, 6, 7), RasterMat{4.0});
+    r.set_source(2, { {8.5, 8.5} }, false, fdtd::PointSource<double>{});
+    r.apply(E, true);
+
+    const auto      in      = fdtd::make_coefficients(RasterMat{4.0}, E.Sc());
+    const auto      out     = fdtd::make_coefficients(RasterMat{},    E.Sc());
+    const auto      ceh     = E.coefficient(Engine::CEH);
+    const bool      coeffs  = ceh[E.index(3, 4)] == in.ce_h  &&  ceh[E.index(0, 0)] == out.ce_h;
+    const bool      srcs    = E.sources().size() == 1  &&  E.sources()[0].cell == E.index(8, 8);
+
+    TestResult      t;
+    t.name  = "R4 --- apply() writes material coefficients and sources into an FDTD_2D";
+    t.pass  = coeffs && srcs;
+    if (!t.pass)    { t.note = std::string("coefficients=") + (coeffs ? "ok" : "FAIL") + " sources=" + (srcs ? "ok" : "FAIL"); }
+    return t;
+}
+
+
+//  "draw_rasterizer_tests"
+//
+inline void draw_rasterizer_tests()
+{
+    static bool                     s_ran   = false;
+    static std::vector<TestResult>  s_results;
+
+    if (!s_ran) {
+        s_results = {
+              test_r0_square()
+            , test_r1_partial_coverage()
+            , test_r2_z_order_and_remove()
+            , test_r3_sources()
+            , test_r4_apply_to_engine()
+        };
+        s_ran = true;
+    }
+
+    int passed = 0;
+    for (const auto & r : s_results) { if (r.pass) ++passed; }
+
+    ImGui::SeparatorText("Unit-Testing for \"SceneRasterizer\" | R0---R4 (cached)");
+    ImGui::Text("Passed %d / %d", passed, (int)s_results.size());
+
+    if (ImGui::BeginTable("raster_tests_tbl", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn("Test");
+        ImGui::TableSetupColumn("Result");
+        ImGui::TableSetupColumn("Note");
+        ImGui::TableHeadersRow();
+
+        for (const auto & r : s_results) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);      ImGui::TextUnformatted(r.name);
+            ImGui::TableSetColumnIndex(1);      ImGui::TextUnformatted(r.pass ? "PASS" : "FAIL");
+            ImGui::TableSetColumnIndex(2);
+            if (!r.note.empty())    { ImGui::TextUnformatted(r.note.c_str()); }
+        }
+        ImGui::EndTable();
+    }
+}
+
+
+
+
+// *************************************************************************** //
+//      "tests" |    ORCHID UNDO HISTORY.
+// *************************************************************************** //
+
+using       History         = cblib::containers::Orchid;
+
+
+//  "BlobAction"            No-op edit that reports "bytes" against the memory budget.
+struct BlobAction : cblib::containers::orchid::ABC
+{
+    explicit BlobAction(std::size_t bytes_) : bytes(bytes_)   {   }
+    void                undo        (void)  noexcept override           {   }
+    void                redo        (void)  noexcept override           {   }
+    std::string_view    label       (void)  const noexcept override     { return "Blob";        }
+    std::size_t         byte_size   (void)  const noexcept override     { return bytes;         }
+    std::size_t         bytes;
+};
+
+//  "OffsetAction"          The action base is NOT the first base, so its address differs from the object's:  the
+//                          pool must still get back the most-derived pointer.  Counts live instances;  a block handed
+//                          back at the wrong address overlaps its neighbour and shows up as a clobbered "pad".
+struct OffsetPad { std::uint64_t pad [3] = { 1, 2, 3 };  virtual ~OffsetPad() = default; };
+struct OffsetAction : OffsetPad, cblib::containers::orchid::ABC
+{
+    explicit OffsetAction(int & live_) : live(live_)      { ++live; }
+    ~OffsetAction() override                            { --live;  if (pad[0] != 1 || pad[1] != 2 || pad[2] != 3) { live += 1000; } }
+    void                undo        (void)  noexcept override           {   }
+    void                redo        (void)  noexcept override           {   }
+    std::string_view    label       (void)  const noexcept override     { return "Offset";      }
+    int &               live;
+};
+
+
+//  "test_o0_merge"
+//
+[[nodiscard]] inline TestResult test_o0_merge()
+{
+    int         v       = 0;
+    History     h;
+    h.set_merge_window( std::chrono::hours(1) );
+    h.emplace<IncrementAction>(v, 1);
+    h.emplace<IncrementAction>(v, 2);
+    h.emplace<IncrementAction>(v, 3);
+    const bool  one     = h.size() == 1  &&  v == 6  &&  h.stats().merged == 2;
+    h.undo();
+    const bool  undone  = v == 0  &&  !h.can_undo();
+    h.redo();
+
+    TestResult  t;
+    t.name  = "O0 --- same merge_key inside the window coalesces into one undo step";
+    t.pass  = one && undone && v == 6;
+    if (!t.pass)    { t.note = "size=" + std::to_string(h.size()) + " value=" + std::to_string(v)
+                             + " merged=" + std::to_string(h.stats().merged); }
+    return t;
+}
+
+
+//  "test_o1_merge_boundaries"
+//
+[[nodiscard]] inline TestResult test_o1_merge_boundaries()
+{
+    int         v       = 0;
+    bool        f       = false;
+    History     h;
+    h.set_merge_window( std::chrono::hours(1) );
+    h.emplace<IncrementAction>(v, 1);
+    h.seal();
+    h.emplace<IncrementAction>(v, 1);                   //  Sealed:         new step.
+    h.emplace<ToggleFlagAction>(f);                     //  Key 0:          never merges.
+    h.emplace<IncrementAction>(v, 1);                   //  Different top:  new step.
+    const bool  split   = h.size() == 4;
+
+    History     g;
+    g.set_merge_window( std::chrono::hours(0) );        //  Zero window disables merging.
+    g.emplace<IncrementAction>(v, 1);
+    g.emplace<IncrementAction>(v, 1);
+    const bool  off     = g.size() == 2;
+
+    TestResult  t;
+    t.name  = "O1 --- seal(), key 0, another key on top and a zero window all start a new step";
+    t.pass  = split && off;
+    if (!t.pass)    { t.note = "sealed history=" + std::to_string(h.size()) + " (want 4),  zero window=" + std::to_string(g.size()) + " (want 2)"; }
+    return t;
+}
+
+
+//  "test_o2_entry_budget"
+//
+[[nodiscard]] inline TestResult test_o2_entry_budget()
+{
+    bool        f       = false;
+    History     h;
+    h.set_budget({ 4, std::size_t(1) << 30 });
+    for (int i = 0; i < 10; ++i)    { h.emplace<ToggleFlagAction>(f); }
+    std::size_t undos   = 0;
+    while ( h.can_undo() )          { h.undo();  ++undos; }
+
+    TestResult  t;
+    t.name  = "O2 --- max_entries evicts the oldest steps;  the newest stay undoable";
+    t.pass  = h.size() == 4  &&  undos == 4  &&  h.stats().evicted == 6  &&  f == false;
+    if (!t.pass)    { t.note = "size=" + std::to_string(h.size()) + " undos=" + std::to_string(undos)
+                             + " evicted=" + std::to_string(h.stats().evicted); }
+    return t;
+}
+
+
+//  "test_o3_byte_budget"
+//
+[[nodiscard]] inline TestResult test_o3_byte_budget()
+{
+    History     h;
+    h.set_budget({ 4096, 3000 });
+    for (int i = 0; i < 8; ++i)     { h.emplace<BlobAction>(1000); }
+    const bool  capped  = h.size() == 3  &&  h.stats().bytes_held == 3000  &&  h.stats().evicted == 5;
+    h.emplace<BlobAction>(10000);                       //  Larger than the whole budget:  kept alone.
+    const bool  newest  = h.size() == 1  &&  h.stats().bytes_held == 10000;
+
+    TestResult  t;
+    t.name  = "O3 --- max_bytes evicts by byte_size();  the newest entry is always kept";
+    t.pass  = capped && newest;
+    if (!t.pass)    { t.note = "size=" + std::to_string(h.size()) + " bytes=" + std::to_string(h.stats().bytes_held)
+                             + " evicted=" + std::to_string(h.stats().evicted); }
+    return t;
+}
+
+
+//  "test_o4_pooled_lifetime"
+//
+[[nodiscard]] inline TestResult test_o4_pooled_lifetime()
+{
+    int             live    = 0;
+    std::size_t     pooled  = 0;
+    {
+        History     h;
+        h.set_budget({ 8, std::size_t(1) << 30 });
+        for (int i = 0; i < 64; ++i)    { h.emplace<OffsetAction>(live); }     //  Evictions recycle pool blocks.
+        pooled      = h.stats().pooled;
+    }
+
+    TestResult  t;
+    t.name  = "O4 --- pooled actions with a non-first action base are destroyed and freed exactly once";
+    t.pass  = live == 0  &&  pooled == 8;
+    if (!t.pass)    { t.note = "live after destruction=" + std::to_string(live) + " pooled=" + std::to_string(pooled); }
+    return t;
+}
+
+
+//  "draw_orchid_history_tests"
+//
+inline void draw_orchid_history_tests()
+{
+    static bool                     s_ran   = false;
+    static std::vector<TestResult>  s_results;
+
+    if (!s_ran) {
+        s_results = {
+              test_o0_merge()
+            , test_o1_merge_boundaries()
+            , test_o2_entry_budget()
+            , test_o3_byte_budget()
+            , test_o4_pooled_lifetime()
+        };
+        s_ran = true;
+    }
+
+    int passed = 0;
+    for (const auto & r : s_results) { if (r.pass) ++passed; }
+
+    ImGui::SeparatorText("Unit-Testing for \"Orchid\" History | O0---O4 (cached)");
+    ImGui::Text("Passed %d / %d", passed, (int)s_results.size());
+
+    if (ImGui::BeginTable("orchid_tests_tbl", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn("Test");
+        ImGui::TableSetupColumn("Result");
+        ImGui::TableSetupColumn("Note");
+        ImGui::TableHeadersRow();
+
+        for (const auto & r : s_results) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);      ImGui::TextUnformatted(r.name);
+            ImGui::TableSetColumnIndex(1);      ImGui::TextUnformatted(r.pass ? "PASS" : "FAIL");
+            ImGui::TableSetColumnIndex(2);
+            if (!r.note.empty())    { ImGui::TextUnformatted(r.note.c_str()); }
+        }
+        ImGui::EndTable();
+    }
+}
+
+
+
+
 //
 // *************************************************************************** //
 // *************************************************************************** //   END [ 1.1.  "FUNCTIONS" ].
@@ -763,6 +1203,46 @@ void CBDebugger::TestndRingBuffer(void) noexcept
     
     
     
+    return;
+}
+
+
+//  "TestFDTDRasterizer"
+//
+void CBDebugger::TestFDTDRasterizer(void) noexcept
+{
+    static bool     gate            = false;
+    
+    if (!gate)
+    {
+        if ( ImGui::Button("Perform \"SceneRasterizer\" Unit-Tests") ) {
+            gate    = true;
+        }
+    }
+    else {
+        tests::draw_rasterizer_tests();
+    }
+    
+    return;
+}
+
+
+//  "TestOrchidHistory"
+//
+void CBDebugger::TestOrchidHistory(void) noexcept
+{
+    static bool     gate            = false;
+    
+    if (!gate)
+    {
+        if ( ImGui::Button("Perform \"Orchid\" History Unit-Tests") ) {
+            gate    = true;
+        }
+    }
+    else {
+        tests::draw_orchid_history_tests();
+    }
+    
     return;
 }
 
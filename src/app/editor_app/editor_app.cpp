@@ -9,6 +9,7 @@
 **************************************************************************************
 **************************************************************************************/
 #include "app/editor_app/editor_app.h"
+#include <cmath>
 
 
 
@@ -40,6 +41,13 @@ EditorApp::~EditorApp(void)     { this->destroy(); }
 //
 void EditorApp::destroy(void)
 {
+    //  A 2D run may still be queued or stepping on the scheduler.  Claim its ticket:  if the task has not started it
+    //  never will;  if it has, abandon it and wait, since it writes into "m_fdtd".
+    FDTDRun &       R           = this->m_fdtd;
+    R.token.cancel();
+    if ( !R.ticket )        { return; }
+    if ( R.ticket->claimed.exchange(true, std::memory_order_acq_rel) )  { R.ticket->done.wait(false, std::memory_order_acquire); }
+    else                                                                { R.ticket->done.store(true, std::memory_order_release); }
     return;
 }
 
@@ -208,6 +216,98 @@ void EditorApp::display_plots(void)
 void EditorApp::display_controls(void)
 {
     m_editor.DrawBrowser();
+    
+    ImGui::SetNextItemOpen(false, ImGuiCond_Once);
+    if ( ImGui::CollapsingHeader("FDTD (2D TMz)") ) {
+        this->display_fdtd();
+    }
+    return;
+}
+
+
+//  "display_fdtd"
+//      Rasterize the drawn Dielectric / Source paths into an "FDTD_2D" and run it for "steps" time-steps on the
+//      task scheduler.     The scene is synced on the UI thread (it reads the editor);  only the stepping is off-thread,
+//      and nothing touches the engine until the run's ticket is "done".
+//
+void EditorApp::display_fdtd(void)
+{
+    FDTDRun &       R           = this->m_fdtd;
+    const bool      busy        = R.ticket  &&  !R.ticket->done.load(std::memory_order_acquire);
+
+
+    //  1.  SETTINGS...
+    ImGui::BeginDisabled(busy);
+        ImGui::SetNextItemWidth( 0.5f * ImGui::GetContentRegionAvail().x );
+        ImGui::InputDouble("Cell Size##EditorFDTD",     &R.cell,    1.0, 4.0, "%.2f");
+        ImGui::SetNextItemWidth( 0.5f * ImGui::GetContentRegionAvail().x );
+        ImGui::SliderInt("Time-Steps##EditorFDTD",      &R.steps,   1, 5000, "%d", ImGuiSliderFlags_AlwaysClamp);
+        R.cell      = std::max(R.cell, 0.25);
+    
+    
+        //  2.  RUN:    (re)build the engine when the grid changed, push the scene, step in the background...
+        if ( ImGui::Button("Run##EditorFDTD") )
+        {
+            const fdtd::RasterGrid      grid        = this->m_editor.FDTDGrid(R.cell);
+            const bool                  regrid      = !R.scene  ||  R.scene->grid().nx != grid.nx  ||  R.scene->grid().ny != grid.ny
+                                                      ||  R.scene->grid().h != grid.h;
+            if (regrid) {
+                R.scene     = std::make_unique< fdtd::SceneRasterizer<double> >(grid);
+                R.engine    = std::make_unique< fdtd::FDTD_2D<double> >(grid.nx, grid.ny, grid.Sc);
+            }
+            this->m_editor.SyncFDTDScene(*R.scene);
+            R.scene->apply(*R.engine, regrid);
+            R.engine->reset();
+            
+            cb::utl::TaskScheduler &    sched       = cb::utl::TaskScheduler::instance();
+            R.token                     = sched.make_token();
+            R.ticket                    = std::make_shared<FDTDRun::Ticket>();
+            sched.submit( [&R, ticket = R.ticket, token = R.token, NT = static_cast<std::size_t>(R.steps)]()
+            {
+                if ( ticket->claimed.exchange(true, std::memory_order_acq_rel) )    { return; }    //  Discarded by "destroy".
+                struct Done {                   //  Cleared on every path out, including an exception from "step".
+                    FDTDRun::Ticket &   t;
+                    ~Done(void)         { t.done.store(true, std::memory_order_release);  t.done.notify_all(); }
+                }                   done    { *ticket };
+
+                for (std::size_t q = 0ULL; q < NT && !token.cancelled(); ++q)   { R.engine->step(); }
+                //  Snapshot in image order (row = y, top row first) so the heatmap lines up with the canvas.
+                const auto          Ez      = std::as_const(*R.engine).Ez();
+                const std::size_t   nx      = R.engine->nx(),       ny      = R.engine->ny();
+                R.Ez.assign(nx * ny, 0.0);
+                R.Ez_max            = 0.0;
+                for (std::size_t m = 0ULL; m < nx; ++m)
+                    for (std::size_t n = 0ULL; n < ny; ++n) {
+                        const double    v   = Ez[ R.engine->index(m, n) ];
+                        R.Ez[ (ny - 1ULL - n) * nx + m ]    = v;
+                        R.Ez_max            = std::max(R.Ez_max, std::abs(v));
+                    }
+            }, cb::utl::TaskPriority::Low, R.token );
+        }
+    ImGui::EndDisabled();
+
+
+    //  3.  STATUS  +  |Ez|  HEATMAP OF THE LAST RUN...
+    if ( !R.scene )         { ImGui::TextDisabled("Not run yet.");      return; }
+    
+    const fdtd::RasterGrid &    grid        = R.scene->grid();
+    ImGui::SameLine();
+    ImGui::Text("%zu x %zu cells  |  %zu sources", grid.nx, grid.ny, R.scene->sources().size());
+    if (busy)               { ImGui::TextUnformatted("Running...");     return; }
+    if ( R.Ez.size() != grid.nx * grid.ny )     { return; }
+    
+    ImGui::Text("step %zu  |  max |Ez| = %.4g", R.engine->step_count(), R.Ez_max);
+    if ( ImPlot::BeginPlot("##EditorFDTD_Ez", ImVec2(-1, ImGui::GetContentRegionAvail().x), ImPlotFlags_NoLegend | ImPlotFlags_Equal) )
+    {
+        const double    lim     = (R.Ez_max > 0.0) ? R.Ez_max : 1.0;
+        ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_NoDecorations);
+        ImPlot::PushColormap(ImPlotColormap_RdBu);
+        ImPlot::PlotHeatmap("Ez", R.Ez.data(), static_cast<int>(grid.ny), static_cast<int>(grid.nx), -lim, lim, nullptr,
+                            ImPlotPoint(grid.x0, grid.y0),
+                            ImPlotPoint(grid.x0 + grid.h * static_cast<double>(grid.nx), grid.y0 + grid.h * static_cast<double>(grid.ny)));
+        ImPlot::PopColormap();
+        ImPlot::EndPlot();
+    }
     return;
 }
 
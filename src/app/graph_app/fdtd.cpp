@@ -62,10 +62,10 @@ using                           value_type                      = GraphApp::valu
 
 //  "InitializeData"
 //
-void InitializeData([[maybe_unused]] std::atomic<bool> & flag, [[maybe_unused]] FDTD_t & model)
+void InitializeData([[maybe_unused]] std::atomic<bool> & flag, [[maybe_unused]] FDTD_t & model, const cb::utl::CancelToken & token)
 {
-    model.run();
-    flag.store(true, std::memory_order_release);
+    if ( model.run( [&token]{ return token.cancelled(); } ) )
+        { flag.store(true, std::memory_order_release); }
     return;
 }
 
@@ -74,10 +74,15 @@ void InitializeData([[maybe_unused]] std::atomic<bool> & flag, [[maybe_unused]]
 //
 void GraphApp::StartDataInitAsync(void)
 {
-    std::thread([this]()
+    this->ms_model.set_frame_sink( fdtd::make_frame_sink<value_type>(this->m_frame_sink_cfg) );
+    
+    cb::utl::TaskScheduler &    sched       = cb::utl::TaskScheduler::instance();
+    cb::utl::CancelToken        token       = sched.make_token();       //  Fires at shutdown, abandoning the run.
+    
+    sched.submit( [this, token]()
     {
-        InitializeData( data_ready, this->ms_model );
-    }).detach();
+        InitializeData( data_ready, this->ms_model, token );
+    }, cb::utl::TaskPriority::Low, token );
     
     return;
 }
@@ -145,12 +150,18 @@ void GraphApp::ShowPlayback(void)
         
         static re_array                 ms_perm_E           = cblib::math::make_real_vector( ms_model.get_eps_r() );
         static re_array                 ms_frequencies      = ms_model.get_fourier_freqs();
-        static re_frame &               ms_Ez_T_data        = *ms_model.get_E_time_data();
-        static re_frame &               ms_Ez_F_data        = *ms_model.get_E_freq_data();
+        const FDTD_t::sink_t &          sink                = ms_model.get_sink();
         
         static float                    perm_lims [2]       = {1.0, 16.0f};
+        
+        //      Nothing retained (e.g. an empty ring): nothing to draw.
+        if ( sink.empty() )     { return; }
+        
+        //      The sink decides how many frames exist;  clamp the slider to it.
+        m_playback.frame.limits.max     = static_cast<ImU64>( sink.size() - 1ULL );
+        m_playback.frame.value          = std::min( m_playback.frame.value, m_playback.frame.limits.max );
 
-        if (m_playback.playing && delta >= 1.0 / m_playback.fps) {
+        if (m_playback.playing && delta >= 1.0 / m_playback.fps && m_playback.frame.limits.max > 0) {
             m_playback.frame.value      = (m_playback.frame.value + 1) % m_playback.frame.limits.max;
             m_playback.last_time        = now;
         }
@@ -186,8 +197,8 @@ void GraphApp::ShowPlayback(void)
                 ImPlot::SetNextLineStyle( ET_COLOR,      3.0);
                 ImPlot::PlotLine(
                     ET_PLOT_LABEL.c_str(),
-                    &ms_Ez_T_data[ m_playback.frame.value ][0],
-                    NX,
+                    sink.Ez_T( m_playback.frame.value ),
+                    static_cast<int>( sink.nx() ),
                     1.0,
                     0.0,
                     ImPlotLineFlags_None);
@@ -217,11 +228,11 @@ void GraphApp::ShowPlayback(void)
                 ImPlot::SetupAxisLimits(ImAxis_Y1, 0.00f, 1.10f, ImGuiCond_Once);
                 ImPlot::SetNextFillStyle(EF_COLOR, 0.4f);
                 ImPlot::SetNextLineStyle(EF_COLOR, 3.0f);
-                const int M = static_cast<int>(ms_frequencies.size());
+                const int M = static_cast<int>( std::min(ms_frequencies.size(), sink.bins()) );
                 ImPlot::PlotLine(
                     EF_PLOT_LABEL.c_str(),
                     ms_frequencies.data(),
-                    ms_Ez_F_data[m_playback.frame.value].data(),
+                    sink.Ez_F( m_playback.frame.value ),
                     M);
                 ImPlot::EndPlot();
             }
@@ -733,6 +733,56 @@ void GraphApp::init_ctrl_rows(void)
             //
             ImGui::EndDisabled();
         }
+        }, // END ROW.
+    //
+        {"Frame Sink",                      [this]
+        {
+            fdtd::FrameSinkCFG &    cfg         = this->m_frame_sink_cfg;
+            int                     type        = static_cast<int>( cfg.type );
+            ImU64                   param       = static_cast<ImU64>( cfg.param );
+            constexpr ImU64         PARAM_MIN   = 1ULL;
+            constexpr ImU64         PARAM_MAX   = static_cast<ImU64>( NT );
+            const bool              has_param   = ( cfg.type != fdtd::FrameSinkType::KeepAll );
+
+            //  WIDGET 1.  SINK TYPE  +  STRIDE / CAPACITY...
+            ImGui::SetNextItemWidth( 0.40f * ImGui::GetColumnWidth() );
+            if ( ImGui::Combo("##FDTD_FrameSinkType", &type, fdtd::DEF_FRAME_SINK_TYPE_NAMES.data(),
+                              static_cast<int>(fdtd::FrameSinkType::COUNT)) )
+                { cfg.type = static_cast<fdtd::FrameSinkType>( type ); }
+
+            ImGui::SameLine(0.0f, pad);
+            ImGui::BeginDisabled( !has_param );
+                ImGui::SetNextItemWidth( 0.30f * ImGui::GetColumnWidth() );
+                if ( ImGui::SliderScalar("##FDTD_FrameSinkParam",   ImGuiDataType_U64,  &param,  &PARAM_MIN,  &PARAM_MAX,
+                                         (cfg.type == fdtd::FrameSinkType::Ring) ? "%llu frames" : "every %llu", SLIDER_FLAGS) )
+                    { cfg.param = static_cast<std::size_t>( std::clamp(param, PARAM_MIN, PARAM_MAX) ); }
+            ImGui::EndDisabled();
+
+            ImGui::SameLine(0.0f, pad);
+            ImGui::Checkbox("Hy##FDTD_FrameSinkKeepH", &cfg.keep_H);
+
+            //  WIDGET 2.  RE-RUN WITH THE NEW SINK  (only once the previous run has finished)...
+            ImGui::SameLine(0.0f, pad);
+            ImGui::BeginDisabled( !m_playback.ready );
+                if ( ImGui::Button("Apply", ImVec2(ImGui::GetContentRegionAvail().x - pad, 0)) )
+                {
+                    m_playback.playing          = false;
+                    m_playback.frame.value      = 0;
+                    this->data_ready.store(false, std::memory_order_release);
+                    this->StartDataInitAsync();
+                }
+            ImGui::EndDisabled();
+        }
+        }, // END ROW.
+    //
+        {"Frame Storage",                   [this]
+        {
+            //  WIDGET 1.  READ-ONLY SUMMARY OF THE FRAME SINK...
+            if ( !m_playback.ready )    { ImGui::TextDisabled("-");     return; }
+            const auto &    sink    = this->ms_model.get_sink();
+            ImGui::Text("%s  |  %zu frames  |  %.2f MiB",
+                        sink.name(), sink.size(), static_cast<double>(sink.bytes()) / (1024.0 * 1024.0));
+        }
         } // END ROW.
     //
     //
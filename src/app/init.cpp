@@ -619,6 +619,11 @@ App::~App(void)
 void App::destroy(void)
 {
     S.log_shutdown_info();
+    
+    
+    
+    //      0.      STOP BACKGROUND WORK  (cancel tokened tasks, finish queued saves, join workers)...
+    cb::utl::TaskScheduler::instance().shutdown();
 
 
 
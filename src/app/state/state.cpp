@@ -61,6 +61,9 @@ AppState::AppState(void)
     this->m_LogLevel    = LogLevel::Warning;
 # endif     //  __CBLIB_RELEASE_WITH_DEBUG_INFO__ || __CBAPP_DEBUG__  //
     this->m_logger.set_level(this->m_LogLevel);
+# ifdef CBAPP_LOG_BINARY_SINK
+    this->m_logger.open_binary_sink( CBAPP_LOG_BINARY_SINK );
+# endif     //  CBAPP_LOG_BINARY_SINK  //
   
   
     
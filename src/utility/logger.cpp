@@ -22,14 +22,12 @@ namespace cb { namespace utl { //     BEGINNING NAMESPACE "cb" :: "utl"...
 // *************************************************************************** //
 // *************************************************************************** //
 
-static void append_indent(std::ostream& os, std::size_t n) { os << std::string(n, ' '); }
+static void append_indent(std::string & out, std::size_t n) { out.append(n, ' '); }
 
-static std::string tid_hex(std::thread::id tid)
-{
-    std::ostringstream s;
-    s << std::hex << std::uppercase << std::hash<std::thread::id>{}(tid);
-    return s.str();
-}
+//  "put_pod"
+//      Raw little-endian (native) field for the binary sink.
+template< typename T >
+static void put_pod(std::ofstream & os, const T & v) { os.write(reinterpret_cast<const char *>(&v), sizeof(T)); }
 
 
 
@@ -91,49 +89,43 @@ Logger::~Logger(void) {
 //  "log"
 //
 void Logger::log(const char * msg,          Level lvl)          { enqueue(msg, lvl); }
-void Logger::log(const std::string & msg,   Level lvl)          { enqueue(msg.c_str(), lvl); }
-
-
-//  "debug"
-//
-void Logger::debug(const char * msg)                            { enqueue(msg,          Level::Debug);      }
-void Logger::debug(const std::string & msg)                     { enqueue(msg.c_str(),  Level::Debug);      }
+void Logger::log(const std::string & msg,   Level lvl)          { enqueue(msg, lvl); }
 
 
 //  "info"
 //
 void Logger::info(const char * msg)                             { enqueue(msg,          Level::Info);       }
-void Logger::info(const std::string & msg)                      { enqueue(msg.c_str(),  Level::Info);       }
+void Logger::info(const std::string & msg)                      { enqueue(msg,          Level::Info);       }
 
 
 //  "warning"
 //
 void Logger::warning(const char * msg)                          { enqueue(msg,          Level::Warning);    }
-void Logger::warning(const std::string & msg)                   { enqueue(msg.c_str(),  Level::Warning);    }
+void Logger::warning(const std::string & msg)                   { enqueue(msg,          Level::Warning);    }
 
 
 //  "exception"
 //
 void Logger::exception(const char * msg)                        { enqueue(msg,          Level::Exception);  }
-void Logger::exception(const std::string & msg)                 { enqueue(msg.c_str(),  Level::Exception);  }
+void Logger::exception(const std::string & msg)                 { enqueue(msg,          Level::Exception);  }
 
 
 //  "error"
 //
 void Logger::error(const char * msg)                            { enqueue(msg,          Level::Error);      }
-void Logger::error(const std::string & msg)                     { enqueue(msg.c_str(),  Level::Error);      }
+void Logger::error(const std::string & msg)                     { enqueue(msg,          Level::Error);      }
 
 
 //  "notify"
 //
 void Logger::notify(const char * msg)                           { enqueue(msg,          Level::Notify);   }
-void Logger::notify(const std::string & msg)                    { enqueue(msg.c_str(),  Level::Notify);   }
+void Logger::notify(const std::string & msg)                    { enqueue(msg,          Level::Notify);   }
 
 
 //  "critical"
 //
 void Logger::critical(const char * msg)                         { enqueue(msg,          Level::Critical);   }
-void Logger::critical(const std::string & msg)                  { enqueue(msg.c_str(),  Level::Critical);   }
+void Logger::critical(const std::string & msg)                  { enqueue(msg,          Level::Critical);   }
 
 
 
@@ -148,7 +140,7 @@ void Logger::critical(const std::string & msg)                  { enqueue(msg.c_
 // *************************************************************************** //
 
 //  "set_level"
-void  Logger::set_level(const Level & level)                    { this->m_threshold = level; }
+void  Logger::set_level(const Level & level)                    { this->m_threshold.store(level, std::memory_order_relaxed); }
 
 //  "set_console_format"
 void Logger::set_console_format(ConsoleFormat fmt)              { m_console_fmt = fmt; }
@@ -167,6 +159,47 @@ Logger::ConsoleFormat Logger::get_console_format(void) const    { return m_conso
 //  "get_path_depth"
 std::size_t Logger::get_path_depth(void) const                  { return m_path_depth; }
 
+//  "get_dropped"
+std::size_t Logger::get_dropped(void) const                     { return m_dropped.load(std::memory_order_relaxed); }
+
+//  "has_binary_sink"
+bool Logger::has_binary_sink(void) const                        { return m_bin_open.load(std::memory_order_acquire); }
+
+
+//  "open_binary_sink"
+//      File layout (native byte-order):
+//          header:     char[8] "CBLOGBIN",  u32 version,  u32 reserved.
+//          'S' record: u32 id,  u32 length,  bytes.                                --  defines a file / func string.
+//          'E' record: i32 level,  u64 count,  i64 ts_ns,  u64 thread,  u32 file-id,  u32 func-id,  i32 line,
+//                      u32 length,  bytes.                                         --  one log record (id 0 = none).
+//
+bool Logger::open_binary_sink(const std::filesystem::path & path)
+{
+    std::lock_guard<std::mutex>     lock    (m_bin_mtx);
+    if ( m_bin.is_open() )          { m_bin.close(); }
+    m_bin_strings.clear();
+
+    m_bin.open(path, std::ios::binary | std::ios::trunc);
+    if ( !m_bin )                   { m_bin_open.store(false, std::memory_order_release);  return false; }
+
+    m_bin.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    put_pod(m_bin, BINARY_VERSION);
+    put_pod(m_bin, std::uint32_t{0});
+    m_bin_open.store(true, std::memory_order_release);
+    return true;
+}
+
+
+//  "close_binary_sink"
+void Logger::close_binary_sink(void)
+{
+    std::lock_guard<std::mutex>     lock    (m_bin_mtx);
+    m_bin_open.store(false, std::memory_order_release);
+    if ( m_bin.is_open() )          { m_bin.flush();  m_bin.close(); }
+    m_bin_strings.clear();
+    return;
+}
+
 
 
 // *************************************************************************** //
@@ -184,34 +217,54 @@ std::size_t Logger::get_path_depth(void) const                  { return m_path_
 //
 void Logger::enqueue(const char * msg, Level lvl)
 {
-    this->enqueue_event(LogEvent{
-          lvl
-        , msg
-        , this->next_count(lvl)
-        , /*file=*/ nullptr
-        , /*line=*/ 0
-        , /*func=*/ nullptr
-        , std::this_thread::get_id()
-        , iso_timestamp()
-    });
-    
+    if ( !msg || !this->accepts(lvl) )      { return; }
+    this->record( lvl, nullptr, 0, nullptr, [msg](std::string & out) { out.append(msg); } );
     return;
 }
 
 
-//  "enqueue_event"
+//  "enqueue"
 //
-void Logger::enqueue_event(LogEvent && ev)
+void Logger::enqueue(const std::string & msg, Level lvl)
 {
-    if ( static_cast<int>(ev.level) < static_cast<int>(m_threshold) )       { return; }
+    if ( !this->accepts(lvl) )              { return; }
+    this->record( lvl, nullptr, 0, nullptr, [&msg](std::string & out) { out.append(msg); } );
+    return;
+}
 
-    std::unique_lock<std::mutex>    lock        (m_mtx);
-    
-    m_cv.wait(lock, [this]{ return m_queue.size() < QUEUE_CAPACITY; });
-    m_queue.push(std::move(ev));
-    lock.unlock();
-    m_cv.notify_one();
-    
+
+//  "local_ring"
+//      The calling thread's ring, registered on first use.  The thread-local handle marks it retired on thread exit.
+//
+Logger::ThreadRing & Logger::local_ring(void)
+{
+    struct Handle {
+        std::shared_ptr<ThreadRing>     ring;
+        ~Handle(void)   { if (ring) { ring->retired.store(true, std::memory_order_release); } }
+    };
+    static thread_local Handle      tl;
+
+    if ( !tl.ring )
+    {
+        tl.ring                 = std::make_shared<ThreadRing>();
+        tl.ring->thread_id      = std::hash<std::thread::id>{}( std::this_thread::get_id() );
+        std::lock_guard<std::mutex>     lock    (m_mtx);
+        m_rings.push_back(tl.ring);
+    }
+    return *tl.ring;
+}
+
+
+//  "wake_worker"
+//      Only reached for errors or a filling ring while the worker is parked, so routine records cost no syscalls.
+//
+void Logger::wake_worker(void)
+{
+    if ( m_sleeping.exchange(false, std::memory_order_acq_rel) )
+    {
+        { std::lock_guard<std::mutex> lock(m_mtx); }
+        m_cv.notify_one();
+    }
     return;
 }
 
@@ -221,35 +274,13 @@ void Logger::enqueue_event(LogEvent && ev)
 void Logger::start_worker(void)
 {
     m_running   = true;
-    m_worker    = std::thread( [this]
-        {
-            std::unique_lock<std::mutex>    lock    (m_mtx);
-            
-            while ( m_running || !m_queue.empty() )     //  while #1.
-            {
-                m_cv.wait(lock, [this]{ return !m_queue.empty() || !m_running; });
-                while ( !m_queue.empty() )                  //  while #2.
-                {
-                    LogEvent    ev = std::move(m_queue.front());
-                    m_queue.pop();
-                    lock.unlock();
-                    write_event(ev);
-                    lock.lock();
-                    m_cv.notify_all();   // signal space to any waiting producers
-                    
-                }//     END "while #1".
-            //
-            }// END "while empty queue".
-        //
-        //
-        }// END LAMBDA.
-    );
-    
+    m_worker    = std::thread( [this]{ this->worker_loop(); } );
     return;
 }
 
 
 //  "stop_worker"
+//      Flushes everything still queued before joining;  later records are written synchronously.
 //
 void Logger::stop_worker(void)
 {
@@ -259,11 +290,71 @@ void Logger::stop_worker(void)
     }
     m_cv.notify_all();
     if (m_worker.joinable())    { m_worker.join(); }
+    this->close_binary_sink();
     
     return;
 }
 
 
+//  "worker_loop"
+//      Drain every ring, write the batch in timestamp order, flush once.  Parks on "m_cv" when idle for at most
+//      "PARK_MS", which bounds how long a routine record waits to be printed.
+//
+void Logger::worker_loop(void)
+{
+    std::vector<LogEvent>       batch;
+    batch.reserve(DRAIN_BATCH);
+
+    for (;;)
+    {
+        const bool      running     = m_running.load(std::memory_order_acquire);
+        if ( this->drain(batch) != 0 )      { continue; }
+        if ( !running )                     { break; }
+
+        std::unique_lock<std::mutex>    lock    (m_mtx);
+        m_sleeping.store(true, std::memory_order_release);
+        m_cv.wait_for(lock, std::chrono::milliseconds(PARK_MS), [this]{
+            return !m_sleeping.load(std::memory_order_acquire) || !m_running.load(std::memory_order_acquire); });
+        m_sleeping.store(false, std::memory_order_release);
+    }
+    return;
+}
+
+
+//  "drain"
+//      One pass over every ring;  returns how many records were written.
+//
+std::size_t Logger::drain(std::vector<LogEvent> & batch)
+{
+    std::vector< std::shared_ptr<ThreadRing> >      rings;
+    {
+        std::lock_guard<std::mutex>     lock    (m_mtx);
+        std::erase_if(m_rings, [](const std::shared_ptr<ThreadRing> & r)
+            { return r->retired.load(std::memory_order_acquire)  &&  r->ring.size() == 0; });
+        rings   = m_rings;
+    }
+
+    std::size_t     n       = 0;
+    for (const auto & r : rings)
+    {
+        if ( batch.size() < n + DRAIN_BATCH )   { batch.resize(n + DRAIN_BATCH); }
+        n  += r->ring.try_pop_many( std::span<LogEvent>(batch.data() + n, DRAIN_BATCH) );
+    }
+    if ( n == 0 )   { return 0; }
+
+    //      Per-thread order is already right;  the stable sort interleaves threads by capture time.
+    std::stable_sort(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(n),
+                     [](const LogEvent & a, const LogEvent & b) { return a.ts_ns < b.ts_ns; });
+
+    std::lock_guard<std::mutex>     lock    (m_sync_mtx);
+    for (std::size_t i = 0; i < n; ++i)     { this->write_event(batch[i]); }
+    std::cout.flush();
+    if ( m_bin_open.load(std::memory_order_acquire) )
+        { std::lock_guard<std::mutex> bl(m_bin_mtx);  if (m_bin.is_open()) { m_bin.flush(); } }
+    return n;
+}
+
+
 // ---------------------------------------------------------------------------
 // FORMATTED OUTPUT WITH HANGING-INDENT + WORD WRAP
 // ---------------------------------------------------------------------------
@@ -272,105 +363,150 @@ void Logger::stop_worker(void)
 // ---------------------------------------------------------------------------
 // Member helper: build textual header "[CBLOG LEVEL ###] : "
 // ---------------------------------------------------------------------------
-std::string Logger::build_header(const LogEvent& ev)
+void Logger::build_header(const LogEvent & ev, std::string & out) const
 {
-    std::ostringstream ss;
-    ss << '[' << HEADER << ' '
-       << std::left  << std::setw(MAX_LEVEL_LEN) << level_str(ev.level) << ' '
-       << std::right << std::setfill('0') << std::setw(COUNTER_WIDTH) << ev.count
-       << std::setfill(' ') << "]    : ";
-    return ss.str();
+    std::format_to( std::back_inserter(out), "[{} {:<{}} {:0>{}}]    : "
+                  , HEADER, level_str(ev.level), MAX_LEVEL_LEN, ev.count, COUNTER_WIDTH );
+    return;
 }
 
 // ---------------------------------------------------------------------------
-// Member helper: hanging‑indent, word‑wrapped body (writes directly to `out`)
+// Member helper: hanging‑indent, word‑wrapped body (appends to `out`)
 // ---------------------------------------------------------------------------
-void Logger::write_body(const std::string& msg, std::ostream& out, std::size_t indent_len) const
+void Logger::write_body(std::string_view msg, std::string & out, std::size_t indent_len) const
 {
-    out << BODY_OPEN_DELIM;
+    out += BODY_OPEN_DELIM;
     std::size_t col = indent_len + std::char_traits<char>::length(BODY_OPEN_DELIM);
 
-    std::ostringstream line;
-    auto flush_line = [&]{ out << line.str(); line.str({}); line.clear(); };
-    auto newline    = [&]{ flush_line(); out << '\n'; append_indent(out, indent_len); col = indent_len; };
+    auto newline    = [&]{ out += '\n'; append_indent(out, indent_len); col = indent_len; };
 
     for (std::size_t i = 0; i < msg.size();) {
         if (msg[i] == '\n') { newline(); ++i; continue; }
         std::size_t word_end = msg.find_first_of(" \n", i);
-        if (word_end == std::string::npos) word_end = msg.size();
-        std::string_view word(&msg[i], word_end - i);
+        if (word_end == std::string_view::npos) word_end = msg.size();
+        std::string_view word = msg.substr(i, word_end - i);
 
         if (col > indent_len && col + word.size() + 1 > MAX_COL_WIDTH) newline();
-        if (col > indent_len) { line << ' '; ++col; }
-        line << word; col += word.size();
+        if (col > indent_len) { out += ' '; ++col; }
+        out += word; col += word.size();
         i = word_end;
         if (i < msg.size() && msg[i] == ' ') ++i; // skip single space
     }
-    flush_line();
-    out << BODY_CLOSE_DELIM;
+    out += BODY_CLOSE_DELIM;
 }
 
 // ---------------------------------------------------------------------------
 // Member helper: metadata line (file, line, func, thread, timestamp)
 // ---------------------------------------------------------------------------
-std::string Logger::build_metadata(const LogEvent & ev, std::size_t indent_len)
+void Logger::build_metadata(const LogEvent & ev, std::size_t indent_len, std::string & out) const
 {
     bool                    first   = true;
     ConsoleFormat           fmt     = m_console_fmt.load(std::memory_order_relaxed);
-    std::ostringstream      ss;
-    append_indent(ss, indent_len);
+    auto                    it      = std::back_inserter(out);
+    append_indent(out, indent_len);
     
-    ss << '(';
+    out += '(';
     if (fmt & CF_THREAD_ID) {                                       //  1.  Thread ID.
-        if (!first) ss << ' ';
-        ss << "thread: 0x" << tid_hex(ev.thread_id) << ".";
+        if (!first) out += ' ';
+        std::format_to(it, "thread: 0x{:X}.", ev.thread_id);
         first = false;
     }
     
     if ((fmt & CF_FUNCTION) && ev.func) {                           //  2.  Function-Name.
-        if (!first) ss << ' ';
-        ss << "func: " << ev.func << ".";
+        if (!first) out += ' ';
+        std::format_to(it, "func: {}.", ev.func);
         first = false;
     }
     
     if ((fmt & CF_FILE) && ev.file) {                               //  3.  Filename.
-        if (!first) ss << ' ';
-        ss << "file: " << path_tail(ev.file, m_path_depth) << ".";
+        if (!first) out += ' ';
+        std::format_to(it, "file: {}.", path_tail(ev.file, m_path_depth));
         first = false;
     }
     
     if ((fmt & CF_LINE) && ev.file) {                               //  4.  Line Number.
-        if (!first) ss << ' ';
-        ss << "line: " << ev.line << ".";
+        if (!first) out += ' ';
+        std::format_to(it, "line: {}.", ev.line);
     }
     
     if (fmt & CF_TIMESTAMP) {                                       //  5.  Time-Stamp.
-        if (!first) ss << ' ';
-        ss << ev.ts_iso8601;
+        if (!first) out += ' ';
+        iso_timestamp(out, ev.ts_ns);
         first = false;
     }
     
-    ss << ')';
-    return ss.str();
+    out += ')';
+    return;
 }
 
 // ---------------------------------------------------------------------------
 // Public sink: write_event – orchestrates helpers
 // ---------------------------------------------------------------------------
+//      Caller holds "m_sync_mtx";  the caller flushes.
 void Logger::write_event(const LogEvent & ev)
 {
     const bool          color       = m_vt_enabled.load(std::memory_order_relaxed);
-    const char *        prefix      = color ? ansi_code(level_to_color(ev.level)) : "";
-    const char *        suffix      = color ? ansi_code(TermColor::Reset)         : "";
-    const std::string   header      = this->build_header(ev);
-    const std::size_t   indent_len  = header.size();
+    std::string &       out         = this->m_line;
+
+    out.clear();
+    if (color)          { out += ansi_code(level_to_color(ev.level)); }
+    const std::size_t   start       = out.size();
+    this->build_header(ev, out);
+    const std::size_t   indent_len  = out.size() - start;
 
-    std::ostringstream out;
-    out << header;
     this->write_body(ev.text, out, indent_len);
-    out << '\n' << this->build_metadata(ev, indent_len);
+    out += '\n';
+    this->build_metadata(ev, indent_len, out);
+    if (color)          { out += ansi_code(TermColor::Reset); }
+    out += '\n';
+
+    std::cout.write( out.data(), static_cast<std::streamsize>(out.size()) );
+    if ( m_bin_open.load(std::memory_order_acquire) )   { this->write_binary(ev); }
+    return;
+}
+
+
+//  "write_binary"
+//
+void Logger::write_binary(const LogEvent & ev)
+{
+    std::lock_guard<std::mutex>     lock    (m_bin_mtx);
+    if ( !m_bin.is_open() )         { return; }
+
+    const std::uint32_t     file_id     = this->binary_string_id(ev.file);
+    const std::uint32_t     func_id     = this->binary_string_id(ev.func);
+
+    m_bin.put('E');
+    put_pod( m_bin, static_cast<std::int32_t>(ev.level) );
+    put_pod( m_bin, static_cast<std::uint64_t>(ev.count) );
+    put_pod( m_bin, ev.ts_ns );
+    put_pod( m_bin, ev.thread_id );
+    put_pod( m_bin, file_id );
+    put_pod( m_bin, func_id );
+    put_pod( m_bin, static_cast<std::int32_t>(ev.line) );
+    put_pod( m_bin, static_cast<std::uint32_t>(ev.text.size()) );
+    m_bin.write( ev.text.data(), static_cast<std::streamsize>(ev.text.size()) );
+    return;
+}
+
 
-    std::cout << prefix << out.str() << suffix << std::endl;
+//  "binary_string_id"
+//      "file" / "func" are string literals, so their address identifies them;  each is written once as an 'S' record.
+//      Caller holds "m_bin_mtx".
+//
+std::uint32_t Logger::binary_string_id(const char * str)
+{
+    if ( !str )                     { return 0u; }
+    auto [it, inserted]     = m_bin_strings.try_emplace( str, static_cast<std::uint32_t>(m_bin_strings.size() + 1) );
+    if ( inserted )
+    {
+        const std::uint32_t     len     = static_cast<std::uint32_t>( std::char_traits<char>::length(str) );
+        m_bin.put('S');
+        put_pod(m_bin, it->second);
+        put_pod(m_bin, len);
+        m_bin.write(str, len);
+    }
+    return it->second;
 }
 
 
@@ -381,7 +517,8 @@ void Logger::write_event(const LogEvent & ev)
 // *************************************************************************** //
 //
 //
-    void Logger::enqueue(const char *, Level )      { }
+    void Logger::enqueue(const char *, Level )          { }
+    void Logger::enqueue(const std::string &, Level )   { }
 //
 //
 //
@@ -445,14 +582,14 @@ Logger::TermColor Logger::level_to_color(Level lvl)
 
 //  "path_tail"
 //
-std::string Logger::path_tail(std::string_view s, std::size_t depth) {
+std::string_view Logger::path_tail(std::string_view s, std::size_t depth) {
     // works for '/' and '\\'
     for (std::size_t i = 0; i < depth && !s.empty(); ++i) {
         auto pos = s.find_last_of("/\\");
         if (pos == std::string_view::npos) break;
         s.remove_prefix(pos + 1);
     }
-    return std::string{s};
+    return s;
 }
 
 
@@ -202,6 +202,12 @@ PyStream::~PyStream(void)
     if ( !this->m_running.compare_exchange_strong(expected, true) )     { throw std::logic_error("PyStream::start: already running"); }
 
 
+    //      0.      PRE-ALLOCATE THE RECEIVE RING OF THIS FRAMING  (the reader never allocates a queue node afterwards)...
+    this->m_bad_frames.store(0ULL);
+    if ( this->m_framing == Framing::Binary )   { this->m_frame_ring    = std::make_unique<FrameRing>(this->m_queue_capacity);   this->m_line_ring .reset(); }
+    else                                        { this->m_line_ring     = std::make_unique<LineRing >(this->m_queue_capacity);   this->m_frame_ring.reset(); }
+
+
     //      1.      SPAWN THE CHILD PROCESS...
     if ( !this->launch_process() )
     {
@@ -269,6 +275,8 @@ bool PyStream::start(void)
     if ( !this->m_running.compare_exchange_strong(expected, true) )
         { throw std::logic_error("PyStream::start: already running"); }
 
+    this->m_line_ring   = std::make_unique<LineRing>(this->m_queue_capacity);
+
 
     // Spawn child; translate “false” to a descriptive exception.
     if ( !this->launch_process() )
@@ -405,11 +413,10 @@ void PyStream::stop(void)
 //
 #endif  //  _WIN32  //
 
-    //      4.      JOIN READER & CLEAR QUEUE...
+    //      4.      JOIN READER & CLEAR QUEUE  (reader is gone:  no producer left;  high-water marks are kept)...
     if ( this->m_reader_thread.joinable() )     { this->m_reader_thread.join(); }
-
-    std::lock_guard<std::mutex>     lock    (this->m_queue_mutex);
-    this->m_recv_queue.clear();
+    if ( this->m_line_ring  )                   { this->m_line_ring ->clear(); }
+    if ( this->m_frame_ring )                   { this->m_frame_ring->clear(); }
     return;
 }
 //
@@ -442,8 +449,7 @@ void PyStream::stop(void)
     if (m_reader_thread.joinable())
         m_reader_thread.join();
 
-    std::lock_guard<std::mutex> lock(m_queue_mutex);
-    m_recv_queue.clear();
+    if (m_line_ring)    { m_line_ring->clear(); }
     return;
 }
 #endif  //  PYSTREAM_REFACTOR  //
@@ -486,30 +492,60 @@ bool PyStream::send(const std::string & msg)
     
 
 //  "try_receive"
-//      try_receive (non‑blocking)
+//      try_receive (non‑blocking, lock-free).  "out" is swapped with the ring slot (through "m_rx_line"), so re-using the
+//      same string every call recycles both buffers and a steady stream allocates nothing.  Drops the read stamp;  use
+//      "try_receive_many" to keep it.
 //
 bool PyStream::try_receive(std::string & out)
 {
-    std::lock_guard<std::mutex>     lock    (m_queue_mutex);
-    if ( m_recv_queue.empty() )     { return false; }
-    
-    out             = std::move(m_recv_queue.front());
-    m_recv_queue    .pop_front();
+    if ( !this->m_line_ring  ||  !this->m_line_ring->try_pop(this->m_rx_line) )     { return false; }
+    out.swap(this->m_rx_line.text);
     return true;
 }
 
 
+//  "try_receive_many"
+//      Batch version of "try_receive":  drains up to "out.size()" lines (text + read stamp) with a single claim on the ring.
+//
+size_t PyStream::try_receive_many(std::span<Line> out)
+{
+    return ( this->m_line_ring )    ? this->m_line_ring->try_pop_many(out)  : 0ULL;
+}
+
+
+//  "try_receive_frame"
+//      Non-blocking pop of the next binary frame  [ Framing::Binary only ].
+//      Lock-free;  "out" is assigned in place, so a caller-owned frame is reused without allocating.
+//
+bool PyStream::try_receive_frame(BinaryFrame & out)
+{
+    return ( this->m_frame_ring )   ? this->m_frame_ring->try_pop(out)  : false;
+}
+
+
+//  "try_receive_many"
+//      Batch version of "try_receive_frame".
+//
+size_t PyStream::try_receive_many(std::span<BinaryFrame> out)
+{
+    return ( this->m_frame_ring )   ? this->m_frame_ring->try_pop_many(out) : 0ULL;
+}
+
+
 //  "reader_thread_func"
 //      reader thread — blocks on stdout and pushes complete lines
 //
 void PyStream::reader_thread_func(void)
 #ifdef PYSTREAM_REFACTOR
 {
+    if ( this->m_framing == Framing::Binary )   { this->frame_reader_func();  return; }
+
     constexpr size_t            BSIZE       = PyStream::ms_READ_BUFFER_SIZE;
     static thread_local char    s_buffer    [BSIZE];
     //
     std::string                 line        = {   };        //     accumulates current line (without '\n')
     char                        ch          = '\0';
+    int64_t                     t_read      = 0;            //     "monotonic_ns" right after the last "read" returned.
 #ifdef _WIN32
     DWORD                       n           = 0;
 # else
@@ -524,6 +560,7 @@ void PyStream::reader_thread_func(void)
         const BOOL  ok      = ReadFile(m_child_stdout_r, s_buffer, static_cast<DWORD>(BSIZE), &n, nullptr);
         
         if ( !ok || n == 0 )            { break; }  //  CASE 1 :    BREAK LOOP ON EOF or ERROR...
+        t_read                          = monotonic_ns();
          
         //      2.      ITERATE THRU INPUT...
         for (DWORD i = 0; i < n; ++i)
@@ -538,7 +575,7 @@ void PyStream::reader_thread_func(void)
                 }
                 //      CASE 2.2. :     ???.
                 case '\n': {
-                    enqueue_line_(std::move(line));  line.clear();
+                    enqueue_line_(line, t_read);  line.clear();
                     break;
                 }
                 //
@@ -558,6 +595,7 @@ void PyStream::reader_thread_func(void)
         n               = ::read(this->m_child_stdout_fd, s_buffer, BSIZE);
         
         if (n <= 0)     { break; }      //  CASE 1 :    BREAK LOOP ON EOF or ERROR...
+        t_read          = monotonic_ns();
         
         //      2.      ITERATE THRU INPUT...
         for (ssize_t i = 0; i < n; ++i)
@@ -568,7 +606,7 @@ void PyStream::reader_thread_func(void)
             {
                 //      CASE 2.1. :     ???.
                 case '\n': {
-                    enqueue_line_(std::move(line));  line.clear();
+                    enqueue_line_(line, t_read);  line.clear();
                     break;
                 }
                 //
@@ -587,7 +625,7 @@ void PyStream::reader_thread_func(void)
     }// END "while(run)".
     
 #endif
-    if ( !line.empty() )    { enqueue_line_(std::move(line));  line.clear(); }      //  flush any unterminated tail on EOF.
+    if ( !line.empty() )    { enqueue_line_(line, t_read);  line.clear(); }      //  flush any unterminated tail on EOF.
 
     this->m_running.store(false);     // reflect EOF in liveness
     return;
@@ -607,8 +645,7 @@ void PyStream::reader_thread_func(void)
         if ( !ReadFile(m_child_stdout_r, &ch, 1, &nread, nullptr) || nread == 0 )   { break; }  // pipe closed
         if (ch == '\n')
         {
-            std::lock_guard<std::mutex>     lock    (m_queue_mutex);
-            m_recv_queue                    .emplace_back(std::move(buf));
+            enqueue_line_(buf);
             buf.clear();
         }
         else buf.push_back(ch);
@@ -620,8 +657,7 @@ void PyStream::reader_thread_func(void)
         if (n <= 0)         { break; }
         if (ch == '\n')
         {
-            std::lock_guard<std::mutex> lock(m_queue_mutex);
-            m_recv_queue.emplace_back(std::move(buf));
+            enqueue_line_(buf);
             buf.clear();
         }
         else buf.push_back(ch);
@@ -633,6 +669,95 @@ void PyStream::reader_thread_func(void)
 #endif  //  PYSTREAM_REFACTOR  //
 
 
+//  "frame_reader_func"
+//      reader thread for "Framing::Binary" — blocks on stdout and pushes complete frames into the SPSC ring.
+//
+void PyStream::frame_reader_func(void)
+{
+    constexpr size_t            BSIZE       = PyStream::ms_READ_BUFFER_SIZE;
+    static thread_local char    s_buffer    [BSIZE];
+    //
+    std::vector<std::byte>      pending     = {   };        //  bytes of a partially-received frame (reserved once).
+#ifdef _WIN32
+    DWORD                       n           = 0;
+# else
+    ssize_t                     n           = 0;
+#endif  //  _WIN32  //
+    pending.reserve(BSIZE + BinaryFrame::ms_HEADER_SIZE + BinaryFrame::ms_MAX_PAYLOAD);
+
+
+    for (;;)
+    {
+    #ifdef _WIN32
+        if ( !this->m_running.load() )  { break; }
+        const BOOL  ok      = ReadFile(m_child_stdout_r, s_buffer, static_cast<DWORD>(BSIZE), &n, nullptr);
+        if ( !ok || n == 0 )            { break; }  //  CASE 1 :    BREAK LOOP ON EOF or ERROR...
+    # else
+        n                   = ::read(this->m_child_stdout_fd, s_buffer, BSIZE);
+        if ( n <= 0 )                   { break; }  //  CASE 1 :    BREAK LOOP ON EOF or ERROR...
+    #endif  //  _WIN32  //
+
+        const int64_t       t_read  = monotonic_ns();
+        const std::byte *   first   = reinterpret_cast<const std::byte *>(s_buffer);
+        pending.insert( pending.end(), first, first + static_cast<size_t>(n) );
+        this->consume_frames_(pending, t_read);
+
+    # ifndef _WIN32
+        if ( !m_running.load() )        { break; }
+    # endif  //  _WIN32  //
+    }
+
+    this->m_running.store(false);     // reflect EOF in liveness
+    return;
+}
+
+
+//  "consume_frames_"
+//      Cut every complete frame off the front of "pending".  Garbage before a "CBFR" magic (or a header announcing an
+//      oversized payload) is skipped one byte at a time and counted, so a corrupted byte re-synchronizes on the next frame.
+//      Every frame completed by this read is stamped with "t_read_ns".
+//
+void PyStream::consume_frames_(std::vector<std::byte> & pending, const int64_t t_read_ns)
+{
+    constexpr size_t        HEADER      = BinaryFrame::ms_HEADER_SIZE;
+    const std::byte *       data        = pending.data();
+    const size_t            N           = pending.size();
+    size_t                  pos         = 0ULL;
+    size_t                  skipped     = 0ULL;
+    
+    auto                    load_u16    = [data](const size_t i) -> uint16_t
+    { return static_cast<uint16_t>( std::to_integer<uint16_t>(data[i]) | (std::to_integer<uint16_t>(data[i + 1]) << 8) ); };
+
+
+    while ( N - pos >= HEADER )
+    {
+        const uint16_t      size        = load_u16(pos + 6ULL);
+        
+        //      CASE 1 :    NOT A FRAME HEADER  --  RE-SYNCHRONIZE...
+        if ( std::memcmp(data + pos, BinaryFrame::ms_MAGIC, sizeof(BinaryFrame::ms_MAGIC)) != 0  ||  size > BinaryFrame::ms_MAX_PAYLOAD ) {
+            ++pos;  ++skipped;
+            continue;
+        }
+        
+        //      CASE 2 :    INCOMPLETE FRAME  --  WAIT FOR MORE BYTES...
+        if ( N - pos < HEADER + size )      { break; }
+        
+        //      3.      COPY STRAIGHT INTO THE RING SLOT...
+        this->enqueue_frame_( [&](BinaryFrame & f) {
+            f.version       = load_u16(pos + 4ULL);
+            f.size          = size;
+            f.t_read_ns     = t_read_ns;
+            std::memcpy( f.payload.data(), data + pos + HEADER, size );
+        } );
+        pos                += HEADER + size;
+    }
+
+    if (skipped)    { this->m_bad_frames.fetch_add(skipped, std::memory_order_relaxed); }
+    pending.erase( pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(pos) );
+    return;
+}
+
+
 
 //
 //
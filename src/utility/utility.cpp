@@ -860,15 +860,16 @@ bool SaveImPlotStyleToDisk(const ImPlotStyle & style, const std::string_view & f
 // *************************************************************************** //
 
 //  "SaveImGuiStyleToDiskAsync"
+//      Returns true once the write is QUEUED on the task scheduler;  the write itself reports nothing back.
 bool SaveImGuiStyleToDiskAsync(const ImGuiStyle & style, const char * file_path) {
-    //  ** CRITICAL **  Create a local, deep-copy of "style" object to prevent race condition if the main thread alters
-    bool                status  =   false;      //  the "style" data while the worker thread is writing it's data to the file.
-    const ImGuiStyle    copy(style);            //      Note:   We could also accomplish this by **PASSING THE ARG BY VALUE**.
-    std::thread([&status, &copy, &file_path]() {
-        status = SaveImGuiStyleToDisk_IMPL(copy, file_path);
-    }).detach();
-
-    return status;
+    //  ** CRITICAL **  The task owns a deep-copy of "style" AND of the path, so neither the main thread altering the
+    //                  style nor the caller's buffer going out of scope can race with the write.
+    if ( !file_path )       { return false; }
+    cb::utl::TaskScheduler::instance().submit(
+        [copy = ImGuiStyle(style), path = std::string(file_path)]() { SaveImGuiStyleToDisk_IMPL(copy, path.c_str()); }
+    );
+
+    return true;
 }
 
 //  "SaveImGuiStyleToDiskAsync"
@@ -881,15 +882,15 @@ bool SaveImGuiStyleToDiskAsync(const ImGuiStyle & style, const char * file_path)
 
 
 //  "SaveImPlotStyleToDiskAsync"
+//      Returns true once the write is QUEUED on the task scheduler;  the write itself reports nothing back.
 bool SaveImPlotStyleToDiskAsync(const ImPlotStyle & style, const char * file_path) {
-    //  ** CRITICAL **  Create a local, deep-copy of "style" object to prevent race condition if the main thread alters
-    bool                status  =   false;      //  the "style" data while the worker thread is writing it's data to the file.
-    const ImPlotStyle   copy(style);            //      Note:   We could also accomplish this by **PASSING THE ARG BY VALUE**.
-    std::thread([&status, &copy, &file_path]() {
-        status = SaveImPlotStyleToDisk_IMPL(copy, file_path);
-    }).detach();
+    //  ** CRITICAL **  The task owns a deep-copy of "style" AND of the path (see "SaveImGuiStyleToDiskAsync").
+    if ( !file_path )       { return false; }
+    cb::utl::TaskScheduler::instance().submit(
+        [copy = ImPlotStyle(style), path = std::string(file_path)]() { SaveImPlotStyleToDisk_IMPL(copy, path.c_str()); }
+    );
     
-    return status;
+    return true;
 }
 
 //  "SaveImPlotStyleToDiskAsync"
@@ -227,6 +227,7 @@ void Editor::_draw_properties_panel_multi([[maybe_unused]] const LabelFn & callb
         for (size_t i : idxs) {
             if (i < m_paths.size())     { m_paths.erase(m_paths.begin() + static_cast<long>(i)); }
         }
+        m_vindex.invalidate();
 
         this->reset_selection();    // m_sel.clear();
         m_browser_S.m_inspector_vertex_idx = -1;
@@ -530,6 +531,7 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
     const double &                  WS_xmax             = GS.m_world_size[0].value;
     const double &                  WS_ymax             = GS.m_world_size[1].value;
     const bool                      quadratic           = ( v.IsQuadratic() );
+    bool                            dirty               = false;
 
 
 
@@ -540,7 +542,7 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
     //
     //  //      3.1.    Position:
         ImGui::PushItemWidth( ms_HALF_WIDTH );
-            v.ui_Position       (WS_xmax, WS_ymax, speedx, speedy);
+            dirty |= v.ui_Position       (WS_xmax, WS_ymax, speedx, speedy);
         ImGui::PopItemWidth();
         
         
@@ -551,7 +553,7 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
         //              3.2A    ANCHOR TYPE (corner / smooth / symmetric):
         {
             callback("Type:");
-            v.ui_CurvatureType();
+            dirty |= v.ui_CurvatureType();
         }
             
             
@@ -559,7 +561,7 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
         if ( !quadratic ) {
             callback("In-Handle:");
             ImGui::PushItemWidth( ms_HALF_WIDTH );
-                v.ui_InHandle       (WS_xmax, WS_ymax, speedx, speedy);
+                dirty |= v.ui_InHandle       (WS_xmax, WS_ymax, speedx, speedy);
             ImGui::PopItemWidth();
         }
         //              3.2C.   Out-Handle:
@@ -567,14 +569,14 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
         if ( quadratic ) {
             callback("Control:");
             ImGui::PushItemWidth( ms_HALF_WIDTH );
-                v.ui_OutHandle      (WS_xmax, WS_ymax, speedx, speedy);
+                dirty |= v.ui_OutHandle      (WS_xmax, WS_ymax, speedx, speedy);
             ImGui::PopItemWidth();
         }
         //                      (B)     CUBIC BEZIER CURVE.
         else {
             callback("Out-Handle:");
             ImGui::PushItemWidth( ms_HALF_WIDTH );
-                v.ui_OutHandle      (WS_xmax, WS_ymax, speedx, speedy);
+                dirty |= v.ui_OutHandle      (WS_xmax, WS_ymax, speedx, speedy);
             ImGui::PopItemWidth();
         }
     //
@@ -583,6 +585,8 @@ inline void Editor::_draw_vertex_properties_panel(Vertex & v, const LabelFn & ca
     }
     ImGui::PopStyleVar();   //  ImGuiStyleVar_ItemSpacing
     
+    if ( dirty )    { this->_spatial_touch(v.id); }     //  Keep hit-testing in step with inspector edits.
+    
     
     return;
 }
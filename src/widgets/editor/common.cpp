@@ -102,6 +102,7 @@ void Editor::open(void)
 //
 void Editor::undo(void) {
     //  CB_LOG( LogLevel::Info, "Editor--undo" );
+    m_vindex.invalidate();
     return;
 }
 
@@ -110,6 +111,7 @@ void Editor::undo(void) {
 //
 void Editor::redo(void) {
     //  CB_LOG( LogLevel::Info, "Editor--redo" );
+    m_vindex.invalidate();
     return;
 }
 
@@ -383,6 +385,7 @@ void Editor::move_selection(const float dx, const float dy)
         {
             v->x += dx;
             v->y += dy;
+            _spatial_touch(vid);
         }
 
     // If you maintain cached bounds elsewhere, update them here:
@@ -523,6 +526,7 @@ void Editor::paste_from_clipboard(ImVec2 target_ws)
         for (VertexID vid : m_paths.back().verts)
             m_sel.vertices.insert(vid);
     }
+    m_vindex.invalidate();
     
     return;
 }
@@ -584,6 +588,7 @@ void Editor::_clear_all(void)
     this->m_paths           .clear();       // clears Path<…> vector
     this->m_points          .clear();       // glyphs
     this->m_vertices        .clear();       // anchors
+    this->m_vindex          .invalidate();
 
 
     //      2.      RESET SELECTION AND TOOL STATES...
@@ -391,7 +391,6 @@ void Editor::Begin(const char * /*id*/)
 
 
     //      2A.     HANDLE ANY I/O OPERATIONS BEFORE PLOT BEGINS...
-    this->_MECH_pump_main_tasks();
     this->_MECH_drive_io();
     //
     //      2B.     DRAW THE EDITOR CONTROL BAR UI...
@@ -1322,6 +1321,7 @@ inline void Editor::_handle_add_anchor([[maybe_unused]] const Interaction & it)
         vid                                     = _add_vertex(p_hit->pos_ws);               //  Add new vertex...
         _add_point_glyph(vid);
         path->insert_vertex_after(p_hit->seg_idx, vid);                                     //  Insert into path right after seg_idx...
+        m_vindex.invalidate();
     }
 
 
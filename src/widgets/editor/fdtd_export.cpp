@@ -0,0 +1,168 @@
+/***********************************************************************************
+*
+*       *********************************************************************
+*       ****        F D T D _ E X P O R T . C P P  ____  F I L E         ****
+*       *********************************************************************
+*
+*              AUTHOR:      Collin A. Bond.
+*               DATED:      October 17, 2026.
+*
+**************************************************************************************
+**************************************************************************************/
+#include "widgets/editor/editor.h"
+#include "fdtd/engine/_rasterizer.h"
+
+
+
+namespace cb { //     BEGINNING NAMESPACE "cb"...
+// *************************************************************************** //
+// *************************************************************************** //
+
+namespace { //     BEGINNING ANONYMOUS NAMESPACE...
+
+//  "to_source_type"
+//
+[[nodiscard]] inline fdtd::SourceType to_source_type(const path::SourcePayload::Type t) noexcept
+{
+    using   Type    = path::SourcePayload::Type;
+    switch (t) {
+        case Type::HardH    : { return fdtd::SourceType::HardB; }
+        case Type::SoftE    : { return fdtd::SourceType::SoftE; }
+        case Type::SoftH    : { return fdtd::SourceType::SoftB; }
+        default             : { break; }
+    }
+    return fdtd::SourceType::HardE;
+}
+
+
+//  "to_waveform_type"
+//      "User" waveforms have no engine counterpart yet and fall back to the Gaussian pulse.
+//
+[[nodiscard]] inline fdtd::WaveformType to_waveform_type(const path::SourcePayload::Wave w) noexcept
+{
+    using   Wave    = path::SourcePayload::Wave;
+    switch (w) {
+        case Wave::Sine     : { return fdtd::WaveformType::Harmonic; }
+        case Wave::Ricker   : { return fdtd::WaveformType::Ricker;   }
+        default             : { break; }
+    }
+    return fdtd::WaveformType::Gaussian;
+}
+
+} //   END OF ANONYMOUS NAMESPACE.
+
+
+
+//      1.      FDTD EXPORT...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "FDTDGrid"
+//      A raster grid covering the whole canvas  [0, world_w) x [0, world_h)  with "cell" world units per cell
+//      (never smaller than the 3 x 3 that "FDTD_2D" needs).
+//
+fdtd::RasterGrid Editor::FDTDGrid(const double cell) const
+{
+    const double        h           = std::max(cell, 1.0e-6);
+    auto                count       = [h](const double extent) -> std::size_t
+    { return std::max<std::size_t>( static_cast<std::size_t>( std::ceil(extent / h) ), 3ULL ); };
+
+    fdtd::RasterGrid    grid        = {};
+    grid.nx             = count( this->m_grid.m_world_size[0].Value() );
+    grid.ny             = count( this->m_grid.m_world_size[1].Value() );
+    grid.h              = h;
+    return grid;
+}
+
+
+//  "SyncFDTDScene"
+//      Push every visible Dielectric / Source path into "scene".   Curved segments are flattened exactly as the fill
+//      pass in "render.cpp" does (ms_BEZIER_FILL_STEPS per segment), so the solver sees what the canvas shows.
+//      Unchanged paths cost one comparison;  only the cells of edited paths are re-rasterized on the next rebuild.
+//
+//      Boundary payloads are not rasterized:  the engines only have PEC outer walls so far.
+//
+void Editor::SyncFDTDScene(fdtd::SceneRasterizer<double> & scene) const
+{
+    using           fdtd::RasterPoint;
+    const auto &    grid        = scene.grid();
+    const int       steps       = std::max(this->m_style.ms_BEZIER_FILL_STEPS, 1);
+
+
+    //  1.  Flatten one path into world-space points (closing edge implied for areas).
+    auto            flatten     = [&](const Path & p) -> std::vector<RasterPoint>
+    {
+        std::vector<RasterPoint>    pts;
+        const size_t                N       = p.verts.size();
+        const bool                  area    = p.IsArea();
+        if (N == 0)     { return pts; }
+
+        const Vertex *  first   = find_vertex(this->m_vertices, p.verts[0]);
+        if (first)      { pts.push_back({ first->x, first->y }); }
+        for (size_t i = 0; i + (area ? 0 : 1) < N; ++i)
+        {
+            const Vertex *  a   = find_vertex(this->m_vertices, p.verts[i]);
+            const Vertex *  b   = find_vertex(this->m_vertices, p.verts[(i + 1) % N]);
+            if (!a || !b)   { continue; }
+
+            if ( !is_curved<VertexID>(a, b) )   { pts.push_back({ b->x, b->y }); }
+            else {
+                for (int s = 1; s <= steps; ++s) {
+                    const ImVec2    wp  = cubic_eval<VertexID>(a, b, static_cast<float>(s) / static_cast<float>(steps));
+                    pts.push_back({ wp.x, wp.y });
+                }
+            }
+        }
+        if ( area && pts.size() > 1 )   { pts.pop_back(); }        //  Last point repeats the first.
+        return pts;
+    };
+
+
+    //  2.  Re-send the whole scene;  anything not set again is dropped by "end_sync".
+    scene.begin_sync();
+    for (const Path & p : this->m_paths)
+    {
+        if ( !p.IsVisible() )       { continue; }
+
+        if ( const auto * d = std::get_if<path::DielectricPayload>(&p.payload) )
+        {
+            if ( !p.IsArea() )      { continue; }
+            scene.set_shape( static_cast<uint64_t>(p.id), static_cast<int64_t>(p.z_index), flatten(p),
+                             fdtd::material_from_SI<double>(grid, d->eps_r.real(), d->mu_r.real(), d->sigma_e, d->sigma_m) );
+        }
+        else if ( const auto * s = std::get_if<path::SourcePayload>(&p.payload) )
+        {
+            fdtd::PointSource<double>   proto;
+            proto.type          = to_source_type(s->type);
+            proto.component     = 2;                                //  TMz:  E sources drive Ez,  H sources Hx or Hy
+            if ( !fdtd::is_E_source(proto.type) )                   //        (whichever the payload's direction favours).
+                { proto.component = (std::abs(s->direction[1]) > std::abs(s->direction[0])) ? 1 : 0; }
+            proto.amplitude     = s->amplitude;
+            proto.wave          = fdtd::waveform_from_SI<double>(grid, to_waveform_type(s->waveform), s->frequency, s->tau, s->t0);
+            scene.set_source( static_cast<uint64_t>(p.id), flatten(p), p.IsArea(), proto );
+        }
+    }
+    scene.end_sync();
+
+    return;
+}
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//
+} //   END OF "cb" NAMESPACE.
+
+
+
+
+
+
+// *************************************************************************** //
+// *************************************************************************** //
+//
+//  END.
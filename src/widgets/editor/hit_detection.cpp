@@ -218,11 +218,18 @@ inline void Editor::_dispatch_cursor_icon(const Interaction & /* it */) const
 //
 int Editor::_hit_point([[maybe_unused]] const Interaction & it) const
 {
-    const ImVec2 ms = ImGui::GetIO().MousePos;          // mouse in px
+    using                   Kind                    = SpatialIndex::Item::Kind;
+    const ImVec2            ms                      = ImGui::GetIO().MousePos;          // mouse in px
+    int                     best                    = -1;
 
 
-    for (size_t i = 0; i < m_points.size(); ++i)
+    //  Only glyphs whose box is near the cursor;  keep the lowest index, as the old linear scan did.
+    for (const SpatialIndex::Item & h : this->_spatial_query_px( ms, std::sqrt(m_style.HIT_THRESH_SQ) ))
     {
+        const size_t    i       = h.index;
+        if ( h.kind != Kind::Point  ||  i >= m_points.size() )          { continue; }
+        if ( best >= 0  &&  i >= static_cast<size_t>(best) )            { continue; }
+
         const Vertex *   v      = find_vertex(m_vertices, m_points[i].v);
         if (!v) continue;
 
@@ -234,9 +241,9 @@ int Editor::_hit_point([[maybe_unused]] const Interaction & it) const
         float           dx      = scr.x - ms.x;
         float           dy      = scr.y - ms.y;
         if ( dx*dx + dy*dy <= m_style.HIT_THRESH_SQ )
-            { return static_cast<int>(i); }
+            { best = static_cast<int>(i); }
     }
-    return -1;
+    return best;
 }
 
 
@@ -260,9 +267,11 @@ std::optional<Editor::Hit> Editor::_hit_any(const Interaction & it) const
 
 
     // ───────────────────────────────────────────── 1. Bézier handles
-    for (const Vertex & v : m_vertices)
+    for (const VertexID vid : m_sel.vertices)                              // handles only for selected verts
     {
-        if ( !m_sel.vertices.count(v.id) )                  { continue; }  // handles only for selected verts
+        const Vertex * vp = find_vertex(m_vertices, vid);
+        if ( !vp )                                          { continue; }
+        const Vertex & v  = *vp;
         const Path * pp = parent_path_of_vertex(v.id);
         if ( !pp  ||  pp->locked  ||  !pp->visible )        { continue; }
 
@@ -294,34 +303,51 @@ std::optional<Editor::Hit> Editor::_hit_any(const Interaction & it) const
     }
 
     // ───────────────────────────────────────────── 3. paths
-    // Build vector of unlocked+visible paths, sort by z (low→high), iterate reverse
-    std::vector<const Path*> vec;
-    vec.reserve(m_paths.size());
-    for (const Path& p : m_paths)
-        if (!p.locked && p.visible) vec.push_back(&p);
-
-    std::stable_sort(vec.begin(), vec.end(),
-        [](const Path* a, const Path* b){ return a->z_index < b->z_index; });
+    // Candidates are the unlocked+visible paths with a segment or surface box near the cursor.
+    // Visit them topmost-first (ties: later slot first, as the old stable sort + reverse walk did).
+    // Edges and interiors are tested against the flattened curve cache.
+    using                   Kind                    = SpatialIndex::Item::Kind;
+    this->_curve_sync();
+    const float             thresh_px               = std::sqrt(m_style.HIT_THRESH_SQ);
+    const ImVec2            ms_ws                   = pixels_to_world(ms);
+    const float             px_per_ws               = std::min( std::abs(m_curves.scale.x), std::abs(m_curves.scale.y) );
+    const float             thresh_ws               = (px_per_ws > 0.f) ? thresh_px / px_per_ws : 0.f;
+    auto &                  hits                    = this->_spatial_query_px( ms, thresh_px );
+    std::vector<uint32_t> & order                   = m_spatial.scratch;
+
+    hits.erase( std::remove_if(hits.begin(), hits.end(), [](const SpatialIndex::Item & h) { return h.kind == Kind::Point; }), hits.end() );
+    std::sort( hits.begin(), hits.end(), [](const SpatialIndex::Item & a, const SpatialIndex::Item & b)
+        { return (a.index != b.index) ? (a.index < b.index) : (a.seg < b.seg); } );
+
+    order.clear();
+    for (const SpatialIndex::Item & h : hits) {
+        if ( h.index >= m_paths.size()  ||  (!order.empty() && order.back() == h.index) )     { continue; }
+        if ( !m_paths[h.index].locked  &&  m_paths[h.index].visible )                       { order.push_back(h.index); }
+    }
+    std::sort( order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+        { return (m_paths[a].z_index != m_paths[b].z_index) ? (m_paths[a].z_index > m_paths[b].z_index) : (a > b); } );
 
-    for (auto rit = vec.rbegin(); rit != vec.rend(); ++rit)
+    for (const uint32_t index : order)
     {
-        const Path &  p     = **rit;
-        const size_t  N     = p.verts.size();
-        const size_t  index = &p - m_paths.data();          // back to array idx
-        if (N < 2) continue;
+        const Path &                p       = m_paths[index];
+        const CurveCache::Entry &   E       = this->_curve_flat(index);
+        if ( p.verts.size() < 2  ||  !E.contains(ms_ws, thresh_ws) )     { continue; }
 
-        // ── EDGE proximity test (topmost-first)
-        for (size_t si = 0; si < N - 1 + (p.closed ? 1u : 0u); ++si)
+        const auto    first = std::lower_bound(hits.begin(), hits.end(), index,
+                                               [](const SpatialIndex::Item & h, uint32_t i) { return h.index < i; });
+        bool          near_surface  = false;
+
+        // ── EDGE proximity test (candidate segments only, in pixel space)
+        for (auto hit = first; hit != hits.end() && hit->index == index; ++hit)
         {
-            const Vertex * a = find_vertex(m_vertices, p.verts[si]);
-            const Vertex * b = find_vertex(m_vertices, p.verts[(si + 1) % N]);
-            if (!a || !b) continue;
+            if ( hit->kind == Kind::Surface )   { near_surface = true;  continue; }
+            if ( hit->seg >= E.spans.size() )   { continue; }
 
-            // 1. Straight edge
-            if (!is_curved<VertexID>(a, b))
+            const CurveCache::Span & sp = E.spans[hit->seg];
+            for (uint32_t k = sp.first; k < sp.last; ++k)
             {
-                ImVec2 A = world_to_pixels({ a->x, a->y });
-                ImVec2 B = world_to_pixels({ b->x, b->y });
+                const ImVec2 A = m_curves.project(E.pts[k]);
+                const ImVec2 B = m_curves.project(E.pts[k + 1]);
 
                 ImVec2 AB{ B.x - A.x, B.y - A.y };
                 ImVec2 AP{ ms.x - A.x, ms.y - A.y };
@@ -334,95 +360,13 @@ std::optional<Editor::Hit> Editor::_hit_any(const Interaction & it) const
                 if (dx*dx + dy*dy <= m_style.HIT_THRESH_SQ)
                     return Hit{ HitType::Edge, index };
             }
-            // 2. Quadratic edge: sample chords and project in pixel space
-            else if (a->IsQuadratic())
-            {
-                // World control points (A, C, B) with single control from A.out_handle
-                ImVec2 A_ws{ a->x, a->y };
-                ImVec2 C_ws{ a->x + a->m_bezier.out_handle.x, a->y + a->m_bezier.out_handle.y };
-                ImVec2 B_ws{ b->x, b->y };
-
-                ImVec2 prev_px = world_to_pixels(A_ws);
-
-                for (int k = 1; k <= m_style.ms_BEZIER_HIT_STEPS; ++k)
-                {
-                    float  tk     = static_cast<float>(k) / static_cast<float>(m_style.ms_BEZIER_HIT_STEPS);
-                    // Evaluate quadratic in world, then to pixels
-                    float  u1     = 1.0f - tk;
-                    ImVec2 cur_ws { u1*u1*A_ws.x + 2*u1*tk*C_ws.x + tk*tk*B_ws.x,
-                                    u1*u1*A_ws.y + 2*u1*tk*C_ws.y + tk*tk*B_ws.y };
-                    ImVec2 cur_px = world_to_pixels(cur_ws);
-
-                    ImVec2 seg{ cur_px.x - prev_px.x, cur_px.y - prev_px.y };
-                    ImVec2 to_pt{ ms.x - prev_px.x,   ms.y - prev_px.y   };
-                    float  len_sq = seg.x*seg.x + seg.y*seg.y;
-                    float  u      = (len_sq > 0.f) ? (to_pt.x*seg.x + to_pt.y*seg.y) / len_sq : 0.f;
-                    u             = std::clamp(u, 0.f, 1.f);
-                    ImVec2 C{ prev_px.x + seg.x*u, prev_px.y + seg.y*u };
-                    float  dx = ms.x - C.x, dy = ms.y - C.y;
-
-                    if (dx*dx + dy*dy <= m_style.HIT_THRESH_SQ)
-                        return Hit{ HitType::Edge, index };
-
-                    prev_px = cur_px;
-                }
-            }
-            // 3. Cubic edge: existing sampling & projection
-            else
-            {
-                ImVec2 prev_px = world_to_pixels({ a->x, a->y });
-
-                for (int k = 1; k <= m_style.ms_BEZIER_HIT_STEPS; ++k)
-                {
-                    float  t      = static_cast<float>(k) / m_style.ms_BEZIER_HIT_STEPS;
-                    ImVec2 wpt    = cubic_eval<VertexID>(a, b, t);
-                    ImVec2 cur_px = world_to_pixels(wpt);
-
-                    ImVec2 seg{ cur_px.x - prev_px.x, cur_px.y - prev_px.y };
-                    ImVec2 to_pt{ ms.x - prev_px.x,   ms.y - prev_px.y   };
-                    float  len_sq = seg.x*seg.x + seg.y*seg.y;
-                    float  u      = (len_sq > 0.f) ? (to_pt.x*seg.x + to_pt.y*seg.y) / len_sq : 0.f;
-                    u             = std::clamp(u, 0.f, 1.f);
-                    ImVec2 C{ prev_px.x + seg.x*u, prev_px.y + seg.y*u };
-                    float  dx = ms.x - C.x, dy = ms.y - C.y;
-
-                    if (dx*dx + dy*dy <= m_style.HIT_THRESH_SQ)
-                        return Hit{ HitType::Edge, index };
-
-                    prev_px = cur_px;
-                }
-            }
         }
 
-        // ── interior point-in-polygon
-        if ( p.closed )
-        {
-            std::vector<ImVec2> poly;
-            poly.reserve(N * 4);
-
-            for (size_t vi = 0; vi < N; ++vi)
-            {
-                const Vertex * a = find_vertex(m_vertices, p.verts[vi]);
-                const Vertex * b = find_vertex(m_vertices, p.verts[(vi + 1) % N]);
-                if (!a || !b) continue;
-
-                if (!is_curved<VertexID>(a, b))
-                {
-                    poly.push_back(world_to_pixels({ a->x, a->y }));
-                }
-                else
-                {
-                    for (int k = 0; k <= m_style.ms_BEZIER_HIT_STEPS; ++k) {
-                        float  t   = static_cast<float>(k) / m_style.ms_BEZIER_HIT_STEPS;
-                        ImVec2 wpt = cubic_eval<VertexID>(a, b, t);
-                        poly.push_back(world_to_pixels(wpt));
-                    }
-                }
-            }
-
-            if (!poly.empty() && point_in_polygon(poly, ms))
-                return Hit{ HitType::Surface, index };
-        }
+        // ── interior point-in-polygon (world space:  the view map is affine, so inside-ness is preserved;
+        //    same fill rule as the renderer, closing duplicate dropped)
+        if ( p.closed && near_surface && E.pts.size() > 3 &&
+             cblib::math::triangulate::contains(E.pts.data(), E.pts.size() - 1, ms_ws, m_style.ms_FILL_RULE) )
+            return Hit{ HitType::Surface, index };
     }
 
     return std::nullopt;   // nothing hit
@@ -436,159 +380,83 @@ std::optional<Editor::Hit> Editor::_hit_any(const Interaction & it) const
 //
 std::optional<Editor::PathHit> Editor::_hit_path_segment(const Interaction & /*it*/) const
 {
-    namespace               bez                     = cblib::math::bezier;
     namespace               bezpx                   = cblib::math::bezier::px;
 
     //      Zoom-invariant pick thresholds (pixels)
     constexpr float         PICK_PX                 = 6.0f;   // edge pick radius
     constexpr float         ENDPOINT_EPS_PX         = 3.0f;   // reject near-vertex "cuts"
-    constexpr float         HANDLE_EPS2             = 1e-12f; // linear-handle epsilon^2 (world units)
     const float             thresh_sq               = PICK_PX * PICK_PX;
     const float             endpoint_eps_sq         = ENDPOINT_EPS_PX * ENDPOINT_EPS_PX;
 
     //      Mouse in pixel space
     const ImVec2            ms                      = ImGui::GetIO().MousePos;
 
-    //      Build Z-sorted list of eligible paths (visible & unlocked)
-    std::vector<size_t>     order                   {   };
-    order.reserve(m_paths.size());
-    
-    for (size_t pi = 0; pi < m_paths.size(); ++pi)
+    //      Candidate segments near the cursor, grouped by path;  eligible paths (visible & unlocked) Z-sorted.
+    using                   Kind                    = SpatialIndex::Item::Kind;
+    this->_curve_sync();
+    auto &                  hits                    = this->_spatial_query_px(ms, PICK_PX);
+    std::vector<uint32_t> & order                   = m_spatial.scratch;
+
+    hits.erase( std::remove_if(hits.begin(), hits.end(), [](const SpatialIndex::Item & h) { return h.kind != Kind::Segment; }), hits.end() );
+    std::sort( hits.begin(), hits.end(), [](const SpatialIndex::Item & a, const SpatialIndex::Item & b)
+        { return (a.index != b.index) ? (a.index < b.index) : (a.seg < b.seg); } );
+
+    order.clear();
+    for (const SpatialIndex::Item & h : hits)
     {
-        const Path& p = m_paths[pi];
+        if ( h.index >= m_paths.size()  ||  (!order.empty() && order.back() == h.index) )     { continue; }
+        const Path& p = m_paths[h.index];
         if (!p.visible || p.locked) continue;
-        order.push_back(pi);
+        order.push_back(h.index);
     }
-    std::stable_sort(order.begin(), order.end(),
-        [&](size_t a, size_t b){ return m_paths[a].z_index < m_paths[b].z_index; });
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+        { return (m_paths[a].z_index != m_paths[b].z_index) ? (m_paths[a].z_index > m_paths[b].z_index) : (a > b); });
 
 
     // Walk from topmost down; return as soon as the topmost eligible path yields a valid hit
-    for (auto rit = order.rbegin(); rit != order.rend(); ++rit)
+    for (const uint32_t path_slot : order)
     {
-        const size_t  pi = *rit;
-        const Path&   p  = m_paths[pi];
-        const size_t  N  = p.verts.size();
-        if (N < 2) continue;
-
-        const bool   closed    = p.closed;
-        const size_t seg_count = N - (closed ? 0 : 1);
+        const size_t                pi = path_slot;
+        const Path&                 p  = m_paths[pi];
+        const CurveCache::Entry &   E  = this->_curve_flat(pi);
+        if (p.verts.size() < 2) continue;
 
         std::optional<PathHit> best_for_path;
         float                  best_d2 = thresh_sq;
 
-        for (size_t si = 0; si < seg_count; ++si)
+        const auto first = std::lower_bound(hits.begin(), hits.end(), path_slot,
+                                            [](const SpatialIndex::Item & h, uint32_t i) { return h.index < i; });
+        for (auto hit = first; hit != hits.end() && hit->index == path_slot; ++hit)
         {
-            const Vertex* a = find_vertex(m_vertices, p.verts[si]);
-            const Vertex* b = find_vertex(m_vertices, p.verts[(si + 1) % N]);
-            if (!a || !b) continue;
-
-            // Linear test (epsilon on handle magnitudes)
-            const float a_out_len2 = a->m_bezier.out_handle.x * a->m_bezier.out_handle.x
-                                        + a->m_bezier.out_handle.y * a->m_bezier.out_handle.y;
-            const float b_in_len2  = b->m_bezier.in_handle.x  * b->m_bezier.in_handle.x
-                                        + b->m_bezier.in_handle.y  * b->m_bezier.in_handle.y;
-            const bool  linear     = (a_out_len2 <= HANDLE_EPS2) && (b_in_len2 <= HANDLE_EPS2);
-
-            if (linear)
-            {
-                // Straight segment (pixel space projection)
-                const ImVec2 A = this->world_to_pixels(ImVec2{ a->x, a->y });
-                const ImVec2 B = this->world_to_pixels(ImVec2{ b->x, b->y });
+            const size_t  si = hit->seg;
+            if ( si >= E.spans.size() ) continue;
 
-                // Reject near endpoints
-                if (bezpx::dist2(A, ms) <= endpoint_eps_sq) continue;
-                if (bezpx::dist2(B, ms) <= endpoint_eps_sq) continue;
+            const CurveCache::Span & sp = E.spans[si];
+            if ( sp.first == sp.last ) continue;
 
-                const float  u  = bezpx::project_param_on_segment(A, B, ms);
-                const ImVec2 C  = bezpx::lerp(A, B, u);
-                const float  d2 = bezpx::dist2(ms, C);
+            // Reject near the segment's end vertices (no "cuts" on top of an anchor)
+            if (bezpx::dist2(m_curves.project(E.pts[sp.first]), ms) <= endpoint_eps_sq) continue;
+            if (bezpx::dist2(m_curves.project(E.pts[sp.last]),  ms) <= endpoint_eps_sq) continue;
 
-                if (d2 < best_d2)
-                {
+            // Project onto each flattened chord;  "t" interpolates the cached Bézier parameters
+            for (uint32_t k = sp.first; k < sp.last; ++k)
+            {
+                const ImVec2 prev_px = m_curves.project(E.pts[k]);
+                const ImVec2 cur_px  = m_curves.project(E.pts[k + 1]);
+
+                const float  u   = bezpx::project_param_on_segment(prev_px, cur_px, ms);
+                const ImVec2 Cpx = bezpx::lerp(prev_px, cur_px, u);
+                const float  d2  = bezpx::dist2(ms, Cpx);
+
+                if (d2 < best_d2) {
                     best_d2 = d2;
-                    // World-space closest point on straight chord
-                    const ImVec2 pos_ws {
-                        a->x + (b->x - a->x) * u,
-                        a->y + (b->y - a->y) * u
+                    const float t0       = (k == sp.first) ? 0.0f : E.ts[k];
+                    const float t_global = t0 + (E.ts[k + 1] - t0) * u;
+                    const ImVec2 pos_ws{
+                        E.pts[k].x + (E.pts[k + 1].x - E.pts[k].x) * u,
+                        E.pts[k].y + (E.pts[k + 1].y - E.pts[k].y) * u
                     };
-                    best_for_path = PathHit{ pi, si, u /* t on straight */, pos_ws };
-                }
-            }
-            else if ( a->IsQuadratic() )
-            {
-                // Quadratic: use start vertex's out_handle as single control point
-                const ImVec2 A_ws{ a->x, a->y };
-                const ImVec2 C_ws{ a->x + a->m_bezier.out_handle.x, a->y + a->m_bezier.out_handle.y };
-                const ImVec2 B_ws{ b->x, b->y };
-
-                ImVec2 prev_ws = A_ws;
-                ImVec2 prev_px = this->world_to_pixels(prev_ws);
-
-                const int STEPS = m_style.ms_BEZIER_HIT_STEPS;
-                for (int k = 1; k <= STEPS; ++k)
-                {
-                    const float tk     = static_cast<float>(k) / static_cast<float>(STEPS);
-                    const ImVec2 cur_ws = bez::eval_quadratic<ImVec2,float>(A_ws, C_ws, B_ws, tk);
-                    const ImVec2 cur_px = this->world_to_pixels(cur_ws);
-
-                    // Reject near endpoints of sub-segment
-                    if (bezpx::dist2(prev_px, ms) <= endpoint_eps_sq) { prev_px = cur_px; prev_ws = cur_ws; continue; }
-                    if (bezpx::dist2(cur_px,  ms) <= endpoint_eps_sq) { prev_px = cur_px; prev_ws = cur_ws; continue; }
-
-                    const float  u   = bezpx::project_param_on_segment(prev_px, cur_px, ms);
-                    const ImVec2 Cpx = bezpx::lerp(prev_px, cur_px, u);
-                    const float  d2  = bezpx::dist2(ms, Cpx);
-
-                    if (d2 < best_d2) {
-                        best_d2 = d2;
-                        // Continuous parameter along the whole curve
-                        const float t_global = (static_cast<float>(k - 1) + u) / static_cast<float>(STEPS);
-                        // World-space closest point (chord interpolation)
-                        const ImVec2 pos_ws{
-                            prev_ws.x + (cur_ws.x - prev_ws.x) * u,
-                            prev_ws.y + (cur_ws.y - prev_ws.y) * u
-                        };
-                        best_for_path = PathHit{ pi, si, t_global, pos_ws };
-                    }
-
-                    prev_px = cur_px;
-                    prev_ws = cur_ws;
-                }
-            }
-            else
-            {
-                // Cubic: uniform sampling & pixel-space projection
-                ImVec2 prev_ws{ a->x, a->y };
-                ImVec2 prev_px = this->world_to_pixels(prev_ws);
-
-                const int STEPS = m_style.ms_BEZIER_HIT_STEPS;
-                for (int k = 1; k <= STEPS; ++k)
-                {
-                    const float  tk     = static_cast<float>(k) / static_cast<float>(STEPS);
-                    const ImVec2 cur_ws = cubic_eval<VertexID>(a, b, tk);
-                    const ImVec2 cur_px = this->world_to_pixels(cur_ws);
-
-                    // Reject near endpoints of sub-segment
-                    if (bezpx::dist2(prev_px, ms) <= endpoint_eps_sq) { prev_px = cur_px; prev_ws = cur_ws; continue; }
-                    if (bezpx::dist2(cur_px,  ms) <= endpoint_eps_sq) { prev_px = cur_px; prev_ws = cur_ws; continue; }
-
-                    const float  u   = bezpx::project_param_on_segment(prev_px, cur_px, ms);
-                    const ImVec2 Cpx = bezpx::lerp(prev_px, cur_px, u);
-                    const float  d2  = bezpx::dist2(ms, Cpx);
-
-                    if (d2 < best_d2) {
-                        best_d2 = d2;
-                        const float t_global = (static_cast<float>(k - 1) + u) / static_cast<float>(STEPS);
-                        const ImVec2 pos_ws{
-                            prev_ws.x + (cur_ws.x - prev_ws.x) * u,
-                            prev_ws.y + (cur_ws.y - prev_ws.y) * u
-                        };
-                        best_for_path = PathHit{ pi, si, t_global, pos_ws };
-                    }
-
-                    prev_px = cur_px;
-                    prev_ws = cur_ws;
+                    best_for_path = PathHit{ pi, si, t_global, pos_ws };
                 }
             }
         }
@@ -616,12 +484,374 @@ std::optional<Editor::PathHit> Editor::_hit_path_segment(const Interaction & /*i
 //
 //
 //
-//      2.      HIT-DETECTION UTILITIES...
+//      3.      SPATIAL INDEX...
 // *************************************************************************** //
 // *************************************************************************** //
-    
-    
-    
+
+//  "_spatial_segment_box"
+//      World-space box of segment "si" of "p":  the hull of its control cage, which bounds straight, quadratic
+//      and cubic edges alike.  False if either endpoint is missing.
+//
+bool Editor::_spatial_segment_box(const Path & p, const size_t si, SpatialIndex::Box & out) const noexcept
+{
+    const size_t        N       = p.verts.size();
+    const Vertex *      a       = find_vertex(m_vertices, p.verts[si]);
+    const Vertex *      b       = find_vertex(m_vertices, p.verts[(si + 1) % N]);
+    if ( !a || !b )     { return false; }
+
+    const ImVec2        pts[4]  = {
+        ImVec2{ a->x,                               a->y                                },
+        ImVec2{ a->x + a->m_bezier.out_handle.x,    a->y + a->m_bezier.out_handle.y     },
+        ImVec2{ b->x + b->m_bezier.in_handle.x,     b->y + b->m_bezier.in_handle.y      },
+        ImVec2{ b->x,                               b->y                                }
+    };
+    out     = SpatialIndex::Box{ pts[0].x, pts[0].y, pts[0].x, pts[0].y };
+    for (const ImVec2 & q : pts) {
+        out.min_x = std::min(out.min_x, q.x);   out.min_y = std::min(out.min_y, q.y);
+        out.max_x = std::max(out.max_x, q.x);   out.max_y = std::max(out.max_y, q.y);
+    }
+    return true;
+}
+
+
+//  "_spatial_rebuild"
+//      One leaf per point glyph, per path segment and per closed-path surface.
+//
+void Editor::_spatial_rebuild(void) const
+{
+    using                   Item                    = SpatialIndex::Item;
+    using                   Box                     = SpatialIndex::Box;
+    SpatialIndex &          S                       = this->m_spatial;
+
+    S.tree          .clear();
+    S.adjacency     .clear();
+    S.dirty         .clear();
+    S.surfaces      .assign( m_paths.size(), SpatialIndex::Tree::ms_NULL );
+    S.tree          .reserve( m_points.size() + m_vertices.size() + m_paths.size() );
+
+
+    //      1.      POINT GLYPHS...
+    for (size_t i = 0; i < m_points.size(); ++i)
+    {
+        const Vertex *      v       = find_vertex(m_vertices, m_points[i].v);
+        if ( !v )           { continue; }
+
+        const Box           box     { v->x, v->y, v->x, v->y };
+        const auto          id      = S.tree.insert( box, Item{ Item::Kind::Point, static_cast<uint32_t>(i), 0 }, S.margin(box) );
+        S.adjacency.emplace_back(v->id, id);
+    }
+
+
+    //      2.      PATH SEGMENTS + SURFACES...
+    for (size_t pi = 0; pi < m_paths.size(); ++pi)
+    {
+        const Path &        p       = m_paths[pi];
+        const size_t        N       = p.verts.size();
+        if ( N < 2 )        { continue; }
+
+        Box                 surface {   };
+        bool                any     = false;
+        for (size_t si = 0; si < N - 1 + (p.closed ? 1u : 0u); ++si)
+        {
+            Box             box     {   };
+            if ( !_spatial_segment_box(p, si, box) )    { continue; }
+
+            const auto      id      = S.tree.insert( box, Item{ Item::Kind::Segment, static_cast<uint32_t>(pi), static_cast<uint32_t>(si) }, S.margin(box) );
+            S.adjacency.emplace_back(p.verts[si],           id);
+            S.adjacency.emplace_back(p.verts[(si + 1) % N], id);
+
+            surface         = any   ? Box::merge(surface, box)  : box;
+            any             = true;
+        }
+        if ( p.closed && any )
+            { S.surfaces[pi] = S.tree.insert( surface, Item{ Item::Kind::Surface, static_cast<uint32_t>(pi), 0 }, S.margin(surface) ); }
+    }
+
+
+    std::sort( S.adjacency.begin(), S.adjacency.end() );
+    S.generation    = m_vindex.generation();
+    S.points_data   = m_points.data();
+    S.points_size   = m_points.size();
+    return;
+}
+
+
+//  "_spatial_sync"
+//      Rebuild after structural edits;  otherwise refit only the leaves touched since the last query.
+//
+void Editor::_spatial_sync(void) const
+{
+    using                   Item                    = SpatialIndex::Item;
+    using                   Box                     = SpatialIndex::Box;
+    SpatialIndex &          S                       = this->m_spatial;
+
+    const bool              stale                   = ( S.generation != m_vindex.generation()  ||
+                                                        S.points_data != m_points.data()  ||  S.points_size != m_points.size() );
+    if ( stale  ||  S.dirty.size() > m_vertices.size() )    { this->_spatial_rebuild();  this->m_curves.touch_all();  return; }
+    if ( S.dirty.empty() )                                  { return; }
+
+
+    //      1.      REFIT LEAVES THAT DEPEND ON A DIRTY VERTEX...
+    std::sort( S.dirty.begin(), S.dirty.end() );
+    S.dirty.erase( std::unique(S.dirty.begin(), S.dirty.end()), S.dirty.end() );
+    S.scratch.clear();                                      //  Paths whose segments moved (surface re-merge, curve revision).
+
+    for (const VertexID vid : S.dirty)
+    {
+        auto        it      = std::lower_bound( S.adjacency.begin(), S.adjacency.end(), vid,
+                                                [](const auto & e, VertexID v) { return e.first < v; } );
+        for ( ; it != S.adjacency.end() && it->first == vid; ++it)
+        {
+            const Item &    item    = S.tree.data(it->second);
+            Box             box     {   };
+
+            if ( item.kind == Item::Kind::Point ) {
+                const Vertex *  v   = find_vertex(m_vertices, vid);
+                if ( !v )       { continue; }
+                box             = Box{ v->x, v->y, v->x, v->y };
+            }
+            else {
+                if ( !_spatial_segment_box(m_paths[item.index], item.seg, box) )    { continue; }
+                S.scratch.push_back(item.index);
+            }
+            S.tree.move( it->second, box, S.margin(box) );
+        }
+    }
+    S.dirty.clear();
+
+
+    //      2.      RE-MERGE SURFACES OF THE AFFECTED PATHS  (AND RE-FLATTEN THEIR CURVES)...
+    std::sort( S.scratch.begin(), S.scratch.end() );
+    S.scratch.erase( std::unique(S.scratch.begin(), S.scratch.end()), S.scratch.end() );
+    for (const uint32_t pi : S.scratch)
+    {
+        this->m_curves.touch(pi);
+        if ( S.surfaces[pi] == SpatialIndex::Tree::ms_NULL )    { continue; }
+
+        const Path &        p       = m_paths[pi];
+        const size_t        N       = p.verts.size();
+        Box                 surface {   };
+        bool                any     = false;
+        for (size_t si = 0; si < N; ++si)
+        {
+            Box             box     {   };
+            if ( !_spatial_segment_box(p, si, box) )    { continue; }
+            surface         = any   ? Box::merge(surface, box)  : box;
+            any             = true;
+        }
+        if ( any )          { S.tree.move( S.surfaces[pi], surface, S.margin(surface) ); }
+    }
+    return;
+}
+
+
+//  "_spatial_query"
+//      Every leaf whose (fat) box overlaps the world-space rectangle [tl, br];  corners may come in any order.
+//      Returns the index's scratch vector:  valid until the next query.
+//
+std::vector<Editor::SpatialIndex::Item> & Editor::_spatial_query(ImVec2 tl, ImVec2 br) const
+{
+    SpatialIndex &          S                       = this->m_spatial;
+    this->_spatial_sync();
+
+    if ( tl.x > br.x )      { std::swap(tl.x, br.x); }
+    if ( tl.y > br.y )      { std::swap(tl.y, br.y); }
+
+    S.hits.clear();
+    S.tree.query( SpatialIndex::Box{ tl.x, tl.y, br.x, br.y },
+                  [&S](SpatialIndex::proxy_type id) { S.hits.push_back( S.tree.data(id) ); } );
+    return S.hits;
+}
+
+
+//  "_spatial_query_px"
+//      Same, for a square of half-width "r_px" pixels around the screen point "px".
+//
+std::vector<Editor::SpatialIndex::Item> & Editor::_spatial_query_px(const ImVec2 px, const float r_px) const
+{
+    return this->_spatial_query( pixels_to_world( ImVec2{ px.x - r_px, px.y - r_px } ),
+                                 pixels_to_world( ImVec2{ px.x + r_px, px.y + r_px } ) );
+}
+
+
+
+//
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END "SPATIAL INDEX".
+
+
+
+
+
+
+
+// *************************************************************************** //
+//
+//
+//
+//      4.      FLATTENED CURVE CACHE...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "_curve_sync"
+//      Once per frame (and before each hit-test):  apply pending vertex edits, drop every entry after a structural
+//      edit, and capture the current world --> pixel transform and flattening tolerance.
+//
+void Editor::_curve_sync(void) const
+{
+    CurveCache &            C                       = this->m_curves;
+    this->_spatial_sync();                                  //  Bumps "rev" of every path with a dirty vertex.
+
+    if ( C.generation != m_vindex.generation()  ||  C.entries.size() != m_paths.size() )
+    {
+        C.entries.clear();
+        C.entries.resize( m_paths.size() );
+        C.generation    = m_vindex.generation();
+    }
+
+
+    //      1.      AFFINE VIEW TRANSFORM  (from the plot limits, in double precision)...
+    const ImPlotRect        lim                     = ImPlot::GetPlotLimits();
+    const ImPlotPoint       p0                      = ImPlot::PlotToPixels( lim.X.Min, lim.Y.Min );
+    const ImPlotPoint       p1                      = ImPlot::PlotToPixels( lim.X.Max, lim.Y.Max );
+    const double            sx                      = (lim.X.Size() > 0.0)  ? (p1.x - p0.x) / lim.X.Size()  : 1.0;
+    const double            sy                      = (lim.Y.Size() > 0.0)  ? (p1.y - p0.y) / lim.Y.Size()  : 1.0;
+
+    C.scale         = ImVec2( static_cast<float>(sx),                       static_cast<float>(sy)                      );
+    C.offset        = ImVec2( static_cast<float>(p0.x - sx * lim.X.Min),    static_cast<float>(p0.y - sy * lim.Y.Min)   );
+    C.view_min      = ImVec2( static_cast<float>(lim.X.Min),                static_cast<float>(lim.Y.Min)               );
+    C.view_max      = ImVec2( static_cast<float>(lim.X.Max),                static_cast<float>(lim.Y.Max)               );
+
+
+    //      2.      TOLERANCE  (world units per "ms_TOL_PX", snapped down to a power of two)...
+    const double            px_per_ws               = std::max( std::abs(sx), std::abs(sy) );
+    const double            raw                     = (px_per_ws > 0.0)  ? CurveCache::ms_TOL_PX / px_per_ws  : 1.0;
+    if ( std::isfinite(raw)  &&  raw > 0.0 )
+        { C.tol = static_cast<float>( std::exp2( std::floor(std::log2(raw)) ) ); }
+
+    return;
+}
+
+
+//  "_curve_flat"
+//      World-space polyline of path "pi" at the current tolerance;  rebuilt only when stale.
+//      Segments follow the stroke renderer:  straight when both handles are linear, quadratic (A.out as the single
+//      control point) when A is quadratic, cubic otherwise.
+//
+const Editor::CurveCache::Entry & Editor::_curve_flat(const size_t pi) const
+{
+    namespace               bez                     = cblib::math::bezier;
+    CurveCache &            C                       = this->m_curves;
+    if ( pi >= C.entries.size() )                   { this->_curve_sync(); }
+
+    CurveCache::Entry &     E                       = C.entries[pi];
+    const Path &            p                       = m_paths[pi];
+    if ( E.closed != p.closed )                     { ++E.rev; }        //  New "built" stamp for the retained meshes too.
+    if ( E.built == E.rev  &&  E.tol == C.tol )     { return E; }
+
+
+    const size_t            N                       = p.verts.size();
+    const size_t            seg_cnt                 = (N < 2)  ? 0  : N - 1 + (p.closed ? 1u : 0u);
+    const float             tol                     = C.tol;
+    bool                    joined                  = false;
+    auto                    emit                    = [&E](const ImVec2 & P, const float t) { E.pts.push_back(P);  E.ts.push_back(t); };
+
+    E.pts           .clear();
+    E.ts            .clear();
+    E.spans         .clear();
+    E.spans         .reserve(seg_cnt);
+    E.contiguous    = true;
+
+
+    //      1.      FLATTEN EACH SEGMENT  (consecutive segments share their joint)...
+    for (size_t si = 0; si < seg_cnt; ++si)
+    {
+        const Vertex *      a       = find_vertex(m_vertices, p.verts[si]);
+        const Vertex *      b       = find_vertex(m_vertices, p.verts[(si + 1) % N]);
+        if ( !a || !b ) {
+            const uint32_t  at      = static_cast<uint32_t>( E.pts.size() );
+            E.spans.push_back( CurveCache::Span{ at, at } );
+            E.contiguous    = false;
+            joined          = false;
+            continue;
+        }
+
+        const ImVec2        P0      { a->x, a->y };
+        const ImVec2        P3      { b->x, b->y };
+        const ImVec2        out     = a->EffectiveOutHandle();
+        const ImVec2        in      = b->EffectiveInHandle();
+        const ImVec2        P1      { P0.x + out.x, P0.y + out.y };
+        const ImVec2        P2      { P3.x + in.x,  P3.y + in.y  };
+
+        if ( !joined )      { emit(P0, 0.0f); }
+        const uint32_t      first   = static_cast<uint32_t>( E.pts.size() - 1 );
+
+        if ( Vertex::SegmentIsLinear(P0, P1, P2, P3) )  { emit(P3, 1.0f); }
+        else if ( a->IsQuadratic() )                    { bez::flatten_quadratic_adaptive<ImVec2, float>(P0, P1, P3, tol, emit, CurveCache::ms_MAX_DEPTH); }
+        else                                            { bez::flatten_cubic_adaptive<ImVec2, float>(P0, P1, P2, P3, tol, emit, CurveCache::ms_MAX_DEPTH); }
+
+        E.spans.push_back( CurveCache::Span{ first, static_cast<uint32_t>(E.pts.size() - 1) } );
+        joined              = true;
+    }
+
+
+    //      2.      BOUNDS  (padded by the tolerance so they also cover the true curve)...
+    if ( !E.pts.empty() )
+    {
+        E.min_x = E.max_x = E.pts.front().x;
+        E.min_y = E.max_y = E.pts.front().y;
+        for (const ImVec2 & q : E.pts) {
+            E.min_x = std::min(E.min_x, q.x);       E.min_y = std::min(E.min_y, q.y);
+            E.max_x = std::max(E.max_x, q.x);       E.max_y = std::max(E.max_y, q.y);
+        }
+        E.min_x -= tol;     E.min_y -= tol;
+        E.max_x += tol;     E.max_y += tol;
+    }
+
+    E.built         = E.rev;
+    E.tol           = tol;
+    E.closed        = p.closed;
+    return E;
+}
+
+
+//  "_curve_culled"
+//      True if path "pi" (its bounds grown by "pad_px" pixels) lies entirely outside the plot area.
+//
+bool Editor::_curve_culled(const size_t pi, const float pad_px) const
+{
+    const CurveCache &          C       = this->m_curves;
+    const CurveCache::Entry &   E       = this->_curve_flat(pi);
+    if ( E.pts.empty() )        { return true; }
+
+    const float                 s       = std::min( std::abs(C.scale.x), std::abs(C.scale.y) );
+    const float                 pad     = (s > 0.0f)  ? pad_px / s  : 0.0f;
+    const ImVec2                lo      { std::min(C.view_min.x, C.view_max.x) - pad,   std::min(C.view_min.y, C.view_max.y) - pad };
+    const ImVec2                hi      { std::max(C.view_min.x, C.view_max.x) + pad,   std::max(C.view_min.y, C.view_max.y) + pad };
+    return !E.overlaps(lo, hi);
+}
+
+
+//  "_curve_px"
+//      Pixel-space outline of path "pi" (closing duplicate dropped), projected in one affine pass.
+//      Returns the cache's scratch vector:  valid until the next call.  Empty if the outline is broken by a missing
+//      vertex, in which case callers fall back to per-segment drawing.
+//
+std::span<const ImVec2> Editor::_curve_px(const size_t pi) const
+{
+    CurveCache &                C       = this->m_curves;
+    const CurveCache::Entry &   E       = this->_curve_flat(pi);
+    size_t                      n       = E.pts.size();
+    if ( !E.contiguous  ||  n < 2 )     { return { }; }
+
+    if ( E.closed  &&  n > 2 )    { --n; }
+
+    C.px.resize(n);
+    for (size_t i = 0; i < n; ++i)      { C.px[i] = C.project( E.pts[i] ); }
+    return std::span<const ImVec2>( C.px.data(), n );
+}
 
 
 
@@ -629,7 +859,7 @@ std::optional<Editor::PathHit> Editor::_hit_path_segment(const Interaction & /*i
 //
 //
 // *************************************************************************** //
-// *************************************************************************** //   END "HIT-DETECTION UTILITIES".
+// *************************************************************************** //   END "FLATTENED CURVE CACHE".
 
 
 
@@ -38,7 +38,7 @@ Editor::Editor(app::AppState & src)
     , m_menu_state          ( std::make_unique<app::MenuState_t>()                              )
     , m_render_ctx          (
           world_to_pixels           , pixels_to_world
-        , find_vertex               , find_vertex
+        , m_vindex                  , m_vindex
         , m_vertices
     )
     , m_vertex_style        ( world_to_pixels, ms_VERTEX_STYLES[ VertexStyleType::Default ]     )
@@ -125,6 +125,7 @@ void Editor::_pen_update_handle_drag(const Interaction & it)
 
 
     mirror_handles<VertexID>  (v, m_dragging_out);
+    _spatial_touch            (v.id);
 
 
     if ( !io.MouseDown[ImGuiMouseButton_Left] )
@@ -165,6 +166,7 @@ void Editor::_pen_begin_path_if_click_empty(const Interaction & /*it*/ )
 
     // 5. Push to container and update Pen state
     m_paths.push_back(std::move(p));
+    m_vindex.invalidate();
 
     m_pen = { true,                    // active
               m_paths.size() - 1,      // index of the new path
@@ -240,6 +242,7 @@ void Editor::_pen_append_or_close_live_path(const Interaction & it)
 
     if (m_pen.prepend)      { p.verts.insert(p.verts.begin(), new_vid); }
     else                    { p.verts.push_back(new_vid); }
+    m_vindex.invalidate();
 
 
     //  NEW...
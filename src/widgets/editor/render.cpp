@@ -45,6 +45,7 @@ void Editor::_MECH_render_frame([[maybe_unused]] const Interaction & it) const
     this->m_render_ctx.args.dl                      = CTX.dl;
     this->m_render_ctx.args.bezier_fill_steps       = this->m_style.ms_BEZIER_FILL_STEPS;
     this->m_render_ctx.args.bezier_segments         = this->m_style.ms_BEZIER_SEGMENTS;
+    this->_curve_sync();
     //
     //
     //
@@ -120,6 +121,13 @@ void Editor::_RENDER_update_render_cache(void) const noexcept
     auto  &         view        = cache.z_view;
     const size_t    N           = m_paths.size();
 
+    //  Structural edits (add / remove / reorder) bump the entity store's generation.
+    if ( cache.generation != m_vindex.generation() )
+    {
+        cache.generation    = m_vindex.generation();
+        cache.dirty         = true;
+    }
+
     //  Grow (or shrink) the view to match path count; re-use capacity.
     if ( view.size() != N )
     {
@@ -143,6 +151,9 @@ void Editor::_RENDER_update_render_cache(void) const noexcept
         return a.id < b.id; // tie-breaker for deterministic render
     } );
 
+    //  Retained meshes are keyed by path slot;  drop them all.
+    cache.retained.entries.clear();
+    cache.retained.entries.resize(N);
 
 
     cache.dirty = false;
@@ -190,8 +201,8 @@ inline void Editor::_RENDER_object_channel(std::span<const size_t> z_view, const
         const Path &        path            = this->m_paths[idx];
         const bool          should_render   = ( path.IsVisible()  &&  path.IsArea()  &&  path.FillIsVisible() );
         
-        if ( should_render )
-            { path.render_fill_area(ctx); }
+        if ( should_render  &&  !this->_curve_culled(idx, 0.0f) )
+            { this->_retained_fill(idx, ctx); }
     }
     
     return;
@@ -223,7 +234,8 @@ inline void Editor::_RENDER_highlights_channel([[maybe_unused]] std::span<const
         if ( should_render )
         {
             hl_style.stroke_width = path.style.stroke_width + hl_width;
-            path.render_highlight(hl_style, ctx);
+            if ( !this->_curve_culled(idx, hl_style.stroke_width) )
+                { path.render_highlight( hl_style, ctx, this->_curve_px(idx) ); }
         }
     }
 
@@ -259,14 +271,16 @@ inline void Editor::_RENDER_features_channel(std::span<const size_t> z_view, con
         const Path &    path            = m_paths[idx];
         const bool      should_render   = ( path.IsVisible()  &&  path.IsPath()  &&  path.StrokeIsVisible() );  //  ( path.IsVisible()  &&  path.IsPath()  &&  path.StrokeIsVisible() );
         
-        if ( should_render )    { path.render_stroke(ctx); }
+        if ( should_render  &&  !this->_curve_culled(idx, path.style.stroke_width) )
+            { this->_retained_stroke(idx, ctx); }
     }
     
     
     //      2.      IF USING PEN-TOOL,  DRAW THE CURRENT PATH...
     if ( this->m_pen.active  &&  this->m_pen.path_index.has_value() )
     {
-        this->m_paths[ (*this->m_pen.path_index) ].render_stroke(ctx);
+        const size_t    idx     = ( *this->m_pen.path_index );
+        this->m_paths[idx].render_stroke( ctx, this->_curve_px(idx) );
     }
     
     return;
@@ -872,6 +886,305 @@ inline void Editor::_auxiliary_highlight_handle(const Vertex & v) const noexcept
 
 
 
+// *************************************************************************** //
+//
+//
+//
+//      5.      RETAINED GEOMETRY...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "_retained_fill"
+//      Fill of path "idx" from its retained mesh;  re-tessellates only when an input stamp changed.  The outline is
+//      triangulated under "ms_FILL_RULE" (concave and self-intersecting outlines fill correctly), and the triangles are
+//      cached per curve revision.  Falls back to immediate drawing when the outline is broken or too large for one
+//      16-bit draw.
+//
+void Editor::_retained_fill(const size_t idx, const RenderCTX & ctx) const
+{
+    namespace                   tri         = cblib::math::triangulate;
+    ImDrawList *                dl          = ctx.args.dl;
+    const Path &                path        = this->m_paths[idx];
+    const CurveCache::Entry &   E           = this->_curve_flat(idx);
+    RetainedGeometry &          R           = this->m_render_cache.retained;
+    const ImU32                 col         = path.style.fill_color;
+    const bool                  aa          = ( dl->Flags & ImDrawListFlags_AntiAliasedFill );
+    const float                 aspect      = m_curves.scale.x / m_curves.scale.y;
+    const tri::FillRule         rule        = this->m_style.ms_FILL_RULE;
+
+    if ( idx >= R.entries.size()  ||  !E.contiguous  ||  E.pts.size() < 4 )
+        { path.render_fill_area( ctx, this->_curve_px(idx) );  return; }
+    if ( (col & IM_COL32_A_MASK) == 0 )     { return; }
+
+
+    //      1.      WORLD-SPACE TRIANGULATION  (closing duplicate dropped)...
+    RetainedGeometry::Entry &   slot        = R.entries[idx];
+    RetainedGeometry::Fill &    T           = slot.tess;
+    RetainedGeometry::Mesh &    M           = slot.fill;
+    if ( !T.valid  ||  T.built != E.built  ||  T.tol != E.tol  ||  T.closed != E.closed  ||  T.rule != rule )
+    {
+        tri::triangulate( E.pts.data(), E.pts.size() - (E.closed ? 1 : 0), rule, T.tris );
+        T.built         = E.built;      T.tol           = E.tol;
+        T.closed        = E.closed;     T.rule          = rule;
+        T.valid         = true;         M.valid         = false;
+    }
+    if ( T.tris.empty() )                   { return; }             //  Zero filled area.
+    if ( 2 * T.tris.points.size() > 0xFFFF )
+        { path.render_fill_area( ctx, this->_curve_px(idx) );  return; }
+
+
+    //      2.      PIXEL-OFFSET MESH  (AA fringe depends on the view's aspect)...
+    const bool                  stale       = ( !M.valid  ||  M.curve_built != E.built  ||  M.curve_tol != E.tol  ||  M.closed != E.closed  ||
+                                                M.col != col  ||  M.aa != aa  ||
+                                                std::abs(M.aspect - aspect) > RetainedGeometry::ms_ASPECT_EPS * std::abs(aspect) );
+    if ( stale )
+    {
+        this->_retained_build_fill( M, T.tris, col, aa, dl->_FringeScale );
+        M.curve_built   = E.built;      M.curve_tol     = E.tol;
+        M.closed        = E.closed;
+        M.col           = col;          M.aa            = aa;
+        M.aspect        = aspect;       M.valid         = true;
+    }
+
+    this->_retained_emit(dl, M);
+    return;
+}
+
+
+//  "_retained_stroke"
+//      Stroke of path "idx" from its retained mesh;  same policy as "_retained_fill".
+//
+void Editor::_retained_stroke(const size_t idx, const RenderCTX & ctx) const
+{
+    ImDrawList *                dl          = ctx.args.dl;
+    const Path &                path        = this->m_paths[idx];
+    const CurveCache::Entry &   E           = this->_curve_flat(idx);
+    RetainedGeometry &          R           = this->m_render_cache.retained;
+    const ImU32                 col         = path.style.stroke_color;
+    const float                 width       = path.style.stroke_width;
+    const bool                  aa          = ( dl->Flags & ImDrawListFlags_AntiAliasedLines );
+    const float                 aspect      = m_curves.scale.x / m_curves.scale.y;
+
+    if ( idx >= R.entries.size()  ||  !E.contiguous  ||  E.pts.size() < 2  ||  E.pts.size() > 0x3FFF )
+        { path.render_stroke( ctx, this->_curve_px(idx) );  return; }
+    if ( (col & IM_COL32_A_MASK) == 0 )     { return; }
+
+
+    RetainedGeometry::Mesh &    M           = R.entries[idx].stroke;
+    const bool                  stale       = ( !M.valid  ||  M.curve_built != E.built  ||  M.curve_tol != E.tol  ||  M.closed != E.closed  ||
+                                                M.col != col  ||  M.width != width  ||  M.aa != aa  ||
+                                                std::abs(M.aspect - aspect) > RetainedGeometry::ms_ASPECT_EPS * std::abs(aspect) );
+    if ( stale )
+    {
+        //  "E.closed" (not "path.closed"):  the flag the cached points were flattened with.
+        this->_retained_build_stroke( M, E, E.closed, col, width, aa, dl->_FringeScale );
+        M.curve_built   = E.built;      M.curve_tol     = E.tol;
+        M.closed        = E.closed;
+        M.col           = col;          M.width         = width;
+        M.aa            = aa;           M.aspect        = aspect;
+        M.valid         = true;
+    }
+
+    this->_retained_emit(dl, M);
+    return;
+}
+
+
+//  "_retained_build_fill"
+//      Triangles of "T", plus ImGui's 1-px AA fringe around every ring when enabled.  Rings keep the fill on their
+//      left in world space, so the outward normal is the SCREEN-space edge normal flipped by the sign of sx*sy.
+//
+void Editor::_retained_build_fill(RetainedGeometry::Mesh & M, const RetainedGeometry::Triangulation & T,
+                                  const ImU32 col, const bool aa, const float fringe) const
+{
+    using                       Vert        = RetainedGeometry::Vert;
+    std::vector<ImVec2> &       nrm         = this->m_render_cache.retained.normals;
+    const ImVec2 &              S           = this->m_curves.scale;
+    const uint32_t              n           = static_cast<uint32_t>( T.points.size() );
+    const float                 flip        = ( S.x * S.y > 0.0f )  ? 1.0f  : -1.0f;
+    const ImU32                 col_trans   = col & ~IM_COL32_A_MASK;
+
+    M.clear();
+    if ( !aa )
+    {
+        M.vtx.reserve(n);
+        for (uint32_t i = 0; i < n; ++i)        { M.vtx.push_back( Vert{ T.points[i], ImVec2(0.0f, 0.0f), col } ); }
+        M.idx.assign( T.indices.begin(), T.indices.end() );
+        return;
+    }
+
+
+    //      1.      PER-EDGE OUTWARD NORMALS  (edge k -> next point of the same ring)...
+    nrm.resize(n);
+    for (const auto & ring : T.rings)
+    {
+        for (uint32_t k = 0; k < ring.count; ++k)
+        {
+            const ImVec2 &  a   = T.points[ ring.first + k ];
+            const ImVec2 &  b   = T.points[ ring.first + (k + 1) % ring.count ];
+            float           dx  = S.x * (b.x - a.x);
+            float           dy  = S.y * (b.y - a.y);
+            const float     d2  = dx*dx + dy*dy;
+            if ( d2 > 0.0f )    { const float inv = 1.0f / std::sqrt(d2);  dx *= inv;  dy *= inv; }
+            nrm[ring.first + k] = ImVec2( flip * dy, -flip * dx );
+        }
+    }
+
+
+    //      2.      INNER / OUTER VERTEX PER POINT, TRIANGLES ON THE INNER ONES, FRINGE QUAD PER RING EDGE...
+    M.vtx.reserve(2 * n);
+    M.idx.reserve( T.indices.size() + 6 * n );
+    for (const uint32_t i : T.indices)          { M.idx.push_back(i << 1); }
+
+    for (const auto & ring : T.rings)
+    {
+        for (uint32_t k = 0; k < ring.count; ++k)
+        {
+            const uint32_t  i0      = ring.first + (k + ring.count - 1) % ring.count;
+            const uint32_t  i1      = ring.first + k;
+            float           dm_x    = 0.5f * (nrm[i0].x + nrm[i1].x);
+            float           dm_y    = 0.5f * (nrm[i0].y + nrm[i1].y);
+            const float     d2      = dm_x*dm_x + dm_y*dm_y;
+            if ( d2 > 0.000001f )   { const float inv2 = std::min(1.0f / d2, 100.0f);  dm_x *= inv2;  dm_y *= inv2; }
+            dm_x   *= 0.5f * fringe;
+            dm_y   *= 0.5f * fringe;
+
+            M.vtx.push_back( Vert{ T.points[i1], ImVec2(-dm_x, -dm_y), col       } );     //  Inner.
+            M.vtx.push_back( Vert{ T.points[i1], ImVec2( dm_x,  dm_y), col_trans } );     //  Outer.
+
+            const uint32_t  in0     = i0 << 1,      in1     = i1 << 1;
+            M.idx.insert( M.idx.end(), { in1, in0, in0 + 1,   in0 + 1, in1 + 1, in1 } );
+        }
+    }
+    return;
+}
+
+
+//  "_retained_build_stroke"
+//      Thick polyline with mitred joins (ImGui's miter clamp);  4 vertices per point when anti-aliased
+//      (outer fringe, inner edge, inner edge, outer fringe), 2 otherwise.
+//
+void Editor::_retained_build_stroke(RetainedGeometry::Mesh & M, const CurveCache::Entry & E, const bool closed,
+                                    const ImU32 col, const float width, const bool aa, const float fringe) const
+{
+    using                       Vert        = RetainedGeometry::Vert;
+    std::vector<ImVec2> &       nrm         = this->m_render_cache.retained.normals;
+    const ImVec2 &              S           = this->m_curves.scale;
+    const uint32_t              n           = static_cast<uint32_t>( (closed  &&  E.pts.size() > 2)  ? E.pts.size() - 1  : E.pts.size() );
+    const uint32_t              n_seg       = closed ? n : n - 1;
+    const ImU32                 col_trans   = col & ~IM_COL32_A_MASK;
+    const float                 half_in     = aa    ? std::max(0.0f, 0.5f * (width - fringe))  : 0.5f * width;
+    const float                 half_out    = half_in + fringe;
+    const uint32_t              stride      = aa    ? 4u  : 2u;
+
+    M.clear();
+
+
+    //      1.      PER-EDGE NORMALS  (edge i -> i+1)...
+    nrm.resize(n);
+    for (uint32_t i = 0; i < n_seg; ++i)
+    {
+        const uint32_t  j   = (i + 1) % n;
+        float           dx  = S.x * (E.pts[j].x - E.pts[i].x);
+        float           dy  = S.y * (E.pts[j].y - E.pts[i].y);
+        const float     d2  = dx*dx + dy*dy;
+        if ( d2 > 0.0f )    { const float inv = 1.0f / std::sqrt(d2);  dx *= inv;  dy *= inv; }
+        nrm[i]          = ImVec2( dy, -dx );
+    }
+    if ( !closed )      { nrm[n - 1] = nrm[n - 2]; }
+
+
+    //      2.      VERTICES  (averaged, clamped miter normal per point)...
+    M.vtx.reserve(stride * n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        ImVec2          dm      = nrm[i];
+        if ( closed  ||  (i > 0  &&  i < n - 1) )
+        {
+            const ImVec2 & prev = nrm[ (i + n - 1) % n ];
+            dm                  = ImVec2( 0.5f * (prev.x + nrm[i].x),  0.5f * (prev.y + nrm[i].y) );
+            const float     d2  = dm.x*dm.x + dm.y*dm.y;
+            if ( d2 > 0.000001f )   { const float inv2 = std::min(1.0f / d2, 100.0f);  dm.x *= inv2;  dm.y *= inv2; }
+        }
+
+        const ImVec2 &  p       = E.pts[i];
+        if ( aa ) {
+            M.vtx.push_back( Vert{ p, ImVec2( dm.x * half_out,  dm.y * half_out), col_trans } );
+            M.vtx.push_back( Vert{ p, ImVec2( dm.x * half_in,   dm.y * half_in ), col       } );
+            M.vtx.push_back( Vert{ p, ImVec2(-dm.x * half_in,  -dm.y * half_in ), col       } );
+            M.vtx.push_back( Vert{ p, ImVec2(-dm.x * half_out, -dm.y * half_out), col_trans } );
+        }
+        else {
+            M.vtx.push_back( Vert{ p, ImVec2( dm.x * half_in,   dm.y * half_in ), col       } );
+            M.vtx.push_back( Vert{ p, ImVec2(-dm.x * half_in,  -dm.y * half_in ), col       } );
+        }
+    }
+
+
+    //      3.      INDICES  (one quad per band per segment)...
+    M.idx.reserve( (aa ? 18u : 6u) * n_seg );
+    for (uint32_t i = 0; i < n_seg; ++i)
+    {
+        const uint32_t  a   = i * stride;
+        const uint32_t  b   = ((i + 1) % n) * stride;
+        for (uint32_t k = 0; k + 1 < stride; ++k)
+            { M.idx.insert( M.idx.end(), { b + k + 1, a + k + 1, a + k,   a + k, b + k, b + k + 1 } ); }
+    }
+    return;
+}
+
+
+//  "_retained_emit"
+//      Append mesh "M" to "dl":  re-project only if the camera moved since the last emit, then copy.
+//
+void Editor::_retained_emit(ImDrawList * dl, RetainedGeometry::Mesh & M) const
+{
+    const CurveCache &          C           = this->m_curves;
+    const int                   n_vtx       = static_cast<int>( M.vtx.size() );
+    const int                   n_idx       = static_cast<int>( M.idx.size() );
+    if ( n_vtx == 0  ||  n_idx == 0 )       { return; }
+
+    if ( !M.projected  ||  M.cam_scale.x != C.scale.x  ||  M.cam_scale.y != C.scale.y  ||
+         M.cam_offset.x != C.offset.x  ||  M.cam_offset.y != C.offset.y )
+    {
+        const ImVec2            uv          = dl->_Data->TexUvWhitePixel;
+        M.out.resize(n_vtx);
+        for (int i = 0; i < n_vtx; ++i)
+        {
+            const RetainedGeometry::Vert &  v   = M.vtx[i];
+            const ImVec2                    p   = C.project(v.ws);
+            M.out[i].pos    = ImVec2( p.x + v.off.x,  p.y + v.off.y );
+            M.out[i].uv     = uv;
+            M.out[i].col    = v.col;
+        }
+        M.cam_scale     = C.scale;
+        M.cam_offset    = C.offset;
+        M.projected     = true;
+    }
+
+    dl->PrimReserve(n_idx, n_vtx);
+    const unsigned int          base        = dl->_VtxCurrentIdx;
+    std::memcpy( dl->_VtxWritePtr, M.out.data(), static_cast<size_t>(n_vtx) * sizeof(ImDrawVert) );
+    for (int i = 0; i < n_idx; ++i)         { dl->_IdxWritePtr[i] = static_cast<ImDrawIdx>( base + M.idx[i] ); }
+    dl->_VtxWritePtr       += n_vtx;
+    dl->_IdxWritePtr       += n_idx;
+    dl->_VtxCurrentIdx     += static_cast<unsigned int>(n_vtx);
+    return;
+}
+
+
+
+//
+//
+// *************************************************************************** //
+// *************************************************************************** //   END "RETAINED GEOMETRY".
+
+
+
+
+
+
+
 
 
 
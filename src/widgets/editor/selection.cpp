@@ -271,6 +271,7 @@ inline void Editor::_update_bbox_move(const Interaction & it)
             //      3.1A.       Move each PATH-OBJECT in the selection.
             for (PathID pid : m_sel.paths) {
                 m_paths[pid].translate(m_render_ctx, step.x, step.y);
+                for (VertexID vid : m_paths[pid].verts)     { _spatial_touch(vid); }
             }
             
             //      3.1B.       Move each standalone VERTEX in the selection.       [[ TO-DO ]]:
@@ -738,6 +739,7 @@ void Editor::_update_bbox_scaling(void)
             const ImVec2    q0      {  this->m_boxdrag.v_orig[i].x - P.x    , this->m_boxdrag.v_orig[i].y - P.y     };
             const ImVec2    q1      {  q0.x * sx                            , q0.y * sy                             };
             v->SetXYPosition        ({ P.x + q1.x                           , P.y + q1.y                            });
+            this->_spatial_touch    ( v->id );
         }
     }
 //  #endif  //  _EDITOR_REDUCE_REDUNDANCY  //
@@ -831,9 +833,20 @@ void Editor::_update_lasso(const Interaction & it)
         if ( !additive )    { m_sel.clear(); }
 
 
+        //  Candidates come from the spatial index;  exact tests below are unchanged.  Each hit is collected
+        //  first and toggled once, in index order, so additive lassos behave exactly as the old full scan.
+        using                   Kind            = SpatialIndex::Item::Kind;
+        std::vector<size_t>     point_hits      {   };
+        std::vector<size_t>     path_hits       {   };
+        const auto &            candidates      = _spatial_query(tl_w, br_w);
+
+
         // ---------- Points ----------
-        for (size_t i = 0; i < m_points.size(); ++i)
+        for (const SpatialIndex::Item & h : candidates)
         {
+            const size_t i = h.index;
+            if ( h.kind != Kind::Point  ||  i >= m_points.size() )     { continue; }
+
             const Vertex* v = find_vertex(m_vertices, m_points[i].v);
             
             if ( !v )                           { continue; }
@@ -848,14 +861,19 @@ void Editor::_update_lasso(const Interaction & it)
                            
             if ( !inside )                      { continue; }
 
+            point_hits.push_back(i);
+        }
+        std::sort(point_hits.begin(), point_hits.end());
+        point_hits.erase(std::unique(point_hits.begin(), point_hits.end()), point_hits.end());
 
+        for (const size_t i : point_hits)
+        {
             if (additive) {
                 if ( !m_sel.points.erase(i) )   { m_sel.points.insert(i); }
             }
             else {
                 m_sel.points.insert(i);
             }
-    
         }
 
 
@@ -888,28 +906,36 @@ void Editor::_update_lasso(const Interaction & it)
 
 
         // ---------- Paths ----------
-        for (size_t pi = 0; pi < m_paths.size(); ++pi)
+        //  Segments are tested along their flattened curve (not just the anchor chord).
+        this->_curve_sync();
+        for (const SpatialIndex::Item & h : candidates)
         {
+            const size_t        pi          = h.index;
+            if ( h.kind != Kind::Segment  ||  pi >= m_paths.size() )   { continue; }
+
             const Path &        p           = m_paths[pi];
             const size_t        N           = p.size();
-            bool                intersects  = false;
+            const size_t        si          = h.seg;
             
             
             if ( !p.IsMutable() )       { continue; }   //  NEW guard
             if ( N < 2 )                { continue; }
 
-            for (size_t si = 0; si < N - 1 + (p.closed ? 1u : 0u); ++si)
+            const CurveCache::Entry &   E   = this->_curve_flat(pi);
+            if ( si >= E.spans.size()  ||  !E.overlaps(tl_w, br_w) )     { continue; }
+
+            const CurveCache::Span &    sp  = E.spans[si];
+            for (uint32_t k = sp.first; k < sp.last; ++k)
             {
-                const Vertex *  a   = find_vertex( m_vertices,   p.verts[si]                );
-                const Vertex *  b   = find_vertex( m_vertices,   p.verts[ (si+1) % N ]      );
-                
-                if ( !a || !b )     { continue; }
-                if (seg_rect_intersect( {a->x,a->y}, {b->x,b->y}, tl_w, br_w) )
-                    { intersects = true;    break; }
+                if ( seg_rect_intersect(E.pts[k], E.pts[k + 1], tl_w, br_w) )
+                    { path_hits.push_back(pi);  break; }
             }
-            if ( !intersects )      { continue; }
-
+        }
+        std::sort(path_hits.begin(), path_hits.end());
+        path_hits.erase(std::unique(path_hits.begin(), path_hits.end()), path_hits.end());
 
+        for (const size_t pi : path_hits)
+        {
             if (additive) {
                 if ( !m_sel.paths.erase(pi) )   { m_sel.paths.insert(pi); }
             }
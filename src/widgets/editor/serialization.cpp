@@ -18,6 +18,449 @@ namespace cb { //     BEGINNING NAMESPACE "cb"...
 // *************************************************************************** //
 
 
+//  0.  STATIC / INTERNAL LINKAGE TO THIS TU...
+//
+namespace {  //     BEGINNING ANONYMOUS NAMESPACE...
+// *************************************************************************** //
+// *************************************************************************** //
+
+//  "BINARY PROJECT CONTAINER"
+//      Little-endian, versioned by "ms_EDITOR_SCHEMA".  Every section is a flat array of POD records at an 8-byte
+//      aligned offset, so the mapped file is read in place:
+//
+//          [ Header ][ Section x N ][ section 0 ][ section 1 ] ...
+//
+//      Variable-length data (path vertex lists, labels, payload strings) lives in the "PathVerts" / "Strings" sections
+//      and is referenced by (offset, count).  The record layout mirrors what the JSON writer emits;  JSON stays
+//      available as an export format.
+//
+//      Compatibility:  any file with the same MAJOR version is read.  A newer MINOR version may append sections
+//      (unknown tags are skipped), grow the header, or append fields to a record (a larger "stride";  only the
+//      leading fields known here are read).  A different MAJOR version is a "VersionMismatch".
+//
+namespace bin {
+    using                           SchemaVersion   = cblib::SchemaVersion;
+    using                           Vertex          = EditorSnapshot::Vertex;
+    using                           Path            = EditorSnapshot::Path;
+    using                           Point           = EditorSnapshot::Point;
+    using                           PayloadType     = path::PayloadType;
+    //
+    inline constexpr char           MAGIC   [8]     = { 'C', 'B', 'E', 'D', 'P', 'R', 'O', 'J' };
+    inline constexpr uint32_t       ENDIAN_TAG      = 0x01020304u;
+    inline constexpr uint32_t       NONE            = ~0u;
+    inline constexpr std::size_t    ALIGN           = 8;
+    
+    
+    enum class Tag : uint32_t {
+        Vertices = 1, Paths, PathVerts, Points, Payloads, Strings, SelVertices, SelPoints, SelPaths,
+        COUNT
+    };
+    
+    struct Header {
+        char                magic   [8];
+        uint8_t             major;
+        uint8_t             minor;
+        uint16_t            header_size;
+        uint32_t            endian;
+        uint32_t            section_count;
+        uint32_t            reserved;
+        uint64_t            file_size;
+    };
+    struct Section      { uint32_t tag;  uint32_t stride;  uint64_t offset;  uint64_t count; };
+    struct StrRef       { uint32_t offset;  uint32_t size; };
+    //
+    struct VertexRec {
+        uint32_t            id;
+        float               x, y, z;
+        float               in_x, in_y, out_x, out_y;
+        uint8_t             kind, curvature_state, pad[2];
+    };
+    struct PathRec {
+        uint32_t            id;
+        uint32_t            z_index;
+        uint32_t            first_vert, vert_count;
+        StrRef              label;
+        uint32_t            stroke_color, fill_color;
+        float               stroke_width;
+        uint32_t            payload;                        //  Index into "Payloads", or NONE.
+        uint8_t             closed, locked, visible, payload_type;
+    };
+    struct PointRec {
+        uint32_t            v;
+        uint32_t            color;
+        float               radius;
+        uint8_t             visible, pad[3];
+    };
+    struct PayloadRec {
+        double              x, y;                           //  GenericPayload.
+        StrRef              data, meta;
+        float               value;                          //  Source / Boundary / Dielectric  (as in JSON).
+        uint8_t             type, pad[3];
+    };
+    
+    static_assert( std::is_trivially_copyable_v<VertexRec>  &&  std::is_trivially_copyable_v<PathRec>  &&
+                   std::is_trivially_copyable_v<PointRec>   &&  std::is_trivially_copyable_v<PayloadRec> );
+    static_assert( std::endian::native == std::endian::little, "binary project format assumes a little-endian host" );
+    static_assert( sizeof(EditorSnapshot::VertexID) == 4  &&  sizeof(EditorSnapshot::PathID) == 4  &&  sizeof(EditorSnapshot::ZID) == 4 );
+
+
+
+    //  "Writer"
+    //      Collects sections, then lays them out back-to-back behind the header and section table.
+    //
+    struct Writer {
+        std::vector<std::pair<Section, std::vector<std::byte>>>     sections;
+        std::vector<char>                                           strings;
+    
+        inline StrRef       add_string  (std::string_view s)
+        {
+            const StrRef    r       { static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size()) };
+            strings.insert( strings.end(), s.begin(), s.end() );
+            return r;
+        }
+        
+        template<typename T>
+        inline void         add         (const Tag tag, const std::vector<T> & v)
+        {
+            std::vector<std::byte>  raw     ( v.size() * sizeof(T) );
+            if ( !v.empty() )       { std::memcpy( raw.data(), v.data(), raw.size() ); }
+            sections.push_back( { Section{ static_cast<uint32_t>(tag), static_cast<uint32_t>(sizeof(T)), 0, v.size() }, std::move(raw) } );
+        }
+        
+        [[nodiscard]] inline std::vector<std::byte>     finish      (const SchemaVersion version)
+        {
+            this->add( Tag::Strings, strings );
+            
+            auto                align       = [](std::size_t n) { return (n + ALIGN - 1) & ~(ALIGN - 1); };
+            std::size_t         offset      = align( sizeof(Header) + sections.size() * sizeof(Section) );
+            for (auto & [sec, raw] : sections)      { sec.offset = offset;  offset = align(offset + raw.size()); }
+            
+            std::vector<std::byte>  out     ( offset );
+            Header                  h       {   };
+            std::memcpy( h.magic, MAGIC, sizeof(MAGIC) );
+            h.major             = version.major;
+            h.minor             = version.minor;
+            h.header_size       = static_cast<uint16_t>( sizeof(Header) );
+            h.endian            = ENDIAN_TAG;
+            h.section_count     = static_cast<uint32_t>( sections.size() );
+            h.file_size         = offset;
+            std::memcpy( out.data(), &h, sizeof(h) );
+            
+            std::byte *         table       = out.data() + sizeof(Header);
+            for (std::size_t i = 0; i < sections.size(); ++i)
+            {
+                const auto & [sec, raw]     = sections[i];
+                std::memcpy( table + i * sizeof(Section), &sec, sizeof(Section) );
+                if ( !raw.empty() )         { std::memcpy( out.data() + sec.offset, raw.data(), raw.size() ); }
+            }
+            return out;
+        }
+    };
+    
+    
+    //  "encode"
+    //
+    [[nodiscard]] inline std::vector<std::byte> encode(const EditorSnapshot & s, const SchemaVersion version)
+    {
+        Writer                      w;
+        std::vector<VertexRec>      verts;      verts   .reserve( s.vertices.size() );
+        std::vector<PathRec>        paths;      paths   .reserve( s.paths.size() );
+        std::vector<uint32_t>       pverts;
+        std::vector<PointRec>       points;     points  .reserve( s.points.size() );
+        std::vector<PayloadRec>     payloads;
+    
+        for (const Vertex & v : s.vertices)
+        {
+            const auto &    b       = v.m_bezier;
+            verts.push_back( VertexRec{ v.id, v.x, v.y, v.z, b.in_handle.x, b.in_handle.y, b.out_handle.x, b.out_handle.y,
+                                        static_cast<uint8_t>(b.kind), static_cast<uint8_t>(b.m_curvature_state), {0, 0} } );
+        }
+        
+        for (const Path & p : s.paths)
+        {
+            PathRec         r       {   };
+            r.id                = p.id;
+            r.z_index           = p.z_index;
+            r.first_vert        = static_cast<uint32_t>( pverts.size() );
+            r.vert_count        = static_cast<uint32_t>( p.verts.size() );
+            r.label             = w.add_string( p.label );
+            r.stroke_color      = p.style.stroke_color;
+            r.fill_color        = p.style.fill_color;
+            r.stroke_width      = p.style.stroke_width;
+            r.closed            = p.closed;
+            r.locked            = p.locked;
+            r.visible           = p.visible;
+            r.payload_type      = static_cast<uint8_t>( p.payload_type );
+            r.payload           = NONE;
+            pverts.insert( pverts.end(), p.verts.begin(), p.verts.end() );
+            
+            if ( !std::holds_alternative<std::monostate>(p.payload) )
+            {
+                PayloadRec  pr      {   };
+                pr.type             = r.payload_type;
+                std::visit( [&](const auto & pl) {
+                    using T = std::decay_t<decltype(pl)>;
+                    if constexpr ( std::is_same_v<T, path::GenericPayload> ) {
+                        pr.x        = pl.x;                         pr.y    = pl.y;
+                        pr.data     = w.add_string(pl.data);        pr.meta = w.add_string(pl.meta);
+                    }
+                    else if constexpr ( !std::is_same_v<T, std::monostate> )   { pr.value = pl.value; }
+                }, p.payload );
+                r.payload           = static_cast<uint32_t>( payloads.size() );
+                payloads.push_back(pr);
+            }
+            paths.push_back(r);
+        }
+        
+        for (const Point & pt : s.points)
+            { points.push_back( PointRec{ pt.v, pt.sty.color, pt.sty.radius, static_cast<uint8_t>(pt.sty.visible), {0, 0, 0} } ); }
+        
+        
+        w.add( Tag::Vertices,       verts       );
+        w.add( Tag::Paths,          paths       );
+        w.add( Tag::PathVerts,      pverts      );
+        w.add( Tag::Points,         points      );
+        w.add( Tag::Payloads,       payloads    );
+        w.add( Tag::SelVertices,    std::vector<uint32_t>( s.selection.vertices .begin(),   s.selection.vertices.end()  ) );
+        w.add( Tag::SelPoints,      std::vector<uint32_t>( s.selection.points   .begin(),   s.selection.points  .end()  ) );
+        w.add( Tag::SelPaths,       std::vector<uint32_t>( s.selection.paths    .begin(),   s.selection.paths   .end()  ) );
+        return w.finish(version);
+    }
+    
+    
+    
+    //  "is_binary"
+    //
+    [[nodiscard]] inline bool is_binary(std::span<const std::byte> file) noexcept
+        { return ( file.size() >= sizeof(MAGIC)  &&  std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) == 0 ); }
+    
+    
+    //  "View"
+    //      Typed, bounds-checked window onto one section of the mapped file.
+    //
+    template<typename T>
+    struct View {
+        const std::byte *   base    = nullptr;
+        std::size_t         count   = 0;
+        std::size_t         stride  = sizeof(T);            //  >= sizeof(T):  a newer minor may append fields.
+        
+        [[nodiscard]] inline T  operator []     (const std::size_t i) const noexcept
+            { T t;  std::memcpy( &t, base + i * stride, sizeof(T) );  return t; }
+    };
+    
+    
+    //  "decode"
+    //      One validation pass over the header, the section table and every cross-reference (path vertex lists, point
+    //      and selected vertex ids against the vertex section, selected path / point slots, strings, payloads, enums),
+    //      then a straight copy into "out".  Only the sorted vertex-id table is allocated before the file is accepted.
+    //
+    [[nodiscard]] inline IOResult decode(std::span<const std::byte> file, const SchemaVersion version, EditorSnapshot & out)
+    {
+        //      1.      HEADER...
+        if ( file.size() < sizeof(Header)  ||  !is_binary(file) )                           { return IOResult::ParseError; }
+        Header          h;
+        std::memcpy( &h, file.data(), sizeof(Header) );
+        if ( h.major != version.major )                                                     { return IOResult::VersionMismatch; }
+        const bool          newer       = ( h.minor > version.minor );
+        if ( h.endian != ENDIAN_TAG  ||  h.file_size != file.size()  ||
+             h.header_size < sizeof(Header)  ||  (!newer  &&  h.header_size != sizeof(Header)) )
+                                                                                            { return IOResult::ParseError; }
+        
+        const std::size_t   table_at    = h.header_size;
+        const std::size_t   table_end   = table_at + static_cast<std::size_t>(h.section_count) * sizeof(Section);
+        if ( h.section_count > 1024  ||  table_end > file.size() )                          { return IOResult::ParseError; }
+    
+    
+        //      2.      SECTION TABLE...
+        std::array<Section, static_cast<std::size_t>(Tag::COUNT)>   secs    {   };
+        for (uint32_t i = 0; i < h.section_count; ++i)
+        {
+            Section     s;
+            std::memcpy( &s, file.data() + table_at + i * sizeof(Section), sizeof(Section) );
+            if ( s.tag == 0  ||  s.tag >= static_cast<uint32_t>(Tag::COUNT) )              { continue; }      //  Unknown:  skip.
+            if ( s.offset % ALIGN != 0  ||  s.offset < table_end  ||  s.offset > file.size() )
+                                                                                            { return IOResult::ParseError; }
+            if ( s.stride != 0  &&  s.count > (file.size() - s.offset) / s.stride )         { return IOResult::ParseError; }
+            secs[s.tag]     = s;
+        }
+        
+        auto    view        = [&]<typename T>(const Tag tag, std::type_identity<T>) -> std::optional<View<T>> {
+            const Section & s   = secs[ static_cast<std::size_t>(tag) ];
+            if ( s.count == 0 )                 { return View<T>{ nullptr, 0 }; }
+            if ( s.stride < sizeof(T)  ||  (!newer  &&  s.stride != sizeof(T)) )        { return std::nullopt; }
+            return View<T>{ file.data() + s.offset, static_cast<std::size_t>(s.count), s.stride };
+        };
+        const auto      V       = view( Tag::Vertices,      std::type_identity<VertexRec>{}     );
+        const auto      P       = view( Tag::Paths,         std::type_identity<PathRec>{}       );
+        const auto      PV      = view( Tag::PathVerts,     std::type_identity<uint32_t>{}      );
+        const auto      PT      = view( Tag::Points,        std::type_identity<PointRec>{}      );
+        const auto      PL      = view( Tag::Payloads,      std::type_identity<PayloadRec>{}    );
+        const auto      STR     = view( Tag::Strings,       std::type_identity<char>{}          );
+        const auto      SV      = view( Tag::SelVertices,   std::type_identity<uint32_t>{}      );
+        const auto      SP      = view( Tag::SelPoints,     std::type_identity<uint32_t>{}      );
+        const auto      SA      = view( Tag::SelPaths,      std::type_identity<uint32_t>{}      );
+        if ( !V || !P || !PV || !PT || !PL || !STR || !SV || !SP || !SA )                  { return IOResult::ParseError; }
+        
+        
+        //      3.      CROSS-REFERENCES  (vertex ids, vertex lists, strings, payloads, enums)...
+        if ( STR->stride != 1  ||  PV->stride != sizeof(uint32_t) )                         { return IOResult::ParseError; }
+        auto    str_ok      = [&](const StrRef r) { return ( uint64_t(r.offset) + r.size <= STR->count ); };
+        auto    str         = [&](const StrRef r) { return std::string( reinterpret_cast<const char *>(STR->base) + r.offset, r.size ); };
+        
+        std::vector<uint32_t>   ids;        ids.reserve( V->count );
+        for (std::size_t i = 0; i < V->count; ++i)
+        {
+            const VertexRec     r   = (*V)[i];
+            if ( r.kind >= static_cast<uint8_t>(BezierCurvatureType::COUNT)  ||
+                 r.curvature_state >= static_cast<uint8_t>(BezierCurvatureState::COUNT) )  { return IOResult::ParseError; }
+            ids.push_back( r.id );
+        }
+        std::sort( ids.begin(), ids.end() );
+        if ( std::adjacent_find(ids.begin(), ids.end()) != ids.end() )                      { return IOResult::ParseError; }     //  Duplicate vertex id.
+        auto    vid_ok      = [&](const uint32_t id) { return std::binary_search(ids.begin(), ids.end(), id); };
+        
+        for (std::size_t i = 0; i < P->count; ++i)
+        {
+            const PathRec       r   = (*P)[i];
+            if ( uint64_t(r.first_vert) + r.vert_count > PV->count  ||  !str_ok(r.label)  ||
+                 r.payload_type >= static_cast<uint8_t>(PayloadType::COUNT)  ||
+                 ( r.payload != NONE  &&  r.payload >= PL->count ) )                        { return IOResult::ParseError; }
+            for (uint32_t k = 0; k < r.vert_count; ++k)
+                { if ( !vid_ok( (*PV)[ std::size_t(r.first_vert) + k ] ) )                  { return IOResult::ParseError; } }
+        }
+        for (std::size_t i = 0; i < PT->count; ++i)
+            { if ( !vid_ok( (*PT)[i].v ) )                                                  { return IOResult::ParseError; } }
+        if ( SV->stride != sizeof(uint32_t)  ||  SP->stride != sizeof(uint32_t)  ||  SA->stride != sizeof(uint32_t) )
+                                                                                            { return IOResult::ParseError; }
+        for (std::size_t i = 0; i < SV->count; ++i)     { if ( !vid_ok( (*SV)[i] ) )        { return IOResult::ParseError; } }
+        for (std::size_t i = 0; i < SP->count; ++i)     { if ( (*SP)[i] >= PT->count )      { return IOResult::ParseError; } }      //  Slots, not ids.
+        for (std::size_t i = 0; i < SA->count; ++i)     { if ( (*SA)[i] >= P->count )       { return IOResult::ParseError; } }
+        for (std::size_t i = 0; i < PL->count; ++i)
+        {
+            const PayloadRec    r   = (*PL)[i];
+            if ( !str_ok(r.data)  ||  !str_ok(r.meta) )                                     { return IOResult::ParseError; }
+        }
+        
+        
+        //      4.      BUILD THE SNAPSHOT...
+        out.vertices.clear();       out.vertices.reserve( V->count );
+        out.paths   .clear();       out.paths   .reserve( P->count );
+        out.points  .clear();       out.points  .reserve( PT->count );
+        
+        for (std::size_t i = 0; i < V->count; ++i)
+        {
+            const VertexRec     r   = (*V)[i];
+            Vertex &            v   = out.vertices.emplace_back();
+            v.id                        = r.id;
+            v.x = r.x;  v.y = r.y;  v.z = r.z;
+            v.m_bezier.in_handle        = ImVec2( r.in_x,  r.in_y  );
+            v.m_bezier.out_handle       = ImVec2( r.out_x, r.out_y );
+            v.m_bezier.kind             = static_cast<BezierCurvatureType >( r.kind );
+            v.m_bezier.m_curvature_state= static_cast<BezierCurvatureState>( r.curvature_state );
+        }
+        
+        for (std::size_t i = 0; i < P->count; ++i)
+        {
+            const PathRec       r   = (*P)[i];
+            Path &              p   = out.paths.emplace_back();
+            p.id                = r.id;
+            p.z_index           = r.z_index;
+            p.label             = str( r.label );
+            p.style.stroke_color= r.stroke_color;
+            p.style.fill_color  = r.fill_color;
+            p.style.stroke_width= r.stroke_width;
+            p.closed            = r.closed;
+            p.locked            = r.locked;
+            p.visible           = r.visible;
+            p.payload_type      = static_cast<PayloadType>( r.payload_type );
+            p.verts.resize( r.vert_count );
+            if ( r.vert_count )     { std::memcpy( p.verts.data(), PV->base + std::size_t(r.first_vert) * sizeof(uint32_t), r.vert_count * sizeof(uint32_t) ); }
+            
+            if ( r.payload == NONE )        { continue; }
+            const PayloadRec    pr  = (*PL)[r.payload];
+            switch ( p.payload_type )
+            {
+                case PayloadType::Generic       : { p.payload = path::GenericPayload{ pr.x, pr.y, str(pr.data), str(pr.meta) };  break; }
+                case PayloadType::Source        : { path::SourcePayload     pl;  pl.value = pr.value;  p.payload = pl;  break; }
+                case PayloadType::Boundary      : { path::BoundaryPayload   pl;  pl.value = pr.value;  p.payload = pl;  break; }
+                case PayloadType::Dielectric    : { path::DielectricPayload pl;  pl.value = pr.value;  p.payload = pl;  break; }
+                default                         : { break; }
+            }
+        }
+        
+        for (std::size_t i = 0; i < PT->count; ++i)
+        {
+            const PointRec      r   = (*PT)[i];
+            out.points.push_back( Point{ r.v, PointStyle{ r.color, r.radius, r.visible != 0 } } );
+        }
+        
+        out.selection.vertices  .clear();   for (std::size_t i = 0; i < SV->count; ++i)  { out.selection.vertices .insert( (*SV)[i] ); }
+        out.selection.points    .clear();   for (std::size_t i = 0; i < SP->count; ++i)  { out.selection.points   .insert( (*SP)[i] ); }
+        out.selection.paths     .clear();   for (std::size_t i = 0; i < SA->count; ++i)  { out.selection.paths    .insert( (*SA)[i] ); }
+        return IOResult::Ok;
+    }
+    
+}//   END OF "bin" NAMESPACE.
+
+
+
+
+//  "DOCUMENT MIRROR"
+//      Element comparisons used to decide which blocks of the block-shared mirror ("Editor::m_doc_*") still match the
+//      live arrays.  They may report a false "different" (the block is merely rebuilt), never a false "same".
+//
+namespace doc {
+    using                           Vertex          = EditorSnapshot::Vertex;
+    using                           Path            = EditorSnapshot::Path;
+    using                           Point           = EditorSnapshot::Point;
+    
+    [[nodiscard]] inline bool same_xy(const ImVec2 & a, const ImVec2 & b) noexcept    { return a.x == b.x  &&  a.y == b.y; }
+    
+    //  "same"      | Vertex...
+    [[nodiscard]] inline bool same(const Vertex & a, const Vertex & b) noexcept
+    {
+        return ( a.id == b.id  &&  a.x == b.x  &&  a.y == b.y  &&  a.z == b.z  &&
+                 a.m_bezier.kind == b.m_bezier.kind  &&  a.m_bezier.m_curvature_state == b.m_bezier.m_curvature_state  &&
+                 same_xy(a.m_bezier.in_handle, b.m_bezier.in_handle)  &&  same_xy(a.m_bezier.out_handle, b.m_bezier.out_handle) );
+    }
+    
+    //  "same"      | Point...
+    [[nodiscard]] inline bool same(const Point & a, const Point & b) noexcept
+        { return ( a.v == b.v  &&  a.sty.color == b.sty.color  &&  a.sty.radius == b.sty.radius  &&  a.sty.visible == b.sty.visible ); }
+    
+    //  "same"      | Path...
+    [[nodiscard]] inline bool same(const Path & a, const Path & b) noexcept
+    {
+        if ( a.id != b.id  ||  a.z_index != b.z_index  ||  a.closed != b.closed  ||  a.locked != b.locked  ||  a.visible != b.visible  ||
+             a.payload_type != b.payload_type  ||  a.payload.index() != b.payload.index()  ||
+             a.style.stroke_color != b.style.stroke_color  ||  a.style.fill_color != b.style.fill_color  ||
+             a.style.stroke_width != b.style.stroke_width  ||  a.verts != b.verts  ||  a.label != b.label )
+            { return false; }
+        
+        return std::visit( [&](const auto & pa) -> bool {
+            using T = std::decay_t<decltype(pa)>;
+            const T &   pb  = std::get<T>(b.payload);
+            if constexpr ( std::is_same_v<T, std::monostate> )              { return true; }
+            else if constexpr ( std::is_same_v<T, path::GenericPayload> )   { return pa.x == pb.x  &&  pa.y == pb.y  &&  pa.data == pb.data  &&  pa.meta == pb.meta; }
+            else if constexpr ( std::is_trivially_copyable_v<T> )           { return std::memcmp(&pa, &pb, sizeof(T)) == 0; }
+            else                                                            { return false; }
+        }, a.payload );
+    }
+    
+    inline constexpr auto           SAME            = [](const auto & a, const auto & b) noexcept { return same(a, b); };
+    
+}//   END OF "doc" NAMESPACE.
+
+
+
+// *************************************************************************** //
+//
+// *************************************************************************** //
+// *************************************************************************** //
+}//   END OF ANONYMOUS NAMESPACE.
+
+
+
 
 // *************************************************************************** //
 //
@@ -790,19 +1233,6 @@ inline void Editor::_settings_H4(SettingsData & args)
 // *************************************************************************** //
 // *************************************************************************** //
 
-//  "_MECH_pump_main_tasks"
-//
-void Editor::_MECH_pump_main_tasks(void)
-{
-    std::vector<std::function<void()>> tasks;
-    {
-        std::lock_guard lk( this->m_editor_S.m_task_mtx );
-        tasks.swap( this->m_editor_S.m_main_tasks );
-    }
-    for (auto & fn : tasks) fn();
-}
-
-
 //  "_draw_io_overlay"
 //
 void Editor::_draw_io_overlay(void)
@@ -834,14 +1264,20 @@ void Editor::_draw_io_overlay(void)
 // *************************************************************************** //
 
 //  "make_snapshot"
+//      Re-syncs the block-shared mirror ("m_doc_*") with the live arrays, rebuilding only blocks whose contents changed,
+//      then copies the mirror's block tables.  The snapshot shares every block with the mirror and with earlier
+//      snapshots;  shared blocks are never written, so it is safe to hand to a worker thread.
 //
 EditorSnapshot Editor::make_snapshot(void) const
 {
     //      1.      EXISTING...
     EditorSnapshot      s;
-    s.vertices          = m_vertices;        // shallow copies fine
-    s.paths             = m_paths;
-    s.points            = m_points;
+    m_doc_vertices      .sync( m_vertices,  doc::SAME );
+    m_doc_paths         .sync( m_paths,     doc::SAME );
+    m_doc_points        .sync( m_points,    doc::SAME );
+    s.vertices          = m_doc_vertices;
+    s.paths             = m_doc_paths;
+    s.points            = m_doc_points;
     s.selection         = m_sel;
     
     
@@ -862,10 +1298,15 @@ EditorSnapshot Editor::make_snapshot(void) const
 void Editor::load_from_snapshot(EditorSnapshot && snap)
 {
     //      1.      EXISTING...
-    m_vertices  = std::move(snap.vertices);
-    m_paths     = std::move(snap.paths);
-    m_points    = std::move(snap.points);
-    m_sel       = std::move(snap.selection);
+    m_vertices      = snap.vertices .to_vector();
+    m_paths         = snap.paths    .to_vector();
+    m_points        = snap.points   .to_vector();
+    m_sel           = std::move(snap.selection);
+    m_vindex        .invalidate();
+    //
+    m_doc_vertices  = std::move(snap.vertices);         //  The loaded blocks already mirror the document.
+    m_doc_paths     = std::move(snap.paths);
+    m_doc_points    = std::move(snap.points);
     
     
     //      2.      NEW ENTRIES / SUB-OBJECTS...
@@ -930,10 +1371,10 @@ bool Editor::save_async(std::filesystem::path path)
     path                            = fs::absolute(path);   //  convert to absolute once, so worker sees a full path
 
 
-    //      1.      PERFORM I/O ON SECONDARY THREAD...
-    std::thread([this, snap = std::move(snap), path]{
-        save_worker(snap, path);
-    }).detach();
+    //      1.      PERFORM I/O ON THE TASK SCHEDULER  (no token:  a queued save still completes during shutdown)...
+    cb::utl::TaskScheduler::instance().submit( [this, snap = std::move(snap), path]() mutable {
+        save_worker( std::move(snap), path );
+    }, cb::utl::TaskPriority::High );
     
     
     
@@ -953,11 +1394,29 @@ bool Editor::save_async(std::filesystem::path path)
 
 
 //  "save_worker"
+//      Writes the native binary container unless "path" names a JSON file (".json", ".cbjson", ".txt"), which is
+//      kept as a human-readable export.  Binary saves go through a temp file + rename, so an interrupted autosave
+//      never truncates the project.
 //
 void Editor::save_worker(EditorSnapshot snap, std::filesystem::path path)
 {
-    EditorState &       ES      = this->m_editor_S;
-    nlohmann::json      j;
+    EditorState &       ES          = this->m_editor_S;
+    const std::string   ext         = path.extension().string();
+    const bool          as_json     = ( ext == ".json"  ||  ext == ".cbjson"  ||  ext == ".txt" );
+    IOResult            res         = IOResult::Ok;
+
+
+    //      1A.     BINARY PROJECT...
+    if ( !as_json )
+    {
+        const std::vector<std::byte>    bytes   = bin::encode( snap, ms_EDITOR_SCHEMA );
+        res                                     = cblib::utl::write_file_atomic(path, bytes)    ? IOResult::Ok  : IOResult::IoError;
+    }
+    //
+    //      1B.     JSON EXPORT...
+    else
+    {
+        nlohmann::json      j;
     //
     //
     //  j["version"]                    = std::format("{}.{}", this->ms_MAJOR_VERSION, this->ms_MINOR_VERSION); //    kSaveFormatVersion;
@@ -971,17 +1430,16 @@ void Editor::save_worker(EditorSnapshot snap, std::filesystem::path path)
     //  j["editor_state"]               = this->m_editor_S;
     //
     //
-    std::ofstream       os          (path, std::ios::binary);
-    IOResult            res         = ( os )    ? IOResult::Ok      : IOResult::IoError;
+        std::ofstream       os          (path, std::ios::binary);
+        res                             = ( os )    ? IOResult::Ok      : IOResult::IoError;
     
-    
-    if ( res == IOResult::Ok )      { os << j.dump(2); }
+        if ( res == IOResult::Ok )      { os << j.dump(2); }
+    }
     
     
-    // enqueue completion notification
+    // enqueue completion notification  (runs on the GUI thread in "App::PREFrameCache")
     {
-        std::lock_guard     lk      (ES.m_task_mtx);
-        ES.m_main_tasks.push_back( [this, res, path]
+        cb::utl::TaskScheduler::instance().post_main( [this, res, path]
         {
             EditorState &   ES_             = this->m_editor_S;
             std::string     message         = {   };
@@ -1050,10 +1508,10 @@ bool Editor::load_async(std::filesystem::path path)
     bool                result      = true;
 
 
-    //      1.      PERFORM I/O ON SECONDARY THREAD...
-    std::thread([this, path]{
+    //      1.      PERFORM I/O ON THE TASK SCHEDULER...
+    cb::utl::TaskScheduler::instance().submit( [this, path]{
         load_worker(path);
-    }).detach();
+    }, cb::utl::TaskPriority::High );
     
     
     //      2.      TAKE ACTIONS BASED ON SUCCESS/FAILURE OF LOADING PROCEDURE...
@@ -1083,17 +1541,25 @@ void Editor::load_worker(std::filesystem::path path)
     using                   Version     = cblib::SchemaVersion;
     EditorState &           ES          = this->m_editor_S;
     nlohmann::json          j;
-    std::ifstream           is          (path, std::ios::binary);
-    IOResult                res         = ( is )    ? IOResult::Ok      : IOResult::IoError;
+    cblib::utl::MappedFile  file        (path);
+    IOResult                res         = ( file.is_open() )    ? IOResult::Ok      : IOResult::IoError;
     EditorSnapshot          snap;
 
 
+    //      0.      NATIVE BINARY PROJECT  (detected by its magic, not the extension)...
+    if ( res == IOResult::Ok  &&  bin::is_binary(file.bytes()) )
+    {
+        try                 { res = bin::decode( file.bytes(), ms_EDITOR_SCHEMA, snap ); }
+        catch (...)         { res = IOResult::ParseError; }
+    }
+    //
     //      1.      LOAD FROM JSON-FILE...
-    if ( res == IOResult::Ok )
+    else if ( res == IOResult::Ok )
     {
         try
         {
-            is >> j;
+            const char *      text        = reinterpret_cast<const char *>( file.data() );
+            j                             = nlohmann::json::parse( text, text + file.size() );
             const Version     file_ver    = j.at("version").get<Version>();
             
             
@@ -1115,9 +1581,7 @@ void Editor::load_worker(std::filesystem::path path)
 
     //      2.      ASSESS I/O RESULT.      -- enqueue GUI-thread callback...
     {
-        std::lock_guard     lk      (ES.m_task_mtx);
-        
-        ES.m_main_tasks.push_back( [this, res, snap = std::move(snap), path]() mutable
+        cb::utl::TaskScheduler::instance().post_main( [this, res, snap = std::move(snap), path]() mutable
         {
             EditorState &   ES_             = this->m_editor_S;
             std::string     message         = {   };
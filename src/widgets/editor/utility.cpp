@@ -164,6 +164,7 @@ void Editor::_erase_vertex_and_fix_paths(VertexID vid)
             m_paths.erase(m_paths.begin() + static_cast<long>(i)); // drop path
         else    { ++i; }
     }
+    m_vindex.invalidate();
 
 
     //      3.      Drop glyphs referencing the vertex.
@@ -212,6 +213,7 @@ void Editor::_erase_path_and_orphans(PathID pidx)
     //  1.  Move-out the doomed path so we still have its vertex IDs
     Path doomed = std::move(m_paths[pidx]);
     m_paths.erase(m_paths.begin() + pidx);
+    m_vindex.invalidate();
 
     //  2.  Collect every vertex still used anywhere
     std::unordered_set<VertexID> still_used;
@@ -329,6 +331,7 @@ void Editor::_scissor_cut(const PathHit & h)
 
     // ─── 5.  Store the new path ─────────────────────────────────────
     m_paths.push_back(std::move(rightPath));
+    m_vindex.invalidate();
 
     // NOTE: Bézier handle subdivision still “TODO”.
 }